@@ -16,6 +16,7 @@
  */
 
 #include "diag.h"
+#include "diag_report.h"
 #include "bleservice.h"
 #include "gps.h"
 #include "hardware.h"
@@ -27,7 +28,6 @@
 #include <esp_heap_caps.h>
 #include <esp_timer.h>
 #include <esp_log.h>
-#include <cstdio>
 #include <cinttypes>
 
 static const char* TAG = "diag";
@@ -36,91 +36,82 @@ static const char* TAG = "diag";
 // Custom 128-bit UUIDs — not assigned by the Bluetooth SIG.
 static const NimBLEUUID DIAG_SVC_UUID ("BA5EBA11-0000-D1A6-0000-000000000001");
 static const NimBLEUUID DIAG_CHAR_UUID("BA5EBA11-0000-D1A6-0000-000000000002");
+static const NimBLEUUID DIAG_CAP_UUID ("BA5EBA11-0000-D1A6-0000-000000000003");
 
 // ── Static member definitions ──────────────────────────────────────────────
 NimBLECharacteristic* Diag::_pChar       = nullptr;
 TimerHandle_t         Diag::_notifyTimer = nullptr;
 Diag::CharCallbacks   Diag::_charCbs;
 
+NimBLECharacteristic* Diag::_pCapChar    = nullptr;
+TimerHandle_t         Diag::_capTimer    = nullptr;
+McPcapStream          Diag::_capStream;
+uint8_t               Diag::_capChunk[CAP_CHUNK_MAX];
+size_t                Diag::_capLen      = 0;
+bool                  Diag::_capHave     = false;
+std::atomic<size_t>   Diag::_capChunkMax{20};
+std::atomic<bool>     Diag::_capRestart{false};
+Diag::CapCallbacks    Diag::_capCbs;
+
 // ── buildReport ───────────────────────────────────────────────────────────
 size_t Diag::buildReport(char* buf, size_t bufSize)
 {
-    const uint32_t upSec    = (uint32_t)(esp_timer_get_time() / 1000000ULL);
-    const uint32_t heap     = (uint32_t)esp_get_free_heap_size();
-    const uint32_t heapMin  = (uint32_t)esp_get_minimum_free_heap_size();
-    const unsigned bat      = (unsigned)Heltec.cachedBatteryLevel();
-    const int      bleConn  = Ble.isConnected() ? 1 : 0;
-    const int      bonds    = (int)NimBLEDevice::getNumBonds();
-    const unsigned notif    = (unsigned)Notifications.getNotificationCount();
-    const int      gpsFix   = gps.isFixed() ? 1 : 0;
-    const uint32_t gpsSats  = gps.satellites();
-    const float    gpsHdop  = gps.hdop();
-    const uint32_t gpsOk    = gps.passedChecksum();
-    const uint32_t gpsFail  = gps.failedChecksum();
+    DiagReport r;
+    r.upSec        = (uint32_t)(esp_timer_get_time() / 1000000ULL);
+    r.heap         = (uint32_t)esp_get_free_heap_size();
+    r.heapMin      = (uint32_t)esp_get_minimum_free_heap_size();
+    r.battery      = Heltec.cachedBatteryLevel();
+    r.bleConnected = Ble.isConnected();
+    r.bonds        = (uint32_t)NimBLEDevice::getNumBonds();
+    r.notifications = (uint32_t)Notifications.getNotificationCount();
+    r.gpsFix       = gps.isFixed();
+    r.gpsSats      = gps.satellites();
+    r.gpsHdop      = gps.hdop();
+    r.gpsOk        = gps.passedChecksum();
+    r.gpsFail      = gps.failedChecksum();
+    r.hdr          = Heltec.headerStats();
+    r.disp         = Heltec.displayPowerStats();
+    r.dispState    = Heltec.displayPowerState();
+    for (uint8_t s = 0; s < PANEL_POWER_STATES; s++)
+        r.dispUa[s] = Heltec.displayCurrentUa(static_cast<PanelPower>(s));
 
 #if CONFIG_LORA_ENABLED
     const LoRaStats ls = Lora.stats();
-    const char* loraState =
+    r.hasLora   = true;
+    r.nodeId    = Node.nodeIdStr();
+    r.shortName = Node.shortName();
+    r.lora.state =
         ls.state == LoRaStats::State::Listening  ? "listening"   :
         ls.state == LoRaStats::State::InitFailed ? "init_failed" : "disabled";
+    r.lora.preambles      = ls.preambles;
+    r.lora.headersValid   = ls.headersValid;
+    r.lora.rxPackets      = ls.rxPackets;
+    r.lora.crcErrors      = ls.crcErrors;
+    r.lora.headerErrors   = ls.headerErrors;
+    r.lora.decryptOk      = ls.decryptOk;
+    r.lora.duplicates     = ls.duplicates;
+    r.lora.textMessages   = ls.textMessages;
+    r.lora.inboxOverflows = ls.inboxOverflows;
+    r.lora.txPackets      = ls.txPackets;
+    r.lora.txErrors       = ls.txErrors;
+    r.lora.txTimeouts     = ls.txTimeouts;
+    r.lora.cadBusy        = ls.cadBusy;
+    r.lora.txBackoffs     = ls.txBackoffs;
+    r.lora.channelUtil    = ls.channelUtil;
+    r.lora.airUtilTx      = ls.airUtilTx;
+    r.lora.neighbors      = (uint32_t)Lora.neighborCount();
+    r.lora.lastRssi       = ls.lastRssi;
+    r.lora.lastSnr        = ls.lastSnr;
 #endif
 
-    int n = snprintf(buf, bufSize,
-        "{"
-#if CONFIG_LORA_ENABLED
-        "\"node_id\":\"%s\","
-        "\"short_name\":\"%s\","
-#endif
-        "\"up\":%" PRIu32 ","
-        "\"heap\":%" PRIu32 ","
-        "\"heap_min\":%" PRIu32 ","
-        "\"ble\":%d,"
-        "\"bat\":%u,"
-        "\"gps\":{\"fix\":%d,\"sats\":%" PRIu32 ",\"hdop\":%.1f,"
-                 "\"ok\":%" PRIu32 ",\"fail\":%" PRIu32 "},"
-#if CONFIG_LORA_ENABLED
-        "\"lora\":{\"state\":\"%s\","
-                   "\"preamble\":%" PRIu32 ",\"hdr_ok\":%" PRIu32 ","
-                   "\"rx\":%" PRIu32 ",\"crc_err\":%" PRIu32 ","
-                   "\"hdr_err\":%" PRIu32 ",\"decrypt\":%" PRIu32 ","
-                   "\"text\":%" PRIu32 ",\"tx\":%" PRIu32 ","
-                   "\"tx_err\":%" PRIu32 ",\"tx_timeout\":%" PRIu32 ","
-                   "\"neighbors\":%u,"
-                   "\"rssi\":%d,\"snr\":%.1f},"
-#endif
-        "\"notif\":%u,"
-        "\"bonds\":%d"
-        "}",
-#if CONFIG_LORA_ENABLED
-        Node.nodeIdStr(),
-        Node.shortName(),
-#endif
-        upSec, heap, heapMin,
-        bleConn, bat,
-        gpsFix, gpsSats, (double)gpsHdop, gpsOk, gpsFail,
-#if CONFIG_LORA_ENABLED
-        loraState, ls.preambles, ls.headersValid,
-        ls.rxPackets, ls.crcErrors,
-        ls.headerErrors, ls.decryptOk,
-        ls.textMessages, ls.txPackets,
-        ls.txErrors, ls.txTimeouts,
-        (unsigned)Lora.neighborCount(),
-        (int)ls.lastRssi, (double)ls.lastSnr,
-#endif
-        notif, bonds);
-
-    if (n < 0 || (size_t)n >= bufSize) {
-        buf[bufSize - 1] = '\0';
-        return bufSize - 1;
-    }
-    return (size_t)n;
+    return diag_formatReport(buf, bufSize, r);
 }
 
 // ── CharCallbacks::onRead ─────────────────────────────────────────────────
 void Diag::CharCallbacks::onRead(NimBLECharacteristic* pChar,
                                  NimBLEConnInfo& /*connInfo*/)
 {
-    char buf[512];
+    char buf[DIAG_REPORT_MAX];
     const size_t len = Diag::buildReport(buf, sizeof(buf));
     pChar->setValue(reinterpret_cast<const uint8_t*>(buf), len);
     ESP_LOGD(TAG, "Read (%zu B): %s", len, buf);
@@ -147,17 +138,72 @@ void Diag::_notifyTimerCb(TimerHandle_t /*xTimer*/)
 {
     if (!_pChar || !Ble.isConnected()) { return; }
 
-    char buf[512];
+    char buf[DIAG_REPORT_MAX];
     const size_t len = buildReport(buf, sizeof(buf));
     _pChar->setValue(reinterpret_cast<const uint8_t*>(buf), len);
     _pChar->notify();
     ESP_LOGD(TAG, "Notify (%zu B): %s", len, buf);
 }
 
+// ── CapCallbacks::onSubscribe ─────────────────────────────────────────────
+void Diag::CapCallbacks::onSubscribe(NimBLECharacteristic* /*pChar*/,
+                                     NimBLEConnInfo& connInfo,
+                                     uint16_t subValue)
+{
+    if (!_capTimer) return;
+    if (subValue == 0) {
+        xTimerStop(_capTimer, 0);
+        return;
+    }
+
+    size_t chunk = connInfo.getMTU() > 3 ? connInfo.getMTU() - 3 : 20;
+    if (chunk > CAP_CHUNK_MAX) chunk = CAP_CHUNK_MAX;
+    _capChunkMax.store(chunk);
+    _capRestart.store(true);
+    xTimerStart(_capTimer, 0);
+    ESP_LOGI(TAG, "Capture export requested (%zu B per notification)", chunk);
+}
+
+// ── _capTimerCb ───────────────────────────────────────────────────────────
+void Diag::_capTimerCb(TimerHandle_t xTimer)
+{
+#if CONFIG_LORA_ENABLED
+    if (!_pCapChar || !Ble.isConnected()) {
+        xTimerStop(xTimer, 0);
+        return;
+    }
+
+    if (_capRestart.exchange(false)) {
+        Lora.captureBegin(_capStream);
+        _capHave = false;
+    }
+
+    for (int i = 0; i < CAP_CHUNKS_PER_TICK; i++) {
+        if (!_capHave) {
+            _capLen  = Lora.captureRead(_capStream, _capChunk, _capChunkMax.load());
+            _capHave = true;
+        }
+        // Out of notification buffers — the same chunk goes next tick.
+        if (!_pCapChar->notify(_capChunk, _capLen)) return;
+        _capHave = false;
+
+        if (_capLen == 0) {         // end-of-file marker sent
+            ESP_LOGI(TAG, "Capture export done: %" PRIu32 " frames, %" PRIu32 " overwritten",
+                     _capStream.sent, _capStream.lost);
+            xTimerStop(xTimer, 0);
+            return;
+        }
+    }
+#else
+    xTimerStop(xTimer, 0);
+#endif
+}
+
 // ── stopNotifications ─────────────────────────────────────────────────────
 void Diag::stopNotifications()
 {
     if (_notifyTimer) xTimerStop(_notifyTimer, 0);
+    if (_capTimer)    xTimerStop(_capTimer, 0);
 }
 
 // ── registerService ───────────────────────────────────────────────────────
@@ -167,15 +213,26 @@ void Diag::registerService(NimBLEServer* pServer)
 
     _pChar = pSvc->createCharacteristic(
         DIAG_CHAR_UUID,
-        NIMBLE_PROPERTY::READ | NIMBLE_PROPERTY::NOTIFY);
+        NIMBLE_PROPERTY::READ | NIMBLE_PROPERTY::NOTIFY,
+        DIAG_REPORT_MAX);
     _pChar->setCallbacks(&_charCbs);
 
     // Prime the characteristic with an initial value so the very first READ
     // never returns an empty payload.
-    char buf[512];
+    char buf[DIAG_REPORT_MAX];
     const size_t len = buildReport(buf, sizeof(buf));
     _pChar->setValue(reinterpret_cast<const uint8_t*>(buf), len);
 
+#if CONFIG_LORA_ENABLED
+    _pCapChar = pSvc->createCharacteristic(DIAG_CAP_UUID, NIMBLE_PROPERTY::NOTIFY);
+    _pCapChar->setCallbacks(&_capCbs);
+    _capTimer = xTimerCreate("diag_cap", pdMS_TO_TICKS(CAP_TICK_MS),
+                             pdTRUE, nullptr, _capTimerCb);
+    if (!_capTimer) {
+        ESP_LOGW(TAG, "Failed to create capture timer");
+    }
+#endif
+
     pSvc->start();
 
     // Create the periodic NOTIFY timer (auto-reload, initially stopped).
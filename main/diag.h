@@ -18,8 +18,10 @@
 #ifndef DIAG_H_
 #define DIAG_H_
 
+#include "mesh_capture.h"
 #include <NimBLEDevice.h>
 #include <freertos/timers.h>
+#include <atomic>
 #include <cstddef>
 
 /**
@@ -28,18 +30,40 @@
  * Exposes a single READ + NOTIFY GATT characteristic that returns a compact
  * JSON snapshot of runtime state: heap, GPS, BLE, battery, notification queue.
  *
+ * "disp" is the display power state (0 full, 1 dim, 2 asleep), the
+ * estimated display current in each state and the mean since boot, mA
+ * (display_power.h).
+ *
  * Service UUID:        BA5EBA11-0000-D1A6-0000-000000000001
  * Characteristic UUID: BA5EBA11-0000-D1A6-0000-000000000002
  *
- * Example report (≈ 280 bytes):
+ * The report is formatted by diag_formatReport() (diag_report.h) into a
+ * DIAG_REPORT_MAX buffer; the characteristic is created that long, as a
+ * typical report already passes 512 bytes.  A READ returns all of it over
+ * read-blob requests; a NOTIFY carries the first MTU − 3 bytes.
+ *
+ * Example report (525 bytes; node_id, short_name and "lora" only in LoRa
+ * builds):
  *   {"node_id":"!deadbeef","short_name":"YIFF",
  *    "up":3600,"heap":142080,"heap_min":98304,"ble":1,"bat":85,
  *    "gps":{"fix":1,"sats":8,"hdop":1.2,"ok":142,"fail":0},
- *    "lora":{"state":"listening","rx":12,"crc_err":0,"hdr_err":0,
- *            "decrypt":10,"text":3,"tx":2,"tx_err":0,"tx_timeout":0,
- *            "rssi":-87,"snr":7.5},
+ *    "lora":{"state":"listening","preamble":40,"hdr_ok":15,"rx":12,
+ *            "crc_err":0,"hdr_err":0,"decrypt":10,"dup":2,"text":3,
+ *            "inbox_lost":0,"tx":2,"tx_err":0,"tx_timeout":0,
+ *            "cad_busy":1,"backoff":1,"ch_util":4.2,"air_tx":0.8,
+ *            "neighbors":5,"rssi":-87,"snr":7.5},
+ *    "hdr":{"upd":412,"same":371,"bursts":44,"px":9630},
+ *    "disp":{"st":1,"ma":[18.0,6.0,0.01],"avg":4.7},
  *    "notif":2,"bonds":1}
  *
+ * Packet capture (LoRa builds):
+ *   Characteristic UUID: BA5EBA11-0000-D1A6-0000-000000000003  (NOTIFY)
+ *
+ *   Subscribing streams every frame now in LoRa's capture ring as one pcap
+ *   file (LINKTYPE_LORATAP) split across notifications of up to MTU − 3
+ *   bytes; an empty notification ends the file.  Subscribe again for a
+ *   fresh dump.  test/capture_decode prints it.
+ *
  * Usage:
  *   // In BleService::startServer(), after createService() calls:
  *   Diag::registerService(pServer);   // before startServices()
@@ -54,12 +78,13 @@ public:
     /// Must be called before NimBLEServer::startServices().
     static void registerService(NimBLEServer* pServer);
 
-    /// Stop the periodic NOTIFY timer.  Call on BLE disconnect so the timer
-    /// does not fire into an unconnected stack.
+    /// Stop the periodic NOTIFY timer and any capture export.  Call on BLE
+    /// disconnect so neither timer fires into an unconnected stack.
     static void stopNotifications();
 
-    /// Build a compact JSON diagnostic report into buf (null-terminated).
-    /// Returns the number of bytes written (excluding NUL).
+    /// Build a compact JSON diagnostic report into buf (null-terminated);
+    /// DIAG_REPORT_MAX bytes always hold it.  Returns the number of bytes
+    /// written (excluding NUL).
     static size_t buildReport(char* buf, size_t bufSize);
 
 private:
@@ -68,6 +93,26 @@ private:
 
     static void _notifyTimerCb(TimerHandle_t xTimer);
 
+    // ── Packet capture export ─────────────────────────────────────────────
+    // The export runs on its own timer, CAP_CHUNKS_PER_TICK notifications
+    // per tick; a notification the stack cannot queue is retried on the
+    // next tick.  _capStream and the chunk buffer belong to the timer
+    // callback; a subscription only raises _capRestart.
+    static constexpr uint32_t CAP_TICK_MS         = 20;
+    static constexpr int      CAP_CHUNKS_PER_TICK = 4;
+    static constexpr size_t   CAP_CHUNK_MAX       = 512;  ///< ATT value limit
+
+    static NimBLECharacteristic* _pCapChar;
+    static TimerHandle_t         _capTimer;
+    static McPcapStream          _capStream;
+    static uint8_t               _capChunk[CAP_CHUNK_MAX];
+    static size_t                _capLen;       ///< bytes in _capChunk
+    static bool                  _capHave;      ///< _capChunk not yet sent
+    static std::atomic<size_t>   _capChunkMax;  ///< MTU − 3 of the subscriber
+    static std::atomic<bool>     _capRestart;
+
+    static void _capTimerCb(TimerHandle_t xTimer);
+
     /// GATT characteristic callbacks — onRead builds a fresh report;
     /// onSubscribe starts/stops the periodic notify timer.
     class CharCallbacks final : public NimBLECharacteristicCallbacks
@@ -79,6 +124,15 @@ private:
                          uint16_t subValue) override;
     };
     static CharCallbacks _charCbs;
+
+    /// Capture characteristic: a subscription starts a new export.
+    class CapCallbacks final : public NimBLECharacteristicCallbacks
+    {
+        void onSubscribe(NimBLECharacteristic* pChar,
+                         NimBLEConnInfo& connInfo,
+                         uint16_t subValue) override;
+    };
+    static CapCallbacks _capCbs;
 };
 
 #endif // DIAG_H_
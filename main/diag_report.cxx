@@ -0,0 +1,125 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * diag_report.cxx — diagnostic report JSON (see diag_report.h).
+ */
+
+#include "diag_report.h"
+#include <cinttypes>
+#include <cstdarg>
+#include <cstdio>
+
+namespace {
+
+/// snprintf appends into one buffer; the first that does not fit cuts the
+/// report at the end of the buffer and stops the rest.
+struct ReportWriter {
+    char*  buf;
+    size_t size;
+    size_t len = 0;
+    bool   cut = false;
+
+    void put(const char* fmt, ...)
+    {
+        if (cut) return;
+        va_list ap;
+        va_start(ap, fmt);
+        const int n = vsnprintf(buf + len, size - len, fmt, ap);
+        va_end(ap);
+        if (n < 0 || (size_t)n >= size - len) {
+            cut = true;
+            len = size - 1;
+            buf[len] = '\0';
+            return;
+        }
+        len += (size_t)n;
+    }
+};
+
+double clamp(double v, double lo, double hi)
+{
+    return v < lo ? lo : v > hi ? hi : v;
+}
+
+} // namespace
+
+size_t diag_formatReport(char* buf, size_t bufSize, const DiagReport& r)
+{
+    if (bufSize == 0) return 0;
+    ReportWriter w{buf, bufSize};
+
+    w.put("{");
+    if (r.hasLora)
+        w.put("\"node_id\":\"%.9s\",\"short_name\":\"%.4s\",", r.nodeId, r.shortName);
+
+    w.put("\"up\":%" PRIu32 ","
+          "\"heap\":%" PRIu32 ","
+          "\"heap_min\":%" PRIu32 ","
+          "\"ble\":%d,"
+          "\"bat\":%u,"
+          "\"gps\":{\"fix\":%d,\"sats\":%" PRIu32 ",\"hdop\":%.1f,"
+                   "\"ok\":%" PRIu32 ",\"fail\":%" PRIu32 "},",
+          r.upSec, r.heap, r.heapMin,
+          r.bleConnected ? 1 : 0, (unsigned)r.battery,
+          r.gpsFix ? 1 : 0, r.gpsSats, clamp(r.gpsHdop, 0.0, 99.9),
+          r.gpsOk, r.gpsFail);
+
+    if (r.hasLora) {
+        const DiagLoraReport& l = r.lora;
+        w.put("\"lora\":{\"state\":\"%.11s\","
+                        "\"preamble\":%" PRIu32 ",\"hdr_ok\":%" PRIu32 ","
+                        "\"rx\":%" PRIu32 ",\"crc_err\":%" PRIu32 ","
+                        "\"hdr_err\":%" PRIu32 ",\"decrypt\":%" PRIu32 ","
+                        "\"dup\":%" PRIu32 ","
+                        "\"text\":%" PRIu32 ",\"inbox_lost\":%" PRIu32 ","
+                        "\"tx\":%" PRIu32 ","
+                        "\"tx_err\":%" PRIu32 ",\"tx_timeout\":%" PRIu32 ","
+                        "\"cad_busy\":%" PRIu32 ",\"backoff\":%" PRIu32 ","
+                        "\"ch_util\":%.1f,\"air_tx\":%.1f,"
+                        "\"neighbors\":%" PRIu32 ","
+                        "\"rssi\":%d,\"snr\":%.1f},",
+              l.state, l.preambles, l.headersValid,
+              l.rxPackets, l.crcErrors,
+              l.headerErrors, l.decryptOk,
+              l.duplicates,
+              l.textMessages, l.inboxOverflows,
+              l.txPackets,
+              l.txErrors, l.txTimeouts,
+              l.cadBusy, l.txBackoffs,
+              clamp(l.channelUtil, 0.0, 100.0), clamp(l.airUtilTx, 0.0, 100.0),
+              l.neighbors,
+              (int)l.lastRssi, clamp(l.lastSnr, -32.0, 32.0));
+    }
+
+    w.put("\"hdr\":{\"upd\":%" PRIu32 ",\"same\":%" PRIu32 ","
+                   "\"bursts\":%" PRIu32 ",\"px\":%" PRIu32 "},"
+          "\"disp\":{\"st\":%u,\"ma\":[%.1f,%.1f,%.2f],\"avg\":%.1f},"
+          "\"notif\":%" PRIu32 ","
+          "\"bonds\":%" PRIu32
+          "}",
+          r.hdr.updates, r.hdr.unchanged, r.hdr.bursts, r.hdr.pixels,
+          (unsigned)r.dispState,
+          clamp(r.dispUa[0] / 1000.0, 0.0, 999.9),
+          clamp(r.dispUa[1] / 1000.0, 0.0, 999.9),
+          clamp(r.dispUa[2] / 1000.0, 0.0, 999.9),
+          clamp(r.disp.avgUa / 1000.0, 0.0, 999.9),
+          r.notifications, r.bonds);
+
+    return w.len;
+}
@@ -0,0 +1,102 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * diag_report.h — the JSON snapshot the BLE diagnostic service returns.
+ *
+ * Diag::buildReport() copies the figures out of the firmware singletons
+ * into a DiagReport; diag_formatReport() turns that into the compact JSON
+ * documented in diag.h.  Keeping the text apart from NimBLE and the
+ * singletons lets the host tests check the format, and that the widest
+ * report — every counter at ten digits — still fits DIAG_REPORT_MAX.
+ *
+ * Floats are clamped to the range their source can produce (a percentage,
+ * the SX1262's SNR, an NMEA HDOP, display current under 1 A) before
+ * printing, so a corrupt value cannot widen the report past that bound.
+ */
+
+#pragma once
+
+#include "display_power.h"
+#include "header_bar.h"
+
+#include <cstddef>
+#include <cstdint>
+
+/// Report buffer size, NUL included.  The widest report (every uint32_t
+/// at ten digits) is 762 bytes; a typical one about 525.
+static constexpr size_t DIAG_REPORT_MAX = 768;
+
+/// LoRa section — LoRaStats fields plus the neighbour count.
+struct DiagLoraReport {
+    const char* state        = "disabled";   ///< "listening", "init_failed", "disabled"
+    uint32_t    preambles    = 0;
+    uint32_t    headersValid = 0;
+    uint32_t    rxPackets    = 0;
+    uint32_t    crcErrors    = 0;
+    uint32_t    headerErrors = 0;
+    uint32_t    decryptOk    = 0;
+    uint32_t    duplicates   = 0;
+    uint32_t    textMessages = 0;
+    uint32_t    inboxOverflows = 0;
+    uint32_t    txPackets    = 0;
+    uint32_t    txErrors     = 0;
+    uint32_t    txTimeouts   = 0;
+    uint32_t    cadBusy      = 0;
+    uint32_t    txBackoffs   = 0;
+    float       channelUtil  = 0.f;          ///< percent
+    float       airUtilTx    = 0.f;          ///< percent
+    uint32_t    neighbors    = 0;
+    int16_t     lastRssi     = 0;
+    float       lastSnr      = 0.f;
+};
+
+struct DiagReport {
+    bool        hasLora   = false;   ///< include node_id, short_name and "lora"
+    const char* nodeId    = "";      ///< "!xxxxxxxx"
+    const char* shortName = "";      ///< up to 4 characters
+
+    uint32_t upSec   = 0;
+    uint32_t heap    = 0;
+    uint32_t heapMin = 0;
+    bool     bleConnected = false;
+    uint8_t  battery = 0;            ///< percent
+
+    bool     gpsFix  = false;
+    uint32_t gpsSats = 0;
+    float    gpsHdop = 0.f;
+    uint32_t gpsOk   = 0;            ///< sentences with a good checksum
+    uint32_t gpsFail = 0;            ///< … and a bad one
+
+    DiagLoraReport lora;
+
+    HeaderStats       hdr;
+    PanelPower        dispState = PanelPower::Full;
+    uint32_t          dispUa[PANEL_POWER_STATES] = {};  ///< estimated current per state
+    DisplayPowerStats disp;
+
+    uint32_t notifications = 0;      ///< queued ANCS notifications
+    uint32_t bonds         = 0;
+};
+
+/**
+ * Write @p r as JSON into @p buf (always NUL-terminated).  Returns the
+ * length written, excluding the NUL; a report that does not fit is cut
+ * and bufSize - 1 returned.
+ */
+size_t diag_formatReport(char* buf, size_t bufSize, const DiagReport& r);
@@ -34,23 +34,51 @@ static const char* TAG = "display";
 Display::Display(int8_t cs, int8_t rst, int8_t dc,
                  int8_t sclk, int8_t mosi, int8_t led, int8_t vext)
 : _tft(cs, rst, dc, sclk, mosi, led, vext)
+, _header(_tft.width(), HEADER_COLOR, TFT::Color::WHITE)
 { }
 
 // ── init ──────────────────────────────────────────────────────────────────
 
-void Display::init()
+void Display::init(bool framebuffer, size_t glyphSlots)
 {
-    _tft.init();
+    _tft.init(framebuffer, glyphSlots);
     blank();
     _tft.drawXbm(16, 10, 128, 64, Bitmaps::Gnu_128x64, TFT::Color::BLUE);
+    _tft.flush();
     ESP_LOGI(TAG, "TFT initialised");
 }
 
-// ── drawIcon (private) ────────────────────────────────────────────────────
+// ── flush ─────────────────────────────────────────────────────────────────
 
-void Display::drawIcon(uint16_t x, uint16_t y, const uint8_t* xbm, uint16_t color)
+void Display::flush()
 {
-    _tft.drawXbm(x, y, 16, 16, xbm, color, HEADER_COLOR);
+    // The header keeps its differences and the frame its dirty
+    // rectangles until the panel is awake to take them.
+    if (_tft.asleep()) return;
+
+    HeaderRect rects[HDR_RECTS_MAX];
+    const uint8_t n = _header.dirty(rects);
+    for (uint8_t i = 0; i < n; i++) {
+        const HeaderRect& r = rects[i];
+        _tft.drawRows(r.x0, r.y0, r.width(), r.height(), [&](uint16_t y, uint16_t* dst) {
+            _header.drawRow(static_cast<uint8_t>(y), r.x0, r.width(), dst);
+        });
+    }
+    if (n) _header.drawn();
+    _tft.flush();
+}
+
+// ── setPower ──────────────────────────────────────────────────────────────
+
+void Display::setPower(PanelPower state, uint8_t backlightPercent)
+{
+    if (state == PanelPower::Sleep) {
+        _tft.backlight(0);
+        _tft.sleep(true);
+    } else {
+        _tft.sleep(false);
+        _tft.backlight(backlightPercent);
+    }
 }
 
 // ── Header bar methods ────────────────────────────────────────────────────
@@ -58,20 +86,21 @@ void Display::drawIcon(uint16_t x, uint16_t y, const uint8_t* xbm, uint16_t colo
 void Display::paintHeaderBackground()
 {
     _tft.fillRectangle(0, 0, _tft.width(), HEADER_HEIGHT, HEADER_COLOR);
+    _header.invalidate();
 }
 
 void Display::showBLEState(conn_state_def state)
 {
     switch (state) {
         case BLE_CONNECTED:
-            drawIcon(_tft.width() - 33, 1, Bitmaps::BluetoothRound);
+            _header.setIcon(HDR_BLE, Bitmaps::BluetoothRound, TFT::Color::WHITE);
             break;
         case BLE_SERVER_CONNECTED:
         case BLE_PAIRING:
-            drawIcon(_tft.width() - 33, 1, Bitmaps::Mqtt);
+            _header.setIcon(HDR_BLE, Bitmaps::Mqtt, TFT::Color::WHITE);
             break;
         case BLE_DISCONNECTED:
-            drawIcon(_tft.width() - 33, 1, Bitmaps::Bluetooth);
+            _header.setIcon(HDR_BLE, Bitmaps::Bluetooth, TFT::Color::WHITE);
             break;
     }
 }
@@ -79,61 +108,47 @@ void Display::showBLEState(conn_state_def state)
 void Display::showBatteryLevel(uint8_t percent, bool isCharging)
 {
     if (isCharging) {
-        // USB VBUS present — TP4054 actively charging.  Yellow lightning bolt;
-        // the ADC voltage reading is unreliable while the charger is active.
-        drawIcon(_tft.width() - 16, 1, Bitmaps::Battery_Charging, TFT::Color::YELLOW);
-        return;
-    }
-    if (percent > 75) {
-        drawIcon(_tft.width() - 16, 1, Bitmaps::Battery_100);
+        // USB VBUS present — TP4054 actively charging.  Yellow lightning
+        // bolt; the ADC voltage reading is unreliable while the charger
+        // is active.
+        _header.setIcon(HDR_BATTERY, Bitmaps::Battery_Charging, TFT::Color::YELLOW);
+    } else if (percent > 75) {
+        _header.setIcon(HDR_BATTERY, Bitmaps::Battery_100, TFT::Color::WHITE);
     } else if (percent > 50) {
-        drawIcon(_tft.width() - 16, 1, Bitmaps::Battery_66);
+        _header.setIcon(HDR_BATTERY, Bitmaps::Battery_66, TFT::Color::WHITE);
     } else if (percent > 25) {
-        drawIcon(_tft.width() - 16, 1, Bitmaps::Battery_33);
+        _header.setIcon(HDR_BATTERY, Bitmaps::Battery_33, TFT::Color::WHITE);
     } else {
-        drawIcon(_tft.width() - 16, 1, Bitmaps::Battery_0, TFT::Color::RED);
+        _header.setIcon(HDR_BATTERY, Bitmaps::Battery_0, TFT::Color::RED);
     }
 }
 
 void Display::showCallState(bool active)
 {
-    if (active == _callState) { return; }  // idempotent — skip redundant SPI write
-    _callState = active;
-    if (active) {
-        drawIcon(_tft.width() - 84, 1, Bitmaps::PhoneCall, TFT::Color::GREEN);
-    } else {
-        _tft.fillRectangle(_tft.width() - 84, 1, 16, 16, HEADER_COLOR);
-    }
+    _header.setIcon(HDR_CALL, active ? Bitmaps::PhoneCall : nullptr, TFT::Color::GREEN);
 }
 
 void Display::showGpsState(bool fixed)
 {
-    if (fixed) {
-        drawIcon(_tft.width() - 50, 1, Bitmaps::GPS, TFT::Color::WHITE);
-    } else {
-        _tft.fillRectangle(_tft.width() - 50, 1, 16, 16, HEADER_COLOR);
-    }
+    _header.setIcon(HDR_GPS, fixed ? Bitmaps::GPS : nullptr, TFT::Color::WHITE);
 }
 
 void Display::showLoraState(bool connected)
 {
-    if (connected) {
-        drawIcon(_tft.width() - 67, 1, Bitmaps::LoRaMesh, TFT::Color::WHITE);
-    } else {
-        _tft.fillRectangle(_tft.width() - 67, 1, 16, 16, HEADER_COLOR);
-    }
+    _header.setIcon(HDR_LORA, connected ? Bitmaps::LoRaMesh : nullptr, TFT::Color::WHITE);
 }
 
 void Display::showTime(const char* ts)
 {
     if (ts == nullptr || ts[0] == '\0') { return; }
-    _tft.drawStr(0, 6, ts, Font_7x10, TFT::Color::WHITE, HEADER_COLOR);
+    _header.setTime(ts);
 }
 
 // ── Body area methods ─────────────────────────────────────────────────────
 
 void Display::blank()
 {
+    _scroll.stop();
     _tft.fillRectangle(0, HEADER_HEIGHT, _tft.width(), _tft.height() - HEADER_HEIGHT,
                        TFT::Color::BLACK);
 }
@@ -168,25 +183,72 @@ void Display::standby(conn_state_def state, const char* pairingMsg)
     }
 }
 
-void Display::showNotification(notification_def const& notification)
+static uint32_t fnv1a(const char* s, uint32_t h = 2166136261u)
+{
+    for (; *s; s++) h = (h ^ static_cast<uint8_t>(*s)) * 16777619u;
+    return (h ^ 0xFF) * 16777619u;    // separator, so "ab"+"c" ≠ "a"+"bc"
+}
+
+void Display::showNotification(notification_def const& notification, uint32_t nowMs)
 {
     char timestamp[8];
     struct tm timeinfo;
     localtime_r(&notification.time, &timeinfo);
     strftime(timestamp, sizeof(timestamp), "%R", &timeinfo);
 
+    // Lay out only what has not been laid out before.
+    const char*    app  = AppList.getDisplayName(notification.bundleId);
+    const uint32_t hash = fnv1a(notification.message, fnv1a(notification.title, fnv1a(app)));
+    NotificationText& t = _notifText;
+    if (!t.valid || t.key != notification.key || t.hash != hash) {
+        const uint16_t appWidth = _tft.width() - 38 - 4;   // clear of the timestamp
+        text_layout(t.app, app, strlen(app), Font_7x10, appWidth, 1);
+        // Proportional: about a third more text per line than the 11 px cell.
+        text_layout(t.title, notification.title, sizeof(notification.title),
+                    Font_11x18_Prop, _tft.width(), 1);
+        // All of the message: what does not fit the window scrolls into it.
+        text_layout(t.message, notification.message, sizeof(notification.message),
+                    Font_11x18_Prop, _tft.width(), TEXT_MAX_LINES);
+        t.key   = notification.key;
+        t.hash  = hash;
+        t.valid = true;
+    }
+
     blank();
     _tft.fillRectangle(0, HEADER_HEIGHT, _tft.width(), _tft.height() - HEADER_HEIGHT,
                        TFT::Color::WHITE);
-    _tft.drawStr(0, 21, AppList.getDisplayName(notification.bundleId),
-                 Font_7x10, TFT::Color::BLACK, TFT::Color::WHITE);
+    if (t.app.lines)
+        _tft.drawText(0, 21, t.app.line(0), Font_7x10, TFT::Color::BLACK, TFT::Color::WHITE);
     _tft.drawStr(_tft.width() - 38, 21, timestamp,
                  Font_7x10, TFT::Color::BLACK, TFT::Color::WHITE);
-    _tft.drawStr(0, 44, notification.title,   Font_11x18, TFT::Color::BLACK, TFT::Color::WHITE);
-    _tft.drawStr(0, 62, notification.message, Font_11x18, TFT::Color::BLACK, TFT::Color::WHITE);
+    if (t.title.lines)
+        _tft.drawText(0, 32, t.title.line(0), Font_11x18_Prop, TFT::Color::BLACK, TFT::Color::WHITE);
+    _tft.drawTextRows(MESSAGE_Y, MESSAGE_ROWS, t.message, Font_11x18_Prop, 0,
+                      TFT::Color::BLACK, TFT::Color::WHITE);
+    _scroll.start(static_cast<uint16_t>(t.message.lines * Font_11x18_Prop.height),
+                  MESSAGE_ROWS, nowMs);
 }
 
-void Display::showLoraMessage(MeshMessage const& msg)
+bool Display::scrollStep(uint32_t nowMs)
+{
+    TextScrollStep step;
+    if (!_scroll.step(nowMs, step)) return false;
+
+    // Shift what is on screen and draw the rows that came into view; back
+    // at the top, or drawing direct, draw the whole window.
+    const TextLayout& msg = _notifText.message;
+    if (step.full || !_tft.scrollUp(MESSAGE_Y, MESSAGE_ROWS, step.delta)) {
+        _tft.drawTextRows(MESSAGE_Y, MESSAGE_ROWS, msg, Font_11x18_Prop, step.offset,
+                          TFT::Color::BLACK, TFT::Color::WHITE);
+    } else {
+        const uint16_t fresh = MESSAGE_ROWS - step.delta;
+        _tft.drawTextRows(MESSAGE_Y + fresh, step.delta, msg, Font_11x18_Prop,
+                          step.offset + fresh, TFT::Color::BLACK, TFT::Color::WHITE);
+    }
+    return true;
+}
+
+void Display::showLoraMessage(MeshMessage const& msg, uint32_t more)
 {
     blank();
 
@@ -197,6 +259,15 @@ void Display::showLoraMessage(MeshMessage const& msg)
     _tft.fillRectangle(0, HEADER_HEIGHT, _tft.width(), 12, hdrColor);
     _tft.drawStr(0, 21, hdrLabel, Font_7x10, hdrText, hdrColor);
 
+    // Backlog count after the label.
+    uint16_t labelEnd = static_cast<uint16_t>(strlen(hdrLabel) * 7);
+    if (more > 0) {
+        char moreStr[8];
+        snprintf(moreStr, sizeof(moreStr), "+%" PRIu32, more > 99 ? 99 : more);
+        _tft.drawStr(labelEnd + 4, 21, moreStr, Font_7x10, hdrText, hdrColor);
+        labelEnd += static_cast<uint16_t>(4 + strlen(moreStr) * 7);
+    }
+
     // Sender: prefer short name; fall back to abbreviated node ID.
     char sender[12] = {};
     if (msg.shortName[0] != '\0') {
@@ -212,7 +283,7 @@ void Display::showLoraMessage(MeshMessage const& msg)
     _tft.drawStr(rssiX, 21, rssiStr, Font_7x10, hdrText, hdrColor);
 
     const uint16_t senderX = rssiX - static_cast<uint16_t>(strlen(sender) * 7) - 4;
-    if (static_cast<int16_t>(senderX) > 28)
+    if (static_cast<int16_t>(senderX) > labelEnd)
         _tft.drawStr(senderX, 21, sender, Font_7x10, hdrText, hdrColor);
 
     // ── Message body (y=32..79) ───────────────────────────────────────────
@@ -17,7 +17,10 @@
 
 #pragma once
 
+#include "display_power.h"
+#include "header_bar.h"
 #include "mesh_codec.h"
+#include "text_layout.h"
 #include "tft.h"
 #include "util.h"    // conn_state_def
 
@@ -48,16 +51,43 @@ public:
     Display(int8_t cs, int8_t rst, int8_t dc,
             int8_t sclk, int8_t mosi, int8_t led, int8_t vext);
 
-    /// Initialise the TFT driver and show the boot splash screen.
-    void init();
+    /**
+     * Initialise the TFT driver and show the boot splash screen.
+     * @param framebuffer Compose into RAM; nothing reaches the panel until
+     *                    flush().  See framebuffer.h.
+     * @param glyphSlots  Glyphs to keep pre-expanded when drawing direct
+     *                    (glyph_cache.h); 0 = none.
+     */
+    void init(bool framebuffer = false, size_t glyphSlots = 0);
+
+    /// Push what changed since the last flush: the header cells that
+    /// differ from what is on screen, then the frame's dirty rectangles
+    /// (drawing direct, the rows still in flight).  Held back while the
+    /// panel sleeps and pushed on the first flush after it wakes.
+    void flush();
+
+    /**
+     * Put the panel in @p state (display_power.h) with the backlight at
+     * @p backlightPercent.  Sleep switches the backlight off first and
+     * sends the ST7735 to sleep; leaving Sleep wakes it (up to 120 ms)
+     * before the backlight comes back.  Nothing is redrawn: the panel
+     * keeps its GRAM.
+     */
+    void setPower(PanelPower state, uint8_t backlightPercent);
 
     // ── Header bar (top 20 px) ────────────────────────────────────────────
-    /// Fill the top HEADER_HEIGHT rows with HEADER_COLOR.  Call once at boot
-    /// before the individual icon methods.
+    // The icon and clock setters only note what the header should show;
+    // flush() redraws the cells that differ from what it shows now — the
+    // icons in one address window, the clock digits in one more unless it
+    // is cheaper to join them (header_bar.h).  Callers may repeat them
+    // freely.
+
+    /// Fill the top HEADER_HEIGHT rows with HEADER_COLOR.  Every cell is
+    /// drawn again on the next flush().
     void paintHeaderBackground();
     void showBLEState(conn_state_def state);
+    /// Redraws only when the icon (charging, or the 25 % step) changes.
     void showBatteryLevel(uint8_t pct, bool isCharging);
-    /// Idempotent: skips the SPI write when state is unchanged.
     void showCallState(bool active);
     void showGpsState(bool fixed);
     void showLoraState(bool connected);
@@ -73,19 +103,49 @@ public:
      * @param pairingMsg Passcode or hint string shown during pairing; may be nullptr.
      */
     void standby(conn_state_def state, const char* pairingMsg = nullptr);
-    void showNotification(notification_def const& notification);
-    void showLoraMessage(MeshMessage const& msg);
+    /**
+     * Show @p notification.  A message longer than its window scrolls from
+     * @p nowMs on; see scrollStep().
+     */
+    void showNotification(notification_def const& notification, uint32_t nowMs);
+    /// @param more  Unread messages queued behind this one, shown as "+N".
+    void showLoraMessage(MeshMessage const& msg, uint32_t more = 0);
     void showPositionMessage(MeshPosition const& pos);
     void showNodeInfoMessage(MeshUser const& user);
 
+    // ── Message scrolling ─────────────────────────────────────────────────
+    /// Move a scrolling message on to @p nowMs.  Returns true if anything
+    /// was drawn (flush() to show it).
+    bool scrollStep(uint32_t nowMs);
+    /// Milliseconds until scrollStep() has work; UINT32_MAX when nothing
+    /// scrolls.  Drawing anything else in the body stops the scroll.
+    uint32_t scrollWaitMs(uint32_t nowMs) const { return _scroll.waitMs(nowMs); }
+
     // ── Accessors ─────────────────────────────────────────────────────────
     uint8_t width()  const { return _tft.width();  }
     uint8_t height() const { return _tft.height(); }
+    const HeaderStats& headerStats() const { return _header.stats(); }
 
 private:
-    void drawIcon(uint16_t x, uint16_t y, const uint8_t* xbm,
-                  uint16_t color = TFT::Color::WHITE);
+    // Notification message window: a line and two thirds of Font_11x18_Prop,
+    // so a longer message shows that there is more.
+    static constexpr uint8_t MESSAGE_Y    = 50;
+    static constexpr uint8_t MESSAGE_ROWS = 30;
 
     TFT  _tft;
-    bool _callState = false;  ///< last drawn call state — prevents redundant redraws
+
+    HeaderBar _header;
+
+    // Layout of the notification last shown — decoded, measured and
+    // wrapped once, redrawn from here while key and text stay the same.
+    struct NotificationText {
+        bool       valid = false;
+        uint32_t   key   = 0;
+        uint32_t   hash  = 0;      ///< FNV-1a of app name, title and message
+        TextLayout app;
+        TextLayout title;
+        TextLayout message;
+    };
+    NotificationText _notifText;
+    TextScroll       _scroll;
 };
@@ -0,0 +1,128 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * display_power.cxx — display idle timeouts and current estimates (see
+ * display_power.h).
+ */
+
+#include "display_power.h"
+
+DisplayPower::DisplayPower(const DisplayPowerConfig& cfg)
+:   _cfg(cfg)
+{
+    if (_cfg.dimPercent > 100) _cfg.dimPercent = 100;
+}
+
+// ── State ─────────────────────────────────────────────────────────────────
+
+PanelPower DisplayPower::wake(uint32_t nowMs)
+{
+    if (!_started) {
+        _started = true;
+        _markMs  = nowMs;
+    }
+    _account(nowMs);
+    const PanelPower was = _state;
+    if (was == PanelPower::Sleep) _wakes++;
+    _state    = PanelPower::Full;
+    _activeMs = nowMs;
+    return was;
+}
+
+bool DisplayPower::step(uint32_t nowMs)
+{
+    // Only ever deeper: coming back up is wake()'s job.
+    const PanelPower t = _target(nowMs);
+    if (!_started || t <= _state) return false;
+    _account(nowMs);
+    _state = t;
+    return true;
+}
+
+uint32_t DisplayPower::waitMs(uint32_t nowMs) const
+{
+    if (!_started) return UINT32_MAX;
+
+    uint32_t due = UINT32_MAX;
+    if (_state == PanelPower::Full && _cfg.dimMs)
+        due = _cfg.dimMs;
+    if (_state != PanelPower::Sleep && _cfg.sleepMs && _cfg.sleepMs < due)
+        due = _cfg.sleepMs;
+    if (due == UINT32_MAX) return UINT32_MAX;
+
+    const int32_t idle = static_cast<int32_t>(nowMs - _activeMs);
+    if (idle < 0) return due;
+    return static_cast<uint32_t>(idle) >= due ? 0 : due - static_cast<uint32_t>(idle);
+}
+
+PanelPower DisplayPower::_target(uint32_t nowMs) const
+{
+    const int32_t idle = static_cast<int32_t>(nowMs - _activeMs);
+    if (idle < 0) return PanelPower::Full;
+    if (_cfg.sleepMs && static_cast<uint32_t>(idle) >= _cfg.sleepMs) return PanelPower::Sleep;
+    if (_cfg.dimMs   && static_cast<uint32_t>(idle) >= _cfg.dimMs)   return PanelPower::Dim;
+    return PanelPower::Full;
+}
+
+// ── Estimates ─────────────────────────────────────────────────────────────
+
+uint8_t DisplayPower::backlightPercent(PanelPower s) const
+{
+    switch (s) {
+        case PanelPower::Full:  return 100;
+        case PanelPower::Dim:   return _cfg.dimPercent;
+        case PanelPower::Sleep: break;
+    }
+    return 0;
+}
+
+uint32_t DisplayPower::currentUa(PanelPower s) const
+{
+    const uint32_t panel = s == PanelPower::Sleep ? DISP_PANEL_SLEEP_UA : DISP_PANEL_ON_UA;
+    return panel + DISP_BACKLIGHT_UA * backlightPercent(s) / 100;
+}
+
+void DisplayPower::_account(uint32_t nowMs)
+{
+    const int32_t d = static_cast<int32_t>(nowMs - _markMs);
+    if (d > 0) _spentMs[static_cast<uint8_t>(_state)] += static_cast<uint32_t>(d);
+    _markMs = nowMs;
+}
+
+DisplayPowerStats DisplayPower::stats(uint32_t nowMs) const
+{
+    DisplayPowerStats s;
+    s.wakes = _wakes;
+    s.avgUa = currentUa(_state);
+    if (!_started) return s;
+
+    uint64_t spent[PANEL_POWER_STATES];
+    for (uint8_t i = 0; i < PANEL_POWER_STATES; i++) spent[i] = _spentMs[i];
+    const int32_t d = static_cast<int32_t>(nowMs - _markMs);
+    if (d > 0) spent[static_cast<uint8_t>(_state)] += static_cast<uint32_t>(d);
+
+    uint64_t total = 0, charge = 0;     // ms, µA·ms
+    for (uint8_t i = 0; i < PANEL_POWER_STATES; i++) {
+        s.seconds[i] = static_cast<uint32_t>(spent[i] / 1000);
+        total  += spent[i];
+        charge += spent[i] * currentUa(static_cast<PanelPower>(i));
+    }
+    if (total) s.avgUa = static_cast<uint32_t>(charge / total);
+    return s;
+}
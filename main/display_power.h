@@ -0,0 +1,116 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * display_power.h — when the TFT is bright, dimmed, or asleep.
+ *
+ * The panel and its backlight used to stay fully on from boot, showing
+ * the standby screen to nobody.  DisplayPower steps down as the display
+ * sits idle:
+ *
+ *   Full   backlight at 100 %                  until dimMs idle
+ *   Dim    backlight at dimPercent (LEDC PWM)  until sleepMs idle
+ *   Sleep  backlight off, ST7735 DISPOFF+SLPIN
+ *
+ * The draw task calls wake() whenever it draws a body screen, and while
+ * one other than standby is up; header updates (clock, battery) do not
+ * count.  It waits at most waitMs() for its next notification and calls
+ * step() after every wakeup, like ScreenScheduler.  wake() returns the
+ * state it left so the caller knows when the panel must come out of
+ * sleep.  Asleep, the ST7735 keeps its GRAM — and the framebuffer its
+ * frame — so waking needs no redraw, only what changed meanwhile.
+ *
+ * Current-draw figures are estimates for the Wireless Tracker's 0.96"
+ * panel, not measurements: the backlight LED scaled by its duty, plus the
+ * ST7735 driver on or asleep.  stats() weighs them by time spent in each
+ * state.
+ *
+ * Times are caller-supplied milliseconds, wrap-safe.  Not thread-safe:
+ * draw task only.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+enum class PanelPower : uint8_t {
+    Full,
+    Dim,
+    Sleep,
+};
+
+static constexpr uint8_t PANEL_POWER_STATES = 3;
+
+/// Estimated supply current, microamps.
+static constexpr uint32_t DISP_BACKLIGHT_UA   = 15000;  ///< backlight LED at 100 %
+static constexpr uint32_t DISP_PANEL_ON_UA    =  3000;  ///< ST7735 driving the panel
+static constexpr uint32_t DISP_PANEL_SLEEP_UA =    10;  ///< ST7735 in SLPIN
+
+/// Idle timeouts, from the last wake().  0 = never.  A sleepMs no longer
+/// than dimMs goes straight from Full to Sleep.
+struct DisplayPowerConfig {
+    uint32_t dimMs      =  30000;
+    uint32_t sleepMs    = 120000;
+    uint8_t  dimPercent =     20;  ///< backlight while dimmed, 0..100
+};
+
+struct DisplayPowerStats {
+    uint32_t seconds[PANEL_POWER_STATES] = {};  ///< time spent in each state
+    uint32_t wakes = 0;                         ///< times woken from Sleep
+    uint32_t avgUa = 0;                         ///< estimated mean current
+};
+
+class DisplayPower {
+public:
+    explicit DisplayPower(const DisplayPowerConfig& cfg = {});
+
+    /// The display was drawn or is showing something: back to Full, idle
+    /// timeouts restart from @p nowMs.  Returns the state before — Sleep
+    /// means the panel has to be woken.  The first call starts the clock
+    /// for stats().
+    PanelPower wake(uint32_t nowMs);
+
+    /// Apply the idle timeouts at @p nowMs.  True when state() changed.
+    bool step(uint32_t nowMs);
+
+    /// Milliseconds until step() has work; UINT32_MAX when none.
+    uint32_t waitMs(uint32_t nowMs) const;
+
+    PanelPower state() const { return _state; }
+    uint8_t    backlightPercent() const { return backlightPercent(_state); }
+    uint8_t    backlightPercent(PanelPower s) const;
+    /// Estimated display current in state @p s, microamps.
+    uint32_t   currentUa(PanelPower s) const;
+
+    /// Time in each state up to @p nowMs, and the mean current over it.
+    DisplayPowerStats stats(uint32_t nowMs) const;
+
+    const DisplayPowerConfig& config() const { return _cfg; }
+
+private:
+    PanelPower _target(uint32_t nowMs) const;
+    void       _account(uint32_t nowMs);
+
+    DisplayPowerConfig _cfg;
+    PanelPower _state   = PanelPower::Full;
+    bool       _started = false;
+    uint32_t   _activeMs = 0;                       ///< last wake()
+    uint32_t   _markMs   = 0;                       ///< time accounted up to
+    uint64_t   _spentMs[PANEL_POWER_STATES] = {};
+    uint32_t   _wakes    = 0;
+};
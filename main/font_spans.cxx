@@ -0,0 +1,1023 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * font_spans.cxx — GENERATED by test/font_compile.cxx from fonts.cxx.
+ * Do not edit by hand.
+ *
+ * Run tables of the TFT fonts; format in fonts.h.
+ */
+
+#include "fonts.h"
+
+// ── Font_7x10 ───────────────────────────────────────────────────────────
+
+static const uint8_t Spans_7x10[] = {
+    // sp (no ink)
+    0x31, 0x61, 0x61, 0x61, 0x61, 0x61, 0xD1,                                // !
+    0x21, 0x11, 0x41, 0x11, 0x41, 0x11,                                      // "
+    0x21, 0x21, 0x31, 0x21, 0x25, 0x31, 0x21, 0x21, 0x21, 0x35, 0x21, 0x21,  // #
+    0x31, 0x21,
+    0x23, 0x31, 0x11, 0x11, 0x21, 0x11, 0x53, 0x51, 0x11, 0x21, 0x11, 0x11,  // $
+    0x21, 0x11, 0x11, 0x33, 0x51,
+    0x21, 0x51, 0x11, 0x11, 0x21, 0x12, 0x42, 0x51, 0x11, 0x31, 0x11, 0x11,  // %
+    0x41, 0x11, 0x51,
+    0x31, 0x51, 0x11, 0x41, 0x11, 0x51, 0x52, 0x11, 0x21, 0x21, 0x31, 0x21,  // &
+    0x42, 0x11,
+    0x31, 0x61, 0x61,                                                        // '
+    0x41, 0x51, 0x51, 0x61, 0x61, 0x61, 0x61, 0x61, 0x71, 0x71,              // (
+    0x21, 0x71, 0x71, 0x61, 0x61, 0x61, 0x61, 0x61, 0x51, 0x51,              // )
+    0x31, 0x53, 0x51, 0x51, 0x11,                                            // *
+    0xF0, 0x21, 0x61, 0x45, 0x41, 0x61,                                      // +
+    0xF0, 0xF0, 0xF0, 0x71, 0x61, 0x61,                                      // ,
+    0xF0, 0xF0, 0x73,                                                        // -
+    0xF0, 0xF0, 0xF0, 0x71,                                                  // .
+    0x41, 0x61, 0x51, 0x61, 0x61, 0x61, 0x51, 0x61,                          // /
+    0x23, 0x31, 0x31, 0x21, 0x31, 0x21, 0x11, 0x11, 0x21, 0x31, 0x21, 0x31,  // 0
+    0x21, 0x31, 0x33,
+    0x31, 0x52, 0x41, 0x11, 0x61, 0x61, 0x61, 0x61, 0x61,                    // 1
+    0x23, 0x31, 0x31, 0x21, 0x31, 0x61, 0x51, 0x51, 0x51, 0x55,              // 2
+    0x23, 0x31, 0x31, 0x61, 0x42, 0x71, 0x61, 0x21, 0x31, 0x33,              // 3
+    0x41, 0x52, 0x41, 0x11, 0x41, 0x11, 0x31, 0x21, 0x35, 0x51, 0x61,        // 4
+    0x15, 0x21, 0x61, 0x64, 0x71, 0x61, 0x21, 0x31, 0x33,                    // 5
+    0x23, 0x31, 0x31, 0x21, 0x64, 0x31, 0x31, 0x21, 0x31, 0x21, 0x31, 0x33,  // 6
+    0x15, 0x61, 0x51, 0x51, 0x61, 0x51, 0x61, 0x61,                          // 7
+    0x23, 0x31, 0x31, 0x21, 0x31, 0x33, 0x31, 0x31, 0x21, 0x31, 0x21, 0x31,  // 8
+    0x33,
+    0x23, 0x31, 0x31, 0x21, 0x31, 0x21, 0x31, 0x34, 0x61, 0x21, 0x31, 0x33,  // 9
+    0xF0, 0x21, 0xF0, 0xF0, 0x41,                                            // :
+    0xF0, 0x91, 0xF0, 0xC1, 0x61, 0x61,                                      // ;
+    0xF0, 0x32, 0x32, 0x41, 0x72, 0x72,                                      // <
+    0xF0, 0x75, 0x95,                                                        // =
+    0xF2, 0x72, 0x71, 0x42, 0x32,                                            // >
+    0x23, 0x31, 0x31, 0x61, 0x51, 0x51, 0x61, 0xD1,                          // ?
+    0x23, 0x31, 0x31, 0x21, 0x22, 0x21, 0x11, 0x11, 0x21, 0x13, 0x21, 0x61,  // @
+    0x73,
+    0x31, 0x51, 0x11, 0x41, 0x11, 0x41, 0x11, 0x41, 0x11, 0x35, 0x21, 0x31,  // A
+    0x21, 0x31,
+    0x14, 0x31, 0x31, 0x21, 0x31, 0x24, 0x31, 0x31, 0x21, 0x31, 0x21, 0x31,  // B
+    0x24,
+    0x23, 0x31, 0x31, 0x21, 0x61, 0x61, 0x61, 0x61, 0x31, 0x33,              // C
+    0x13, 0x41, 0x21, 0x31, 0x31, 0x21, 0x31, 0x21, 0x31, 0x21, 0x31, 0x21,  // D
+    0x21, 0x33,
+    0x15, 0x21, 0x61, 0x65, 0x21, 0x61, 0x61, 0x65,                          // E
+    0x15, 0x21, 0x61, 0x64, 0x31, 0x61, 0x61, 0x61,                          // F
+    0x23, 0x31, 0x31, 0x21, 0x61, 0x61, 0x13, 0x21, 0x31, 0x21, 0x31, 0x33,  // G
+    0x11, 0x31, 0x21, 0x31, 0x21, 0x31, 0x25, 0x21, 0x31, 0x21, 0x31, 0x21,  // H
+    0x31, 0x21, 0x31,
+    0x23, 0x51, 0x61, 0x61, 0x61, 0x61, 0x61, 0x53,                          // I
+    0x51, 0x61, 0x61, 0x61, 0x61, 0x61, 0x21, 0x31, 0x33,                    // J
+    0x11, 0x31, 0x21, 0x21, 0x31, 0x11, 0x42, 0x51, 0x11, 0x41, 0x21, 0x31,  // K
+    0x21, 0x31, 0x31,
+    0x11, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x65,                          // L
+    0x11, 0x31, 0x22, 0x12, 0x22, 0x12, 0x21, 0x11, 0x11, 0x21, 0x31, 0x21,  // M
+    0x31, 0x21, 0x31, 0x21, 0x31,
+    0x11, 0x31, 0x22, 0x21, 0x22, 0x21, 0x21, 0x11, 0x11, 0x21, 0x11, 0x11,  // N
+    0x21, 0x22, 0x21, 0x22, 0x21, 0x31,
+    0x23, 0x31, 0x31, 0x21, 0x31, 0x21, 0x31, 0x21, 0x31, 0x21, 0x31, 0x21,  // O
+    0x31, 0x33,
+    0x14, 0x31, 0x31, 0x21, 0x31, 0x21, 0x31, 0x24, 0x31, 0x61, 0x61,        // P
+    0x23, 0x31, 0x31, 0x21, 0x31, 0x21, 0x31, 0x21, 0x31, 0x21, 0x31, 0x21,  // Q
+    0x11, 0x11, 0x33, 0x71,
+    0x14, 0x31, 0x31, 0x21, 0x31, 0x21, 0x31, 0x24, 0x31, 0x21, 0x31, 0x21,  // R
+    0x31, 0x31,
+    0x23, 0x31, 0x31, 0x21, 0x72, 0x71, 0x71, 0x21, 0x31, 0x33,              // S
+    0x15, 0x41, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,                          // T
+    0x11, 0x31, 0x21, 0x31, 0x21, 0x31, 0x21, 0x31, 0x21, 0x31, 0x21, 0x31,  // U
+    0x21, 0x31, 0x33,
+    0x11, 0x31, 0x21, 0x31, 0x21, 0x31, 0x31, 0x11, 0x41, 0x11, 0x41, 0x11,  // V
+    0x51, 0x61,
+    0x11, 0x31, 0x21, 0x31, 0x21, 0x11, 0x11, 0x21, 0x11, 0x11, 0x21, 0x11,  // W
+    0x11, 0x22, 0x12, 0x31, 0x11, 0x41, 0x11,
+    0x11, 0x31, 0x31, 0x11, 0x41, 0x11, 0x51, 0x61, 0x51, 0x11, 0x41, 0x11,  // X
+    0x31, 0x31,
+    0x11, 0x31, 0x21, 0x31, 0x31, 0x11, 0x41, 0x11, 0x51, 0x61, 0x61, 0x61,  // Y
+    0x15, 0x61, 0x51, 0x51, 0x61, 0x51, 0x51, 0x65,                          // Z
+    0x32, 0x51, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x62,              // [
+    0x21, 0x61, 0x71, 0x61, 0x61, 0x61, 0x71, 0x61,                          /* \ */
+    0x22, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x52,              // ]
+    0x31, 0x51, 0x11, 0x41, 0x11, 0x31, 0x31,                                // ^
+    0xF0, 0xF0, 0xF0, 0xF0, 0x37,                                            // _
+    0x21, 0x71,                                                              // `
+    0xF0, 0x13, 0x31, 0x31, 0x34, 0x21, 0x31, 0x21, 0x22, 0x32, 0x11,        // a
+    0x11, 0x61, 0x61, 0x12, 0x32, 0x21, 0x21, 0x31, 0x21, 0x31, 0x22, 0x21,  // b
+    0x21, 0x12,
+    0xF0, 0x13, 0x31, 0x31, 0x21, 0x61, 0x61, 0x31, 0x33,                    // c
+    0x51, 0x61, 0x32, 0x11, 0x21, 0x22, 0x21, 0x31, 0x21, 0x31, 0x21, 0x22,  // d
+    0x32, 0x11,
+    0xF0, 0x13, 0x31, 0x31, 0x25, 0x21, 0x61, 0x31, 0x33,                    // e
+    0x42, 0x41, 0x45, 0x41, 0x61, 0x61, 0x61, 0x61,                          // f
+    0xF0, 0x12, 0x11, 0x21, 0x22, 0x21, 0x31, 0x21, 0x31, 0x21, 0x22, 0x32,  // g
+    0x11, 0x61, 0x24,
+    0x11, 0x61, 0x61, 0x12, 0x32, 0x21, 0x21, 0x31, 0x21, 0x31, 0x21, 0x31,  // h
+    0x21, 0x31,
+    0x31, 0xB3, 0x61, 0x61, 0x61, 0x61, 0x61,                                // i
+    0x31, 0xB3, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x33,                    // j
+    0x11, 0x61, 0x61, 0x21, 0x31, 0x11, 0x42, 0x51, 0x11, 0x41, 0x21, 0x31,  // k
+    0x31,
+    0x13, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,                          // l
+    0xF4, 0x31, 0x11, 0x11, 0x21, 0x11, 0x11, 0x21, 0x11, 0x11, 0x21, 0x11,  // m
+    0x11, 0x21, 0x11, 0x11,
+    0xF1, 0x12, 0x32, 0x21, 0x21, 0x31, 0x21, 0x31, 0x21, 0x31, 0x21, 0x31,  // n
+    0xF0, 0x13, 0x31, 0x31, 0x21, 0x31, 0x21, 0x31, 0x21, 0x31, 0x33,        // o
+    0xF1, 0x12, 0x32, 0x21, 0x21, 0x31, 0x21, 0x31, 0x22, 0x21, 0x21, 0x12,  // p
+    0x31, 0x61,
+    0xF0, 0x12, 0x11, 0x21, 0x22, 0x21, 0x31, 0x21, 0x31, 0x21, 0x22, 0x32,  // q
+    0x11, 0x61, 0x61,
+    0xF1, 0x12, 0x32, 0x21, 0x21, 0x61, 0x61, 0x61,                          // r
+    0xF0, 0x13, 0x31, 0x31, 0x32, 0x71, 0x31, 0x31, 0x33,                    // s
+    0x21, 0x61, 0x54, 0x41, 0x61, 0x61, 0x61, 0x72,                          // t
+    0xF1, 0x31, 0x21, 0x31, 0x21, 0x31, 0x21, 0x31, 0x21, 0x22, 0x32, 0x11,  // u
+    0xF1, 0x31, 0x21, 0x31, 0x31, 0x11, 0x41, 0x11, 0x41, 0x11, 0x51,        // v
+    0xF1, 0x11, 0x11, 0x21, 0x11, 0x11, 0x21, 0x11, 0x11, 0x22, 0x12, 0x31,  // w
+    0x11, 0x41, 0x11,
+    0xF1, 0x31, 0x31, 0x11, 0x51, 0x61, 0x51, 0x11, 0x31, 0x31,              // x
+    0xF1, 0x31, 0x21, 0x31, 0x31, 0x11, 0x41, 0x11, 0x51, 0x61, 0x61, 0x42,  // y
+    0xF5, 0x51, 0x51, 0x51, 0x51, 0x65,                                      // z
+    0x32, 0x51, 0x61, 0x61, 0x51, 0x61, 0x71, 0x61, 0x61, 0x62,              // {
+    0x31, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61,              // |
+    0x22, 0x61, 0x61, 0x61, 0x71, 0x61, 0x51, 0x61, 0x61, 0x52,              // }
+    0xF0, 0x73, 0x11, 0x21, 0x22,                                            // ~
+};
+
+static const uint16_t Index_7x10[FONT_GLYPHS + 1] = {
+      0,   0,   7,  13,  27,  44,  59,  73,  76,  86,  96, 101,
+    107, 113, 116, 120, 128, 143, 152, 162, 172, 183, 192, 204,
+    212, 225, 237, 242, 248, 254, 257, 262, 270, 283, 297, 310,
+    320, 334, 342, 350, 362, 377, 385, 394, 409, 417, 434, 452,
+    466, 477, 493, 507, 517, 525, 540, 554, 573, 587, 599, 607,
+    617, 625, 635, 642, 647, 649, 660, 674, 683, 697, 706, 714,
+    729, 743, 750, 759, 772, 780, 796, 808, 819, 833, 848, 856,
+    865, 873, 885, 896, 911, 921, 933, 939, 949, 959, 969, 974,
+};
+
+const FontDef Font_7x10 = {7, 10, Index_7x10, Spans_7x10, nullptr};
+
+// ── Font_11x18 ──────────────────────────────────────────────────────────
+
+static const uint8_t Spans_11x18[] = {
+    // sp (no ink)
+    0xF2, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0xF0,  // !
+    0x52, 0x92,
+    0xE2, 0x12, 0x62, 0x12, 0x62, 0x12, 0x62, 0x12, 0x62, 0x12,              // "
+    0xE2, 0x22, 0x52, 0x22, 0x52, 0x22, 0x52, 0x22, 0x39, 0x29, 0x42, 0x22,  // #
+    0x42, 0x22, 0x49, 0x29, 0x32, 0x22, 0x52, 0x22, 0x52, 0x22, 0x52, 0x22,
+    0xE4, 0x66, 0x43, 0x11, 0x12, 0x32, 0x21, 0x12, 0x33, 0x11, 0x74, 0x84,  // $
+    0x93, 0x81, 0x12, 0x32, 0x21, 0x12, 0x32, 0x21, 0x12, 0x33, 0x11, 0x12,
+    0x46, 0x64, 0x91, 0xA1,
+    0xC3, 0x72, 0x12, 0x62, 0x12, 0x41, 0x12, 0x12, 0x32, 0x12, 0x12, 0x22,  // %
+    0x33, 0x22, 0x82, 0x82, 0x82, 0x13, 0x42, 0x12, 0x12, 0x22, 0x22, 0x12,
+    0x21, 0x32, 0x12, 0x62, 0x12, 0x73,
+    0xE4, 0x66, 0x52, 0x22, 0x52, 0x22, 0x52, 0x22, 0x64, 0x82, 0x74, 0x22,  // &
+    0x22, 0x22, 0x12, 0x22, 0x33, 0x32, 0x42, 0x32, 0x33, 0x45, 0x12, 0x43,
+    0x21,
+    0xF2, 0x92, 0x92, 0x92, 0x92,                                            // '
+    0x81, 0x91, 0x92, 0x82, 0x92, 0x91, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,  // (
+    0xA1, 0xA2, 0x92, 0xA2, 0xA1, 0xB1,
+    0x21, 0xB1, 0xA2, 0xA2, 0x92, 0xA1, 0xA2, 0x92, 0x92, 0x92, 0x92, 0x92,  // )
+    0x91, 0x92, 0x92, 0x82, 0x91, 0x91,
+    0xF2, 0x71, 0x12, 0x11, 0x56, 0x64, 0x62, 0x22,                          // *
+    0xF0, 0xF0, 0x72, 0x92, 0x92, 0x92, 0x5A, 0x1A, 0x52, 0x92, 0x92, 0x92,  // +
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xC2, 0x92, 0xA1,  // ,
+    0xA1, 0x91,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xC4, 0x74,                          // -
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xC2, 0x92,        // .
+    0xF0, 0x22, 0x92, 0x92, 0x82, 0x92, 0x92, 0x92, 0x82, 0x92, 0x92, 0x92,  // /
+    0x82, 0x92, 0x92,
+    0xE4, 0x66, 0x52, 0x22, 0x42, 0x42, 0x32, 0x42, 0x32, 0x42, 0x32, 0x12,  // 0
+    0x12, 0x32, 0x12, 0x12, 0x32, 0x42, 0x32, 0x42, 0x32, 0x42, 0x42, 0x22,
+    0x56, 0x64,
+    0xF0, 0x12, 0x83, 0x74, 0x62, 0x12, 0x61, 0x22, 0x92, 0x92, 0x92, 0x92,  // 1
+    0x92, 0x92, 0x92, 0x92, 0x92,
+    0xE4, 0x66, 0x43, 0x23, 0x32, 0x42, 0x32, 0x42, 0x92, 0x82, 0x82, 0x82,  // 2
+    0x82, 0x82, 0x82, 0x98, 0x38,
+    0xE3, 0x75, 0x52, 0x32, 0x42, 0x32, 0x92, 0x73, 0x83, 0xA2, 0xA2, 0x92,  // 3
+    0x32, 0x42, 0x33, 0x23, 0x46, 0x64,
+    0xF0, 0x12, 0x83, 0x83, 0x74, 0x74, 0x71, 0x12, 0x62, 0x12, 0x62, 0x12,  // 4
+    0x52, 0x22, 0x58, 0x38, 0x72, 0x92, 0x92,
+    0xC7, 0x47, 0x42, 0x92, 0x92, 0x92, 0x13, 0x57, 0x42, 0x33, 0x92, 0x92,  // 5
+    0x32, 0x42, 0x33, 0x23, 0x46, 0x64,
+    0xE4, 0x66, 0x52, 0x23, 0x32, 0x42, 0x32, 0x92, 0x13, 0x57, 0x43, 0x23,  // 6
+    0x32, 0x42, 0x32, 0x42, 0x32, 0x42, 0x42, 0x23, 0x46, 0x64,
+    0xC8, 0x38, 0x92, 0x82, 0x92, 0x82, 0x92, 0x82, 0x92, 0x92, 0x91, 0x92,  // 7
+    0x92, 0x92,
+    0xE4, 0x66, 0x42, 0x33, 0x32, 0x42, 0x32, 0x42, 0x41, 0x41, 0x64, 0x66,  // 8
+    0x42, 0x42, 0x32, 0x42, 0x32, 0x42, 0x32, 0x42, 0x46, 0x64,
+    0xE4, 0x66, 0x43, 0x22, 0x42, 0x42, 0x32, 0x42, 0x32, 0x42, 0x33, 0x23,  // 9
+    0x47, 0x53, 0x12, 0x92, 0x32, 0x42, 0x33, 0x22, 0x56, 0x64,
+    0xF0, 0xF0, 0xF0, 0xE2, 0x92, 0xF0, 0xF0, 0xF0, 0xF0, 0xF2, 0x92,        // :
+    0xF0, 0xF0, 0xF0, 0xF0, 0xA2, 0x92, 0xF0, 0xF0, 0xF0, 0xF0, 0x42, 0x92,  // ;
+    0xA1, 0xA1, 0x91,
+    0xF0, 0xF0, 0xF0, 0x71, 0x83, 0x63, 0x63, 0x72, 0xA3, 0xA3, 0xA3, 0xA1,  // <
+    0xF0, 0xF0, 0xF0, 0xB8, 0x38, 0xF0, 0xA8, 0x38,                          // =
+    0xF0, 0xF0, 0xF1, 0xA3, 0xA3, 0xA3, 0xA2, 0x73, 0x63, 0x63, 0x81,        // >
+    0xE5, 0x57, 0x33, 0x33, 0x22, 0x52, 0x92, 0x83, 0x73, 0x73, 0x73, 0x82,  // ?
+    0x92, 0xF0, 0x52, 0x92,
+    0xE4, 0x66, 0x52, 0x32, 0x33, 0x32, 0x32, 0x33, 0x32, 0x15, 0x32, 0x12,  // @
+    0x12, 0x32, 0x12, 0x12, 0x32, 0x15, 0x32, 0x24, 0x32, 0xA2, 0x21, 0x65,
+    0x73,
+    0xF3, 0x83, 0x72, 0x12, 0x62, 0x12, 0x62, 0x12, 0x62, 0x12, 0x52, 0x32,  // A
+    0x42, 0x32, 0x47, 0x47, 0x42, 0x32, 0x32, 0x52, 0x22, 0x52, 0x22, 0x52,
+    0xC5, 0x66, 0x52, 0x32, 0x42, 0x32, 0x42, 0x32, 0x42, 0x32, 0x46, 0x56,  // B
+    0x52, 0x32, 0x42, 0x42, 0x32, 0x42, 0x32, 0x33, 0x37, 0x46,
+    0xE4, 0x66, 0x52, 0x32, 0x32, 0x42, 0x32, 0x92, 0x92, 0x92, 0x92, 0x92,  // C
+    0x92, 0x42, 0x42, 0x32, 0x46, 0x64,
+    0xC5, 0x67, 0x42, 0x32, 0x42, 0x33, 0x32, 0x42, 0x32, 0x42, 0x32, 0x42,  // D
+    0x32, 0x42, 0x32, 0x42, 0x32, 0x42, 0x32, 0x32, 0x42, 0x32, 0x46, 0x55,
+    0xC8, 0x38, 0x32, 0x92, 0x92, 0x92, 0x97, 0x47, 0x42, 0x92, 0x92, 0x92,  // E
+    0x98, 0x38,
+    0xC8, 0x38, 0x32, 0x92, 0x92, 0x92, 0x97, 0x47, 0x42, 0x92, 0x92, 0x92,  // F
+    0x92, 0x92,
+    0xE4, 0x66, 0x52, 0x32, 0x32, 0x42, 0x32, 0x92, 0x92, 0x92, 0x33, 0x32,  // G
+    0x33, 0x32, 0x42, 0x32, 0x42, 0x42, 0x32, 0x47, 0x54,
+    0xC2, 0x42, 0x32, 0x42, 0x32, 0x42, 0x32, 0x42, 0x32, 0x42, 0x32, 0x42,  // H
+    0x38, 0x38, 0x32, 0x42, 0x32, 0x42, 0x32, 0x42, 0x32, 0x42, 0x32, 0x42,
+    0x32, 0x42,
+    0xD6, 0x56, 0x72, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,  // I
+    0x76, 0x56,
+    0xF0, 0x32, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x32, 0x42,  // J
+    0x32, 0x42, 0x33, 0x23, 0x46, 0x64,
+    0xC2, 0x52, 0x22, 0x42, 0x32, 0x32, 0x42, 0x22, 0x52, 0x22, 0x52, 0x12,  // K
+    0x64, 0x75, 0x62, 0x22, 0x52, 0x22, 0x52, 0x32, 0x42, 0x42, 0x32, 0x42,
+    0x32, 0x52,
+    0xC2, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,  // L
+    0x98, 0x38,
+    0xC3, 0x33, 0x23, 0x33, 0x24, 0x14, 0x24, 0x11, 0x12, 0x22, 0x11, 0x11,  // M
+    0x12, 0x22, 0x11, 0x11, 0x12, 0x22, 0x13, 0x12, 0x22, 0x21, 0x22, 0x22,
+    0x52, 0x22, 0x52, 0x22, 0x52, 0x22, 0x52, 0x22, 0x52, 0x22, 0x52,
+    0xC3, 0x32, 0x33, 0x32, 0x34, 0x22, 0x34, 0x22, 0x34, 0x22, 0x32, 0x12,  // N
+    0x12, 0x32, 0x12, 0x12, 0x32, 0x12, 0x12, 0x32, 0x21, 0x12, 0x32, 0x24,
+    0x32, 0x24, 0x32, 0x24, 0x32, 0x33, 0x32, 0x33,
+    0xE4, 0x66, 0x52, 0x22, 0x42, 0x42, 0x32, 0x42, 0x32, 0x42, 0x32, 0x42,  // O
+    0x32, 0x42, 0x32, 0x42, 0x32, 0x42, 0x32, 0x42, 0x42, 0x22, 0x56, 0x64,
+    0xC6, 0x57, 0x42, 0x33, 0x32, 0x42, 0x32, 0x42, 0x32, 0x42, 0x32, 0x33,  // P
+    0x37, 0x46, 0x52, 0x92, 0x92, 0x92, 0x92,
+    0xE4, 0x66, 0x52, 0x22, 0x42, 0x42, 0x32, 0x42, 0x32, 0x42, 0x32, 0x42,  // Q
+    0x32, 0x42, 0x32, 0x42, 0x32, 0x21, 0x12, 0x32, 0x24, 0x42, 0x22, 0x57,
+    0x54, 0x21,
+    0xC6, 0x57, 0x42, 0x33, 0x32, 0x42, 0x32, 0x42, 0x32, 0x33, 0x37, 0x46,  // R
+    0x52, 0x22, 0x52, 0x32, 0x42, 0x32, 0x42, 0x42, 0x32, 0x42, 0x32, 0x52,
+    0xF3, 0x75, 0x52, 0x32, 0x42, 0x32, 0x42, 0x93, 0x94, 0x93, 0x93, 0x32,  // S
+    0x42, 0x32, 0x42, 0x42, 0x32, 0x46, 0x64,
+    0xBA, 0x1A, 0x52, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,  // T
+    0x92, 0x92,
+    0xC2, 0x42, 0x32, 0x42, 0x32, 0x42, 0x32, 0x42, 0x32, 0x42, 0x32, 0x42,  // U
+    0x32, 0x42, 0x32, 0x42, 0x32, 0x42, 0x32, 0x42, 0x32, 0x42, 0x33, 0x23,
+    0x46, 0x64,
+    0xC2, 0x52, 0x22, 0x52, 0x22, 0x52, 0x32, 0x32, 0x42, 0x32, 0x42, 0x32,  // V
+    0x52, 0x12, 0x62, 0x12, 0x62, 0x12, 0x62, 0x12, 0x73, 0x83, 0x83, 0x91,
+    0xB2, 0x62, 0x12, 0x62, 0x12, 0x62, 0x12, 0x62, 0x12, 0x62, 0x12, 0x22,  // W
+    0x22, 0x21, 0x22, 0x21, 0x31, 0x22, 0x21, 0x31, 0x14, 0x11, 0x31, 0x11,
+    0x21, 0x11, 0x31, 0x11, 0x21, 0x11, 0x33, 0x23, 0x32, 0x42, 0x32, 0x42,
+    0xB2, 0x62, 0x22, 0x51, 0x32, 0x42, 0x42, 0x22, 0x53, 0x12, 0x64, 0x82,  // X
+    0x92, 0x84, 0x75, 0x53, 0x12, 0x43, 0x32, 0x32, 0x42, 0x22, 0x62,
+    0xB2, 0x62, 0x22, 0x42, 0x32, 0x42, 0x42, 0x22, 0x52, 0x22, 0x64, 0x74,  // Y
+    0x82, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
+    0xD7, 0x47, 0x92, 0x82, 0x92, 0x82, 0x82, 0x92, 0x82, 0x92, 0x82, 0x82,  // Z
+    0x98, 0x38,
+    0x44, 0x74, 0x72, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,  // [
+    0x92, 0x92, 0x92, 0x92, 0x94, 0x74,
+    0xE2, 0x92, 0x92, 0xA2, 0x92, 0x92, 0x92, 0xA2, 0x92, 0x92, 0x92, 0xA2,  /* \ */
+    0x92, 0x92,
+    0x34, 0x74, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,  // ]
+    0x92, 0x92, 0x92, 0x92, 0x74, 0x74,
+    0xF2, 0x92, 0x84, 0x71, 0x21, 0x62, 0x22, 0x52, 0x22, 0x42, 0x42, 0x32,  // ^
+    0x42,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xBB,  // _
+    0xD3, 0x92, 0xA2,                                                        // `
+    0xF0, 0xF0, 0xF0, 0xD5, 0x57, 0x32, 0x42, 0x92, 0x56, 0x47, 0x32, 0x42,  // a
+    0x32, 0x33, 0x38, 0x43, 0x32,
+    0xC2, 0x92, 0x92, 0x92, 0x92, 0x13, 0x57, 0x43, 0x23, 0x32, 0x42, 0x32,  // b
+    0x42, 0x32, 0x42, 0x32, 0x42, 0x33, 0x23, 0x37, 0x42, 0x13,
+    0xF0, 0xF0, 0xF0, 0xD4, 0x66, 0x43, 0x23, 0x32, 0x42, 0x32, 0x92, 0x92,  // c
+    0x42, 0x33, 0x23, 0x46, 0x64,
+    0xF0, 0x32, 0x92, 0x92, 0x92, 0x53, 0x12, 0x47, 0x33, 0x23, 0x32, 0x42,  // d
+    0x32, 0x42, 0x32, 0x42, 0x32, 0x42, 0x33, 0x23, 0x47, 0x53, 0x12,
+    0xF0, 0xF0, 0xF0, 0xD4, 0x66, 0x43, 0x22, 0x42, 0x42, 0x38, 0x38, 0x32,  // e
+    0x93, 0x32, 0x46, 0x64,
+    0xF0, 0x15, 0x56, 0x52, 0x92, 0x68, 0x38, 0x62, 0x92, 0x92, 0x92, 0x92,  // f
+    0x92, 0x92, 0x92,
+    0xF0, 0xF0, 0xF0, 0x23, 0x12, 0x47, 0x33, 0x23, 0x32, 0x42, 0x32, 0x42,  // g
+    0x32, 0x42, 0x32, 0x42, 0x33, 0x23, 0x47, 0x53, 0x12, 0x92, 0x32, 0x33,
+    0x37, 0x55,
+    0xC2, 0x92, 0x92, 0x92, 0x92, 0x14, 0x48, 0x33, 0x32, 0x32, 0x42, 0x32,  // h
+    0x42, 0x32, 0x42, 0x32, 0x42, 0x32, 0x42, 0x32, 0x42, 0x32, 0x42,
+    0xF0, 0x12, 0x92, 0xF0, 0xD5, 0x65, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,  // i
+    0x92, 0x92,
+    0x52, 0x92, 0xF0, 0xD5, 0x65, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,  // j
+    0x92, 0x92, 0x51, 0x32, 0x56, 0x64,
+    0xC2, 0x92, 0x92, 0x92, 0x92, 0x42, 0x32, 0x32, 0x42, 0x22, 0x52, 0x12,  // k
+    0x65, 0x63, 0x12, 0x52, 0x32, 0x42, 0x32, 0x42, 0x42, 0x32, 0x52,
+    0xD5, 0x65, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,  // l
+    0x92, 0x92,
+    0xF0, 0xF0, 0xF0, 0xA2, 0x13, 0x12, 0x2A, 0x12, 0x23, 0x12, 0x12, 0x22,  // m
+    0x22, 0x12, 0x22, 0x22, 0x12, 0x22, 0x22, 0x12, 0x22, 0x22, 0x12, 0x22,
+    0x22, 0x12, 0x22, 0x22, 0x12, 0x22, 0x22,
+    0xF0, 0xF0, 0xF0, 0xB2, 0x14, 0x48, 0x33, 0x32, 0x32, 0x42, 0x32, 0x42,  // n
+    0x32, 0x42, 0x32, 0x42, 0x32, 0x42, 0x32, 0x42, 0x32, 0x42,
+    0xF0, 0xF0, 0xF0, 0xD4, 0x66, 0x43, 0x23, 0x32, 0x42, 0x32, 0x42, 0x32,  // o
+    0x42, 0x32, 0x42, 0x33, 0x23, 0x46, 0x64,
+    0xF0, 0xF0, 0xF2, 0x13, 0x57, 0x43, 0x23, 0x32, 0x42, 0x32, 0x42, 0x32,  // p
+    0x42, 0x32, 0x42, 0x33, 0x23, 0x37, 0x42, 0x13, 0x52, 0x92, 0x92, 0x92,
+    0xF0, 0xF0, 0xF0, 0x23, 0x12, 0x47, 0x33, 0x23, 0x32, 0x42, 0x32, 0x42,  // q
+    0x32, 0x42, 0x32, 0x42, 0x33, 0x23, 0x47, 0x53, 0x12, 0x92, 0x92, 0x92,
+    0x92,
+    0xF0, 0xF0, 0xF0, 0xB2, 0x23, 0x57, 0x43, 0x21, 0x52, 0x92, 0x92, 0x92,  // r
+    0x92, 0x92, 0x92,
+    0xF0, 0xF0, 0xF0, 0xD4, 0x67, 0x32, 0x42, 0x32, 0x97, 0x57, 0x92, 0x32,  // s
+    0x42, 0x37, 0x64,
+    0xF0, 0xB1, 0x92, 0x92, 0x77, 0x47, 0x62, 0x92, 0x92, 0x92, 0x92, 0x92,  // t
+    0x96, 0x65,
+    0xF0, 0xF0, 0xF0, 0xB2, 0x42, 0x32, 0x42, 0x32, 0x42, 0x32, 0x42, 0x32,  // u
+    0x42, 0x32, 0x42, 0x32, 0x42, 0x32, 0x33, 0x38, 0x44, 0x12,
+    0xF0, 0xF0, 0xF0, 0xB2, 0x52, 0x32, 0x32, 0x42, 0x32, 0x42, 0x32, 0x52,  // v
+    0x12, 0x62, 0x12, 0x62, 0x12, 0x73, 0x83, 0x92,
+    0xF0, 0xF0, 0xF0, 0xA2, 0x13, 0x12, 0x22, 0x13, 0x12, 0x22, 0x13, 0x12,  // w
+    0x31, 0x11, 0x11, 0x11, 0x41, 0x11, 0x11, 0x11, 0x41, 0x11, 0x11, 0x11,
+    0x43, 0x13, 0x43, 0x13, 0x51, 0x31, 0x61, 0x31,
+    0xF0, 0xF0, 0xF0, 0xB2, 0x42, 0x42, 0x22, 0x52, 0x22, 0x64, 0x82, 0x92,  // x
+    0x84, 0x62, 0x22, 0x52, 0x22, 0x42, 0x42,
+    0xF0, 0xF0, 0xF2, 0x42, 0x32, 0x42, 0x42, 0x32, 0x42, 0x22, 0x52, 0x22,  // y
+    0x62, 0x12, 0x62, 0x12, 0x62, 0x12, 0x73, 0x83, 0x83, 0x73, 0x65, 0x63,
+    0xF0, 0xF0, 0xF0, 0xB9, 0x29, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x89,  // z
+    0x29,
+    0x63, 0x74, 0x72, 0x92, 0x92, 0x92, 0x92, 0x83, 0x73, 0x83, 0x93, 0x92,  // {
+    0x92, 0x92, 0x92, 0x92, 0x94, 0x83,
+    0x52, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,  // |
+    0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
+    0x23, 0x84, 0x92, 0x92, 0x92, 0x92, 0x92, 0x93, 0x93, 0x83, 0x73, 0x82,  // }
+    0x92, 0x92, 0x92, 0x92, 0x74, 0x73,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x43, 0x31, 0x38, 0x31, 0x33,              // ~
+};
+
+static const uint16_t Index_11x18[FONT_GLYPHS + 1] = {
+      0,   0,  14,  24,  48,  76, 106, 131, 136, 154, 172, 180,
+    192, 206, 214, 225, 240, 266, 283, 300, 318, 337, 355, 377,
+    391, 413, 435, 446, 461, 473, 481, 492, 508, 533, 557, 579,
+    597, 621, 635, 649, 670, 696, 710, 728, 754, 768, 803, 835,
+    859, 878, 904, 928, 947, 961, 987,1011,1047,1070,1089,1103,
+   1121,1135,1153,1166,1178,1181,1198,1220,1237,1260,1276,1291,
+   1317,1340,1354,1372,1395,1409,1440,1462,1481,1505,1530,1545,
+   1560,1574,1596,1616,1648,1667,1691,1704,1722,1740,1758,1768,
+};
+
+const FontDef Font_11x18 = {11, 18, Index_11x18, Spans_11x18, nullptr};
+
+// ── Font_16x26 ──────────────────────────────────────────────────────────
+
+static const uint8_t Spans_16x26[] = {
+    // sp (no ink)
+    0x65, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB4, 0xC4, 0xD3, 0xD3,  // !
+    0xD3, 0xD3, 0xD3, 0xF0, 0xF0, 0xF0, 0xF5, 0xB5, 0xB5,
+    0x34, 0x34, 0x54, 0x34, 0x54, 0x34, 0x54, 0x34, 0x54, 0x34, 0x54, 0x34,  // "
+    0x54, 0x34,
+    0x73, 0x23, 0x74, 0x23, 0x74, 0x14, 0x73, 0x24, 0x73, 0x23, 0x74, 0x23,  // #
+    0x4E, 0x1F, 0x53, 0x23, 0x74, 0x23, 0x74, 0x14, 0x74, 0x14, 0x73, 0x24,
+    0x3F, 0x0F, 0x02, 0x34, 0x14, 0x73, 0x24, 0x73, 0x23, 0x74, 0x23, 0x74,
+    0x14, 0x73, 0x24,
+    0x68, 0x6B, 0x48, 0x13, 0x44, 0x13, 0x84, 0x13, 0x84, 0x13, 0x84, 0x13,  // $
+    0x88, 0x97, 0xA6, 0xB6, 0xB7, 0x98, 0x88, 0x88, 0x88, 0x88, 0x88, 0x34,
+    0x18, 0x3C, 0x68, 0xB4, 0xC4,
+    0x25, 0x76, 0x13, 0x56, 0x24, 0x37, 0x24, 0x33, 0x13, 0x33, 0x24, 0x13,  // %
+    0x33, 0x14, 0x23, 0x24, 0x13, 0x33, 0x28, 0x34, 0x17, 0x69, 0xC3, 0xCA,
+    0x5B, 0x57, 0x22, 0x48, 0x22, 0x34, 0x14, 0x22, 0x24, 0x24, 0x22, 0x23,
+    0x34, 0x22, 0x14, 0x34, 0x26, 0x5A, 0x76,
+    0x56, 0x99, 0x74, 0x14, 0x65, 0x14, 0x65, 0x14, 0x65, 0x14, 0x74, 0x14,  // &
+    0x78, 0x87, 0x86, 0x89, 0x47, 0x14, 0x46, 0x25, 0x27, 0x35, 0x17, 0x44,
+    0x17, 0x4C, 0x5C, 0x55, 0x25, 0x37, 0x2E, 0x38, 0x14,
+    0x65, 0xB5, 0xB5, 0xB5, 0xB5, 0xB4, 0xD3,                                // '
+    0xA6, 0x95, 0x95, 0xB4, 0xB4, 0xB5, 0xB4, 0xC4, 0xB5, 0xB4, 0xC4, 0xC4,  // (
+    0xC4, 0xC4, 0xC4, 0xC5, 0xC4, 0xC4, 0xC5, 0xC4, 0xD4, 0xC5, 0xD5, 0xC6,
+    0xC4,
+    0x16, 0xC5, 0xD5, 0xC4, 0xD4, 0xC5, 0xC4, 0xC4, 0xC5, 0xC4, 0xC4, 0xC4,  // )
+    0xC4, 0xC4, 0xC4, 0xB5, 0xB4, 0xC4, 0xB5, 0xB4, 0xB4, 0xB5, 0x95, 0x96,
+    0xA4,
+    0x65, 0xB4, 0xD3, 0x83, 0x23, 0x23, 0x3E, 0x26, 0x17, 0x62, 0x21, 0xB2,  // *
+    0x13, 0x98, 0x74, 0x14, 0x65, 0x24, 0x72, 0x33,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3,  // +
+    0xD3, 0x6F, 0x0F, 0x02, 0x73, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,  // ,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x85, 0xB5, 0xB5, 0xB5, 0xC4, 0xC4,
+    0xC4, 0xC3, 0xC3,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xDD,  // -
+    0x3D,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,  // .
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x85, 0xB5, 0xB5, 0xB5,
+    0xC4, 0xC4, 0xB4, 0xC4, 0xB4, 0xC4, 0xB4, 0xC4, 0xB4, 0xC4, 0xB4, 0xC4,  // /
+    0xB4, 0xC4, 0xB4, 0xC4, 0xB4, 0xC4, 0xB4, 0xC4, 0xB4, 0xC4, 0xB4, 0xC4,
+    0xB4,
+    0x57, 0x89, 0x65, 0x15, 0x45, 0x35, 0x34, 0x54, 0x25, 0x55, 0x15, 0x55,  // 0
+    0x14, 0x74, 0x14, 0x74, 0x14, 0x74, 0x14, 0x74, 0x14, 0x74, 0x14, 0x74,
+    0x14, 0x74, 0x15, 0x55, 0x15, 0x55, 0x24, 0x54, 0x35, 0x35, 0x45, 0x15,
+    0x69, 0x87,
+    0x84, 0x97, 0x6A, 0x6A, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5,  // 1
+    0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0x6E, 0x2E,
+    0x47, 0x7B, 0x54, 0x35, 0xC4, 0xC5, 0xB5, 0xB5, 0xB4, 0xC4, 0xB5, 0xA5,  // 2
+    0xA5, 0xA5, 0xA5, 0xB4, 0xB4, 0xB4, 0xB5, 0xB4, 0xCD, 0x3D,
+    0x48, 0x7A, 0x63, 0x35, 0xC5, 0xB5, 0xB5, 0xB4, 0xC4, 0xA5, 0x78, 0x89,  // 3
+    0xC5, 0xC5, 0xC4, 0xC4, 0xC4, 0xC4, 0xB5, 0x43, 0x35, 0x5A, 0x68,
+    0x94, 0xB5, 0xB5, 0xA6, 0x97, 0x88, 0x88, 0x74, 0x14, 0x64, 0x24, 0x64,  // 4
+    0x24, 0x54, 0x34, 0x44, 0x44, 0x44, 0x44, 0x3F, 0x0F, 0x02, 0x94, 0xC4,
+    0xC4, 0xC4, 0xC4, 0xC4,
+    0x3B, 0x5B, 0x5B, 0x54, 0xC4, 0xC4, 0xC4, 0xC4, 0xC8, 0x8A, 0xB6, 0xB5,  // 5
+    0xC5, 0xB5, 0xC4, 0xB5, 0xB5, 0xB4, 0x53, 0x35, 0x5A, 0x68,
+    0x77, 0x7A, 0x55, 0x33, 0x45, 0xB4, 0xB5, 0xB4, 0xC4, 0xC4, 0x16, 0x5C,  // 6
+    0x37, 0x25, 0x26, 0x45, 0x24, 0x64, 0x24, 0x64, 0x24, 0x64, 0x24, 0x64,
+    0x25, 0x54, 0x34, 0x45, 0x35, 0x25, 0x5A, 0x86,
+    0x2E, 0x2E, 0x2E, 0xC4, 0xB4, 0xC4, 0xB4, 0xC3, 0xC4, 0xB4, 0xC4, 0xB4,  // 7
+    0xC4, 0xB4, 0xC4, 0xB4, 0xB5, 0xB5, 0xB4, 0xB5, 0xB5,
+    0x58, 0x7A, 0x55, 0x25, 0x44, 0x44, 0x35, 0x44, 0x35, 0x44, 0x44, 0x44,  // 8
+    0x45, 0x24, 0x69, 0x87, 0x89, 0x64, 0x16, 0x45, 0x35, 0x34, 0x55, 0x15,
+    0x55, 0x15, 0x64, 0x15, 0x64, 0x24, 0x55, 0x26, 0x25, 0x4B, 0x77,
+    0x57, 0x89, 0x64, 0x25, 0x44, 0x45, 0x34, 0x54, 0x25, 0x55, 0x15, 0x55,  // 9
+    0x15, 0x55, 0x15, 0x55, 0x24, 0x55, 0x25, 0x36, 0x3D, 0x56, 0x14, 0xB5,
+    0xB4, 0xC4, 0xB5, 0xB4, 0x43, 0x35, 0x5A, 0x78,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xC5, 0xB5, 0xB5, 0xB5, 0xF0, 0xF0,  // :
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x35, 0xB5, 0xB5, 0xB5,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xC5, 0xB5, 0xB5, 0xB5, 0xF0, 0xF0,  // ;
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x35, 0xB5, 0xB5, 0xB5, 0xC4, 0xC4,
+    0xC4, 0xB4, 0xC3,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x52, 0xC4, 0xA6, 0x86, 0x86,  // <
+    0x86, 0x86, 0x87, 0xB6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC4, 0xE2,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xAF, 0x0F,  // =
+    0x02, 0xF0, 0xF0, 0xF0, 0x3F, 0x0F, 0x02,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x63, 0xD5, 0xC6, 0xC6, 0xC6, 0xC6,  // >
+    0xC6, 0xC5, 0x96, 0x86, 0x86, 0x86, 0x86, 0x95, 0xB3,
+    0x39, 0x6C, 0x43, 0x55, 0x33, 0x65, 0x23, 0x65, 0xB4, 0xC4, 0xB4, 0xB4,  // ?
+    0xB4, 0xB4, 0xB4, 0xC4, 0xB5, 0xB5, 0xF0, 0xF0, 0xF0, 0xE5, 0xB5, 0xB5,
+    0x67, 0x7B, 0x45, 0x34, 0x35, 0x54, 0x24, 0x37, 0x14, 0x38, 0x14, 0x24,  // @
+    0x14, 0x13, 0x24, 0x37, 0x24, 0x37, 0x23, 0x38, 0x23, 0x38, 0x23, 0x38,
+    0x23, 0x29, 0x23, 0x25, 0x13, 0x2A, 0x14, 0x1A, 0x14, 0x25, 0x13, 0x24,
+    0xD5, 0x33, 0x6A, 0x87,
+    0xF0, 0xF0, 0xF0, 0x95, 0xB5, 0xA7, 0x97, 0x97, 0x84, 0x14, 0x74, 0x14,  // A
+    0x73, 0x25, 0x54, 0x34, 0x54, 0x34, 0x44, 0x45, 0x3D, 0x3E, 0x14, 0x65,
+    0x14, 0x78, 0x88, 0x97, 0x93,
+    0xF0, 0xF0, 0xF0, 0x5B, 0x5C, 0x44, 0x45, 0x34, 0x54, 0x34, 0x54, 0x34,  // B
+    0x54, 0x34, 0x45, 0x34, 0x35, 0x4A, 0x6B, 0x54, 0x36, 0x34, 0x55, 0x24,
+    0x55, 0x24, 0x64, 0x24, 0x64, 0x24, 0x55, 0x2D, 0x3B,
+    0xF0, 0xF0, 0xF0, 0xA9, 0x5B, 0x36, 0x43, 0x25, 0xB4, 0xB5, 0xB4, 0xC4,  // C
+    0xC4, 0xC4, 0xC4, 0xC5, 0xB5, 0xC5, 0xB6, 0xB6, 0x52, 0x5B, 0x79,
+    0xF0, 0xF0, 0xF0, 0x4B, 0x5D, 0x34, 0x46, 0x24, 0x65, 0x14, 0x65, 0x14,  // D
+    0x74, 0x14, 0x74, 0x14, 0x74, 0x14, 0x74, 0x14, 0x74, 0x14, 0x74, 0x14,
+    0x74, 0x14, 0x74, 0x14, 0x65, 0x14, 0x64, 0x24, 0x46, 0x2C, 0x4A,
+    0xF0, 0xF0, 0xF0, 0x5E, 0x2E, 0x25, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xBD,  // E
+    0x3D, 0x35, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xBE, 0x2E,
+    0xF0, 0xF0, 0xF0, 0x6D, 0x3D, 0x34, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xCD,  // F
+    0x3D, 0x34, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+    0xF0, 0xF0, 0xF0, 0x99, 0x5C, 0x36, 0x43, 0x25, 0xA5, 0xB5, 0xB4, 0xB5,  // G
+    0xB5, 0xB5, 0x4C, 0x47, 0x14, 0x74, 0x15, 0x64, 0x15, 0x64, 0x25, 0x54,
+    0x36, 0x34, 0x4C, 0x69,
+    0xF0, 0xF0, 0xF0, 0x45, 0x55, 0x15, 0x55, 0x15, 0x55, 0x15, 0x55, 0x15,  // H
+    0x55, 0x15, 0x55, 0x15, 0x55, 0x15, 0x55, 0x1F, 0x1F, 0x15, 0x55, 0x15,
+    0x55, 0x15, 0x55, 0x15, 0x55, 0x15, 0x55, 0x15, 0x55, 0x15, 0x55, 0x15,
+    0x55,
+    0xF0, 0xF0, 0xF0, 0x5E, 0x2E, 0x65, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5,  // I
+    0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0x7E, 0x2E,
+    0xF0, 0xF0, 0xF0, 0x6B, 0x5B, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5,  // J
+    0xB5, 0xB5, 0xB5, 0xB5, 0xB4, 0xC4, 0x53, 0x35, 0x5A, 0x68,
+    0xF0, 0xF0, 0xF0, 0x54, 0x55, 0x24, 0x54, 0x34, 0x44, 0x44, 0x34, 0x54,  // K
+    0x24, 0x64, 0x14, 0x79, 0x78, 0x87, 0x98, 0x89, 0x74, 0x15, 0x64, 0x24,
+    0x64, 0x34, 0x54, 0x35, 0x44, 0x45, 0x34, 0x55, 0x24, 0x64,
+    0xF0, 0xF0, 0xF0, 0x55, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5,  // L
+    0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xBE, 0x2E,
+    0xF0, 0xF0, 0xF0, 0x35, 0x6B, 0x5B, 0x5C, 0x3D, 0x3D, 0x3E, 0x1F, 0x13,  // M
+    0x1B, 0x13, 0x17, 0x17, 0x17, 0x16, 0x27, 0x25, 0x27, 0x25, 0x27, 0x24,
+    0x37, 0x97, 0x97, 0x97, 0x93,
+    0xF0, 0xF0, 0xF0, 0x45, 0x64, 0x15, 0x64, 0x16, 0x54, 0x17, 0x44, 0x17,  // N
+    0x44, 0x18, 0x34, 0x18, 0x34, 0x19, 0x24, 0x14, 0x15, 0x14, 0x14, 0x24,
+    0x14, 0x14, 0x29, 0x14, 0x38, 0x14, 0x38, 0x14, 0x47, 0x14, 0x56, 0x14,
+    0x56, 0x14, 0x65, 0x14, 0x65,
+    0xF0, 0xF0, 0xF0, 0x87, 0x7B, 0x45, 0x35, 0x25, 0x55, 0x14, 0x74, 0x14,  // O
+    0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x74, 0x14, 0x74, 0x14, 0x74, 0x15,
+    0x55, 0x25, 0x35, 0x4B, 0x77,
+    0xF0, 0xF0, 0xF0, 0x5C, 0x4E, 0x25, 0x45, 0x25, 0x54, 0x25, 0x54, 0x25,  // P
+    0x54, 0x25, 0x54, 0x25, 0x45, 0x25, 0x36, 0x2C, 0x4A, 0x65, 0xB5, 0xB5,
+    0xB5, 0xB5, 0xB5, 0xB5,
+    0xF0, 0xF0, 0xF0, 0x87, 0x7B, 0x45, 0x35, 0x25, 0x55, 0x14, 0x74, 0x14,  // Q
+    0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x74, 0x14, 0x74, 0x14, 0x74, 0x15,
+    0x55, 0x25, 0x35, 0x4B, 0x78, 0xC5, 0xC6, 0xC4, 0xE2,
+    0xF0, 0xF0, 0xF0, 0x5A, 0x6C, 0x44, 0x36, 0x34, 0x45, 0x34, 0x54, 0x34,  // R
+    0x54, 0x34, 0x45, 0x34, 0x44, 0x44, 0x26, 0x4A, 0x69, 0x74, 0x15, 0x64,
+    0x25, 0x54, 0x35, 0x44, 0x45, 0x34, 0x54, 0x34, 0x55, 0x24, 0x64,
+    0xF0, 0xF0, 0xF0, 0x89, 0x5C, 0x35, 0x53, 0x34, 0xC4, 0xC4, 0xC5, 0xC7,  // S
+    0xA9, 0x99, 0xA7, 0xB5, 0xC4, 0xC4, 0x21, 0x85, 0x24, 0x45, 0x3C, 0x59,
+    0xF0, 0xF0, 0xF0, 0x3F, 0x0F, 0x02, 0x65, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5,  // T
+    0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5,
+    0xF0, 0xF0, 0xF0, 0x45, 0x64, 0x15, 0x64, 0x15, 0x64, 0x15, 0x64, 0x15,  // U
+    0x64, 0x15, 0x64, 0x15, 0x64, 0x15, 0x64, 0x15, 0x64, 0x15, 0x64, 0x15,
+    0x64, 0x15, 0x64, 0x15, 0x64, 0x24, 0x54, 0x34, 0x54, 0x35, 0x35, 0x4B,
+    0x77,
+    0xF0, 0xF0, 0xF0, 0x34, 0x97, 0x98, 0x83, 0x14, 0x74, 0x15, 0x64, 0x24,  // V
+    0x54, 0x34, 0x54, 0x35, 0x44, 0x44, 0x34, 0x55, 0x24, 0x55, 0x14, 0x74,
+    0x14, 0x79, 0x87, 0x97, 0x97, 0xA5, 0xB5,
+    0xF0, 0xF0, 0xF0, 0x33, 0xB6, 0xA6, 0xA6, 0x97, 0x25, 0x27, 0x25, 0x27,  // W
+    0x25, 0x23, 0x13, 0x25, 0x23, 0x14, 0x16, 0x13, 0x1B, 0x13, 0x1F, 0x17,
+    0x17, 0x17, 0x17, 0x17, 0x16, 0x36, 0x16, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x35,
+    0xF0, 0xF0, 0xF0, 0x35, 0x83, 0x15, 0x64, 0x25, 0x44, 0x35, 0x35, 0x45,  // X
+    0x24, 0x69, 0x87, 0x96, 0xB5, 0xB5, 0xA7, 0x89, 0x74, 0x15, 0x54, 0x25,
+    0x44, 0x45, 0x24, 0x65, 0x14, 0x78, 0x84,
+    0xF0, 0xF0, 0xF0, 0x35, 0x83, 0x14, 0x83, 0x15, 0x64, 0x24, 0x54, 0x35,  // Y
+    0x44, 0x45, 0x24, 0x64, 0x14, 0x79, 0x87, 0xA5, 0xB5, 0xB5, 0xB5, 0xB5,
+    0xB5, 0xB5, 0xB5, 0xB5,
+    0xF0, 0xF0, 0xF0, 0x4F, 0x1F, 0xC4, 0xB5, 0xA5, 0xA5, 0xA5, 0xB4, 0xB4,  // Z
+    0xB5, 0xA5, 0xA5, 0xB4, 0xB4, 0xB5, 0xA5, 0xBF, 0x1F,
+    0x5B, 0x54, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,  // [
+    0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xCB,
+    0x5B,
+    0x14, 0xC4, 0xD4, 0xC4, 0xD4, 0xC4, 0xD4, 0xC4, 0xD4, 0xC4, 0xD4, 0xC4,  /* \ */
+    0xD4, 0xC4, 0xD4, 0xC4, 0xD4, 0xC4, 0xD4, 0xC4, 0xD4, 0xC4, 0xD4, 0xC4,
+    0xD3,
+    0x1B, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,  // ]
+    0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0x5B,
+    0x5B,
+    0x82, 0xD3, 0xD3, 0xC5, 0xB5, 0xA7, 0x97, 0x93, 0x14, 0x74, 0x14, 0x74,  // ^
+    0x23, 0x64, 0x34, 0x54, 0x34, 0x44, 0x54, 0x34, 0x54, 0x33, 0x74, 0x14,
+    0x74, 0x14, 0x83,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,  // _
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x6F, 0x0F,
+    0x02,
+    0x84,                                                                    // `
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xA9, 0x5C, 0x44, 0x35, 0xC5, 0xB5,  // a
+    0xB5, 0x6A, 0x4C, 0x35, 0x35, 0x25, 0x45, 0x24, 0x55, 0x25, 0x45, 0x25,
+    0x36, 0x3E, 0x37, 0x24,
+    0x24, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0x16, 0x5D, 0x36, 0x25, 0x35,  // b
+    0x45, 0x24, 0x64, 0x24, 0x64, 0x24, 0x64, 0x24, 0x64, 0x24, 0x64, 0x24,
+    0x64, 0x24, 0x55, 0x24, 0x54, 0x36, 0x25, 0x3C, 0x43, 0x16,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xC9, 0x5C, 0x36, 0x43, 0x25, 0xB5,  // c
+    0xB4, 0xB5, 0xB5, 0xB5, 0xC4, 0xC5, 0xB5, 0xC6, 0x43, 0x4C, 0x69,
+    0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0x5B, 0x3D, 0x25, 0x36, 0x24, 0x55,  // d
+    0x15, 0x55, 0x15, 0x55, 0x15, 0x55, 0x14, 0x65, 0x14, 0x65, 0x15, 0x55,
+    0x15, 0x55, 0x24, 0x46, 0x25, 0x27, 0x3D, 0x46, 0x15,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xC7, 0x7A, 0x55, 0x25, 0x35, 0x44,  // e
+    0x34, 0x55, 0x15, 0x55, 0x1F, 0x1F, 0x15, 0xB5, 0xC4, 0xC5, 0xC5, 0x53,
+    0x4C, 0x69,
+    0x79, 0x65, 0x41, 0x64, 0xB5, 0xB5, 0xB5, 0x7F, 0x1F, 0x55, 0xB5, 0xB5,  // f
+    0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xB6, 0x14, 0x3D, 0x25, 0x27, 0x24,  // g
+    0x55, 0x15, 0x55, 0x15, 0x55, 0x14, 0x65, 0x14, 0x65, 0x14, 0x65, 0x15,
+    0x55, 0x15, 0x55, 0x24, 0x46, 0x25, 0x27, 0x3D, 0x46, 0x15, 0xB4, 0xC4,
+    0xC4, 0x33, 0x45, 0x4B,
+    0x24, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0x17, 0x4D, 0x37, 0x24, 0x36,  // h
+    0x35, 0x25, 0x45, 0x24, 0x55, 0x24, 0x55, 0x24, 0x55, 0x24, 0x55, 0x24,
+    0x55, 0x24, 0x55, 0x24, 0x55, 0x24, 0x55, 0x24, 0x55, 0x24, 0x55,
+    0x75, 0xB5, 0xF0, 0xF0, 0xF0, 0xF0, 0x9A, 0x6A, 0xC4, 0xC4, 0xC4, 0xC4,  // i
+    0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+    0x85, 0xB5, 0xF0, 0xF0, 0xF0, 0xF0, 0x9B, 0x5B, 0xB5, 0xB5, 0xB5, 0xB5,  // j
+    0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB4,
+    0x53, 0x35, 0x5A,
+    0x24, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0x55, 0x24, 0x45, 0x34, 0x35,  // k
+    0x44, 0x25, 0x54, 0x15, 0x64, 0x14, 0x78, 0x88, 0x89, 0x74, 0x15, 0x64,
+    0x25, 0x54, 0x35, 0x44, 0x45, 0x34, 0x55, 0x24, 0x55,
+    0x1B, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5,  // l
+    0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x64, 0x14, 0x24, 0x1F, 0x0F, 0x0F,  // m
+    0x08, 0x15, 0x28, 0x24, 0x27, 0x33, 0x37, 0x33, 0x37, 0x33, 0x37, 0x33,
+    0x37, 0x33, 0x37, 0x33, 0x37, 0x33, 0x37, 0x33, 0x37, 0x33, 0x33,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x84, 0x17, 0x4D, 0x37, 0x24, 0x36,  // n
+    0x35, 0x25, 0x45, 0x24, 0x55, 0x24, 0x55, 0x24, 0x55, 0x24, 0x55, 0x24,
+    0x55, 0x24, 0x55, 0x24, 0x55, 0x24, 0x55, 0x24, 0x55, 0x24, 0x55,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xB7, 0x7B, 0x45, 0x35, 0x34, 0x55,  // o
+    0x15, 0x55, 0x14, 0x74, 0x14, 0x74, 0x14, 0x74, 0x14, 0x74, 0x14, 0x74,
+    0x15, 0x55, 0x24, 0x55, 0x25, 0x35, 0x4B, 0x77,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x84, 0x16, 0x5D, 0x36, 0x25, 0x35,  // p
+    0x45, 0x24, 0x64, 0x24, 0x64, 0x24, 0x64, 0x24, 0x64, 0x24, 0x64, 0x24,
+    0x64, 0x24, 0x55, 0x25, 0x44, 0x36, 0x25, 0x3C, 0x4B, 0x54, 0xC4, 0xC4,
+    0xC4, 0xC4,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xB6, 0x13, 0x4C, 0x35, 0x26, 0x34,  // q
+    0x54, 0x25, 0x54, 0x24, 0x64, 0x24, 0x64, 0x24, 0x64, 0x24, 0x64, 0x24,
+    0x64, 0x25, 0x54, 0x25, 0x45, 0x35, 0x26, 0x4C, 0x56, 0x14, 0xC4, 0xC4,
+    0xC4, 0xC4, 0xC4,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x95, 0x17, 0x3D, 0x38, 0x23, 0x37,  // r
+    0x33, 0x36, 0x43, 0x35, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5,
+    0xB5,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xB9, 0x5C, 0x44, 0x53, 0x35, 0xB5,  // s
+    0xB6, 0xB8, 0xA9, 0xA7, 0xB5, 0xC4, 0xC4, 0x34, 0x45, 0x3C, 0x59,
+    0xF0, 0xF0, 0xF0, 0x84, 0xC4, 0xC4, 0x8F, 0x1F, 0x54, 0xC4, 0xC4, 0xC4,  // t
+    0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC5, 0xCA, 0x79,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x84, 0x54, 0x34, 0x54, 0x34, 0x54,  // u
+    0x34, 0x54, 0x34, 0x54, 0x34, 0x54, 0x34, 0x54, 0x34, 0x54, 0x34, 0x54,
+    0x34, 0x54, 0x34, 0x45, 0x34, 0x36, 0x35, 0x17, 0x4C, 0x56, 0x14,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x64, 0x93, 0x14, 0x74, 0x14, 0x74,  // v
+    0x24, 0x54, 0x34, 0x54, 0x35, 0x44, 0x44, 0x34, 0x54, 0x34, 0x64, 0x14,
+    0x74, 0x14, 0x78, 0x97, 0x97, 0xA5, 0xB5,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x64, 0xA6, 0x34, 0x36, 0x25, 0x36,  // w
+    0x25, 0x27, 0x26, 0x17, 0x26, 0x13, 0x1B, 0x13, 0x17, 0x13, 0x13, 0x17,
+    0x17, 0x17, 0x17, 0x17, 0x17, 0x25, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x35,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x75, 0x64, 0x25, 0x44, 0x35, 0x34,  // x
+    0x55, 0x24, 0x69, 0x87, 0x97, 0xA5, 0xA7, 0x98, 0x79, 0x64, 0x25, 0x45,
+    0x35, 0x34, 0x55, 0x14, 0x65,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x65, 0x83, 0x14, 0x74, 0x15, 0x64,  // y
+    0x24, 0x54, 0x34, 0x54, 0x44, 0x34, 0x54, 0x34, 0x55, 0x24, 0x64, 0x14,
+    0x79, 0x87, 0x97, 0xA5, 0xB5, 0xB4, 0xC4, 0xC4, 0xB4, 0xB5, 0x87,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x8E, 0x2E, 0xB5, 0xA5, 0xA5, 0xA5,  // z
+    0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xB4, 0xB4, 0xBF, 0x1F,
+    0x78, 0x75, 0xB4, 0xC4, 0xC4, 0xC4, 0xD4, 0xC4, 0xC4, 0xC3, 0xC4, 0x87,  // {
+    0x97, 0xD4, 0xD3, 0xD4, 0xC4, 0xC4, 0xB4, 0xC4, 0xC4, 0xC4, 0xC5, 0xC8,
+    0xA6,
+    0x73, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3,  // |
+    0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3,
+    0xD3,
+    0x28, 0xC5, 0xC4, 0xC4, 0xC4, 0xC4, 0xC3, 0xC4, 0xC4, 0xD3, 0xD4, 0xD7,  // }
+    0x97, 0x84, 0xC3, 0xC4, 0xC4, 0xD3, 0xD4, 0xC4, 0xC4, 0xC4, 0xB5, 0x78,
+    0x86,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xD6,  // ~
+    0x53, 0x19, 0x33, 0x13, 0x25, 0x27, 0x3D, 0x56,
+};
+
+static const uint16_t Index_16x26[FONT_GLYPHS + 1] = {
+      0,   0,  21,  35,  74, 103, 146, 179, 186, 211, 236, 256,
+    278, 305, 318, 340, 365, 403, 424, 446, 469, 497, 519, 551,
+    572, 607, 639, 661, 688, 710, 729, 750, 774, 814, 843, 876,
+    899, 934, 955, 976,1004,1041,1062,1084,1118,1139,1168,1209,
+   1238,1266,1299,1334,1358,1380,1417,1448,1485,1516,1544,1565,
+   1590,1615,1640,1667,1692,1693,1721,1755,1778,1811,1837,1859,
+   1899,1934,1955,1982,2015,2036,2071,2106,2138,2176,2215,2240,
+   2263,2284,2319,2350,2387,2416,2451,2472,2497,2522,2547,2567,
+};
+
+const FontDef Font_16x26 = {16, 26, Index_16x26, Spans_16x26, nullptr};
+
+// ── Font_7x10_Prop ──────────────────────────────────────────────────────
+
+static const uint8_t Spans_7x10_Prop[] = {
+    // sp (no ink)
+    0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x31,                                // !
+    0x01, 0x11, 0x11, 0x11, 0x11, 0x11,                                      // "
+    0x11, 0x21, 0x21, 0x21, 0x15, 0x21, 0x21, 0x11, 0x21, 0x25, 0x11, 0x21,  // #
+    0x21, 0x21,
+    0x13, 0x21, 0x11, 0x11, 0x11, 0x11, 0x43, 0x41, 0x11, 0x11, 0x11, 0x11,  // $
+    0x11, 0x11, 0x11, 0x23, 0x41,
+    0x11, 0x41, 0x11, 0x11, 0x11, 0x12, 0x32, 0x41, 0x11, 0x21, 0x11, 0x11,  // %
+    0x31, 0x11, 0x41,
+    0x21, 0x41, 0x11, 0x31, 0x11, 0x41, 0x42, 0x11, 0x11, 0x21, 0x21, 0x21,  // &
+    0x32, 0x11,
+    0x01, 0x11, 0x11,                                                        // '
+    0x21, 0x21, 0x21, 0x31, 0x31, 0x31, 0x31, 0x31, 0x41, 0x41,              // (
+    0x01, 0x41, 0x41, 0x31, 0x31, 0x31, 0x31, 0x31, 0x21, 0x21,              // )
+    0x11, 0x23, 0x21, 0x21, 0x11,                                            // *
+    0xE1, 0x51, 0x35, 0x31, 0x51,                                            // +
+    0xE1, 0x11, 0x11,                                                        // ,
+    0xF0, 0x53,                                                              // -
+    0xE1,                                                                    // .
+    0x21, 0x31, 0x21, 0x31, 0x31, 0x31, 0x21, 0x31,                          // /
+    0x13, 0x21, 0x31, 0x11, 0x31, 0x11, 0x11, 0x11, 0x11, 0x31, 0x11, 0x31,  // 0
+    0x11, 0x31, 0x23,
+    0x21, 0x22, 0x11, 0x11, 0x31, 0x31, 0x31, 0x31, 0x31,                    // 1
+    0x13, 0x21, 0x31, 0x11, 0x31, 0x51, 0x41, 0x41, 0x41, 0x45,              // 2
+    0x13, 0x21, 0x31, 0x51, 0x32, 0x61, 0x51, 0x11, 0x31, 0x23,              // 3
+    0x31, 0x42, 0x31, 0x11, 0x31, 0x11, 0x21, 0x21, 0x25, 0x41, 0x51,        // 4
+    0x05, 0x11, 0x51, 0x54, 0x61, 0x51, 0x11, 0x31, 0x23,                    // 5
+    0x13, 0x21, 0x31, 0x11, 0x54, 0x21, 0x31, 0x11, 0x31, 0x11, 0x31, 0x23,  // 6
+    0x05, 0x51, 0x41, 0x41, 0x51, 0x41, 0x51, 0x51,                          // 7
+    0x13, 0x21, 0x31, 0x11, 0x31, 0x23, 0x21, 0x31, 0x11, 0x31, 0x11, 0x31,  // 8
+    0x23,
+    0x13, 0x21, 0x31, 0x11, 0x31, 0x11, 0x31, 0x24, 0x51, 0x11, 0x31, 0x23,  // 9
+    0x41, 0x91,                                                              // :
+    0x61, 0x71, 0x11, 0x11,                                                  // ;
+    0xF2, 0x22, 0x31, 0x62, 0x62,                                            // <
+    0xF0, 0x35, 0x75,                                                        // =
+    0xC2, 0x62, 0x61, 0x32, 0x22,                                            // >
+    0x13, 0x21, 0x31, 0x51, 0x41, 0x41, 0x51, 0xB1,                          // ?
+    0x13, 0x21, 0x31, 0x11, 0x22, 0x11, 0x11, 0x11, 0x11, 0x13, 0x11, 0x51,  // @
+    0x63,
+    0x21, 0x41, 0x11, 0x31, 0x11, 0x31, 0x11, 0x31, 0x11, 0x25, 0x11, 0x31,  // A
+    0x11, 0x31,
+    0x04, 0x21, 0x31, 0x11, 0x31, 0x14, 0x21, 0x31, 0x11, 0x31, 0x11, 0x31,  // B
+    0x14,
+    0x13, 0x21, 0x31, 0x11, 0x51, 0x51, 0x51, 0x51, 0x31, 0x23,              // C
+    0x03, 0x31, 0x21, 0x21, 0x31, 0x11, 0x31, 0x11, 0x31, 0x11, 0x31, 0x11,  // D
+    0x21, 0x23,
+    0x05, 0x11, 0x51, 0x55, 0x11, 0x51, 0x51, 0x55,                          // E
+    0x05, 0x11, 0x51, 0x54, 0x21, 0x51, 0x51, 0x51,                          // F
+    0x13, 0x21, 0x31, 0x11, 0x51, 0x51, 0x13, 0x11, 0x31, 0x11, 0x31, 0x23,  // G
+    0x01, 0x31, 0x11, 0x31, 0x11, 0x31, 0x15, 0x11, 0x31, 0x11, 0x31, 0x11,  // H
+    0x31, 0x11, 0x31,
+    0x03, 0x21, 0x31, 0x31, 0x31, 0x31, 0x31, 0x23,                          // I
+    0x41, 0x51, 0x51, 0x51, 0x51, 0x51, 0x11, 0x31, 0x23,                    // J
+    0x01, 0x31, 0x11, 0x21, 0x21, 0x11, 0x32, 0x41, 0x11, 0x31, 0x21, 0x21,  // K
+    0x21, 0x21, 0x31,
+    0x01, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51, 0x55,                          // L
+    0x01, 0x31, 0x12, 0x12, 0x12, 0x12, 0x11, 0x11, 0x11, 0x11, 0x31, 0x11,  // M
+    0x31, 0x11, 0x31, 0x11, 0x31,
+    0x01, 0x31, 0x12, 0x21, 0x12, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,  // N
+    0x11, 0x22, 0x11, 0x22, 0x11, 0x31,
+    0x13, 0x21, 0x31, 0x11, 0x31, 0x11, 0x31, 0x11, 0x31, 0x11, 0x31, 0x11,  // O
+    0x31, 0x23,
+    0x04, 0x21, 0x31, 0x11, 0x31, 0x11, 0x31, 0x14, 0x21, 0x51, 0x51,        // P
+    0x13, 0x21, 0x31, 0x11, 0x31, 0x11, 0x31, 0x11, 0x31, 0x11, 0x31, 0x11,  // Q
+    0x11, 0x11, 0x23, 0x61,
+    0x04, 0x21, 0x31, 0x11, 0x31, 0x11, 0x31, 0x14, 0x21, 0x21, 0x21, 0x21,  // R
+    0x21, 0x31,
+    0x13, 0x21, 0x31, 0x11, 0x62, 0x61, 0x61, 0x11, 0x31, 0x23,              // S
+    0x05, 0x31, 0x51, 0x51, 0x51, 0x51, 0x51, 0x51,                          // T
+    0x01, 0x31, 0x11, 0x31, 0x11, 0x31, 0x11, 0x31, 0x11, 0x31, 0x11, 0x31,  // U
+    0x11, 0x31, 0x23,
+    0x01, 0x31, 0x11, 0x31, 0x11, 0x31, 0x21, 0x11, 0x31, 0x11, 0x31, 0x11,  // V
+    0x41, 0x51,
+    0x01, 0x31, 0x11, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,  // W
+    0x11, 0x12, 0x12, 0x21, 0x11, 0x31, 0x11,
+    0x01, 0x31, 0x21, 0x11, 0x31, 0x11, 0x41, 0x51, 0x41, 0x11, 0x31, 0x11,  // X
+    0x21, 0x31,
+    0x01, 0x31, 0x11, 0x31, 0x21, 0x11, 0x31, 0x11, 0x41, 0x51, 0x51, 0x51,  // Y
+    0x05, 0x51, 0x41, 0x41, 0x51, 0x41, 0x41, 0x55,                          // Z
+    0x02, 0x11, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x22,              // [
+    0x01, 0x31, 0x41, 0x31, 0x31, 0x31, 0x41, 0x31,                          /* \ */
+    0x02, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x12,              // ]
+    0x21, 0x41, 0x11, 0x31, 0x11, 0x21, 0x31,                                // ^
+    0xF0, 0xF0, 0xF0, 0xF0, 0xC7,                                            // _
+    0x01, 0x31,                                                              // `
+    0xD3, 0x21, 0x31, 0x24, 0x11, 0x31, 0x11, 0x22, 0x22, 0x11,              // a
+    0x01, 0x51, 0x51, 0x12, 0x22, 0x21, 0x11, 0x31, 0x11, 0x31, 0x12, 0x21,  // b
+    0x11, 0x12,
+    0xD3, 0x21, 0x31, 0x11, 0x51, 0x51, 0x31, 0x23,                          // c
+    0x41, 0x51, 0x22, 0x11, 0x11, 0x22, 0x11, 0x31, 0x11, 0x31, 0x11, 0x22,  // d
+    0x22, 0x11,
+    0xD3, 0x21, 0x31, 0x15, 0x11, 0x51, 0x31, 0x23,                          // e
+    0x32, 0x31, 0x35, 0x31, 0x51, 0x51, 0x51, 0x51,                          // f
+    0xD2, 0x11, 0x11, 0x22, 0x11, 0x31, 0x11, 0x31, 0x11, 0x22, 0x22, 0x11,  // g
+    0x51, 0x14,
+    0x01, 0x51, 0x51, 0x12, 0x22, 0x21, 0x11, 0x31, 0x11, 0x31, 0x11, 0x31,  // h
+    0x11, 0x31,
+    0x21, 0x53, 0x31, 0x31, 0x31, 0x31, 0x31,                                // i
+    0x31, 0x73, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x13,                    // j
+    0x01, 0x51, 0x51, 0x21, 0x21, 0x11, 0x32, 0x41, 0x11, 0x31, 0x21, 0x21,  // k
+    0x31,
+    0x03, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31,                          // l
+    0xC4, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,  // m
+    0x11, 0x11, 0x11, 0x11,
+    0xC1, 0x12, 0x22, 0x21, 0x11, 0x31, 0x11, 0x31, 0x11, 0x31, 0x11, 0x31,  // n
+    0xD3, 0x21, 0x31, 0x11, 0x31, 0x11, 0x31, 0x11, 0x31, 0x23,              // o
+    0xC1, 0x12, 0x22, 0x21, 0x11, 0x31, 0x11, 0x31, 0x12, 0x21, 0x11, 0x12,  // p
+    0x21, 0x51,
+    0xD2, 0x11, 0x11, 0x22, 0x11, 0x31, 0x11, 0x31, 0x11, 0x22, 0x22, 0x11,  // q
+    0x51, 0x51,
+    0xC1, 0x12, 0x22, 0x21, 0x11, 0x51, 0x51, 0x51,                          // r
+    0xD3, 0x21, 0x31, 0x22, 0x61, 0x21, 0x31, 0x23,                          // s
+    0x11, 0x41, 0x34, 0x21, 0x41, 0x41, 0x41, 0x52,                          // t
+    0xC1, 0x31, 0x11, 0x31, 0x11, 0x31, 0x11, 0x31, 0x11, 0x22, 0x22, 0x11,  // u
+    0xC1, 0x31, 0x11, 0x31, 0x21, 0x11, 0x31, 0x11, 0x31, 0x11, 0x41,        // v
+    0xC1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x12, 0x21,  // w
+    0x11, 0x31, 0x11,
+    0xC1, 0x31, 0x21, 0x11, 0x41, 0x51, 0x41, 0x11, 0x21, 0x31,              // x
+    0xC1, 0x31, 0x11, 0x31, 0x21, 0x11, 0x31, 0x11, 0x41, 0x51, 0x51, 0x32,  // y
+    0xC5, 0x41, 0x41, 0x41, 0x41, 0x55,                                      // z
+    0x12, 0x21, 0x31, 0x31, 0x21, 0x31, 0x41, 0x31, 0x31, 0x32,              // {
+    0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,              // |
+    0x02, 0x31, 0x31, 0x31, 0x41, 0x31, 0x21, 0x31, 0x31, 0x22,              // }
+    0xF0, 0x33, 0x11, 0x11, 0x22,                                            // ~
+};
+
+static const uint16_t Index_7x10_Prop[FONT_GLYPHS + 1] = {
+      0,   0,   7,  13,  27,  44,  59,  73,  76,  86,  96, 101,
+    106, 109, 111, 112, 120, 135, 144, 154, 164, 175, 184, 196,
+    204, 217, 229, 231, 235, 240, 243, 248, 256, 269, 283, 296,
+    306, 320, 328, 336, 348, 363, 371, 380, 395, 403, 420, 438,
+    452, 463, 479, 493, 503, 511, 526, 540, 559, 573, 585, 593,
+    603, 611, 621, 628, 633, 635, 645, 659, 667, 681, 689, 697,
+    711, 725, 732, 741, 754, 762, 778, 790, 800, 814, 828, 836,
+    844, 852, 864, 875, 890, 900, 912, 918, 928, 938, 948, 953,
+};
+
+static const uint8_t Advance_7x10_Prop[FONT_GLYPHS] = {
+    3, 2, 4, 6, 6, 6, 6, 2, 4, 4, 4, 6, 2, 4, 2, 4,
+    6, 4, 6, 6, 6, 6, 6, 6, 6, 6, 2, 2, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 4, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 3, 4, 3, 6, 8,
+    3, 6, 6, 6, 6, 6, 6, 6, 6, 4, 5, 6, 4, 6, 6, 6,
+    6, 6, 6, 6, 5, 6, 6, 6, 6, 6, 6, 4, 2, 4, 6,
+};
+
+const FontDef Font_7x10_Prop = {8, 10, Index_7x10_Prop, Spans_7x10_Prop, Advance_7x10_Prop};
+
+// ── Font_11x18_Prop ─────────────────────────────────────────────────────
+
+static const uint8_t Spans_11x18_Prop[] = {
+    // sp (no ink)
+    0x32, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x42,  // !
+    0x12,
+    0x62, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,              // "
+    0xC2, 0x22, 0x42, 0x22, 0x42, 0x22, 0x42, 0x22, 0x29, 0x19, 0x32, 0x22,  // #
+    0x32, 0x22, 0x39, 0x19, 0x22, 0x22, 0x42, 0x22, 0x42, 0x22, 0x42, 0x22,
+    0xB4, 0x46, 0x23, 0x11, 0x12, 0x12, 0x21, 0x12, 0x13, 0x11, 0x54, 0x64,  // $
+    0x73, 0x61, 0x12, 0x12, 0x21, 0x12, 0x12, 0x21, 0x12, 0x13, 0x11, 0x12,
+    0x26, 0x44, 0x71, 0x81,
+    0xC3, 0x72, 0x12, 0x62, 0x12, 0x41, 0x12, 0x12, 0x32, 0x12, 0x12, 0x22,  // %
+    0x33, 0x22, 0x82, 0x82, 0x82, 0x13, 0x42, 0x12, 0x12, 0x22, 0x22, 0x12,
+    0x21, 0x32, 0x12, 0x62, 0x12, 0x73,
+    0xC4, 0x56, 0x42, 0x22, 0x42, 0x22, 0x42, 0x22, 0x54, 0x72, 0x64, 0x22,  // &
+    0x12, 0x22, 0x12, 0x12, 0x33, 0x22, 0x42, 0x22, 0x33, 0x35, 0x12, 0x33,
+    0x21,
+    0x32, 0x12, 0x12, 0x12, 0x12,                                            // '
+    0x41, 0x41, 0x42, 0x32, 0x42, 0x41, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,  // (
+    0x51, 0x52, 0x42, 0x52, 0x51, 0x61,
+    0x01, 0x61, 0x52, 0x52, 0x42, 0x51, 0x52, 0x42, 0x42, 0x42, 0x42, 0x42,  // )
+    0x41, 0x42, 0x42, 0x32, 0x41, 0x41,
+    0x92, 0x31, 0x12, 0x11, 0x16, 0x24, 0x22, 0x22,                          // *
+    0xF0, 0xF0, 0x72, 0x92, 0x92, 0x92, 0x5A, 0x1A, 0x52, 0x92, 0x92, 0x92,  // +
+    0xF0, 0xF0, 0x92, 0x12, 0x21, 0x21, 0x11,                                // ,
+    0xF0, 0xF0, 0xF4, 0x14,                                                  // -
+    0xF0, 0xF0, 0x92, 0x12,                                                  // .
+    0x92, 0x42, 0x42, 0x32, 0x42, 0x42, 0x42, 0x32, 0x42, 0x42, 0x42, 0x32,  // /
+    0x42, 0x42,
+    0xB4, 0x46, 0x32, 0x22, 0x22, 0x42, 0x12, 0x42, 0x12, 0x42, 0x12, 0x12,  // 0
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x42, 0x12, 0x42, 0x12, 0x42, 0x22, 0x22,
+    0x36, 0x44,
+    0x92, 0x33, 0x24, 0x12, 0x12, 0x11, 0x22, 0x42, 0x42, 0x42, 0x42, 0x42,  // 1
+    0x42, 0x42, 0x42, 0x42,
+    0xB4, 0x46, 0x23, 0x23, 0x12, 0x42, 0x12, 0x42, 0x72, 0x62, 0x62, 0x62,  // 2
+    0x62, 0x62, 0x62, 0x78, 0x18,
+    0xB3, 0x55, 0x32, 0x32, 0x22, 0x32, 0x72, 0x53, 0x63, 0x82, 0x82, 0x72,  // 3
+    0x12, 0x42, 0x13, 0x23, 0x26, 0x44,
+    0xD2, 0x63, 0x63, 0x54, 0x54, 0x51, 0x12, 0x42, 0x12, 0x42, 0x12, 0x32,  // 4
+    0x22, 0x38, 0x18, 0x52, 0x72, 0x72,
+    0x97, 0x27, 0x22, 0x72, 0x72, 0x72, 0x13, 0x37, 0x22, 0x33, 0x72, 0x72,  // 5
+    0x12, 0x42, 0x13, 0x23, 0x26, 0x44,
+    0xB4, 0x46, 0x32, 0x23, 0x12, 0x42, 0x12, 0x72, 0x13, 0x37, 0x23, 0x23,  // 6
+    0x12, 0x42, 0x12, 0x42, 0x12, 0x42, 0x22, 0x23, 0x26, 0x44,
+    0x98, 0x18, 0x72, 0x62, 0x72, 0x62, 0x72, 0x62, 0x72, 0x72, 0x71, 0x72,  // 7
+    0x72, 0x72,
+    0xB4, 0x46, 0x22, 0x33, 0x12, 0x42, 0x12, 0x42, 0x21, 0x41, 0x44, 0x46,  // 8
+    0x22, 0x42, 0x12, 0x42, 0x12, 0x42, 0x12, 0x42, 0x26, 0x44,
+    0xB4, 0x46, 0x23, 0x22, 0x22, 0x42, 0x12, 0x42, 0x12, 0x42, 0x13, 0x23,  // 9
+    0x27, 0x33, 0x12, 0x72, 0x12, 0x42, 0x13, 0x22, 0x36, 0x44,
+    0xF2, 0x12, 0xF0, 0x42, 0x12,                                            // :
+    0xF0, 0x32, 0x12, 0xF0, 0x12, 0x12, 0x21, 0x21, 0x11,                    // ;
+    0xF0, 0xF0, 0xD1, 0x63, 0x43, 0x43, 0x52, 0x83, 0x83, 0x83, 0x81,        // <
+    0xF0, 0xF0, 0xF8, 0x18, 0xF0, 0x48, 0x18,                                // =
+    0xF0, 0xF0, 0x61, 0x83, 0x83, 0x83, 0x82, 0x53, 0x43, 0x43, 0x61,        // >
+    0xC5, 0x47, 0x23, 0x33, 0x12, 0x52, 0x82, 0x73, 0x63, 0x63, 0x63, 0x72,  // ?
+    0x82, 0xF0, 0x32, 0x82,
+    0xB4, 0x46, 0x32, 0x32, 0x13, 0x32, 0x12, 0x33, 0x12, 0x15, 0x12, 0x12,  // @
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x15, 0x12, 0x24, 0x12, 0x82, 0x21, 0x45,
+    0x53,
+    0xD3, 0x73, 0x62, 0x12, 0x52, 0x12, 0x52, 0x12, 0x52, 0x12, 0x42, 0x32,  // A
+    0x32, 0x32, 0x37, 0x37, 0x32, 0x32, 0x22, 0x52, 0x12, 0x52, 0x12, 0x52,
+    0x95, 0x46, 0x32, 0x32, 0x22, 0x32, 0x22, 0x32, 0x22, 0x32, 0x26, 0x36,  // B
+    0x32, 0x32, 0x22, 0x42, 0x12, 0x42, 0x12, 0x33, 0x17, 0x26,
+    0xB4, 0x46, 0x32, 0x32, 0x12, 0x42, 0x12, 0x72, 0x72, 0x72, 0x72, 0x72,  // C
+    0x72, 0x42, 0x22, 0x32, 0x26, 0x44,
+    0x95, 0x47, 0x22, 0x32, 0x22, 0x33, 0x12, 0x42, 0x12, 0x42, 0x12, 0x42,  // D
+    0x12, 0x42, 0x12, 0x42, 0x12, 0x42, 0x12, 0x32, 0x22, 0x32, 0x26, 0x35,
+    0x98, 0x18, 0x12, 0x72, 0x72, 0x72, 0x77, 0x27, 0x22, 0x72, 0x72, 0x72,  // E
+    0x78, 0x18,
+    0x98, 0x18, 0x12, 0x72, 0x72, 0x72, 0x77, 0x27, 0x22, 0x72, 0x72, 0x72,  // F
+    0x72, 0x72,
+    0xB4, 0x46, 0x32, 0x32, 0x12, 0x42, 0x12, 0x72, 0x72, 0x72, 0x33, 0x12,  // G
+    0x33, 0x12, 0x42, 0x12, 0x42, 0x22, 0x32, 0x27, 0x34,
+    0x92, 0x42, 0x12, 0x42, 0x12, 0x42, 0x12, 0x42, 0x12, 0x42, 0x12, 0x42,  // H
+    0x18, 0x18, 0x12, 0x42, 0x12, 0x42, 0x12, 0x42, 0x12, 0x42, 0x12, 0x42,
+    0x12, 0x42,
+    0x76, 0x16, 0x32, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,  // I
+    0x36, 0x16,
+    0xF2, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x12, 0x42, 0x12,  // J
+    0x42, 0x13, 0x23, 0x26, 0x44,
+    0xA2, 0x52, 0x12, 0x42, 0x22, 0x32, 0x32, 0x22, 0x42, 0x22, 0x42, 0x12,  // K
+    0x54, 0x65, 0x52, 0x22, 0x42, 0x22, 0x42, 0x32, 0x32, 0x42, 0x22, 0x42,
+    0x22, 0x52,
+    0x92, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,  // L
+    0x78, 0x18,
+    0xA3, 0x33, 0x13, 0x33, 0x14, 0x14, 0x14, 0x11, 0x12, 0x12, 0x11, 0x11,  // M
+    0x12, 0x12, 0x11, 0x11, 0x12, 0x12, 0x13, 0x12, 0x12, 0x21, 0x22, 0x12,
+    0x52, 0x12, 0x52, 0x12, 0x52, 0x12, 0x52, 0x12, 0x52, 0x12, 0x52,
+    0x93, 0x32, 0x13, 0x32, 0x14, 0x22, 0x14, 0x22, 0x14, 0x22, 0x12, 0x12,  // N
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x21, 0x12, 0x12, 0x24,
+    0x12, 0x24, 0x12, 0x24, 0x12, 0x33, 0x12, 0x33,
+    0xB4, 0x46, 0x32, 0x22, 0x22, 0x42, 0x12, 0x42, 0x12, 0x42, 0x12, 0x42,  // O
+    0x12, 0x42, 0x12, 0x42, 0x12, 0x42, 0x12, 0x42, 0x22, 0x22, 0x36, 0x44,
+    0x96, 0x37, 0x22, 0x33, 0x12, 0x42, 0x12, 0x42, 0x12, 0x42, 0x12, 0x33,  // P
+    0x17, 0x26, 0x32, 0x72, 0x72, 0x72, 0x72,
+    0xC4, 0x56, 0x42, 0x22, 0x32, 0x42, 0x22, 0x42, 0x22, 0x42, 0x22, 0x42,  // Q
+    0x22, 0x42, 0x22, 0x42, 0x22, 0x21, 0x12, 0x22, 0x24, 0x32, 0x22, 0x47,
+    0x44, 0x21,
+    0xA6, 0x47, 0x32, 0x33, 0x22, 0x42, 0x22, 0x42, 0x22, 0x33, 0x27, 0x36,  // R
+    0x42, 0x22, 0x42, 0x32, 0x32, 0x32, 0x32, 0x42, 0x22, 0x42, 0x22, 0x52,
+    0xC3, 0x55, 0x32, 0x32, 0x22, 0x32, 0x22, 0x73, 0x74, 0x73, 0x73, 0x12,  // S
+    0x42, 0x12, 0x42, 0x22, 0x32, 0x26, 0x44,
+    0xBA, 0x1A, 0x52, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,  // T
+    0x92, 0x92,
+    0x92, 0x42, 0x12, 0x42, 0x12, 0x42, 0x12, 0x42, 0x12, 0x42, 0x12, 0x42,  // U
+    0x12, 0x42, 0x12, 0x42, 0x12, 0x42, 0x12, 0x42, 0x12, 0x42, 0x13, 0x23,
+    0x26, 0x44,
+    0xA2, 0x52, 0x12, 0x52, 0x12, 0x52, 0x22, 0x32, 0x32, 0x32, 0x32, 0x32,  // V
+    0x42, 0x12, 0x52, 0x12, 0x52, 0x12, 0x52, 0x12, 0x63, 0x73, 0x73, 0x81,
+    0xB2, 0x62, 0x12, 0x62, 0x12, 0x62, 0x12, 0x62, 0x12, 0x62, 0x12, 0x22,  // W
+    0x22, 0x21, 0x22, 0x21, 0x31, 0x22, 0x21, 0x31, 0x14, 0x11, 0x31, 0x11,
+    0x21, 0x11, 0x31, 0x11, 0x21, 0x11, 0x33, 0x23, 0x32, 0x42, 0x32, 0x42,
+    0xB2, 0x62, 0x22, 0x51, 0x32, 0x42, 0x42, 0x22, 0x53, 0x12, 0x64, 0x82,  // X
+    0x92, 0x84, 0x75, 0x53, 0x12, 0x43, 0x32, 0x32, 0x42, 0x22, 0x62,
+    0xB2, 0x62, 0x22, 0x42, 0x32, 0x42, 0x42, 0x22, 0x52, 0x22, 0x64, 0x74,  // Y
+    0x82, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92,
+    0xA7, 0x27, 0x72, 0x62, 0x72, 0x62, 0x62, 0x72, 0x62, 0x72, 0x62, 0x62,  // Z
+    0x78, 0x18,
+    0x04, 0x14, 0x12, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,  // [
+    0x32, 0x32, 0x32, 0x32, 0x34, 0x14,
+    0x62, 0x42, 0x42, 0x52, 0x42, 0x42, 0x42, 0x52, 0x42, 0x42, 0x42, 0x52,  /* \ */
+    0x42, 0x42,
+    0x04, 0x14, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,  // ]
+    0x32, 0x32, 0x32, 0x32, 0x14, 0x14,
+    0xC2, 0x72, 0x64, 0x51, 0x21, 0x42, 0x22, 0x32, 0x22, 0x22, 0x42, 0x12,  // ^
+    0x42,
+    0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,  // _
+    0xCB,
+    0x53, 0x32, 0x42,                                                        // `
+    0xF0, 0xF0, 0xF0, 0x75, 0x47, 0x22, 0x42, 0x82, 0x46, 0x37, 0x22, 0x42,  // a
+    0x22, 0x33, 0x28, 0x33, 0x32,
+    0x92, 0x72, 0x72, 0x72, 0x72, 0x13, 0x37, 0x23, 0x23, 0x12, 0x42, 0x12,  // b
+    0x42, 0x12, 0x42, 0x12, 0x42, 0x13, 0x23, 0x17, 0x22, 0x13,
+    0xF0, 0xF0, 0xF0, 0x24, 0x46, 0x23, 0x23, 0x12, 0x42, 0x12, 0x72, 0x72,  // c
+    0x42, 0x13, 0x23, 0x26, 0x44,
+    0xF2, 0x72, 0x72, 0x72, 0x33, 0x12, 0x27, 0x13, 0x23, 0x12, 0x42, 0x12,  // d
+    0x42, 0x12, 0x42, 0x12, 0x42, 0x13, 0x23, 0x27, 0x33, 0x12,
+    0xF0, 0xF0, 0xF0, 0x24, 0x46, 0x23, 0x22, 0x22, 0x42, 0x18, 0x18, 0x12,  // e
+    0x73, 0x32, 0x26, 0x44,
+    0xE5, 0x46, 0x42, 0x82, 0x58, 0x28, 0x52, 0x82, 0x82, 0x82, 0x82, 0x82,  // f
+    0x82, 0x82,
+    0xF0, 0xF0, 0x83, 0x12, 0x27, 0x13, 0x23, 0x12, 0x42, 0x12, 0x42, 0x12,  // g
+    0x42, 0x12, 0x42, 0x13, 0x23, 0x27, 0x33, 0x12, 0x72, 0x12, 0x33, 0x17,
+    0x35,
+    0x92, 0x72, 0x72, 0x72, 0x72, 0x14, 0x28, 0x13, 0x32, 0x12, 0x42, 0x12,  // h
+    0x42, 0x12, 0x42, 0x12, 0x42, 0x12, 0x42, 0x12, 0x42, 0x12, 0x42,
+    0x92, 0x42, 0xD5, 0x15, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,  // i
+    0x42, 0x52, 0xF0, 0x15, 0x25, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52,  // j
+    0x52, 0x52, 0x11, 0x32, 0x16, 0x24,
+    0xA2, 0x82, 0x82, 0x82, 0x82, 0x42, 0x22, 0x32, 0x32, 0x22, 0x42, 0x12,  // k
+    0x55, 0x53, 0x12, 0x42, 0x32, 0x32, 0x32, 0x32, 0x42, 0x22, 0x52,
+    0x65, 0x15, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,  // l
+    0x42, 0x42,
+    0xF0, 0xF0, 0xF0, 0xA2, 0x13, 0x12, 0x2A, 0x12, 0x23, 0x12, 0x12, 0x22,  // m
+    0x22, 0x12, 0x22, 0x22, 0x12, 0x22, 0x22, 0x12, 0x22, 0x22, 0x12, 0x22,
+    0x22, 0x12, 0x22, 0x22, 0x12, 0x22, 0x22,
+    0xF0, 0xF0, 0xF2, 0x14, 0x28, 0x13, 0x32, 0x12, 0x42, 0x12, 0x42, 0x12,  // n
+    0x42, 0x12, 0x42, 0x12, 0x42, 0x12, 0x42, 0x12, 0x42,
+    0xF0, 0xF0, 0xF0, 0x24, 0x46, 0x23, 0x23, 0x12, 0x42, 0x12, 0x42, 0x12,  // o
+    0x42, 0x12, 0x42, 0x13, 0x23, 0x26, 0x44,
+    0xF0, 0xF0, 0x62, 0x13, 0x37, 0x23, 0x23, 0x12, 0x42, 0x12, 0x42, 0x12,  // p
+    0x42, 0x12, 0x42, 0x13, 0x23, 0x17, 0x22, 0x13, 0x32, 0x72, 0x72, 0x72,
+    0xF0, 0xF0, 0x83, 0x12, 0x27, 0x13, 0x23, 0x12, 0x42, 0x12, 0x42, 0x12,  // q
+    0x42, 0x12, 0x42, 0x13, 0x23, 0x27, 0x33, 0x12, 0x72, 0x72, 0x72, 0x72,
+    0xF0, 0xF0, 0xF2, 0x23, 0x37, 0x23, 0x21, 0x32, 0x72, 0x72, 0x72, 0x72,  // r
+    0x72, 0x72,
+    0xF0, 0xF0, 0xF0, 0x24, 0x47, 0x12, 0x42, 0x12, 0x77, 0x37, 0x72, 0x12,  // s
+    0x42, 0x17, 0x44,
+    0xF0, 0x61, 0x72, 0x72, 0x57, 0x27, 0x42, 0x72, 0x72, 0x72, 0x72, 0x72,  // t
+    0x76, 0x45,
+    0xF0, 0xF0, 0xF2, 0x42, 0x12, 0x42, 0x12, 0x42, 0x12, 0x42, 0x12, 0x42,  // u
+    0x12, 0x42, 0x12, 0x42, 0x12, 0x33, 0x18, 0x24, 0x12,
+    0xF0, 0xF0, 0xF0, 0x52, 0x52, 0x22, 0x32, 0x32, 0x32, 0x32, 0x32, 0x42,  // v
+    0x12, 0x52, 0x12, 0x52, 0x12, 0x63, 0x73, 0x82,
+    0xF0, 0xF0, 0xF0, 0x52, 0x13, 0x12, 0x12, 0x13, 0x12, 0x12, 0x13, 0x12,  // w
+    0x21, 0x11, 0x11, 0x11, 0x31, 0x11, 0x11, 0x11, 0x31, 0x11, 0x11, 0x11,
+    0x33, 0x13, 0x33, 0x13, 0x41, 0x31, 0x51, 0x31,
+    0xF0, 0xF0, 0xF2, 0x42, 0x22, 0x22, 0x32, 0x22, 0x44, 0x62, 0x72, 0x64,  // x
+    0x42, 0x22, 0x32, 0x22, 0x22, 0x42,
+    0xF0, 0xF0, 0x62, 0x42, 0x12, 0x42, 0x22, 0x32, 0x22, 0x22, 0x32, 0x22,  // y
+    0x42, 0x12, 0x42, 0x12, 0x42, 0x12, 0x53, 0x63, 0x63, 0x53, 0x45, 0x43,
+    0xF0, 0xF0, 0xF0, 0x59, 0x19, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x79,  // z
+    0x19,
+    0x33, 0x34, 0x32, 0x52, 0x52, 0x52, 0x52, 0x43, 0x33, 0x43, 0x53, 0x52,  // {
+    0x52, 0x52, 0x52, 0x52, 0x54, 0x43,
+    0x02, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,  // |
+    0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+    0x03, 0x44, 0x52, 0x52, 0x52, 0x52, 0x52, 0x53, 0x53, 0x43, 0x33, 0x42,  // }
+    0x52, 0x52, 0x52, 0x52, 0x34, 0x33,
+    0xF0, 0xF0, 0xF0, 0xF0, 0x43, 0x31, 0x18, 0x11, 0x33,                    // ~
+};
+
+static const uint16_t Index_11x18_Prop[FONT_GLYPHS + 1] = {
+      0,   0,  13,  23,  47,  75, 105, 130, 135, 153, 171, 179,
+    191, 198, 202, 206, 220, 246, 262, 279, 297, 315, 333, 355,
+    369, 391, 413, 418, 427, 438, 445, 456, 472, 497, 521, 543,
+    561, 585, 599, 613, 634, 660, 674, 691, 717, 731, 766, 798,
+    822, 841, 867, 891, 910, 924, 950, 974,1010,1033,1052,1066,
+   1084,1098,1116,1129,1142,1145,1162,1184,1201,1223,1239,1253,
+   1278,1301,1313,1331,1354,1368,1399,1420,1439,1463,1487,1501,
+   1516,1530,1551,1571,1603,1621,1645,1658,1676,1694,1712,1721,
+};
+
+static const uint8_t Advance_11x18_Prop[FONT_GLYPHS] = {
+    5, 3, 6,10, 9,11,10, 3, 6, 6, 7,11, 3, 5, 3, 6,
+    9, 6, 9, 9, 9, 9, 9, 9, 9, 9, 3, 3, 9, 9, 9,10,
+    9,10, 9, 9, 9, 9, 9, 9, 9, 7, 9,10, 9,10, 9, 9,
+    9,10,10, 9,11, 9,10,11,11,11, 9, 5, 6, 5, 9,12,
+    5,10, 9, 9, 9, 9,10, 9, 9, 6, 7,10, 6,11, 9, 9,
+    9, 9, 9, 9, 9, 9,10,10, 9, 9,10, 7, 3, 7, 9,
+};
+
+const FontDef Font_11x18_Prop = {12, 18, Index_11x18_Prop, Spans_11x18_Prop, Advance_11x18_Prop};
+
@@ -17,6 +17,13 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+/**
+ * fonts.cxx — bitmap source of the TFT fonts.
+ *
+ * Not built into the firmware: test/font_compile.cxx turns these tables
+ * into the run tables of font_spans.cxx (see fonts.h).
+ */
+
 #include "fonts.h"
 
 static const uint16_t Font7x10 [] = {
@@ -313,6 +320,6 @@ static const uint16_t Font16x26 [] = {
 0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3F07,0x7FC7,0x73E7,0xF1FF,0xF07E,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000, // Ascii = [~]
 };
 
-const FontDef Font_7x10  = {7,  10, Font7x10};
-const FontDef Font_11x18 = {11, 18, Font11x18};
-const FontDef Font_16x26 = {16, 26, Font16x26};
+const FontBitmap FontBitmap_7x10  = {7,  10, Font7x10};
+const FontBitmap FontBitmap_11x18 = {11, 18, Font11x18};
+const FontBitmap FontBitmap_16x26 = {16, 26, Font16x26};
@@ -17,19 +17,197 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+/**
+ * fonts.h — text fonts for the TFT.
+ *
+ * Glyphs are stored as runs rather than bitmaps.  Each byte of a glyph is
+ * one (background, ink) pair — high nibble the background pixels, low
+ * nibble the ink pixels that follow, 0..15 each — read row-major across
+ * the glyph as if its rows were one long line.  The runs stop after the
+ * last ink pixel; everything after it is background.  Expanding a glyph
+ * (GlyphRows, font_blit) decodes the runs into an ink mask a row or 32
+ * pixels at a time and writes that two pixels per store, instead of a bit
+ * test and a store per pixel.
+ *
+ * The run tables (font_spans.cxx) are GENERATED by test/font_compile.cxx
+ * from the bitmap tables in fonts.cxx, which are not linked into the
+ * firmware.  Proportional fonts are cropped to each glyph's ink plus one
+ * column of spacing and carry a per-glyph advance.
+ */
+
 #ifndef _FONTS_H__
 #define _FONTS_H__
 
 #include <cstdint>
+#include <cstring>
+
+static constexpr char     FONT_FIRST  = 32;    ///< ' '
+static constexpr uint32_t FONT_GLYPHS = 95;    ///< ' ' .. '~'
 
 struct FontDef {
-    uint8_t        width;
-    uint8_t        height;
-    const uint16_t *data;
+    uint8_t         width;      ///< cell width; the widest glyph if proportional
+    uint8_t         height;
+    const uint16_t* index;      ///< FONT_GLYPHS + 1 offsets into spans
+    const uint8_t*  spans;      ///< (background, ink) nibble pairs per glyph
+    const uint8_t*  advance;    ///< per-glyph width; null = fixed width
 };
 
 extern const FontDef Font_7x10;
 extern const FontDef Font_11x18;
 extern const FontDef Font_16x26;
+extern const FontDef Font_7x10_Prop;
+extern const FontDef Font_11x18_Prop;
+
+/// Source bitmaps for test/font_compile.cxx: one uint16_t per glyph row,
+/// leftmost pixel in bit 15.  Host-only; not in the firmware image.
+struct FontBitmap {
+    uint8_t         width;
+    uint8_t         height;
+    const uint16_t* data;
+};
+
+extern const FontBitmap FontBitmap_7x10;
+extern const FontBitmap FontBitmap_11x18;
+extern const FontBitmap FontBitmap_16x26;
+
+/// How far drawStr() moves right for @p ch.  Characters outside
+/// ' '..'~' are not drawn but still take a cell.
+inline uint8_t font_advance(const FontDef& font, char ch)
+{
+    const bool printable = ch >= FONT_FIRST && static_cast<uint32_t>(ch - FONT_FIRST) < FONT_GLYPHS;
+    return printable && font.advance ? font.advance[ch - FONT_FIRST] : font.width;
+}
+
+/// Width of @p str on one line, in pixels.
+inline uint32_t font_strWidth(const FontDef& font, const char* str)
+{
+    uint32_t w = 0;
+    for (; *str; str++) w += font_advance(font, *str);
+    return w;
+}
+
+/// Fill @p n pixels with @p v, two at a time where @p dst is word-aligned.
+inline void font_fill(uint16_t* dst, uint16_t v, uint32_t n)
+{
+    if (n && (reinterpret_cast<uintptr_t>(dst) & 2)) { *dst++ = v; n--; }
+    uint16_t* const d = static_cast<uint16_t*>(__builtin_assume_aligned(dst, 4));
+    const uint32_t vv = v | static_cast<uint32_t>(v) << 16;
+    uint32_t i = 0;
+    for (; i + 2 <= n; i += 2) memcpy(d + i, &vv, sizeof(vv));
+    if (i < n) d[i] = v;
+}
+
+/// Write @p n pixels from @p ink, bit 0 the leftmost: set bits @p fg, clear
+/// bits @p bg.  Two pixels per store where @p dst is word-aligned, picked
+/// from the four fg/bg pairs by two bits of @p ink.
+inline void font_expand(uint16_t* dst, uint32_t ink, uint32_t n, uint16_t fg, uint16_t bg)
+{
+    if (n && (reinterpret_cast<uintptr_t>(dst) & 2))
+    {
+        *dst++ = (ink & 1) ? fg : bg;
+        ink >>= 1;
+        n--;
+    }
+    uint16_t* const d = static_cast<uint16_t*>(__builtin_assume_aligned(dst, 4));
+    const uint16_t pairs[4][2] = { { bg, bg }, { fg, bg }, { bg, fg }, { fg, fg } };
+    uint32_t i = 0;
+    for (; i + 2 <= n; i += 2, ink >>= 2) memcpy(d + i, pairs[ink & 3], sizeof(pairs[0]));
+    if (i < n) d[i] = (ink & 1) ? fg : bg;
+}
+
+/**
+ * Expands one glyph (printable ASCII) top to bottom, a row per call.
+ * Colours are written as given; the TFT passes them byte-swapped for the
+ * wire.
+ *
+ * The runs are decoded into a bit buffer, and each row is taken off it as
+ * an ink mask, bit 0 the leftmost pixel, that font_expand() writes two
+ * pixels per store.  Runs are mostly a pixel or three long, so filling
+ * them one by one spends more on loop setup than on stores; the mask costs
+ * a shift and an OR per run and keeps the store loop branch-free.
+ */
+class GlyphRows
+{
+public:
+    GlyphRows(const FontDef& font, char ch)
+        : _p(font.spans + font.index[ch - FONT_FIRST]),
+          _end(font.spans + font.index[ch - FONT_FIRST + 1]),
+          _width(font_advance(font, ch)) {}
+
+    uint8_t width() const { return _width; }
+
+    /// Write the next row, width() pixels, to @p dst.
+    void row(uint16_t fg, uint16_t bg, uint16_t* dst)
+    {
+        font_expand(dst, _take(_width), _width, fg, bg);
+    }
+
+    /// Write the next @p n pixels (at most 32) to @p dst as if the glyph's
+    /// rows were one line; font_blit() uses this when they are.
+    void line(uint16_t fg, uint16_t bg, uint16_t* dst, uint32_t n)
+    {
+        font_expand(dst, _take(n), n, fg, bg);
+    }
+
+    /// Pass over the next @p rows rows without writing them.
+    void skip(uint32_t rows)
+    {
+        for (uint32_t left = rows * _width; left; )
+        {
+            const uint32_t n = left < 32 ? left : 32;
+            _take(n);
+            left -= n;
+        }
+    }
+
+private:
+    const uint8_t* _p;
+    const uint8_t* _end;
+    uint8_t        _width;
+    uint64_t       _bits = 0;       ///< decoded pixels not yet written, bit 0 next
+    uint32_t       _have = 0;       ///< how many of them; zeros past _end
+
+    /// Ink mask of the next @p n pixels (at most 32).  Runs are decoded
+    /// until that many are buffered (at most 32 plus one pair, 62 bits), so
+    /// a run crossing a row end needs no carry.
+    uint32_t _take(uint32_t n)
+    {
+        while (_have < n && _p != _end)
+        {
+            _have += *_p >> 4;
+            _bits |= ((1ull << (*_p & 0x0F)) - 1) << _have;
+            _have += *_p & 0x0F;
+            _p++;
+        }
+        const uint32_t mask = static_cast<uint32_t>(_bits & ((1ull << n) - 1));
+        _bits >>= n;
+        _have  = _have > n ? _have - n : 0;
+        return mask;
+    }
+};
+
+/**
+ * Draw @p ch (printable ASCII) whole into @p dst, rows @p stride pixels
+ * apart.  When @p stride is the glyph width the rows are one line and are
+ * written 32 pixels at a time, row ends ignored; otherwise a row at a time.
+ */
+inline void font_blit(const FontDef& font, char ch, uint16_t fg, uint16_t bg,
+                      uint16_t* dst, uint32_t stride)
+{
+    GlyphRows glyph(font, ch);
+    if (stride != glyph.width())
+    {
+        for (uint32_t row = 0; row < font.height; row++, dst += stride)
+            glyph.row(fg, bg, dst);
+        return;
+    }
+    for (uint32_t left = glyph.width() * font.height; left; )
+    {
+        const uint32_t n = left < 32 ? left : 32;
+        glyph.line(fg, bg, dst, n);
+        dst  += n;
+        left -= n;
+    }
+}
 
 #endif // _FONTS_H__
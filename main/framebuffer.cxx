@@ -0,0 +1,133 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * framebuffer.cxx — dirty-rectangle tracking and flushing (see framebuffer.h).
+ */
+
+#include "framebuffer.h"
+
+#include <cstring>
+
+static FbRect unite(const FbRect& a, const FbRect& b)
+{
+    FbRect u;
+    u.x0 = a.x0 < b.x0 ? a.x0 : b.x0;
+    u.y0 = a.y0 < b.y0 ? a.y0 : b.y0;
+    u.x1 = a.x1 > b.x1 ? a.x1 : b.x1;
+    u.y1 = a.y1 > b.y1 ? a.y1 : b.y1;
+    return u;
+}
+
+void FrameBuffer::attach(uint16_t* pixels, uint8_t width, uint8_t height,
+                         uint16_t* stage, size_t stagePixels)
+{
+    _px       = pixels;
+    _w        = width;
+    _h        = height;
+    _stage    = stage;
+    _stageLen = stage ? stagePixels : 0;
+    _count    = 0;
+    if (_px) memset(_px, 0, static_cast<size_t>(_w) * _h * sizeof(uint16_t));
+}
+
+// ── Dirty rectangles ──────────────────────────────────────────────────────
+
+void FrameBuffer::markDirty(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+    if (!_px || w == 0 || h == 0 || x >= _w || y >= _h) return;
+    if (x + w > _w) w = _w - x;
+    if (y + h > _h) h = _h - y;
+
+    FbRect r;
+    r.x0 = static_cast<uint8_t>(x);
+    r.y0 = static_cast<uint8_t>(y);
+    r.x1 = static_cast<uint8_t>(x + w - 1);
+    r.y1 = static_cast<uint8_t>(y + h - 1);
+    _add(r);
+}
+
+void FrameBuffer::_remove(size_t i)
+{
+    _dirty[i] = _dirty[--_count];
+}
+
+void FrameBuffer::_add(FbRect r)
+{
+    // Absorb every noted rectangle worth merging; a merge can make the
+    // union worth merging with one already passed over, so start again.
+    for (size_t i = 0; i < _count; )
+    {
+        const FbRect& d = _dirty[i];
+        const FbRect  u = unite(d, r);
+        if (u.area() == d.area()) return;   // already covered
+        if (u.area() <= d.area() + r.area() + FB_RECT_COST_PX)
+        {
+            r = u;
+            _remove(i);
+            i = 0;
+            continue;
+        }
+        i++;
+    }
+
+    while (_count == FB_DIRTY_MAX)
+    {
+        size_t   best = 0;
+        uint32_t grow = UINT32_MAX;
+        for (size_t i = 0; i < _count; i++)
+        {
+            const uint32_t g = unite(_dirty[i], r).area() - _dirty[i].area();
+            if (g < grow) { grow = g; best = i; }
+        }
+        r = unite(_dirty[best], r);
+        _remove(best);
+    }
+    _dirty[_count++] = r;
+}
+
+// ── Flush ─────────────────────────────────────────────────────────────────
+
+size_t FrameBuffer::flush(TftBus& bus)
+{
+    const size_t sent = _count;
+    for (size_t i = 0; i < _count; i++)
+    {
+        FbRect r = _dirty[i];
+        const size_t w = r.width();
+        const size_t n = r.area();
+
+        if (w < _w && n <= _stageLen)
+        {
+            uint16_t* out = _stage;
+            for (uint16_t y = r.y0; y <= r.y1; y++, out += w)
+                memcpy(out, row(r.x0, y), w * sizeof(uint16_t));
+            bus.window(r.x0, r.y0, r.x1, r.y1);
+            bus.pixels(_stage, n);
+            continue;
+        }
+
+        // Full rows are contiguous in the frame: send them in place.
+        r.x0 = 0;
+        r.x1 = static_cast<uint8_t>(_w - 1);
+        bus.window(r.x0, r.y0, r.x1, r.y1);
+        bus.pixels(row(0, r.y0), r.area());
+    }
+    _count = 0;
+    return sent;
+}
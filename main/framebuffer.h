@@ -0,0 +1,124 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * framebuffer.h — off-screen RGB565 frame for the ST7735, flushed by dirty
+ * rectangle.
+ *
+ * In framebuffer mode the TFT primitives expand their pixels into RAM and
+ * only note the rectangle they touched; nothing goes over SPI until
+ * flush().  Then each dirty rectangle costs one address window and one
+ * pixel burst, however many glyphs, icons and fills were composed into it.
+ * Without a frame, an 11×18 glyph alone is an address window plus one
+ * transaction per row.
+ *
+ * Pixels are kept byte-swapped (big-endian RGB565, the panel's wire order)
+ * so a full-width rectangle is sent straight out of the frame.  A narrower
+ * one is packed into the staging buffer first, or widened to full rows if
+ * it does not fit there.  Both buffers belong to the caller and must be
+ * DMA-capable on the target.
+ *
+ * Two rectangles are merged when the pixels their union adds cost less
+ * than a second window would (FB_RECT_COST_PX), so a line of glyphs or a
+ * row of icons goes out as one.  With FB_DIRTY_MAX already noted, a new
+ * one is merged into whichever grows least.
+ *
+ * Platform-free: TFT implements TftBus on the SPI master driver, the host
+ * benchmark on a mock SPI device.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#ifndef FB_DIRTY_MAX
+#define FB_DIRTY_MAX 8
+#endif
+
+/// Pixels one extra address window is worth: six command/data transactions
+/// against 0.4 µs per pixel at 40 MHz.
+#ifndef FB_RECT_COST_PX
+#define FB_RECT_COST_PX 128
+#endif
+
+static_assert(FB_DIRTY_MAX >= 1, "FB_DIRTY_MAX must be at least 1");
+
+/// Inclusive pixel rectangle.
+struct FbRect {
+    uint8_t x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+
+    uint16_t width()  const { return static_cast<uint16_t>(x1 - x0 + 1); }
+    uint16_t height() const { return static_cast<uint16_t>(y1 - y0 + 1); }
+    uint32_t area()   const { return static_cast<uint32_t>(width()) * height(); }
+};
+
+/**
+ * Where a flush goes.  window() opens an address window (CASET, RASET,
+ * RAMWR); pixels() sends @p n big-endian pixels into it as one transfer.
+ */
+class TftBus
+{
+public:
+    virtual void window(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1) = 0;
+    virtual void pixels(const uint16_t* px, size_t n) = 0;
+
+protected:
+    ~TftBus() = default;
+};
+
+class FrameBuffer
+{
+public:
+    /**
+     * Start composing into @p pixels (@p width × @p height, row-major) with
+     * @p stage (@p stagePixels long) for packing narrow rectangles.  The
+     * frame is cleared to black and nothing is dirty.
+     */
+    void attach(uint16_t* pixels, uint8_t width, uint8_t height,
+                uint16_t* stage, size_t stagePixels);
+
+    bool active() const { return _px != nullptr; }
+
+    /// Frame row @p y from column @p x.  No bounds check.
+    uint16_t* row(uint16_t x, uint16_t y) { return _px + static_cast<size_t>(y) * _w + x; }
+    const uint16_t* row(uint16_t x, uint16_t y) const { return _px + static_cast<size_t>(y) * _w + x; }
+
+    /// Note that the @p w × @p h block at (@p x, @p y) changed.  Clipped
+    /// to the frame.
+    void markDirty(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+
+    size_t        dirtyCount()       const { return _count; }
+    const FbRect& dirty(size_t i)    const { return _dirty[i]; }
+
+    /// Send every dirty rectangle to @p bus and forget them.  Returns the
+    /// number of rectangles sent.
+    size_t flush(TftBus& bus);
+
+private:
+    void _add(FbRect r);
+    void _remove(size_t i);
+
+    uint16_t* _px         = nullptr;
+    uint16_t* _stage      = nullptr;
+    size_t    _stageLen   = 0;
+    uint8_t   _w          = 0;
+    uint8_t   _h          = 0;
+    FbRect    _dirty[FB_DIRTY_MAX];
+    size_t    _count      = 0;
+};
@@ -0,0 +1,69 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * glyph_cache.cxx — pre-expanded glyph LRU (see glyph_cache.h).
+ */
+
+#include "glyph_cache.h"
+
+void GlyphCache::attach(uint16_t* pixels, size_t slots)
+{
+    _px     = pixels;
+    _slots  = pixels ? (slots < GLYPH_CACHE_MAX_SLOTS ? slots : GLYPH_CACHE_MAX_SLOTS) : 0;
+    _clock  = 0;
+    _hits   = 0;
+    _misses = 0;
+    for (Entry& e : _entry) e = Entry{};
+}
+
+const uint16_t* GlyphCache::get(const FontDef& font, char ch, uint16_t fgBe, uint16_t bgBe)
+{
+    if (_slots == 0 || static_cast<size_t>(font.width) * font.height > GLYPH_MAX_PIXELS)
+        return nullptr;
+
+    // Stamps are compared for order only; on the (4-billion-glyph) wrap
+    // the LRU choice is briefly wrong, nothing worse.
+    const uint32_t now = ++_clock;
+
+    size_t victim = 0;
+    for (size_t i = 0; i < _slots; i++)
+    {
+        Entry& e = _entry[i];
+        if (e.font == font.spans && e.ch == ch && e.fg == fgBe && e.bg == bgBe)
+        {
+            e.lastUse = now;
+            _hits++;
+            return _px + i * GLYPH_MAX_PIXELS;
+        }
+        if (_entry[victim].font && (!e.font || e.lastUse < _entry[victim].lastUse))
+            victim = i;
+    }
+
+    Entry& e = _entry[victim];
+    e.font    = font.spans;
+    e.ch      = ch;
+    e.fg      = fgBe;
+    e.bg      = bgBe;
+    e.lastUse = now;
+    _misses++;
+
+    uint16_t* out = _px + victim * GLYPH_MAX_PIXELS;
+    font_blit(font, ch, fgBe, bgBe, out, font_advance(font, ch));
+    return out;
+}
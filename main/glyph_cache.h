@@ -0,0 +1,85 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * glyph_cache.h — LRU cache of pre-expanded glyphs for the TFT.
+ *
+ * Drawing a character means turning each row of font bits into RGB565
+ * pixels in the right two colours.  Screens redraw mostly the same glyphs
+ * in the same colours, so the cache keeps the expanded bitmap — whole,
+ * byte-swapped for the wire — keyed by (font, character, foreground,
+ * background).  A hit goes out as a single DMA transfer straight from
+ * the cache instead of one per pixel row; a miss expands into the least
+ * recently used slot.  The TFT only uses it when drawing direct: with a
+ * framebuffer, expanding into the frame costs no more than copying a
+ * cached glyph there (bench_glyph_cache).
+ *
+ * Slots are GLYPH_MAX_PIXELS each, enough for Font_11x18_Prop (its widest
+ * glyph is 11 columns of ink plus one of spacing); bigger glyphs
+ * are drawn uncached.  The caller provides the pixel storage (DMA-capable
+ * on the target) and the slot count; lookups are a linear scan, cheap at
+ * the few dozen slots a screen needs.
+ */
+
+#pragma once
+
+#include "fonts.h"
+
+#include <cstddef>
+#include <cstdint>
+
+static constexpr size_t GLYPH_MAX_PIXELS     = 12 * 18;
+static constexpr size_t GLYPH_CACHE_MAX_SLOTS = 64;
+
+class GlyphCache
+{
+public:
+    /**
+     * Use @p pixels (@p slots × GLYPH_MAX_PIXELS) as the cache.  @p slots
+     * is capped at GLYPH_CACHE_MAX_SLOTS; 0 or null leaves it inactive.
+     */
+    void attach(uint16_t* pixels, size_t slots);
+
+    bool active() const { return _slots > 0; }
+
+    /**
+     * Pixels of @p ch (printable ASCII) in @p font, its glyph width ×
+     * font.height row-major, expanding it on a miss.  Null when inactive or the glyph
+     * is larger than a slot.  Valid until the next get().
+     */
+    const uint16_t* get(const FontDef& font, char ch, uint16_t fgBe, uint16_t bgBe);
+
+    uint32_t hits()   const { return _hits; }
+    uint32_t misses() const { return _misses; }
+
+private:
+    struct Entry {
+        const uint8_t*  font    = nullptr;   ///< FontDef::spans — null = empty
+        uint16_t        fg      = 0;
+        uint16_t        bg      = 0;
+        char            ch      = 0;
+        uint32_t        lastUse = 0;
+    };
+
+    uint16_t* _px     = nullptr;
+    size_t    _slots  = 0;
+    uint32_t  _clock  = 0;
+    uint32_t  _hits   = 0;
+    uint32_t  _misses = 0;
+    Entry     _entry[GLYPH_CACHE_MAX_SLOTS];
+};
@@ -29,10 +29,37 @@
 
 static const char* TAG = "hardware";
 
+// Dwell times from menuconfig ("Display Configuration"), in seconds.
+static ScreenDwell screenDwell()
+{
+    ScreenDwell d;
+    d.callMs     = CONFIG_DISPLAY_DWELL_CALL_S     * 1000u;
+    d.alertMs    = CONFIG_DISPLAY_DWELL_ALERT_S    * 1000u;
+    d.meshMs     = CONFIG_DISPLAY_DWELL_MESH_S     * 1000u;
+    d.messageMs  = CONFIG_DISPLAY_DWELL_MESSAGE_S  * 1000u;
+    d.scheduleMs = CONFIG_DISPLAY_DWELL_SCHEDULE_S * 1000u;
+    d.infoMs     = CONFIG_DISPLAY_DWELL_INFO_S     * 1000u;
+    d.backlogMs  = CONFIG_DISPLAY_DWELL_BACKLOG_S  * 1000u;
+    return d;
+}
+
+// Idle timeouts from menuconfig ("Display Configuration").
+static DisplayPowerConfig displayPower()
+{
+    DisplayPowerConfig p;
+    p.dimMs      = CONFIG_DISPLAY_DIM_S   * 1000u;
+    p.sleepMs    = CONFIG_DISPLAY_SLEEP_S * 1000u;
+    p.dimPercent = CONFIG_DISPLAY_DIM_PERCENT;
+    return p;
+}
+
 // ── Constructor / Destructor ──────────────────────────────────────────────
 
 Hardware::Hardware()
 :   _display(ST7735_CS, ST7735_REST, ST7735_RS, ST7735_SCLK, ST7735_MOSI, ST7735_LED, VEXT_CTRL)
+,   _screens(screenDwell())
+,   _power(displayPower())
+,   _powerShown(_power)
 {
     portMUX_INITIALIZE(&mHardwareLock);
 }
@@ -41,7 +68,11 @@ Hardware::Hardware()
 
 void Hardware::begin()
 {
-    _display.init();
+#if CONFIG_DISPLAY_FRAMEBUFFER
+    _display.init(true);
+#else
+    _display.init(false, CONFIG_DISPLAY_GLYPH_CACHE_SLOTS);
+#endif
     ESP_LOGI(TAG, "TFT initialized.");
 
     // ── FACTORY_LED — output, initially off ──────────────────────────────
@@ -79,23 +110,35 @@ void Hardware::startDrawing(void* pvParameters)
     ESP_LOGI(TAG, "Starting Draw task");
     Hardware *h = static_cast<Hardware*>(pvParameters);
 
-    // Paint header bar then initial icons.
+    // Paint header bar then initial icons; the scheduler's first pass draws
+    // the standby body.
     h->_display.paintHeaderBackground();
     h->_display.showBLEState(h->mBleState);
     h->_display.showBatteryLevel(h->_battery.level(), h->_battery.isCharging());
-    {
-        char initMsg[sizeof(h->mMessage)];
-        portENTER_CRITICAL(&h->mHardwareLock);
-        memcpy(initMsg, h->mMessage, sizeof(initMsg));
-        portEXIT_CRITICAL(&h->mHardwareLock);
-        h->_display.standby(h->mBleState, initMsg);
-    }
+    h->_power.wake(_nowMs());
+    h->_publishPower();
+    h->_publishHeader();
 
     while (true)
     {
+        // Never sleep through a dwell: wake for the next DRAW_* bit or the
+        // current screen's deadline, whichever comes first — or for the
+        // next step of a scrolling message, or of display power.
+        const uint32_t before     = _nowMs();
+        const uint32_t scrollWait = h->_display.scrollWaitMs(before);
+        const uint32_t powerWait  = h->_power.waitMs(before);
+        uint32_t       wait       = h->_screens.waitMs(before);
+        if (scrollWait < wait) wait = scrollWait;
+        if (powerWait < wait)  wait = powerWait;
         uint32_t bits = 0;
-        xTaskNotifyWait(0u, 0xFFFFFFFFu, &bits, portMAX_DELAY);
-
+        xTaskNotifyWait(0u, 0xFFFFFFFFu, &bits,
+                        wait == UINT32_MAX ? portMAX_DELAY : pdMS_TO_TICKS(wait));
+        const uint32_t now = _nowMs();
+
+        // ── Header — updated on every pass, whatever the body shows.  The
+        // Display setters only record state; the flush at the end of the
+        // pass redraws the cells that changed, together, and a burst of
+        // identical updates costs nothing.
         if (bits & DRAW_BATTERY)
         {
             // Blocking ADC read — safe here in the draw task (not timer task).
@@ -143,67 +186,59 @@ void Hardware::startDrawing(void* pvParameters)
             h->_display.showLoraState(connected);
         }
 
+        // ── Body sources
         if (bits & (DRAW_NOTIFY | DRAW_STATE))
         {
-            h->_display.showCallState(Notifications.isCallingNotification());
-
-            notification_def callNotification;
-            if (Notifications.takeCallingNotification(callNotification)) {
-                h->showNotification(callNotification);
-                h->glow(true);
-                vTaskDelay(pdMS_TO_TICKS(15000));
-                h->glow(false);
+            const bool calling = Notifications.isCallingNotification();
+            h->_display.showCallState(calling);
+            if (calling) {
+                h->_screens.post(Screen::Call, now);
+            } else {
+                if (h->_screens.current() == Screen::Call)
+                    Buzzer::stop();             // hung up while ringing
+                h->_screens.finish(Screen::Call, now);
             }
+            h->_screens.post(Screen::Notification, now);
 
-            // Drain all pending regular notifications.  Run in a loop so that
-            // any notifications that completed DURING the display delays above
-            // are picked up in the same DRAW_NOTIFY handling pass rather than
-            // waiting for the next (potentially never-arriving) DRAW_NOTIFY event.
-            static constexpr size_t MAX_BATCH = 8;
-            notification_def pending[MAX_BATCH];
-            size_t pendingCount = 0;
-            do {
-                pendingCount = Notifications.takeAllPendingNotifications(pending, MAX_BATCH);
-                for (size_t i = 0; i < pendingCount; i++) {
-                    h->showNotification(pending[i]);
-                    h->glow(true);
-                    vTaskDelay(pdMS_TO_TICKS(15000));
-                    h->glow(false);
-                    vTaskDelay(pdMS_TO_TICKS(10));
-                }
-            } while (pendingCount > 0);
-
-            char localMsg[sizeof(h->mMessage)];
-            portENTER_CRITICAL(&h->mHardwareLock);
-            memcpy(localMsg, h->mMessage, sizeof(localMsg));
-            portEXIT_CRITICAL(&h->mHardwareLock);
-            h->_display.standby(h->mBleState, localMsg);
-            vTaskDelay(pdMS_TO_TICKS(100));
+            // BLE state or pairing passcode changed under the idle screen.
+            if ((bits & DRAW_STATE) && h->_screens.current() == Screen::Standby) {
+                h->_wakeDisplay(now);
+                h->_drawStandby();
+            }
         }
 
+#if CONFIG_LORA_ENABLED
         if (bits & DRAW_LORA)
         {
-#if CONFIG_LORA_ENABLED
-            MeshMessage msg = Lora.lastMessage();
-            if (msg.valid)
-            {
-                Buzzer::play(msg.isAlert ? Buzzer::SoundType::ALERT
-                                         : Buzzer::SoundType::LORA);
-                h->_display.showLoraMessage(msg);
-                h->glow(true);
-                vTaskDelay(pdMS_TO_TICKS(msg.isAlert ? 15000 : 10000));
-                h->glow(false);
-                char localMsg[sizeof(h->mMessage)];
-                portENTER_CRITICAL(&h->mHardwareLock);
-                memcpy(localMsg, h->mMessage, sizeof(localMsg));
-                portEXIT_CRITICAL(&h->mHardwareLock);
-                h->_display.standby(h->mBleState, localMsg);
-            }
-#endif
+            h->_screens.post(Screen::Mesh, now);
+            uint32_t    seq;
+            MeshMessage alert;
+            if (h->_peekAlert(seq, alert))
+                h->_screens.post(Screen::Alert, now);
         }
+#endif
 
         if (bits & DRAW_LORA_POS) { /* silent — neighbour table updated in LoRa task */ }
         if (bits & DRAW_LORA_NODE) { /* silent — neighbour table updated in LoRa task */ }
+
+        ScreenPick pick;
+        while (h->_screens.next(now, pick))
+            h->_drawScreen(pick, now);
+
+        // Move a long message on; one drawn in this pass holds at the top.
+        h->_display.scrollStep(now);
+
+        // Anything but standby keeps the panel lit; idle, dim then sleep.
+        // Asleep, the flush below holds its changes for the next wake.
+        if (h->_screens.current() != Screen::Standby)
+            h->_wakeDisplay(now);
+        else if (h->_power.step(now))
+            h->_display.setPower(h->_power.state(), h->_power.backlightPercent());
+        h->_publishPower();
+
+        // Header and body changes of this pass reach the panel together.
+        h->_display.flush();
+        h->_publishHeader();
     }
 
     ESP_LOGI(TAG, "Ending Draw task");
@@ -211,6 +246,203 @@ void Hardware::startDrawing(void* pvParameters)
     vTaskDelete(nullptr);
 }
 
+// ── _drawScreen (private) ─────────────────────────────────────────────────
+
+void Hardware::_drawScreen(ScreenPick const& pick, uint32_t nowMs)
+{
+    const ScreenDwell& dwell = _screens.dwellTimes();
+
+    // Light the panel before drawing: drawing direct, the body goes
+    // straight to it.
+    _wakeDisplay(nowMs);
+
+    switch (pick.screen)
+    {
+    case Screen::Standby:
+        glow(false);
+        _drawStandby();
+        break;
+
+    case Screen::Call:
+        if (!pick.resume)
+        {
+            if (!Notifications.takeCallingNotification(_callNotif)) {
+                _screens.drained(Screen::Call);
+                return;
+            }
+            Buzzer::play(true);
+            _screens.shown(Screen::Call, nowMs, dwell.callMs);
+        }
+        _display.showNotification(_callNotif, nowMs);
+        glow(true);
+        break;
+
+    case Screen::Notification:
+        if (!pick.resume)
+        {
+            if (_notifHead == _notifCount) {
+                _notifCount = Notifications.takeAllPendingNotifications(_notifBatch, NOTIF_BATCH);
+                _notifHead  = 0;
+            }
+            if (_notifHead == _notifCount) {
+                _screens.drained(Screen::Notification);
+                return;
+            }
+            _notif = _notifBatch[_notifHead++];
+            const bool more = _notifHead < _notifCount || _screens.pending(Screen::Mesh);
+            Buzzer::play(_notif.isCall());
+            _screens.shown(Screen::Notification, nowMs,
+                           _screens.dwell(_screens.notificationDwell(_notif.categoryId), more));
+        }
+        _display.showNotification(_notif, nowMs);
+        glow(true);
+        break;
+
+    case Screen::Alert:
+#if CONFIG_LORA_ENABLED
+        if (!pick.resume)
+        {
+            uint32_t seq;
+            if (!_peekAlert(seq, _alertMsg)) {
+                _screens.drained(Screen::Alert);
+                return;
+            }
+            _alertNext = seq + 1;
+            Buzzer::play(Buzzer::SoundType::ALERT);
+            _screens.shown(Screen::Alert, nowMs, dwell.alertMs);
+        }
+        _display.showLoraMessage(_alertMsg, mc_inboxUnread(Lora.inbox()));
+        glow(true);
+#else
+        _screens.drained(Screen::Alert);
+        return;
+#endif
+        break;
+
+    case Screen::Mesh:
+#if CONFIG_LORA_ENABLED
+        if (!pick.resume)
+        {
+            // Oldest unread first.  An alert already shown ahead of its turn
+            // is passed over; one that was not is shown here, in order.
+            McInbox& inbox = Lora.inbox();
+            uint32_t seq;
+            bool     got = false;
+            while (!got && mc_inboxTakeUnread(inbox, _meshMsg, seq))
+                got = !(_meshMsg.isAlert && seq < _alertNext);
+            if (!got) {
+                _screens.drained(Screen::Mesh);
+                return;
+            }
+            if (_meshMsg.isAlert) _alertNext = seq + 1;
+
+            const bool more = mc_inboxUnread(inbox) > 0 || _screens.pending(Screen::Notification);
+            if (_meshMsg.isAlert || _lastShown != Screen::Mesh)
+                Buzzer::play(_meshMsg.isAlert ? Buzzer::SoundType::ALERT
+                                              : Buzzer::SoundType::LORA);
+            _screens.shown(Screen::Mesh, nowMs,
+                           _meshMsg.isAlert ? dwell.alertMs : _screens.dwell(dwell.meshMs, more));
+        }
+        _display.showLoraMessage(_meshMsg, mc_inboxUnread(Lora.inbox()));
+        glow(true);
+#else
+        _screens.drained(Screen::Mesh);
+        return;
+#endif
+        break;
+    }
+
+    _lastShown = pick.screen;
+}
+
+// ── _wakeDisplay (private) ────────────────────────────────────────────────
+
+void Hardware::_wakeDisplay(uint32_t nowMs)
+{
+    if (_power.wake(nowMs) != PanelPower::Full)
+        _display.setPower(PanelPower::Full, _power.backlightPercent());
+}
+
+// ── _publishPower (private) ───────────────────────────────────────────────
+
+void Hardware::_publishPower()
+{
+    portENTER_CRITICAL(&mHardwareLock);
+    _powerShown = _power;
+    portEXIT_CRITICAL(&mHardwareLock);
+}
+
+// ── _publishHeader (private) ──────────────────────────────────────────────
+// After flush(), which draws the pass's header bursts.
+
+void Hardware::_publishHeader()
+{
+    const HeaderStats& stats = _display.headerStats();
+    portENTER_CRITICAL(&mHardwareLock);
+    _headerShown = stats;
+    portEXIT_CRITICAL(&mHardwareLock);
+}
+
+// ── headerStats ───────────────────────────────────────────────────────────
+
+HeaderStats Hardware::headerStats()
+{
+    portENTER_CRITICAL(&mHardwareLock);
+    const HeaderStats stats = _headerShown;
+    portEXIT_CRITICAL(&mHardwareLock);
+    return stats;
+}
+
+// ── displayPowerState / displayPowerStats ─────────────────────────────────
+// _power changes only inside a draw pass, so the copy taken at its end is
+// exact until the next one; stats() carries the current state up to now.
+
+PanelPower Hardware::displayPowerState()
+{
+    portENTER_CRITICAL(&mHardwareLock);
+    const PanelPower state = _powerShown.state();
+    portEXIT_CRITICAL(&mHardwareLock);
+    return state;
+}
+
+DisplayPowerStats Hardware::displayPowerStats()
+{
+    portENTER_CRITICAL(&mHardwareLock);
+    const DisplayPower power = _powerShown;
+    portEXIT_CRITICAL(&mHardwareLock);
+    return power.stats(_nowMs());
+}
+
+// ── _drawStandby (private) ────────────────────────────────────────────────
+
+void Hardware::_drawStandby()
+{
+    char localMsg[sizeof(mMessage)];
+    portENTER_CRITICAL(&mHardwareLock);
+    memcpy(localMsg, mMessage, sizeof(localMsg));
+    portEXIT_CRITICAL(&mHardwareLock);
+    _display.standby(mBleState, localMsg);
+}
+
+// ── _peekAlert (private) ──────────────────────────────────────────────────
+
+bool Hardware::_peekAlert(uint32_t& seq, MeshMessage& out) const
+{
+#if CONFIG_LORA_ENABLED
+    const McInbox& inbox = Lora.inbox();
+    const uint32_t head  = mc_inboxHead(inbox);
+    uint32_t n = mc_inboxFirstUnread(inbox);
+    if (n < _alertNext) n = _alertNext;
+    for (; n < head; n++) {
+        if (mc_inboxGet(inbox, n, out) && out.isAlert) {
+            seq = n;
+            return true;
+        }
+    }
+#endif
+    return false;
+}
+
 // ── pairing ───────────────────────────────────────────────────────────────
 
 void Hardware::pairing(const char* passcode)
@@ -240,14 +472,6 @@ void Hardware::notifyDraw(uint32_t events)
         xTaskNotify(mDrawTask, events, eSetBits);
 }
 
-// ── showNotification (private) ────────────────────────────────────────────
-
-void Hardware::showNotification(notification_def const& notification)
-{
-    Buzzer::play(notification.isCall());
-    _display.showNotification(notification);
-}
-
 // ── showTime ──────────────────────────────────────────────────────────────
 
 void Hardware::showTime(const char* timestamp)
@@ -259,13 +483,6 @@ void Hardware::showTime(const char* timestamp)
     notifyDraw(DRAW_TIME);
 }
 
-// ── showCallState ─────────────────────────────────────────────────────────
-
-void Hardware::showCallState(bool active)
-{
-    _display.showCallState(active);
-}
-
 // ── showGpsState ──────────────────────────────────────────────────────────
 
 void Hardware::showGpsState(bool fixed)
@@ -286,27 +503,6 @@ void Hardware::showLoraState(bool connected)
     notifyDraw(DRAW_LORA_MESH);
 }
 
-// ── showLoraMessage ───────────────────────────────────────────────────────
-
-void Hardware::showLoraMessage(MeshMessage const& msg)
-{
-    _display.showLoraMessage(msg);
-}
-
-// ── showPositionMessage ───────────────────────────────────────────────────
-
-void Hardware::showPositionMessage(MeshPosition const& pos)
-{
-    _display.showPositionMessage(pos);
-}
-
-// ── showNodeInfoMessage ───────────────────────────────────────────────────
-
-void Hardware::showNodeInfoMessage(MeshUser const& user)
-{
-    _display.showNodeInfoMessage(user);
-}
-
 // ── glow ──────────────────────────────────────────────────────────────────
 
 void Hardware::glow(bool on)
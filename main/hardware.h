@@ -20,14 +20,14 @@
 
 #include "battery_monitor.h"
 #include "display.h"          // pulls in util.h → conn_state_def
+#include "notificationservice.h"
+#include "screen_scheduler.h"
 #include <freertos/FreeRTOS.h>
 #include <freertos/portmacro.h>
 #include <freertos/timers.h>
 #include <time.h>
 #include <climits>
 
-struct notification_def;
-
 class Hardware
 {
     friend class NotificationService;
@@ -70,13 +70,9 @@ public:
     void setBLEConnectionState(conn_state_def state);
     void notifyDraw(uint32_t events);
     void showTime(const char* timestamp);
-    void showCallState(bool active);
     void showGpsState(bool fixed);
     void showLoraState(bool connected);
     void glow(bool on);
-    void showLoraMessage(struct MeshMessage const& msg);
-    void showPositionMessage(struct MeshPosition const& pos);
-    void showNodeInfoMessage(struct MeshUser const& user);
     /**
      * Called from the CTS TimeCallback after the system clock has been synced.
      * Stores the UTC offset, immediately updates the header clock, and starts
@@ -109,16 +105,61 @@ public:
      */
     bool isCharging() const { return _battery.isCharging(); }
 
+    /**
+     * Header redraw counters (header_bar.h), from the copy the draw task
+     * publishes after each pass — safe from any task.
+     */
+    HeaderStats headerStats();
+
+    /**
+     * Display power state and estimated current (display_power.h), from the
+     * copy the draw task publishes after each pass — safe from any task.
+     */
+    PanelPower        displayPowerState();
+    DisplayPowerStats displayPowerStats();
+    uint32_t          displayCurrentUa(PanelPower s) const { return _power.currentUa(s); }
+
 private:
     static void startDrawing(void* pvParameters);
     static void clockTimerCallback(TimerHandle_t xTimer);
-    void showNotification(notification_def const& notification);
+
+    // ── Body screens (draw task only) ─────────────────────────────────────
+    static constexpr size_t NOTIF_BATCH = 8;
+
+    static uint32_t _nowMs() { return xTaskGetTickCount() * portTICK_PERIOD_MS; }
+    /// Draw what the scheduler picked: take fresh content, or redraw the
+    /// kept copy when resuming after a preemption.
+    void _drawScreen(ScreenPick const& pick, uint32_t nowMs);
+    void _drawStandby();
+    /// Back to full brightness, waking the panel if it sleeps.
+    void _wakeDisplay(uint32_t nowMs);
+    /// Copy _power for displayPowerState()/displayPowerStats().
+    void _publishPower();
+    /// Copy the header redraw counters for headerStats().
+    void _publishHeader();
+    /// First unread mesh alert not yet shown ahead of its turn.
+    bool _peekAlert(uint32_t& seq, MeshMessage& out) const;
 
     TaskHandle_t  mDrawTask = nullptr;
 
     Display        _display;
     BatteryMonitor _battery;
 
+    // Body screen state — draw task only.
+    ScreenScheduler  _screens;
+    DisplayPower     _power;                    ///< idle dim and sleep
+    DisplayPower     _powerShown;               ///< _power as of the last pass; mHardwareLock
+    HeaderStats      _headerShown;              ///< header counters as of the last pass; mHardwareLock
+    notification_def _callNotif;                ///< kept for resume after preemption
+    notification_def _notif;
+    notification_def _notifBatch[NOTIF_BATCH];  ///< taken from NotificationService, shown one by one
+    size_t           _notifHead  = 0;
+    size_t           _notifCount = 0;
+    MeshMessage      _meshMsg;
+    MeshMessage      _alertMsg;
+    uint32_t         _alertNext  = 0;           ///< inbox seq past the last alert shown out of turn
+    Screen           _lastShown  = Screen::Standby;
+
     conn_state_def mBleState     = BLE_DISCONNECTED;
     bool           mGpsFixed     = false;
     bool           mLoraConnected = false;
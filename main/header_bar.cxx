@@ -0,0 +1,188 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * header_bar.cxx — header cell diffing and row composition (see
+ * header_bar.h).
+ */
+
+#include "header_bar.h"
+
+#include <cstring>
+
+namespace {
+
+constexpr uint8_t ICON   = 16;
+constexpr uint8_t ICON_Y = 1;
+constexpr uint8_t TIME_Y = 6;
+
+// Left column of each icon, back from the right edge.
+constexpr uint8_t FROM_RIGHT[HDR_CELLS] = { 0, 84, 67, 50, 33, 16 };
+
+void grow(HeaderRect& r, bool& any, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1)
+{
+    if (!any) {
+        r   = { x0, y0, x1, y1 };
+        any = true;
+        return;
+    }
+    if (x0 < r.x0) r.x0 = x0;
+    if (y0 < r.y0) r.y0 = y0;
+    if (x1 > r.x1) r.x1 = x1;
+    if (y1 > r.y1) r.y1 = y1;
+}
+
+bool printable(char ch)
+{
+    return ch >= FONT_FIRST && static_cast<uint32_t>(ch - FONT_FIRST) < FONT_GLYPHS;
+}
+
+} // namespace
+
+HeaderBar::HeaderBar(uint8_t width, uint16_t background, uint16_t timeColor)
+    : _bg(__builtin_bswap16(background)), _fg(__builtin_bswap16(timeColor))
+{
+    for (uint8_t c = 0; c < HDR_CELLS; c++)
+        _x[c] = c == HDR_TIME ? 0 : static_cast<uint8_t>(width - FROM_RIGHT[c]);
+    memset(_wantTime, ' ', HDR_TIME_CHARS);
+    _wantTime[HDR_TIME_CHARS] = '\0';
+    memcpy(_shownTime, _wantTime, sizeof(_shownTime));
+}
+
+void HeaderBar::_note(bool changed)
+{
+    _stats.updates++;
+    if (!changed) _stats.unchanged++;
+}
+
+void HeaderBar::setIcon(HeaderCell cell, const uint8_t* xbm, uint16_t color)
+{
+    if (cell == HDR_TIME || cell >= HDR_CELLS) return;
+    Icon icon;
+    icon.xbm   = xbm;
+    icon.color = __builtin_bswap16(color);
+    _note(!(icon == _want[cell]));
+    _want[cell] = icon;
+}
+
+void HeaderBar::setTime(const char* text)
+{
+    char t[HDR_TIME_CHARS + 1];
+    size_t i = 0;
+    for (; i < HDR_TIME_CHARS && text[i]; i++) t[i] = text[i];
+    for (; i < HDR_TIME_CHARS; i++) t[i] = ' ';
+    t[HDR_TIME_CHARS] = '\0';
+    _note(memcmp(t, _wantTime, HDR_TIME_CHARS) != 0);
+    memcpy(_wantTime, t, sizeof(t));
+}
+
+void HeaderBar::invalidate()
+{
+    _valid = false;
+}
+
+uint8_t HeaderBar::dirty(HeaderRect* out) const
+{
+    HeaderRect icons, clock;
+    bool anyIcon = false, anyDigit = false;
+    for (uint8_t c = HDR_TIME + 1; c < HDR_CELLS; c++)
+        if (!_valid || !(_want[c] == _shown[c]))
+            grow(icons, anyIcon, _x[c], ICON_Y, _x[c] + ICON - 1, ICON_Y + ICON - 1);
+
+    // The clock a digit at a time: a minute tick redraws one or two.
+    const uint8_t w = Font_7x10.width;
+    for (uint8_t i = 0; i < HDR_TIME_CHARS; i++)
+        if (!_valid || _wantTime[i] != _shownTime[i])
+            grow(clock, anyDigit, i * w, TIME_Y, i * w + w - 1, TIME_Y + Font_7x10.height - 1);
+
+    uint8_t n = 0;
+    if (anyIcon && anyDigit)
+    {
+        // One window for both if the background between is cheaper.
+        HeaderRect both = icons;
+        bool any = true;
+        grow(both, any, clock.x0, clock.y0, clock.x1, clock.y1);
+        if (both.area() <= icons.area() + clock.area() + FB_RECT_COST_PX) {
+            out[n++] = both;
+            return n;
+        }
+    }
+    if (anyIcon)  out[n++] = icons;
+    if (anyDigit) out[n++] = clock;
+    return n;
+}
+
+void HeaderBar::drawRow(uint8_t y, uint8_t x0, uint8_t w, uint16_t* dst) const
+{
+    font_fill(dst, _bg, w);
+    const uint32_t x1 = x0 + w;     // exclusive
+
+    if (y >= ICON_Y && y < ICON_Y + ICON)
+    {
+        for (uint8_t c = HDR_TIME + 1; c < HDR_CELLS; c++)
+        {
+            const Icon& icon = _want[c];
+            if (!icon.xbm || _x[c] + ICON <= x0 || _x[c] >= x1) continue;
+            // XBM: two bytes a row, least significant bit leftmost.
+            const uint8_t* bits = icon.xbm + (y - ICON_Y) * ((ICON + 7) / 8);
+            for (uint32_t col = 0; col < ICON; col++)
+            {
+                const uint32_t x = _x[c] + col;
+                if (x >= x0 && x < x1 && (bits[col >> 3] >> (col & 7) & 1))
+                    dst[x - x0] = icon.color;
+            }
+        }
+    }
+
+    if (y >= TIME_Y && y < TIME_Y + Font_7x10.height)
+    {
+        const uint8_t cw = Font_7x10.width;
+        for (uint8_t i = 0; i < HDR_TIME_CHARS; i++)
+        {
+            const char ch = _wantTime[i];
+            const uint32_t left = static_cast<uint32_t>(i) * cw;
+            if (!printable(ch) || left + cw <= x0 || left >= x1) continue;
+            uint16_t px[16];
+            GlyphRows glyph(Font_7x10, ch);
+            glyph.skip(y - TIME_Y);
+            glyph.row(_fg, _bg, px);
+            for (uint32_t col = 0; col < cw; col++)
+                if (left + col >= x0 && left + col < x1)
+                    dst[left + col - x0] = px[col];
+        }
+    }
+}
+
+void HeaderBar::drawn()
+{
+    HeaderRect r[HDR_RECTS_MAX];
+    const uint8_t n = dirty(r);
+    for (uint8_t i = 0; i < n; i++)
+        _stats.pixels += r[i].area();
+    _stats.bursts += n;
+
+    for (uint8_t c = HDR_TIME + 1; c < HDR_CELLS; c++)
+        if (!_valid || !(_want[c] == _shown[c]))
+            _stats.cells[c]++;
+    if (!_valid || memcmp(_wantTime, _shownTime, HDR_TIME_CHARS) != 0)
+        _stats.cells[HDR_TIME]++;
+
+    memcpy(_shown, _want, sizeof(_shown));
+    memcpy(_shownTime, _wantTime, sizeof(_shownTime));
+    _valid = true;
+}
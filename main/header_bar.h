@@ -0,0 +1,128 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * header_bar.h — the 20-px status bar at the top of the TFT, redrawn by
+ * difference.
+ *
+ * The Display setters only say what each cell should show — an icon in a
+ * colour, or nothing, and the clock text.  HeaderBar keeps that next to
+ * what was last drawn.  dirty() gives the smallest rectangle covering
+ * every icon that differs, and another for the clock digits that differ
+ * (a minute tick usually changes one) — or a single one for both when
+ * the columns between cost less than a second address window
+ * (FB_RECT_COST_PX).  drawRow() produces any rectangle a row at a time
+ * from the wanted state, background between cells included.
+ * Display::flush() sends each as one address window, however many setters
+ * ran since the last flush, and then calls drawn().
+ *
+ * Cell columns follow the original layout, counted from the right edge:
+ *
+ *   time  call  LoRa  GPS   BLE   battery
+ *   0     W-84  W-67  W-50  W-33  W-16
+ *
+ * Icons are 16×16 XBM at row 1; the clock is Font_7x10 at row 6.  Rows 0
+ * and 17..19 are only ever background (Display::paintHeaderBackground()).
+ *
+ * Pixels come out big-endian, the panel's wire order, like the frame.
+ * HeaderStats counts what was asked against what was redrawn.
+ */
+
+#pragma once
+
+#include "fonts.h"
+#include "framebuffer.h"    // FB_RECT_COST_PX
+
+#include <cstdint>
+
+enum HeaderCell : uint8_t {
+    HDR_TIME,
+    HDR_CALL,
+    HDR_LORA,
+    HDR_GPS,
+    HDR_BLE,
+    HDR_BATTERY,
+    HDR_CELLS,
+};
+
+static constexpr uint8_t HDR_TIME_CHARS = 5;    ///< "HH:MM"
+static constexpr uint8_t HDR_RECTS_MAX  = 2;    ///< icons, clock
+
+/// Redraw counters, since boot.
+struct HeaderStats {
+    uint32_t updates   = 0;     ///< setter calls
+    uint32_t unchanged = 0;     ///< … that asked for what was already wanted
+    uint32_t bursts    = 0;     ///< rectangles redrawn
+    uint32_t pixels    = 0;     ///< pixels in them
+    uint32_t cells[HDR_CELLS] = {};     ///< redraws per cell
+};
+
+/// Inclusive rectangle of the bar to redraw.
+struct HeaderRect {
+    uint8_t x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+
+    uint8_t  width()  const { return static_cast<uint8_t>(x1 - x0 + 1); }
+    uint8_t  height() const { return static_cast<uint8_t>(y1 - y0 + 1); }
+    uint32_t area()   const { return static_cast<uint32_t>(width()) * height(); }
+};
+
+class HeaderBar
+{
+public:
+    HeaderBar(uint8_t width, uint16_t background, uint16_t timeColor);
+
+    /// Show @p xbm (16×16) in @p color in @p cell, or nothing if null.
+    void setIcon(HeaderCell cell, const uint8_t* xbm, uint16_t color);
+    /// Up to HDR_TIME_CHARS characters; shorter is padded with spaces.
+    void setTime(const char* text);
+
+    /// Forget what was drawn: the bar was painted over.  Every cell is
+    /// dirty until the next drawn().
+    void invalidate();
+
+    /// The rectangles to redraw, at most HDR_RECTS_MAX; 0 if nothing
+    /// changed.
+    uint8_t dirty(HeaderRect* out) const;
+
+    /// Row @p y of the wanted bar, columns @p x0 .. @p x0 + @p w − 1.
+    void drawRow(uint8_t y, uint8_t x0, uint8_t w, uint16_t* dst) const;
+
+    /// What dirty() gave is on screen now.
+    void drawn();
+
+    const HeaderStats& stats() const { return _stats; }
+
+private:
+    struct Icon {
+        const uint8_t* xbm   = nullptr;
+        uint16_t       color = 0;
+        bool operator==(const Icon& o) const { return xbm == o.xbm && (!xbm || color == o.color); }
+    };
+
+    void _note(bool changed);
+
+    uint8_t     _x[HDR_CELLS];          ///< left column of each cell
+    uint16_t    _bg;
+    uint16_t    _fg;
+    Icon        _want[HDR_CELLS];
+    Icon        _shown[HDR_CELLS];
+    char        _wantTime[HDR_TIME_CHARS + 1];
+    char        _shownTime[HDR_TIME_CHARS + 1];
+    bool        _valid = false;         ///< _shown / _shownTime are on screen
+    HeaderStats _stats;
+};
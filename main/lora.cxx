@@ -23,8 +23,13 @@
  *   - LoRa::run() — SPI init, SX1262 init, DIO1 ISR install, receive loop,
  *                   periodic TX scheduler (position, nodeinfo, telemetry,
  *                   map report)
+ *   - LoRa::transmit() — queue a frame for the TX pipeline
+ *   - LoRa::_onRadioEvent() — MeshRadio outcomes → _stats and the log
+ *   - LoRa::_periodicTxAllowed() — duty-cycle gate for periodic broadcasts
  *   - extern Lora instance
  *
+ * Radio core (wakeup, IRQ dispatch, TX/LBT state machine, relay):
+ *                          mesh_radio.cxx
  * SX1262 hardware layer:   sx1262.cxx
  * Meshtastic protocol:     meshtastic_proto.cxx
  * Shared internal constants: lora_internal.h
@@ -45,14 +50,48 @@
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 #include <cinttypes>
+#include <cstring>
 #include <ctime>
 
 static const char* TAG = "lora";
 
 // ── Constructor ───────────────────────────────────────────────────────────
+static MeshRadioConfig _radioConfig()
+{
+    MeshRadioConfig c;
+    c.freqHz        = LORA_FREQ_HZ;
+    c.sf            = LORA_SF;
+    c.bwHz          = LORA_BW_HZ;
+    c.cr            = LORA_CR;
+    c.preambleLen   = LORA_PREAMBLE_LEN;
+    c.ldro          = LORA_LDRO;
+    c.dutyPct       = CONFIG_LORA_DUTY_CYCLE_PCT;
+    c.role          = CONFIG_MESH_NODE_ROLE;
+    c.relay         = CONFIG_LORA_TX_ENABLED;
+    c.dedupWindowMs = CONFIG_MESH_DEDUP_WINDOW_SEC * 1000u;
+    return c;
+}
+
+static MeshAppConfig _appConfig()
+{
+    MeshAppConfig c;
+    c.licensed = CONFIG_LORA_IS_LICENSED;
+    c.tx       = CONFIG_LORA_TX_ENABLED;
+    return c;
+}
+
+// Neighbour-table writes in MeshApp are bracketed by _neighborLock, which
+// the public neighbour readers take.  MeshApp only stores the pointer.
 LoRa::LoRa(const char* name, uint16_t stackSize)
 :   Task(name, stackSize, 4)  // priority 4 — below BLE (5), above draw (3)
-{ }
+,   MeshRadio(*this, _radioConfig())
+,   MeshApp(_appConfig(), {
+        [](void* mux) { portENTER_CRITICAL(static_cast<portMUX_TYPE*>(mux)); },
+        [](void* mux) { portEXIT_CRITICAL(static_cast<portMUX_TYPE*>(mux)); },
+        &_neighborLock,
+    })
+{
+}
 
 // ── run ───────────────────────────────────────────────────────────────────
 void LoRa::run(void* /*data*/)
@@ -85,7 +124,8 @@ void LoRa::run(void* /*data*/)
     dev.mode           = 0;         // CPOL=0, CPHA=0
     dev.clock_speed_hz = SPI_FREQ_HZ;
     dev.spics_io_num   = PIN_NSS;
-    dev.queue_size     = 1;
+    dev.queue_size     = SX_BATCH_MAX;  // a whole batch in flight at once
+    dev.pre_cb         = _busyPreCb;
 
     err = spi_bus_add_device(SPI_HOST, &dev, &_spi);
     if (err != ESP_OK)
@@ -112,6 +152,16 @@ void LoRa::run(void* /*data*/)
     busy_conf.intr_type    = GPIO_INTR_DISABLE;
     gpio_config(&busy_conf);
 
+    // BUSY falling-edge interrupt, armed by _waitBusy only while it blocks.
+    gpio_install_isr_service(0);   // safe to call multiple times
+    _busySem = xSemaphoreCreateBinary();
+    if (_busySem)
+    {
+        gpio_set_intr_type(PIN_BUSY, GPIO_INTR_NEGEDGE);
+        gpio_isr_handler_add(PIN_BUSY, _busyIsr, this);
+        gpio_intr_disable(PIN_BUSY);
+    }
+
     // ── SX1262 init ───────────────────────────────────────────────────────
     if (!_initSx1262())
     {
@@ -132,11 +182,10 @@ void LoRa::run(void* /*data*/)
     dio1_conf.intr_type    = GPIO_INTR_POSEDGE;
     gpio_config(&dio1_conf);
 
-    gpio_install_isr_service(0);   // safe to call multiple times
     gpio_isr_handler_add(PIN_DIO1, _dio1Isr, this);
 
     // ── Enter RX mode ─────────────────────────────────────────────────────
-    _setRx();
+    _radioStart(_nowMs());
 
     portENTER_CRITICAL(&_statsLock);
     _stats.state = LoRaStats::State::Listening;
@@ -198,122 +247,14 @@ void LoRa::run(void* /*data*/)
     // ── Receive loop ──────────────────────────────────────────────────────
     while (true)
     {
-        // Wait for DIO1 IRQ (notified by ISR) or 30 s timeout.
-        // The timeout ensures we re-enter RX even if DIO1 was missed.
-        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(30000));
-
-        const uint16_t irq = _getIrqStatus();
-        _clearIrq(0xFFFF);
-
-        // Count preamble/header-valid events from the global IRQ mask.
-        // These don't fire DIO1 but are visible in GetIrqStatus.
-        if (irq & IRQ_PREAMBLE_DET)
-        {
-            portENTER_CRITICAL(&_statsLock);
-            _stats.preambles++;
-            portEXIT_CRITICAL(&_statsLock);
-        }
-        if (irq & IRQ_HEADER_VALID)
-        {
-            portENTER_CRITICAL(&_statsLock);
-            _stats.headersValid++;
-            portEXIT_CRITICAL(&_statsLock);
-        }
-
-        if (irq & IRQ_RX_DONE)
-        {
-            portENTER_CRITICAL(&_statsLock);
-            _stats.rxPackets++;
-            portEXIT_CRITICAL(&_statsLock);
-
-            // GetRxBufferStatus
-            uint8_t txs[4] = { CMD_GET_RX_BUF_STATUS, 0, 0, 0 };
-            uint8_t rxs[4] = {};
-            _transact(txs, rxs, sizeof(txs));
-            const uint8_t payloadLen = rxs[2];
-            const uint8_t rxPtr      = rxs[3];
-
-            ESP_LOGD(TAG, "RX_DONE irq=0x%04x len=%u ptr=0x%02x",
-                     irq, payloadLen, rxPtr);
-
-            // ── CRC error check (must be inside RX_DONE, not a separate else-if)
-            // The SX1262 sets BOTH RX_DONE and CRC_ERROR for packets that
-            // complete reception but fail the LoRa CRC.  Without this check,
-            // corrupted packets would be fed to _processPacket and AES-CTR
-            // would silently "decrypt" garbage.
-            if (irq & IRQ_CRC_ERROR)
-            {
-                portENTER_CRITICAL(&_statsLock);
-                _stats.rxPackets--;   // undo the increment above
-                _stats.crcErrors++;
-                portEXIT_CRITICAL(&_statsLock);
-
-                uint8_t txp[4] = { CMD_GET_PKT_STATUS, 0, 0, 0 };
-                uint8_t rxp[4] = {};
-                _transact(txp, rxp, sizeof(txp));
-                const int16_t rssi = -(static_cast<int16_t>(rxp[2])) / 2;
-                const float   snr  = static_cast<float>(static_cast<int8_t>(rxp[3])) / 4.0f;
-                ESP_LOGD(TAG, "CRC_ERR (with RX_DONE) irq=0x%04x rssi=%d snr=%.1f — discarding",
-                         irq, rssi, (double)snr);
-            }
-            else if (payloadLen > 0)
-            {
-                uint8_t txp[4] = { CMD_GET_PKT_STATUS, 0, 0, 0 };
-                uint8_t rxp[4] = {};
-                _transact(txp, rxp, sizeof(txp));
-                const int16_t rssi = -(static_cast<int16_t>(rxp[2])) / 2;
-                const float   snr  = static_cast<float>(static_cast<int8_t>(rxp[3])) / 4.0f;
-
-                // ReadBuffer → [cmd, startPtr, dummy_status, data[0], data[1], ...]
-                const size_t txLen = 3 + payloadLen;
-                uint8_t txb[3 + 255] = { CMD_READ_BUFFER, rxPtr, 0x00 };
-                uint8_t rxb[3 + 255] = {};
-                _waitBusy();
-                spi_transaction_t t = {};
-                t.length    = txLen * 8;
-                t.tx_buffer = txb;
-                t.rx_buffer = rxb;
-                spi_device_polling_transmit(_spi, &t);
-
-                _processPacket(rxb + 3, payloadLen, rssi, snr);
-            }
-        }
-        else if (irq & IRQ_HEADER_ERR)
-        {
-            portENTER_CRITICAL(&_statsLock);
-            _stats.headerErrors++;
-            portEXIT_CRITICAL(&_statsLock);
-
-            uint8_t txp[4] = { CMD_GET_PKT_STATUS, 0, 0, 0 };
-            uint8_t rxp[4] = {};
-            _transact(txp, rxp, sizeof(txp));
-            const int16_t rssi = -(static_cast<int16_t>(rxp[2])) / 2;
-            const float   snr  = static_cast<float>(static_cast<int8_t>(rxp[3])) / 4.0f;
+        // Wait for DIO1 IRQ (notified by ISR) or until MeshRadio next has
+        // work: a TX poll, a relay or backoff falling due, or at most
+        // IDLE_WAIT_MS so RX is re-entered even if DIO1 was missed.
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(_radioWaitMs(_nowMs())));
 
-            ESP_LOGD(TAG, "HDR_ERR irq=0x%04x rssi=%d snr=%.1f iq_cfg=0x%02x",
-                     irq, rssi, (double)snr, _readReg(REG_IQ_CONFIG));
-        }
-        else if (irq & IRQ_CRC_ERROR)
-        {
-            // CRC_ERROR without RX_DONE — unusual but handle gracefully
-            portENTER_CRITICAL(&_statsLock);
-            _stats.crcErrors++;
-            portEXIT_CRITICAL(&_statsLock);
-
-            uint8_t txp[4] = { CMD_GET_PKT_STATUS, 0, 0, 0 };
-            uint8_t rxp[4] = {};
-            _transact(txp, rxp, sizeof(txp));
-            const int16_t rssi = -(static_cast<int16_t>(rxp[2])) / 2;
-            const float   snr  = static_cast<float>(static_cast<int8_t>(rxp[3])) / 4.0f;
-
-            ESP_LOGD(TAG, "CRC_ERR (no RX_DONE) irq=0x%04x rssi=%d snr=%.1f",
-                     irq, rssi, (double)snr);
-        }
-        else if (irq & IRQ_TIMEOUT)
-        {
-            ESP_LOGD(TAG, "LoRa RX timeout (re-entering RX)");
-        }
-        // else: spurious 30 s wakeup — just re-enter RX
+        // Status batch, TX / CAD / RX completion, re-enter RX.
+        const bool rxBusy = _radioService(_nowMs());
+        _publishAirtime();
 
         // ── 30-second diagnostic log ──────────────────────────────────────
         const TickType_t now = xTaskGetTickCount();
@@ -323,33 +264,47 @@ void LoRa::run(void* /*data*/)
             const LoRaStats s        = stats();
             const int16_t   noiseFloor = _getInstRssi();
             const uint8_t   chipMode   = _getChipMode();
-            const uint8_t   iqCfg      = _readReg(REG_IQ_CONFIG);
+            const uint8_t   iqCfg      = sx_readReg(*this, REG_IQ_CONFIG);
             ESP_LOGD(TAG,
                 "DIAG: preamble=%" PRIu32 " hdr_ok=%" PRIu32
                 " rx=%" PRIu32 "  crc_err=%" PRIu32
                 "  hdr_err=%" PRIu32 "  decrypt_ok=%" PRIu32
+                "  dup=%" PRIu32
                 "  text=%" PRIu32 "  tx=%" PRIu32 "  tx_err=%" PRIu32
-                "  tx_timeout=%" PRIu32 "  neighbors=%u"
+                "  tx_timeout=%" PRIu32
+                "  relay=%" PRIu32 "/%" PRIu32 "/%" PRIu32
+                "  txq=%u/%u drop=%" PRIu32
+                "  cad=%" PRIu32 "/%" PRIu32 " backoff=%" PRIu32 "/%" PRIu32 "ms"
+                " forced=%" PRIu32 " util=%u%%"
+                "  ch_util=%.1f%% air_tx=%.1f%% duty_defer=%" PRIu32 "/%" PRIu32
+                "  neighbors=%u"
                 "  last_rssi=%d  last_snr=%.1f"
                 "  noise=%d dBm  mode=0x%02x  iq=0x%02x",
                 s.preambles, s.headersValid,
                 s.rxPackets, s.crcErrors, s.headerErrors,
-                s.decryptOk, s.textMessages,
+                s.decryptOk, s.duplicates, s.textMessages,
                 s.txPackets, s.txErrors, s.txTimeouts,
+                s.relayed, s.relayCancelled, s.relayDropped,
+                (unsigned)s.txQueueDepth, (unsigned)s.txQueueHighWater,
+                s.txQueueDropped,
+                s.cadClear, s.cadBusy, s.txBackoffs, s.txBackoffMs,
+                s.txForced, (unsigned)s.lbtUtil,
+                (double)s.channelUtil, (double)s.airUtilTx,
+                s.txDutyDeferred, s.txDutyDropped,
                 (unsigned)neighborCount(),
                 s.lastRssi, (double)s.lastSnr,
                 (int)noiseFloor, chipMode, iqCfg);
-            if (chipMode != 0x05)
+            if (chipMode != 0x05 && !_txOwnsRadio())
             {
                 ESP_LOGW(TAG, "Chip mode 0x%02x != 0x05 (RX) — re-entering RX", chipMode);
-                _setRx();
+                sx_setRx(*this);
             }
         }
 
-        // Re-enter RX — required after every RX_DONE or error
-        _setRx();
-
 #if CONFIG_LORA_TX_ENABLED
+        // ── Managed-flood relays ──────────────────────────────────────────
+        _sendDueRelays(_nowMs());
+
         // ── Periodic + adaptive GPS position broadcast ────────────────────
         // Two triggers:
         //   1. Normal: configured interval elapsed (default 300 s).
@@ -392,7 +347,7 @@ void LoRa::run(void* /*data*/)
                 }
             }
 
-            if (doTx)
+            if (doTx && _periodicTxAllowed(_lastPosTxTick, posTxInterval, "Position"))
             {
                 const double   txLat = gps.lat();
                 const double   txLng = gps.lng();
@@ -415,7 +370,8 @@ void LoRa::run(void* /*data*/)
         }
 
         // ── Periodic NodeInfo broadcast ───────────────────────────────────
-        if ((xTaskGetTickCount() - _lastNodeInfoTxTick) >= nodeInfoInterval)
+        if ((xTaskGetTickCount() - _lastNodeInfoTxTick) >= nodeInfoInterval &&
+            _periodicTxAllowed(_lastNodeInfoTxTick, nodeInfoInterval, "NodeInfo"))
         {
             // Use want_response=true during the boot discovery window (first 4
             // broadcasts) to prompt bidirectional exchanges with nearby nodes.
@@ -434,7 +390,8 @@ void LoRa::run(void* /*data*/)
         }
 
         // ── Periodic Telemetry broadcast ──────────────────────────────────
-        if ((xTaskGetTickCount() - _lastTelemetryTxTick) >= telemetryInterval)
+        if ((xTaskGetTickCount() - _lastTelemetryTxTick) >= telemetryInterval &&
+            _periodicTxAllowed(_lastTelemetryTxTick, telemetryInterval, "Telemetry"))
         {
             _lastTelemetryTxTick = xTaskGetTickCount();
             sendTelemetry();
@@ -442,14 +399,288 @@ void LoRa::run(void* /*data*/)
 
         // ── Periodic MAP_REPORT broadcast ─────────────────────────────────
 #if CONFIG_LORA_MAP_REPORT_TX_INTERVAL_SEC > 0
-        if ((xTaskGetTickCount() - _lastMapReportTxTick) >= mapReportInterval)
+        if ((xTaskGetTickCount() - _lastMapReportTxTick) >= mapReportInterval &&
+            _periodicTxAllowed(_lastMapReportTxTick, mapReportInterval, "MapReport"))
         {
             _lastMapReportTxTick = xTaskGetTickCount();
             sendMapReport(); // silently skips when no GPS fix
         }
 #endif
+
+        // ── Start the next queued frame ───────────────────────────────────
+        _pumpTx(rxBusy, _nowMs());
 #endif // CONFIG_LORA_TX_ENABLED
     }
 }
 
+// ── transmit ──────────────────────────────────────────────────────────────
+bool LoRa::transmit(const uint8_t* data, uint8_t len, McTxPriority prio)
+{
+#if !CONFIG_LORA_TX_ENABLED
+    return false;
+#endif
+
+    if (len == 0 || data == nullptr) return false;
+
+    const bool ok = mc_txqPush(_txq, data, len, prio, _nowMs());
+    if (!ok)
+        ESP_LOGW(TAG, "TX queue full — %u-byte frame (prio %u) dropped",
+                 len, (unsigned)prio);
+    _publishTxQueueStats();
+    return ok;
+}
+
+// ── MeshRadio hooks ───────────────────────────────────────────────────────
+uint32_t LoRa::_radioRandom()
+{
+    return esp_random();
+}
+
+// ReadBuffer lands in the capture ring and the frame is parsed in place —
+// capturing costs no extra copy.
+uint8_t* LoRa::_rxSlot()
+{
+    return mc_captureBegin(_capture);
+}
+
+void LoRa::_onRxFrame(uint8_t* buf, uint8_t len, int16_t rssi, float snr,
+                      uint32_t nowMs)
+{
+    mc_captureCommit(_capture, len, rssi, snr, nowMs);
+    _processPacket(buf, len, rssi, snr, nowMs);
+}
+
+void LoRa::_radioReset()
+{
+    _initSx1262();
+}
+
+// ── _onRadioEvent ─────────────────────────────────────────────────────────
+void LoRa::_onRadioEvent(Event e, const EventInfo& info)
+{
+    switch (e)
+    {
+    case Event::Preamble:
+        portENTER_CRITICAL(&_statsLock);
+        _stats.preambles++;
+        portEXIT_CRITICAL(&_statsLock);
+        break;
+
+    case Event::HeaderValid:
+        portENTER_CRITICAL(&_statsLock);
+        _stats.headersValid++;
+        portEXIT_CRITICAL(&_statsLock);
+        break;
+
+    case Event::RxPacket:
+        portENTER_CRITICAL(&_statsLock);
+        _stats.rxPackets++;
+        portEXIT_CRITICAL(&_statsLock);
+        ESP_LOGD(TAG, "RX_DONE irq=0x%04x len=%u", info.irq, info.len);
+        break;
+
+    case Event::CrcError:
+        portENTER_CRITICAL(&_statsLock);
+        _stats.crcErrors++;
+        portEXIT_CRITICAL(&_statsLock);
+        ESP_LOGD(TAG, "CRC_ERR (%s RX_DONE) irq=0x%04x rssi=%d snr=%.1f",
+                 info.flag ? "with" : "no", info.irq, info.rssi, (double)info.snr);
+        break;
+
+    case Event::HeaderError:
+        portENTER_CRITICAL(&_statsLock);
+        _stats.headerErrors++;
+        portEXIT_CRITICAL(&_statsLock);
+        ESP_LOGD(TAG, "HDR_ERR irq=0x%04x rssi=%d snr=%.1f iq_cfg=0x%02x",
+                 info.irq, info.rssi, (double)info.snr,
+                 sx_readReg(*this, REG_IQ_CONFIG));
+        break;
+
+    case Event::RxTimeout:
+        ESP_LOGD(TAG, "LoRa RX timeout (re-entering RX)");
+        break;
+
+    case Event::TxStarted:
+        ESP_LOGD(TAG, "TX: %u bytes", info.len);
+        break;
+
+    case Event::TxDone:
+        ESP_LOGD(TAG, "TX complete (%u bytes, %" PRIu32 " ms)", info.len, info.ms);
+        portENTER_CRITICAL(&_statsLock);
+        _stats.txPackets++;
+        portEXIT_CRITICAL(&_statsLock);
+        break;
+
+    case Event::TxFailed:
+        if ((info.irq & IRQ_TIMEOUT) || info.irq == 0)
+        {
+            ESP_LOGE(TAG,
+                "TX: no TX_DONE after %" PRIu32 " ms "
+                "(irq=0x%04x errs=0x%04x mode=0x%02x) — resetting radio",
+                info.ms, info.irq, info.errs, _getChipMode());
+            portENTER_CRITICAL(&_statsLock);
+            _stats.txTimeouts++;
+            portEXIT_CRITICAL(&_statsLock);
+        }
+        else
+        {
+            ESP_LOGW(TAG,
+                "TX: ended without TX_DONE "
+                "(irq=0x%04x errs=0x%04x "
+                "PA_RAMP_ERR=%d XOSC_ERR=%d PLL_ERR=%d)",
+                info.irq, info.errs,
+                (info.errs >> 8) & 1,   // bit 8 = PA_RAMP_ERR
+                (info.errs >> 5) & 1,   // bit 5 = XOSC_START_ERR
+                (info.errs >> 6) & 1);  // bit 6 = PLL_LOCK_ERR
+            portENTER_CRITICAL(&_statsLock);
+            _stats.txErrors++;
+            portEXIT_CRITICAL(&_statsLock);
+        }
+        break;
+
+    case Event::CadDeadline:
+        ESP_LOGW(TAG, "CAD: no CAD_DONE after %" PRIu32 " ms — transmitting", info.ms);
+        break;
+
+    case Event::CadResult:
+        _publishLbtStats();
+        if (info.lbt.transmit && info.flag)
+            ESP_LOGW(TAG, "LBT: channel still busy after %u scans — transmitting",
+                     (unsigned)MC_LBT_MAX_ATTEMPTS);
+        else if (!info.lbt.transmit)
+            ESP_LOGD(TAG, "LBT: channel busy — backing off %" PRIu32 " ms (window 2^%u)",
+                     info.lbt.backoffMs, (unsigned)mc_lbtWindow(_lbt));
+        break;
+
+    case Event::TxDequeued:
+        ESP_LOGD(TAG, "TX dequeue prio=%u len=%u depth=%u",
+                 (unsigned)info.prio, info.len, _txq.depth);
+        _publishTxQueueStats();
+        break;
+
+    case Event::DutyDropped:
+        ESP_LOGW(TAG, "Duty cycle: %.1f%% of hour used — dropping prio %u frame",
+                 mc_airtimeTxPermille(_airtime, _nowMs()) / 10.0, (unsigned)info.prio);
+        portENTER_CRITICAL(&_statsLock);
+        _stats.txDutyDropped++;
+        portEXIT_CRITICAL(&_statsLock);
+        _publishTxQueueStats();
+        break;
+
+    case Event::DutyHeld:
+        ESP_LOGW(TAG, "Duty cycle: %u%% limit reached — holding frame %" PRIu32 " ms",
+                 (unsigned)CONFIG_LORA_DUTY_CYCLE_PCT, info.ms);
+        portENTER_CRITICAL(&_statsLock);
+        _stats.txDutyDeferred++;
+        portEXIT_CRITICAL(&_statsLock);
+        break;
+
+    case Event::AirtimeRolled:
+        _publishLbtStats();
+        break;
+
+    case Event::Duplicate:
+        portENTER_CRITICAL(&_statsLock);
+        _stats.duplicates++;
+        if (info.cancelled) _stats.relayCancelled++;
+        portEXIT_CRITICAL(&_statsLock);
+        ESP_LOGD(TAG, "Duplicate pkt 0x%08" PRIx32 " from 0x%08" PRIx32 " (%s) — skipped%s",
+                 info.pktId, info.from, info.flag ? "exact" : "bloom",
+                 info.cancelled ? ", relay cancelled" : "");
+        break;
+
+    case Event::RelayScheduled:
+        ESP_LOGD(TAG, "Relay pkt 0x%08" PRIx32 " queued (hop %u→%u, +%" PRIu32 " ms)",
+                 info.pktId, info.hop + 1u, (unsigned)info.hop, info.ms);
+        break;
+
+    case Event::RelayDropped:
+        portENTER_CRITICAL(&_statsLock);
+        _stats.relayDropped++;
+        portEXIT_CRITICAL(&_statsLock);
+        ESP_LOGW(TAG, "Relay queue full — pkt 0x%08" PRIx32 " not relayed", info.pktId);
+        break;
+
+    case Event::Relayed:
+        portENTER_CRITICAL(&_statsLock);
+        _stats.relayed++;
+        portEXIT_CRITICAL(&_statsLock);
+        ESP_LOGD(TAG, "Relay pkt 0x%08" PRIx32 " queued for TX (hop_limit now %u)",
+                 info.pktId, info.hop);
+        _publishTxQueueStats();
+        break;
+
+    case Event::RelayRefused:
+        ESP_LOGW(TAG, "Relay of pkt 0x%08" PRIx32 " dropped — TX queue full", info.pktId);
+        _publishTxQueueStats();
+        break;
+    }
+}
+
+// ── _publishAirtime ───────────────────────────────────────────────────────
+// Called once per run-loop pass; MeshRadio rolls the ledger itself.
+void LoRa::_publishAirtime()
+{
+    const uint32_t nowMs = _nowMs();
+    const uint16_t chPm  = mc_airtimeChannelPermille(_airtime, nowMs);
+    const uint16_t txPm  = mc_airtimeTxPermille(_airtime, nowMs);
+
+    portENTER_CRITICAL(&_statsLock);
+    _stats.channelUtil = chPm / 10.0f;
+    _stats.airUtilTx   = txPm / 10.0f;
+    _stats.txAirtimeMs = _airtime.txTotalMs;
+    portEXIT_CRITICAL(&_statsLock);
+}
+
+// ── _periodicTxAllowed ────────────────────────────────────────────────────
+bool LoRa::_periodicTxAllowed(TickType_t& lastTick, TickType_t interval,
+                              const char* what)
+{
+    if (mc_airtimeAllows(_airtime, _nowMs(), 0, CONFIG_LORA_DUTY_CYCLE_PCT,
+                         /*periodic=*/true))
+        return true;
+
+    ESP_LOGI(TAG, "%s TX deferred — %.1f%% of the %u%% hourly duty cycle used",
+             what, mc_airtimeTxPermille(_airtime, _nowMs()) / 10.0,
+             (unsigned)CONFIG_LORA_DUTY_CYCLE_PCT);
+    lastTick = xTaskGetTickCount() - interval + pdMS_TO_TICKS(PERIODIC_RETRY_MS);
+    portENTER_CRITICAL(&_statsLock);
+    _stats.txDutyDeferred++;
+    portEXIT_CRITICAL(&_statsLock);
+    return false;
+}
+
+// ── _publishLbtStats ──────────────────────────────────────────────────────
+void LoRa::_publishLbtStats()
+{
+    portENTER_CRITICAL(&_statsLock);
+    _stats.cadClear    = _lbt.clear;
+    _stats.cadBusy     = _lbt.busy;
+    _stats.txBackoffs  = _lbt.backoffs;
+    _stats.txBackoffMs = _lbt.backoffMs;
+    _stats.txForced    = _lbt.forced;
+    _stats.lbtUtil     = mc_lbtUtilisation(_lbt);
+    portEXIT_CRITICAL(&_statsLock);
+}
+
+// ── _publishTxQueueStats ──────────────────────────────────────────────────
+void LoRa::_publishTxQueueStats()
+{
+    uint32_t avgMs[MC_TX_PRIORITIES];
+    uint32_t maxMs[MC_TX_PRIORITIES];
+    for (size_t p = 0; p < MC_TX_PRIORITIES; p++)
+    {
+        avgMs[p] = mc_txqWaitAvg(_txq, static_cast<McTxPriority>(p));
+        maxMs[p] = _txq.waitMax[p];
+    }
+
+    portENTER_CRITICAL(&_statsLock);
+    _stats.txQueueDepth     = _txq.depth;
+    _stats.txQueueHighWater = _txq.highWater;
+    _stats.txQueueDropped   = _txq.refused + _txq.displaced;
+    memcpy(_stats.txWaitAvgMs, avgMs, sizeof(avgMs));
+    memcpy(_stats.txWaitMaxMs, maxMs, sizeof(maxMs));
+    portEXIT_CRITICAL(&_statsLock);
+}
+
 LoRa Lora("LoRa", 10240);
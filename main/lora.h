@@ -18,10 +18,21 @@
 #ifndef LORA_H_
 #define LORA_H_
 
+#include "mesh_airtime.h"
+#include "mesh_app.h"
+#include "mesh_capture.h"
 #include "mesh_codec.h"
+#include "mesh_dedup.h"
+#include "mesh_inbox.h"
+#include "mesh_lbt.h"
+#include "mesh_radio.h"
+#include "mesh_relay.h"
+#include "mesh_txqueue.h"
+#include "sx1262_batch.h"
 #include "task.h"
 #include <freertos/FreeRTOS.h>
 #include <freertos/portmacro.h>
+#include <freertos/semphr.h>
 #include <driver/spi_master.h>
 #include <driver/gpio.h>
 #include <cstdint>
@@ -40,13 +51,47 @@ struct LoRaStats {
     uint32_t headerErrors = 0; ///< header error events
     uint32_t decryptOk    = 0; ///< packets that survived AES decryption
     uint32_t textMessages = 0; ///< TEXT_MESSAGE_APP packets displayed
+    uint32_t duplicates   = 0; ///< packets dropped as already seen (from, id)
 
     // TX counters (cumulative since boot)
     uint32_t txPackets    = 0; ///< successful TX_DONE events
     uint32_t txErrors     = 0; ///< TX attempts that failed (not TX_DONE)
-    uint32_t txTimeouts   = 0; ///< TX attempts that timed out waiting for DIO1
-
-    // Last received packet signal quality
+    uint32_t txTimeouts   = 0; ///< TX attempts with no TX_DONE (chip or software timeout)
+
+    // TX queue (mesh_txqueue.h); wait = queued → handed to the radio
+    uint8_t  txQueueDepth     = 0; ///< frames waiting now
+    uint8_t  txQueueHighWater = 0; ///< most frames ever waiting at once
+    uint32_t txQueueDropped   = 0; ///< frames refused or displaced by higher priority
+    uint32_t txWaitAvgMs[MC_TX_PRIORITIES] = {}; ///< mean wait, indexed by McTxPriority
+    uint32_t txWaitMaxMs[MC_TX_PRIORITIES] = {}; ///< longest wait, indexed by McTxPriority
+
+    // Listen-before-talk (mesh_lbt.h)
+    uint32_t cadClear    = 0; ///< pre-TX CAD scans that found the channel free
+    uint32_t cadBusy     = 0; ///< pre-TX scans that found activity (CAD or a reception under way)
+    uint32_t txBackoffs  = 0; ///< backoff periods started
+    uint32_t txBackoffMs = 0; ///< total time spent backing off
+    uint32_t txForced    = 0; ///< frames sent on a busy channel after MC_LBT_MAX_ATTEMPTS
+    uint8_t  lbtUtil     = 0; ///< channel-busy average seen by LBT, percent
+
+    // Airtime (mesh_airtime.h) and duty-cycle budget (CONFIG_LORA_DUTY_CYCLE_PCT)
+    float    channelUtil    = 0.f; ///< TX + RX airtime over the last minute or so, percent
+    float    airUtilTx      = 0.f; ///< TX airtime over the last hour, percent
+    uint32_t txAirtimeMs    = 0;   ///< TX airtime since boot
+    uint32_t txDutyDeferred = 0;   ///< periodic broadcasts put off, frames held back for budget
+    uint32_t txDutyDropped  = 0;   ///< queued NodeInfo / background frames dropped near the limit
+
+    // Relay counters (ROUTER / ROUTER_CLIENT / REPEATER roles only)
+    uint32_t relayed        = 0; ///< rebroadcasts handed to the TX queue
+    uint32_t relayCancelled = 0; ///< rebroadcasts dropped: a neighbour relayed first
+    uint32_t relayDropped   = 0; ///< rebroadcasts not queued: relay queue full
+
+    // Message inbox (mesh_inbox.h) — filled in by stats()
+    uint32_t inboxUnread    = 0; ///< texts and alerts not yet shown
+    uint32_t inboxOverflows = 0; ///< unread messages overwritten by newer ones
+
+    // Last received packet signal quality — always one packet's pair:
+    // written together by LoRa::_noteSignal() and copied together by
+    // stats(), both under _statsLock.
     int16_t lastRssi = 0;
     float   lastSnr  = 0.f;
 
@@ -86,6 +131,19 @@ struct LoRaStats {
  *   - RX: AES-CTR decrypt is tried first; if protobuf parse fails, the raw
  *     payload is used as plaintext (handles other unencrypted nodes).
  *
+ * Transmission is asynchronous: every outgoing frame goes through a
+ * prioritized queue (routing > DM > text > NodeInfo > telemetry) that the
+ * LoRa task drains between receptions, with TX_DONE taken from DIO1.
+ * Each frame is preceded by a CAD scan; a busy channel defers it by a
+ * random contention backoff (mesh_lbt.h) during which RX continues.
+ * TX and RX airtime are tallied per minute over a rolling hour
+ * (mesh_airtime.h); transmissions are held within the regional duty cycle
+ * (CONFIG_LORA_DUTY_CYCLE_PCT), and periodic broadcasts give way first.
+ * The run loop, the TX state machine and the receive-side dedup/relay
+ * screening are the platform-free MeshRadio core (mesh_radio.h); decryption,
+ * the neighbour table, the replies and the frames we originate are MeshApp
+ * (mesh_app.h).  The host-side mesh simulator runs both.
+ *
  * TX packets include:
  *   - POSITION_APP      — GPS fix with speed/heading (periodic + adaptive)
  *   - NODEINFO_APP      — node identity, role, PKC public key
@@ -93,30 +151,39 @@ struct LoRaStats {
  *   - MAP_REPORT_APP    — node identity + firmware_version for MQTT bridges (2.7.x)
  *   - TRACEROUTE_APP    — route-discovery replies
  *
+ * In the ROUTER, ROUTER_CLIENT and REPEATER roles, packets from other nodes
+ * are also rebroadcast with Meshtastic managed flooding (mesh_relay.h):
+ * after an SNR-weighted contention delay, unless a neighbour is heard
+ * relaying the same packet first.  Relayed frames keep their original
+ * ciphertext; only hop_limit and relay_node in the header change.
+ *
  * Runs as a FreeRTOS task on core 1 (BLE / draw tasks run on core 0).
  */
-class LoRa : public Task
+class LoRa : public Task, private SxBus, private MeshRadio, private MeshApp
 {
 public:
     explicit LoRa(const char* name, uint16_t stackSize = 10240);
 
-    /// Return a copy of the most recently received text message.  Thread-safe.
-    MeshMessage lastMessage() const;
+    /// Received texts and alerts, oldest first.  The LoRa task pushes; the
+    /// draw task is the only consumer (mc_inboxTakeUnread / MarkReadTo).
+    McInbox& inbox() { return _inbox; }
 
     /// Return a snapshot of LoRa counters and state.  Thread-safe.
     LoRaStats stats() const;
 
-    /// Transmit a raw LoRa payload.  Blocks until TX_DONE or timeout.
-    /// Must only be called from the LoRa task (run loop).
-    /// Returns true on success, false on error/timeout.
-    bool transmit(const uint8_t* data, uint8_t len);
+    /// Queue a raw LoRa payload for transmission at priority @p prio.
+    /// Returns immediately; the run loop sends queued frames in priority
+    /// order between receptions.  Must only be called from the LoRa task.
+    /// Returns false if the TX queue refused the frame.
+    bool transmit(const uint8_t* data, uint8_t len,
+                  McTxPriority prio = McTxPriority::Text);
 
     /**
      * Broadcast a POSITION_APP packet with the supplied GPS fix data.
      * lat/lng in decimal degrees, altM in metres above MSL,
      * pdop_x100 = PDOP × 100 (e.g. 120 = PDOP 1.20), sats = visible sats,
      * unixTime = UTC epoch seconds (0 → uses system clock).
-     * Must only be called from the LoRa task.  Returns true on TX success.
+     * Must only be called from the LoRa task.  Returns true once queued.
      */
     bool sendPosition(double lat, double lng, float altM,
                       uint32_t pdop_x100, uint32_t sats,
@@ -135,9 +202,10 @@ public:
                       uint32_t requestId = 0);
 
     /**
-     * Broadcast a TELEMETRY_APP Device Metrics packet (uptime + nominal battery).
+     * Broadcast a TELEMETRY_APP Device Metrics packet (uptime, battery,
+     * channel utilisation and TX airtime).
      * Keeps this node appearing as "active" in Meshtastic app node lists.
-     * Must only be called from the LoRa task.  Returns true on TX success.
+     * Must only be called from the LoRa task.  Returns true once queued.
      */
     bool sendTelemetry();
 
@@ -145,7 +213,7 @@ public:
      * Unicast a KEY_VERIFICATION_APP (portnum 77) packet to @p to carrying
      * our own 32-byte X25519 public key so the peer can encrypt PKC DMs to us.
      * No-op in licensed mode (no PKC keys) or when PKC keys are unavailable.
-     * Must only be called from the LoRa task.  Returns true on TX success.
+     * Must only be called from the LoRa task.  Returns true once queued.
      */
     bool sendKeyVerification(uint32_t to);
 
@@ -154,19 +222,28 @@ public:
      * current GPS fix to any MQTT bridge in range.  Bridges forward it to
      * meshtastic.network/map so the node appears on the public map.
      * Only sent when a GPS fix is available.
-     * Must only be called from the LoRa task.  Returns true on TX success.
+     * Must only be called from the LoRa task.  Returns true once queued.
      */
     bool sendMapReport();
 
-    /// Number of unique neighbour nodes seen since boot (0–8).  Thread-safe.
+    /// Number of neighbour nodes currently in the table
+    /// (0–CONFIG_MESH_NEIGHBOR_MAX).  Thread-safe.
     size_t neighborCount() const;
 
-    /// Copy of the neighbour entry at index idx (0-based).  Thread-safe.
-    /// Returns a zeroed MeshPosition/MeshUser/MeshNodeStatus if idx is out of range.
+    /// Copy of the neighbour entry at index idx (0-based, table order).
+    /// Thread-safe.  Returns a zeroed MeshPosition/MeshUser/MeshNodeStatus
+    /// if idx is out of range or that node has not sent one yet.
     MeshPosition   neighborPosition(size_t idx) const;
     MeshUser       neighborUser(size_t idx) const;
     MeshNodeStatus neighborStatus(size_t idx) const;
 
+    /// Start a pcap export of the frames now in the capture ring.
+    /// Thread-safe: the ring is lock-free (mesh_capture.h).
+    void captureBegin(McPcapStream& s) const;
+    /// Next chunk of an export started by captureBegin(); 0 once complete.
+    /// Thread-safe.
+    size_t captureRead(McPcapStream& s, uint8_t* out, size_t cap) const;
+
 protected:
     void run(void* data) override;
 
@@ -191,72 +268,32 @@ private:
     TaskHandle_t _taskHandle = nullptr; // set at top of run() before ISR install
     static void IRAM_ATTR _dio1Isr(void* arg);
 
+    // ── BUSY falling edge → semaphore ─────────────────────────────────────
+    // _waitBusy blocks on this instead of polling once per tick.  Within a
+    // queued batch the SPI pre-callback covers the few-µs BUSY pulse that
+    // follows each command.
+    SemaphoreHandle_t _busySem = nullptr;
+    static constexpr uint32_t BUSY_SPIN_US = 100;   ///< pre-callback bound
+    static void IRAM_ATTR _busyIsr(void* arg);
+    static void IRAM_ATTR _busyPreCb(spi_transaction_t* t);
+
     // ── SX1262 SPI helpers ────────────────────────────────────────────────
     void _waitBusy(uint32_t timeoutMs = 200) const;
     void _transact(const uint8_t* tx, uint8_t* rx, size_t len);
-    void _writeReg(uint16_t addr, uint8_t val);
-    uint8_t _readReg(uint16_t addr);
-    void _writeBuffer(uint8_t offset, const uint8_t* data, uint8_t len);
+    /// SxBus: one BUSY wait, then the batch as queued DMA transactions.
+    void transfer(const SxXfer* xfers, size_t n) override;
+    /// SxBus: drop a DIO1 notification queued under the previous mapping.
+    void dio1Remapped() override;
 
     // ── SX1262 init & config ──────────────────────────────────────────────
     bool _initSx1262();
-    void _setFrequency(uint32_t freqHz);
     void _calibrateImage(uint32_t freqHz);
     void _setModulation(uint8_t sf, uint8_t bw, uint8_t cr, uint8_t ldro);
-    void _setRx();
-    void _setRxIrq();
-    void _setTxIrq();
-    void _fixIqPolarity(); ///< SX1262 errata 15.3 — fix IQ polarity register
 
-    uint16_t _getIrqStatus();
-    void     _clearIrq(uint16_t mask);
     uint8_t  _getChipMode();    ///< bits [6:4] of GetStatus: 2=STBY_RC 5=RX 6=TX
-    uint16_t _getDeviceErrors();///< opError bitmask; bit8=PA_RAMP_ERR bit6=PLL_LOCK_ERR
     int16_t  _getInstRssi();    ///< instantaneous RSSI in RX mode (dBm); noise floor check
 
     // ── Meshtastic constants ──────────────────────────────────────────────
-    // Over-the-air header: [to(4), from(4), id(4), flags(1), chan(1), pad(2)]
-    static constexpr size_t MESH_HDR = 16;
-
-    // PortNum values — verified against meshtastic firmware v2.7.15.567b8ea
-    // src/mesh/generated/meshtastic/portnums.pb.h
-    // Ports 0-63:  Core Meshtastic use
-    // Ports 64-127: Registered 3rd-party apps
-    // Ports 256-511: Private / unregistered apps
-    static constexpr uint32_t PORT_UNKNOWN                   = 0;  ///< UNKNOWN_APP - Message sent from outside the mesh in a form that is not understood
-    static constexpr uint32_t PORT_TEXT                      = 1;  ///< TEXT_MESSAGE_APP
-    static constexpr uint32_t PORT_REMOTE_HARDWARE           = 2;  ///< REMOTE_HARDWARE_APP (received, not dispatched)
-    static constexpr uint32_t PORT_POSITION                  = 3;  ///< POSITION_APP
-    static constexpr uint32_t PORT_NODEINFO                  = 4;  ///< NODEINFO_APP
-    static constexpr uint32_t PORT_ROUTING                   = 5;  ///< ROUTING_APP — ACK/NACK
-    static constexpr uint32_t PORT_ADMIN                     = 6;  ///< ADMIN_APP (received, not dispatched)
-    static constexpr uint32_t PORT_TEXT_COMPRESSED           = 7;  ///< TEXT_MESSAGE_COMPRESSED_APP (received, not dispatched)
-    static constexpr uint32_t PORT_WAYPOINT                  = 8;  ///< WAYPOINT_APP (received, not dispatched)
-    static constexpr uint32_t PORT_AUDIO                     = 9;  ///< AUDIO_APP (received, not dispatched)
-    static constexpr uint32_t PORT_DETECTION_SENSOR          = 10; ///< DETECTION_SENSOR_APP (received, not dispatched)
-    static constexpr uint32_t PORT_ALERT                     = 11; ///< ALERT_APP — critical alert message
-    static constexpr uint32_t PORT_KEY_VERIFICATION          = 12; ///< KEY_VERIFICATION_APP — PKC key exchange
-    static constexpr uint32_t PORT_REPLY                     = 32; ///< REPLY_APP (received, not dispatched)
-    static constexpr uint32_t PORT_PAXCOUNTER                = 34; ///< PAXCOUNTER_APP (received, not dispatched)
-    static constexpr uint32_t PORT_NODE_STATUS               = 36; ///< NODE_STATUS_APP — node status string, broadcasts on change/timer
-    static constexpr uint32_t PORT_SERIAL                    = 64; ///< SERIAL_APP (received, not dispatched)
-    static constexpr uint32_t PORT_STORE_FORWARD             = 65; ///< STORE_FORWARD_APP (received, not dispatched)
-    static constexpr uint32_t PORT_RANGE_TEST                = 66; ///< RANGE_TEST_APP (received, not dispatched)
-    static constexpr uint32_t PORT_TELEMETRY                 = 67; ///< TELEMETRY_APP
-    static constexpr uint32_t PORT_ZPS                       = 68; ///< ZPS_APP (received, not dispatched)
-    static constexpr uint32_t PORT_SIMULATOR                 = 69; ///< SIMULATOR_APP (received, not dispatched)
-    static constexpr uint32_t PORT_TRACEROUTE                = 70; ///< TRACEROUTE_APP — route discovery
-    static constexpr uint32_t PORT_NEIGHBORINFO              = 71; ///< NEIGHBORINFO_APP (received, not dispatched)
-    static constexpr uint32_t PORT_ATAK_PLUGIN               = 72; ///< ATAK_PLUGIN (received, not dispatched)
-    static constexpr uint32_t PORT_MAP_REPORT                = 73; ///< MAP_REPORT_APP — public mesh map
-    static constexpr uint32_t PORT_POWERSTRESS               = 74; ///< POWERSTRESS_APP (received, not dispatched)
-    static constexpr uint32_t PORT_RETICULUM_TUNNEL          = 76; ///< RETICULUM_TUNNEL_APP (received, not dispatched)
-    static constexpr uint32_t PORT_CAYENNE                   = 77; ///< CAYENNE_APP (received, not dispatched)
-
-    // Meshtastic default channel AES-128 PSK (factory LongFast).
-    // Used for both RX decryption and TX encryption.
-    static const uint8_t DEFAULT_PSK[16];
-
     // Meshtastic LoRa sync word.
     // Meshtastic firmware uses RadioLib setSyncWord(0x2B), NOT the generic
     // LoRa private sync word 0x12.  RadioLib converts 0x2B to SX1262
@@ -268,50 +305,13 @@ private:
     static constexpr uint8_t SYNC_LO = 0xB4;
 
     // ── Meshtastic packet processing ──────────────────────────────────────
+    /// Admission (MeshRadio), then MeshApp's decrypt / decode / dispatch.
     void _processPacket(const uint8_t* buf, uint8_t len,
-                        int16_t rssi, float snr);
-    /// AES-128-CTR cipher — same function for both encrypt and decrypt (CTR is symmetric).
-    /// Nonce: [packetId LE (4B) | 0 (4B) | fromNode LE (4B) | 0 (4B)]
-    bool _decrypt(const uint8_t* in, size_t len,
-                  uint32_t packetId, uint32_t fromNode,
-                  uint8_t* out);
-
-    /// AES-256-CCM PKC (public key cryptography) cipher for direct messages.
-    /// Uses SHA-256(X25519 ECDH shared secret) as the 256-bit key.
-    /// chanHash=0x00 marks PKC-encrypted packets on the wire.
-    ///
-    /// Standard Meshtastic PKC decrypt: SHA-256(X25519 ECDH) key, AES-256-CCM,
-    /// nonce = [pktId_LE(4)|0(4)|fromNode_LE(4)|0(4)] truncated to 13 bytes, no AAD.
-    /// Wire = [ciphertext(N)] [8-byte CCM tag].
-    /// @param plainLen  Output: plaintext byte count on success.
-    /// @return true on CCM auth success.
-    bool _decryptPkc(const uint8_t* in, size_t len,
-                     const uint8_t* hdr, size_t hdrLen,
-                     uint32_t packetId, uint32_t fromNode,
-                     uint32_t toNode,
-                     uint8_t* out, size_t& plainLen);
-    bool _parseData(const uint8_t* data, size_t len,
-                    uint32_t& portnum,
-                    const uint8_t*& payload, size_t& payloadLen,
-                    bool& wantResponse);
-
-    /// Decode a Meshtastic Position proto payload into pos.
-    static bool _parsePosition(const uint8_t* data, size_t len, MeshPosition& pos);
-    /// Decode a Meshtastic User proto payload into user.
-    static bool _parseUser(const uint8_t* data, size_t len, MeshUser& user);
-    /// Decode a Meshtastic NodeStatus proto payload into status.
-    static bool _parseNodeStatus(const uint8_t* data, size_t len, MeshNodeStatus& status);
-    /// Decode a PKIReport proto payload into report.
-    static bool _parsePkiReport(const uint8_t* data, size_t len, MeshPkiReport& report);
-    /// Encode a PKIReport proto into buf.  Returns bytes written.
-    static size_t _encodePkiReport(uint8_t* buf, size_t cap,
-                                    const uint8_t publicKey[32],
-                                    uint32_t requestorNodeNum = 0);
-    /// Insert or update the neighbour table entry for fromNode.
-    void _upsertNeighbor(uint32_t fromNode,
-                         const MeshPosition*   pos,        // nullptr = no update
-                         const MeshUser*       user,       // nullptr = no update
-                         const MeshNodeStatus* nodeStatus = nullptr); // nullptr = no update
+                        int16_t rssi, float snr, uint32_t nowMs);
+    /// Copy nodeId's short name into out ("" if unknown).  Thread-safe.
+    void _neighborShortName(uint32_t nodeId, char (&out)[5]) const;
+    /// lastRssi / lastSnr (and textMessages if @p text) in one stats section.
+    void _noteSignal(int16_t rssi, float snr, bool text);
 
     // ── Protobuf encoder helpers (all static, no heap) ────────────────────
     /// Encode a varint into buf. Returns bytes written.
@@ -324,69 +324,39 @@ private:
     /// Write a protobuf string field (length-delimited, null-terminated src).
     static size_t   _pbString(uint8_t* buf, uint8_t tag, const char* s);
 
-    /// Encode a Meshtastic Position proto into buf. Returns bytes written.
-    static size_t _encodePosition(uint8_t* buf, size_t cap,
-                                  int32_t lat_i, int32_t lon_i, int32_t alt_m,
-                                  uint32_t pdop_x100, uint32_t sats,
-                                  uint32_t unixTime,
-                                  uint32_t speed_cm_s = 0,
-                                  uint32_t track_x100 = 0);
-
-    /// Encode a Meshtastic User (NodeInfo) proto into buf. Returns bytes written.
-    static size_t _encodeUser(uint8_t* buf, size_t cap,
-                              uint32_t nodeId,
-                              const char* longName, const char* shortName);
-
-    /// Encode a Meshtastic Telemetry (Device Metrics) proto. Returns bytes written.
-    static size_t _encodeTelemetry(uint8_t* buf, size_t cap,
-                                   uint32_t unixTime, uint32_t uptimeSec,
-                                   uint8_t batteryLevel, float batteryVoltage);
-
-    /// Encode a Meshtastic MapReport proto (MAP_REPORT_APP payload).
+    /// Append a Meshtastic Position proto to w.
+    static void _writePosition(PbWriter& w,
+                               int32_t lat_i, int32_t lon_i, int32_t alt_m,
+                               uint32_t pdop_x100, uint32_t sats,
+                               uint32_t unixTime,
+                               uint32_t speed_cm_s = 0,
+                               uint32_t track_x100 = 0);
+
+    /// Append a Meshtastic User (NodeInfo) proto for this node to w.
+    static void _writeUser(PbWriter& w,
+                           uint32_t nodeId,
+                           const char* longName, const char* shortName);
+
+    /// Append a Meshtastic Telemetry (Device Metrics) proto to w.
+    static void _writeTelemetry(PbWriter& w,
+                                uint32_t unixTime, uint32_t uptimeSec,
+                                uint8_t batteryLevel, float batteryVoltage,
+                                float channelUtil, float airUtilTx);
+
+    /// Append a Meshtastic MapReport proto (MAP_REPORT_APP payload) to w.
     /// Carries node identity, region, modem preset, firmware version, and GPS fix.
     /// Field 4 (firmware_version) is included for Meshtastic 2.7.x map-bridge compat.
     /// @param hasPosition  true = include fields 8-11 (lat/lon/alt/precision).
     ///                     false = omit them (identity-only report when no GPS fix).
-    /// Returns bytes written.
-    static size_t _encodeMapReport(uint8_t* buf, size_t cap,
-                                   const char* longName, const char* shortName,
-                                   int32_t lat_i, int32_t lon_i, int32_t alt_m,
-                                   uint32_t numNeighbors,
-                                   const char* firmwareVersion = nullptr,
-                                   bool hasPosition = true);
-
-    /// Wrap an encoded payload in a Meshtastic Data proto. Returns bytes written.
-    /// dest is fixed32 (field 4). requestId is fixed32 (field 6 = request_id).
-    /// Confirmed from live traffic: Meshtastic uses field 6 (request_id) in
-    /// responses, not field 7 (reply_id). Router.cpp matches on request_id.
-    static size_t _encodeData(uint8_t* buf, size_t cap,
-                              uint32_t portnum,
-                              const uint8_t* payload, size_t payloadLen,
-                              bool want_response = false,
-                              uint32_t dest = 0,
-                              uint32_t source = 0,
-                              uint32_t requestId = 0);
-
-    /// Build a complete OTA Meshtastic packet ready for transmit().
-    /// Data proto is always AES-128-CTR encrypted (channel PSK), even in
-    /// IsLicensed mode — stock Meshtastic nodes match chanHash=0x08 to
-    /// their encrypted channel and will AES-CTR decrypt our payload.
-    /// Sending plaintext with chanHash=0x08 causes receivers to "decrypt"
-    /// the raw bytes into garbage and silently drop the packet.
-    /// @param to        Destination node ID (0xFFFFFFFF = broadcast).
-    /// @param requestId Incoming pktId for unicast NodeInfo responses (0 = none).
-    ///                  Placed in Data field 6 (request_id, fixed32) so the
-    ///                  receiving firmware can correlate the response.
-    bool _buildTxPacket(uint8_t* out, uint8_t& outLen,
-                        uint32_t portnum,
-                        const uint8_t* payload, size_t payloadLen,
-                        bool want_response = false,
-                        uint32_t to = 0xFFFFFFFF,
-                        uint32_t requestId = 0);
-
-    // ── Thread-safe last-message store ────────────────────────────────────
-    mutable portMUX_TYPE _msgLock   = portMUX_INITIALIZER_UNLOCKED;
-    MeshMessage          _lastMsg   = {};
+    static void _writeMapReport(PbWriter& w,
+                                const char* longName, const char* shortName,
+                                int32_t lat_i, int32_t lon_i, int32_t alt_m,
+                                uint32_t numNeighbors,
+                                const char* firmwareVersion = nullptr,
+                                bool hasPosition = true);
+
+    // ── Message inbox (lock-free, LoRa task → draw task) ──────────────────
+    McInbox              _inbox;
 
     // ── Thread-safe stats store ───────────────────────────────────────────
     mutable portMUX_TYPE _statsLock = portMUX_INITIALIZER_UNLOCKED;
@@ -410,58 +380,68 @@ private:
     bool    _hasTxPos    = false;///< true once we've sent at least one position
 
     // ── Neighbour table ───────────────────────────────────────────────────
-    static constexpr size_t NEIGHBOR_MAX = 8;
-    struct NeighborEntry {
-        MeshPosition   pos        = {};
-        MeshUser       user       = {};
-        MeshNodeStatus nodeStatus = {}; ///< last NODE_STATUS_APP received from this node
-        bool           occupied   = false;
-    };
+    // Hash-indexed by node id (mesh_neighbors.h), CONFIG_MESH_NEIGHBOR_MAX
+    // entries, LRU-evicted by last packet time.  Hot records and cold
+    // identity/key/position/status blocks are stored separately; the LoRa
+    // task is the only writer and takes _neighborLock once per block it
+    // changes.  Readers take it once per lookup.  The table itself is
+    // MeshApp's (_neighbors); the lock is handed to it as the write guard.
     mutable portMUX_TYPE _neighborLock = portMUX_INITIALIZER_UNLOCKED;
-    NeighborEntry        _neighbors[NEIGHBOR_MAX] = {};
-
-    // ── Packet deduplication ring (Phase 6) ───────────────────────────────
-    static constexpr size_t SEEN_IDS_MAX = 16;
-    uint32_t _seenIds[SEEN_IDS_MAX] = {};
-    size_t   _seenCursor            = 0;
-
-    // ── PKC key-request rate limiter ──────────────────────────────────────
-    // When a PKC DM arrives from a node whose public key we don't have, we
-    // send a NODEINFO request (want_response=true) so they reply with their
-    // key.  To avoid flooding, we only request once per node per 60 s.
-    static constexpr size_t   PKC_REQ_RING_MAX = 4;
-    static constexpr uint32_t PKC_REQ_COOLDOWN_MS = 60000;
-    struct PkcKeyReq {
-        uint32_t   nodeId = 0;
-        TickType_t tick   = 0;
-    };
-    PkcKeyReq _pkcKeyReqs[PKC_REQ_RING_MAX] = {};
-    size_t    _pkcReqCursor = 0; ///< ring-buffer write cursor for _pkcKeyReqs
-
-    // ── Pending PKC packet buffer ─────────────────────────────────────────
-    // Stores raw undecryptable PKC packets (missing sender public key) so
-    // they can be retried once we learn the sender's key from a NODEINFO.
-    // Entries expire after 5 minutes — stale DMs are not useful.
-    struct PendingPkcPacket {
-        uint8_t    data[256] = {};
-        uint8_t    len       = 0;
-        int16_t    rssi      = 0;
-        float      snr       = 0.f;
-        uint32_t   fromNode  = 0;
-        uint32_t   pktId     = 0;   ///< for dedup within buffer
-        TickType_t tick       = 0;
-        bool       occupied  = false;
-    };
-    static constexpr size_t   PKC_PENDING_MAX       = 4;
-    static constexpr uint32_t PKC_PENDING_EXPIRE_MS = 300000; // 5 minutes
-    PendingPkcPacket _pkcPending[PKC_PENDING_MAX] = {};
-
-    /// Buffer a raw PKC packet for later decryption (called when key is missing).
-    void _bufferPkcPacket(const uint8_t* buf, uint8_t len,
-                          int16_t rssi, float snr);
-    /// Retry decryption of any buffered PKC packets from fromNode.
-    /// Called after we learn a node's public key from their NODEINFO.
-    void _retryPkcBuffer(uint32_t fromNode);
+
+    // ── Packet capture ────────────────────────────────────────────────────
+    // The last CONFIG_LORA_CAPTURE_FRAMES good frames as received.  The run
+    // loop reads each payload straight into the next slot and parses it
+    // there; BLE exports the ring as pcap without taking a lock.
+    McCapture _capture;
+
+    // ── Radio core (MeshRadio) ────────────────────────────────────────────
+    // The run loop's IRQ dispatch, the TX queue → CAD → backoff → SetTx
+    // pipeline, the airtime ledger, dedup and the relay queue live in
+    // mesh_radio.cxx; LoRa supplies the hooks below and turns the events
+    // into _stats and log lines.  LoRa task only.
+    uint32_t _radioRandom() override;
+    uint8_t* _rxSlot() override;
+    void     _onRxFrame(uint8_t* buf, uint8_t len, int16_t rssi, float snr,
+                        uint32_t nowMs) override;
+    /// Re-run _initSx1262() after a failed transmission.
+    void     _radioReset() override;
+    void     _onRadioEvent(Event e, const EventInfo& info) override;
+
+    /// Copy _txq depth and wait-time figures into _stats.
+    void _publishTxQueueStats();
+    /// Copy _lbt counters into _stats.
+    void _publishLbtStats();
+
+    // ── Airtime ledger ────────────────────────────────────────────────────
+    // Kept by MeshRadio (_airtime): TX airtime is booked when a frame
+    // starts, RX airtime (from the frame length) when it ends.
+    static constexpr uint32_t PERIODIC_RETRY_MS = 60000; ///< re-check for a deferred broadcast
+
+    /// Free-running millisecond clock for the ledger.
+    uint32_t _nowMs() const { return xTaskGetTickCount() * portTICK_PERIOD_MS; }
+    /// Copy the ledger's utilisation figures to _stats.
+    void _publishAirtime();
+    /// Duty-cycle gate for a periodic broadcast that is due.  On refusal,
+    /// moves @p lastTick so the broadcast is retried in PERIODIC_RETRY_MS.
+    bool _periodicTxAllowed(TickType_t& lastTick, TickType_t interval,
+                            const char* what);
+
+    // ── App layer (MeshApp) ───────────────────────────────────────────────
+    // Decryption, held PKC DMs and key requests, the neighbour table, the
+    // NodeInfo / traceroute / key replies and frame building live in
+    // mesh_app.cxx; LoRa supplies identity and TX, and turns the events
+    // into _stats, log lines and redraws.  LoRa task only.
+    uint32_t       _appSelf() const override;
+    const uint8_t* _appPrivateKey() const override;
+    const uint8_t* _appPublicKey() const override;
+    uint32_t       _appPacketId() override;
+    bool           _appSend(const uint8_t* frame, uint8_t len, McTxPriority prio) override;
+    bool           _appSendNodeInfo(uint32_t to, bool wantResponse,
+                                    uint32_t requestId) override;
+    /// Texts and alerts → _inbox.
+    void           _onAppText(const Packet& p, const uint8_t* text, size_t len,
+                              bool alert) override;
+    void           _onAppEvent(AppEvent e, const AppEventInfo& info) override;
 };
 
 extern LoRa Lora;
@@ -28,6 +28,7 @@
 
 #pragma once
 
+#include "sx1262_defs.h"
 #include <cstdint>
 
 // ── Kconfig fallback defaults ─────────────────────────────────────────────
@@ -66,6 +67,12 @@
 #ifndef CONFIG_LORA_REGION_CODE
 #  define CONFIG_LORA_REGION_CODE 1 // US
 #endif
+#ifndef CONFIG_LORA_DUTY_CYCLE_PCT
+#  define CONFIG_LORA_DUTY_CYCLE_PCT 100
+#endif
+#ifndef CONFIG_MESH_DEDUP_WINDOW_SEC
+#  define CONFIG_MESH_DEDUP_WINDOW_SEC 600
+#endif
 #ifndef CONFIG_MESH_FIRMWARE_VERSION
 #  define CONFIG_MESH_FIRMWARE_VERSION "2.7.15.0"
 #endif
@@ -103,89 +110,35 @@ static inline uint32_t computeLoraFrequency()
 // Cached at file scope — computed once per TU.  All TUs get the same value.
 static const uint32_t LORA_FREQ_HZ = computeLoraFrequency();
 
-// ── SX1262 opcodes ────────────────────────────────────────────────────────
-static constexpr uint8_t CMD_SET_STANDBY         = 0x80;
-static constexpr uint8_t CMD_SET_RX              = 0x82;
-static constexpr uint8_t CMD_SET_TX              = 0x83;
-static constexpr uint8_t CMD_SET_PACKET_TYPE     = 0x8A;
-static constexpr uint8_t CMD_SET_RF_FREQ         = 0x86;
-static constexpr uint8_t CMD_SET_PA_CONFIG        = 0x95;
-static constexpr uint8_t CMD_SET_TX_PARAMS       = 0x8E;
-static constexpr uint8_t CMD_SET_MOD_PARAMS      = 0x8B;
-static constexpr uint8_t CMD_SET_PKT_PARAMS      = 0x8C;
-static constexpr uint8_t CMD_SET_BUF_BASE_ADDR   = 0x8F;
-static constexpr uint8_t CMD_SET_DIO_IRQ         = 0x08;
-static constexpr uint8_t CMD_GET_IRQ_STATUS      = 0x12;
-static constexpr uint8_t CMD_CLEAR_IRQ           = 0x02;
-static constexpr uint8_t CMD_GET_RX_BUF_STATUS   = 0x13;
-static constexpr uint8_t CMD_GET_PKT_STATUS      = 0x14;
-static constexpr uint8_t CMD_READ_BUFFER         = 0x1E;
-static constexpr uint8_t CMD_WRITE_BUFFER        = 0x0E;
-static constexpr uint8_t CMD_WRITE_REGISTER      = 0x0D;
-static constexpr uint8_t CMD_READ_REGISTER       = 0x1D;
-static constexpr uint8_t CMD_SET_REGULATOR_MODE  = 0x96;
-static constexpr uint8_t CMD_CALIBRATE           = 0x89;
-static constexpr uint8_t CMD_CALIBRATE_IMAGE     = 0x98;
-static constexpr uint8_t CMD_SET_DIO2_RF_SWITCH  = 0x9D;
-static constexpr uint8_t CMD_SET_DIO3_TCXO       = 0x97;
-static constexpr uint8_t CMD_GET_STATUS          = 0xC0;
-static constexpr uint8_t CMD_GET_DEVICE_ERRORS   = 0x17;
-static constexpr uint8_t CMD_CLEAR_DEVICE_ERRORS = 0x07;
-
-// ── SX1262 register addresses ─────────────────────────────────────────────
-static constexpr uint16_t REG_LORA_SYNC_MSB = 0x0740; // LoRa sync word byte 0
-static constexpr uint16_t REG_LORA_SYNC_LSB = 0x0741; // LoRa sync word byte 1
-static constexpr uint16_t REG_IQ_CONFIG     = 0x0736; // IQ polarity (errata 15.3)
-static constexpr uint16_t REG_RX_GAIN       = 0x08AC; // RX LNA gain mode
-
-// ── IRQ bit masks (SX1262 Table 13-29, verified against RadioLib) ─────────
-static constexpr uint16_t IRQ_TX_DONE      = (1u << 0);
-static constexpr uint16_t IRQ_RX_DONE      = (1u << 1);
-static constexpr uint16_t IRQ_PREAMBLE_DET = (1u << 2);
-static constexpr uint16_t IRQ_HEADER_VALID = (1u << 4);
-static constexpr uint16_t IRQ_HEADER_ERR   = (1u << 5);
-static constexpr uint16_t IRQ_CRC_ERROR    = (1u << 6);
-static constexpr uint16_t IRQ_TIMEOUT      = (1u << 9);
-
-// DIO1 mask — events that wake the task via ISR
-static constexpr uint16_t IRQ_RX_DIO1   = IRQ_RX_DONE | IRQ_HEADER_ERR |
-                                           IRQ_CRC_ERROR | IRQ_TIMEOUT;
-// Global mask — events visible in GetIrqStatus (superset of DIO1).
-static constexpr uint16_t IRQ_RX_GLOBAL = IRQ_RX_DIO1 | IRQ_PREAMBLE_DET |
-                                           IRQ_HEADER_VALID;
-static constexpr uint16_t IRQ_TX_MASK   = IRQ_TX_DONE | IRQ_TIMEOUT;
+// ── Modem preset timing ───────────────────────────────────────────────────
+// Modulation of the selected preset, for timing done outside the radio
+// driver (relay contention slots, time on air).  Must agree with the
+// _setModulation() and SetPacketParams calls in _initSx1262().
+#if   defined(CONFIG_LORA_PRESET_LONG_SLOW)
+static constexpr uint8_t  LORA_SF    = 12;
+static constexpr uint32_t LORA_BW_HZ = 125000;
+static constexpr uint8_t  LORA_CR    = 4;   // 4/8
+static constexpr bool     LORA_LDRO  = true;
+#elif defined(CONFIG_LORA_PRESET_MEDIUM_SLOW)
+static constexpr uint8_t  LORA_SF    = 10;
+static constexpr uint32_t LORA_BW_HZ = 250000;
+static constexpr uint8_t  LORA_CR    = 1;   // 4/5
+static constexpr bool     LORA_LDRO  = false;
+#elif defined(CONFIG_LORA_PRESET_SHORT_FAST)
+static constexpr uint8_t  LORA_SF    = 7;
+static constexpr uint32_t LORA_BW_HZ = 250000;
+static constexpr uint8_t  LORA_CR    = 1;
+static constexpr bool     LORA_LDRO  = false;
+#else
+static constexpr uint8_t  LORA_SF    = 11;  // LongFast
+static constexpr uint32_t LORA_BW_HZ = 250000;
+static constexpr uint8_t  LORA_CR    = 1;
+static constexpr bool     LORA_LDRO  = false;
+#endif
+static constexpr uint16_t LORA_PREAMBLE_LEN = 16;
 
 // ── Meshtastic OTA protocol constants ────────────────────────────────────
 
-// DEFAULT_CHAN_HASH: 1-byte channel hash placed in OTA header byte [13].
-// Default "LongFast" channel with the default AES-128 PSK:
-//   xorHash("LongFast", 8) = 0x0A
-//   xorHash(expanded_default_PSK, 16) = 0x02
-//   hash = 0x0A ^ 0x02 = 0x08
-//
-// Always use this on TX so stock encrypted Meshtastic nodes match it to
-// their encrypted "LongFast" channel and AES-CTR decrypt our payload.
-static constexpr uint8_t DEFAULT_CHAN_HASH = 0x08;
-
-// UNENCRYPTED_CHAN_HASH: hash for a channel with an EMPTY PSK.
-//   xorHash("LongFast", 8) = 0x0A,  xorHash("", 0) = 0x00
-//   hash = 0x0A ^ 0x00 = 0x0A
-// Used when matching RX packets from other truly-unencrypted nodes.
-// NOT used on TX (stock encrypted nodes would ignore it).
-static constexpr uint8_t UNENCRYPTED_CHAN_HASH = 0x0A;
-
 // HW_MODEL: Meshtastic HardwareModel enum value for this board.
 // meshtastic_HardwareModel_HELTEC_WIRELESS_TRACKER = 48 (mesh.proto)
 static constexpr uint32_t HW_MODEL = 48;
-
-// Meshtastic OTA flags byte (RadioLibInterface.cpp / mesh_pb.h):
-//   bits [2:0]  hop_limit  — remaining relay hops
-//   bit  [3]    want_ack   — request implicit ACK from next hop
-//   bit  [4]    via_mqtt   — 0 for OTA-originated packets
-//   bits [7:5]  hop_start  — ORIGINAL hop_limit (must equal hop_limit for direct)
-//
-// Correct values (hop_start = hop_limit = 3, via_mqtt = 0):
-//   Broadcast (want_ack=0): 3 | 0 | 0 | (3<<5) = 99  = 0x63
-//   Unicast   (want_ack=1): 3 | 8 | 0 | (3<<5) = 107 = 0x6B
-static constexpr uint8_t FLAGS_BROADCAST = 0x63;
-static constexpr uint8_t FLAGS_UNICAST   = 0x6B;
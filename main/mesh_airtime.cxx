@@ -0,0 +1,127 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * mesh_airtime.cxx — time-on-air and airtime ledger (see mesh_airtime.h).
+ */
+
+#include "mesh_airtime.h"
+#include <cstring>
+
+uint32_t mc_airtimeUs(uint8_t sf, uint32_t bwHz, uint8_t cr,
+                      uint16_t preamble, bool ldro, uint8_t len)
+{
+    // Payload symbols, explicit header (IH = 0), CRC on:
+    //   8 + max(ceil((8·PL − 4·SF + 28 + 16) / (4·(SF − 2·DE))) · (CR + 4), 0)
+    const int32_t num = 8 * static_cast<int32_t>(len) - 4 * sf + 28 + 16;
+    const int32_t den = 4 * (sf - (ldro ? 2 : 0));
+    const int32_t blocks = num > 0 ? (num + den - 1) / den : 0;
+    const uint32_t payloadSym = 8u + static_cast<uint32_t>(blocks) * (cr + 4u);
+
+    // Preamble adds 4.25 symbols (sync word + SFD); count in quarter symbols.
+    const uint64_t quarters = (static_cast<uint64_t>(preamble) + payloadSym) * 4u + 17u;
+    return static_cast<uint32_t>((quarters * (1u << sf) * 1000000u) / (4u * bwHz));
+}
+
+// ── Ledger ────────────────────────────────────────────────────────────────
+
+void mc_airtimeInit(McAirtime& a, uint32_t nowMs)
+{
+    a = McAirtime{};
+    a.bucketStart = nowMs;
+}
+
+bool mc_airtimeAdvance(McAirtime& a, uint32_t nowMs)
+{
+    const uint32_t elapsed = nowMs - a.bucketStart;
+    if (elapsed < MC_AIRTIME_BUCKET_MS) return false;
+
+    const uint32_t steps = elapsed / MC_AIRTIME_BUCKET_MS;
+    if (steps >= MC_AIRTIME_BUCKETS)
+    {
+        memset(a.txMs, 0, sizeof(a.txMs));
+        memset(a.rxMs, 0, sizeof(a.rxMs));
+    }
+    else
+    {
+        for (uint32_t i = 0; i < steps; i++)
+        {
+            a.cur = static_cast<uint8_t>((a.cur + 1) % MC_AIRTIME_BUCKETS);
+            a.txMs[a.cur] = 0;
+            a.rxMs[a.cur] = 0;
+        }
+    }
+    a.bucketStart += steps * MC_AIRTIME_BUCKET_MS;
+    return true;
+}
+
+void mc_airtimeNoteTx(McAirtime& a, uint32_t nowMs, uint32_t ms)
+{
+    mc_airtimeAdvance(a, nowMs);
+    a.txMs[a.cur] += ms;
+    a.txTotalMs   += ms;
+}
+
+void mc_airtimeNoteRx(McAirtime& a, uint32_t nowMs, uint32_t ms)
+{
+    mc_airtimeAdvance(a, nowMs);
+    a.rxMs[a.cur] += ms;
+    a.rxTotalMs   += ms;
+}
+
+static uint32_t _txHourMs(const McAirtime& a)
+{
+    uint32_t sum = 0;
+    for (uint32_t ms : a.txMs) sum += ms;
+    return sum;
+}
+
+uint16_t mc_airtimeTxPermille(McAirtime& a, uint32_t nowMs)
+{
+    mc_airtimeAdvance(a, nowMs);
+    const uint64_t pm = static_cast<uint64_t>(_txHourMs(a)) * 1000u / MC_AIRTIME_HOUR_MS;
+    return static_cast<uint16_t>(pm > 1000 ? 1000 : pm);
+}
+
+uint16_t mc_airtimeChannelPermille(McAirtime& a, uint32_t nowMs)
+{
+    mc_airtimeAdvance(a, nowMs);
+    const uint8_t  prev = static_cast<uint8_t>((a.cur + MC_AIRTIME_BUCKETS - 1) % MC_AIRTIME_BUCKETS);
+    const uint64_t busy = static_cast<uint64_t>(a.txMs[a.cur]) + a.rxMs[a.cur]
+                        + a.txMs[prev] + a.rxMs[prev];
+    const uint32_t span = MC_AIRTIME_BUCKET_MS + (nowMs - a.bucketStart);
+    const uint64_t pm   = busy * 1000u / span;
+    return static_cast<uint16_t>(pm > 1000 ? 1000 : pm);
+}
+
+bool mc_airtimeAllows(McAirtime& a, uint32_t nowMs, uint32_t frameMs,
+                      uint8_t limitPct, bool periodic)
+{
+    if (limitPct >= 100) return true;
+
+    mc_airtimeAdvance(a, nowMs);
+    uint64_t budget = static_cast<uint64_t>(MC_AIRTIME_HOUR_MS) * limitPct / 100u;
+    if (periodic) budget = budget * MC_AIRTIME_SOFT_PCT / 100u;
+    return static_cast<uint64_t>(_txHourMs(a)) + frameMs <= budget;
+}
+
+uint32_t mc_airtimeNextReleaseMs(McAirtime& a, uint32_t nowMs)
+{
+    mc_airtimeAdvance(a, nowMs);
+    return MC_AIRTIME_BUCKET_MS - (nowMs - a.bucketStart);
+}
@@ -0,0 +1,101 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * mesh_airtime.h — LoRa time-on-air and a rolling-hour airtime ledger.
+ *
+ * mc_airtimeUs() is the Semtech time-on-air formula (SX1261/2 datasheet
+ * §6.1.4) for explicit-header packets with CRC on.  The ledger keeps TX and
+ * RX airtime in one-minute buckets covering the last hour, which gives
+ * the two figures Meshtastic reports in DeviceMetrics:
+ *
+ *   channel utilisation — TX + RX airtime over roughly the last minute
+ *   air_util_tx         — TX airtime over the last hour
+ *
+ * and the duty-cycle budget check: a frame may go out only if the last
+ * hour's TX airtime plus its own stays within the regional limit.
+ * Periodic traffic is held to MC_AIRTIME_SOFT_PCT of that limit so that
+ * replies and user messages still have room when the budget runs low.
+ *
+ * Times are milliseconds on a free-running 32-bit clock; wrap is fine.
+ *
+ * Not thread-safe; LoRa uses it from its task only.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+static constexpr uint32_t MC_AIRTIME_BUCKET_MS = 60000;  ///< ledger granularity
+static constexpr size_t   MC_AIRTIME_BUCKETS   = 60;     ///< one hour of buckets
+static constexpr uint32_t MC_AIRTIME_HOUR_MS   = MC_AIRTIME_BUCKET_MS * MC_AIRTIME_BUCKETS;
+static constexpr uint8_t  MC_AIRTIME_SOFT_PCT  = 80;     ///< share of the budget periodic TX may use
+
+/**
+ * Time on air of one packet in microseconds.
+ * @param sf        spreading factor 7–12
+ * @param bwHz      bandwidth in Hz
+ * @param cr        coding rate 1–4 (4/5 … 4/8)
+ * @param preamble  programmed preamble length in symbols
+ * @param ldro      low data-rate optimisation on
+ * @param len       payload bytes
+ */
+uint32_t mc_airtimeUs(uint8_t sf, uint32_t bwHz, uint8_t cr,
+                      uint16_t preamble, bool ldro, uint8_t len);
+
+struct McAirtime {
+    uint32_t txMs[MC_AIRTIME_BUCKETS] = {};   ///< TX airtime per minute
+    uint32_t rxMs[MC_AIRTIME_BUCKETS] = {};   ///< RX airtime per minute (incl. errored frames)
+    uint8_t  cur         = 0;                 ///< bucket being filled
+    uint32_t bucketStart = 0;                 ///< clock at which txMs[cur] began
+
+    // Totals since init
+    uint32_t txTotalMs = 0;
+    uint32_t rxTotalMs = 0;
+};
+
+/// Start an empty ledger at @p nowMs.
+void mc_airtimeInit(McAirtime& a, uint32_t nowMs);
+
+/**
+ * Roll the ledger forward to @p nowMs, clearing buckets that fall out of
+ * the hour.  Returns true if at least one bucket was completed.
+ * The Note/query functions below call this themselves.
+ */
+bool mc_airtimeAdvance(McAirtime& a, uint32_t nowMs);
+
+void mc_airtimeNoteTx(McAirtime& a, uint32_t nowMs, uint32_t ms);
+void mc_airtimeNoteRx(McAirtime& a, uint32_t nowMs, uint32_t ms);
+
+/// TX airtime over the last hour, in 0.1 % of an hour.
+uint16_t mc_airtimeTxPermille(McAirtime& a, uint32_t nowMs);
+
+/// TX + RX airtime over the previous and current minute, in 0.1 % of that span.
+uint16_t mc_airtimeChannelPermille(McAirtime& a, uint32_t nowMs);
+
+/**
+ * Whether a frame of @p frameMs may be sent now under a duty-cycle limit of
+ * @p limitPct percent of any hour.  @p periodic frames are held to
+ * MC_AIRTIME_SOFT_PCT of the limit.  A limit of 100 never refuses.
+ */
+bool mc_airtimeAllows(McAirtime& a, uint32_t nowMs, uint32_t frameMs,
+                      uint8_t limitPct, bool periodic);
+
+/// Milliseconds until the oldest bucket leaves the hour and frees budget.
+uint32_t mc_airtimeNextReleaseMs(McAirtime& a, uint32_t nowMs);
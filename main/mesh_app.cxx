@@ -0,0 +1,507 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * mesh_app.cxx — LoRa application layer (see mesh_app.h).
+ */
+
+#include "mesh_app.h"
+#include <mbedtls/platform_util.h>
+#include <cstring>
+
+// Meshtastic OTA flags byte (RadioLibInterface.cpp / mesh_pb.h):
+//   bits [2:0]  hop_limit  — remaining relay hops
+//   bit  [3]    want_ack   — request implicit ACK from next hop
+//   bit  [4]    via_mqtt   — 0 for OTA-originated packets
+//   bits [7:5]  hop_start  — ORIGINAL hop_limit (must equal hop_limit for direct)
+static constexpr uint8_t FLAG_WANT_ACK = 0x08;
+
+static inline uint32_t _le32(const uint8_t* p)
+{
+    return p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static inline void _put32(uint8_t* p, uint32_t v)
+{
+    p[0] = static_cast<uint8_t>(v);       p[1] = static_cast<uint8_t>(v >> 8);
+    p[2] = static_cast<uint8_t>(v >> 16); p[3] = static_cast<uint8_t>(v >> 24);
+}
+
+MeshApp::MeshApp(const MeshAppConfig& cfg, const McNeighborGuard& guard)
+:   _appCfg(cfg)
+,   _nbGuard(guard)
+{
+}
+
+void MeshApp::_header(Packet& p, const uint8_t* buf, uint8_t len, int16_t rssi,
+                      float snr, uint32_t nowMs)
+{
+    p.to       = _le32(buf);
+    p.from     = _le32(buf + 4);
+    p.id       = _le32(buf + 8);
+    p.hopLimit = buf[12] & 0x07;
+    p.hopStart = (buf[12] >> 5) & 0x07;
+    p.chanHash = buf[13];
+    p.len      = len;
+    p.rssi     = rssi;
+    p.snr      = snr;
+    p.atMs     = nowMs;
+}
+
+bool MeshApp::hasKeyFor(uint32_t node) const
+{
+    const int slot = mc_neighborFind(_neighbors, node);
+    return slot >= 0 && (_neighbors.hot[slot].flags & MC_NB_KEY);
+}
+
+// The table's only writer reads it without the guard.
+bool MeshApp::_peerKey(uint32_t node, uint8_t key[32])
+{
+    const uint8_t* priv = _appPrivateKey();
+    const int      slot = mc_neighborFind(_neighbors, node);
+    if (priv == nullptr || slot < 0 || !(_neighbors.hot[slot].flags & MC_NB_KEY))
+        return false;
+    return mc_pkcKeyCacheGet(_pkcKeys, priv, node, _neighbors.key[slot], key);
+}
+
+void MeshApp::_appReset()
+{
+    mc_neighborClear(_neighbors);
+    mc_pkcKeyCacheClear(_pkcKeys);
+    for (HeldPkc& h : _held) h.occupied = false;
+    for (KeyReq& r : _keyReqs) r = {};
+    _keyReqCursor = 0;
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// Receive
+// ─────────────────────────────────────────────────────────────────────────
+
+void MeshApp::_appReceive(const uint8_t* buf, uint8_t len, int16_t rssi, float snr,
+                          uint32_t nowMs)
+{
+    Packet p;
+    _header(p, buf, len, rssi, snr, nowMs);
+    _onAppEvent(AppEvent::Received, { .pkt = &p });
+
+    const uint8_t* cipher    = buf + MESH_HDR;
+    const size_t   cipherLen = len - MESH_HDR;
+    uint8_t plain[256] = {};
+    size_t  plainLen   = cipherLen;
+
+    if (p.chanHash == 0x00)
+    {
+        // PKC direct message.  One addressed to another node has been
+        // scheduled for relay by _admitRx(); it is not ours to read.
+        p.pkc = true;
+        if (p.to != _appSelf()) return;
+        if (_appCfg.licensed || _appPrivateKey() == nullptr)
+        {
+            _onAppEvent(AppEvent::NoKeyPair, { .pkt = &p });
+            return;
+        }
+        plainLen = _decryptPkc(p, buf, plain);
+        if (plainLen == 0)
+        {
+            // Most likely the sender's key is unknown: keep the frame for
+            // when its NodeInfo arrives, and ask for it.
+            _hold(p, buf);
+            _requestKey(p);
+            return;
+        }
+    }
+    else if (_appCfg.licensed && p.chanHash == UNENCRYPTED_CHAN_HASH)
+    {
+        memcpy(plain, cipher, cipherLen);
+    }
+    else
+    {
+        // Default PSK first; when that does not parse, the sender was a
+        // plaintext (licensed / empty-PSK) node and the bytes are used as-is.
+        if (!mc_channelCrypt(MC_DEFAULT_PSK, p.id, p.from, cipher, cipherLen, plain))
+            return;
+
+        uint32_t       port       = 0;
+        const uint8_t* payload    = nullptr;
+        size_t         payloadLen = 0;
+        bool           wantResp   = false;
+        if (!mc_parseData(plain, cipherLen, port, payload, payloadLen, wantResp) || port == 0)
+            memcpy(plain, cipher, cipherLen);
+    }
+
+    _onAppEvent(AppEvent::Decrypted, { .pkt = &p, .flag = p.pkc });
+    _dispatch(p, plain, plainLen);
+}
+
+size_t MeshApp::_decryptPkc(const Packet& p, const uint8_t* buf, uint8_t* plain)
+{
+    const size_t cipherLen = p.len - MESH_HDR;
+    uint8_t key[32];
+    if (cipherLen <= MC_PKC_OVERHEAD || !_peerKey(p.from, key)) return 0;
+
+    const bool ok = mc_pkcDecryptWithKey(key, p.id, p.from, buf + MESH_HDR, cipherLen, plain);
+    mbedtls_platform_zeroize(key, sizeof(key));
+    return ok ? cipherLen - MC_PKC_OVERHEAD : 0;
+}
+
+// Expired slots are reused first, then the oldest is evicted.
+void MeshApp::_hold(const Packet& p, const uint8_t* buf)
+{
+    for (const HeldPkc& h : _held)
+        if (h.occupied && h.from == p.from && h.id == p.id) return;
+
+    size_t   slot      = PKC_HELD_MAX;
+    size_t   oldest    = 0;
+    uint32_t oldestAge = 0;
+    for (size_t i = 0; i < PKC_HELD_MAX; i++)
+    {
+        HeldPkc& h = _held[i];
+        const uint32_t age = p.atMs - h.atMs;
+        if (h.occupied && age > PKC_HELD_EXPIRE_MS) h.occupied = false;
+        if (!h.occupied)
+        {
+            slot = i;
+            break;
+        }
+        if (age > oldestAge)
+        {
+            oldestAge = age;
+            oldest    = i;
+        }
+    }
+    if (slot == PKC_HELD_MAX) slot = oldest;
+
+    HeldPkc& h = _held[slot];
+    memcpy(h.data, buf, p.len);
+    h.len      = p.len;
+    h.rssi     = p.rssi;
+    h.snr      = p.snr;
+    h.from     = p.from;
+    h.id       = p.id;
+    h.atMs     = p.atMs;
+    h.occupied = true;
+    _onAppEvent(AppEvent::PkcHeld, { .pkt = &p });
+}
+
+void MeshApp::_requestKey(const Packet& p)
+{
+    if (!_appCfg.tx) return;
+
+    for (const KeyReq& r : _keyReqs)
+    {
+        if (r.node == p.from && p.atMs - r.atMs < PKC_REQ_COOLDOWN_MS)
+        {
+            _onAppEvent(AppEvent::KeyRequest, { .pkt = &p, .node = p.from, .flag = true });
+            return;
+        }
+    }
+    _keyReqs[_keyReqCursor] = { p.from, p.atMs };
+    _keyReqCursor = (_keyReqCursor + 1) % PKC_REQ_RING_MAX;
+
+    _onAppEvent(AppEvent::KeyRequest, { .pkt = &p, .node = p.from });
+    _appSendNodeInfo(p.from, /*wantResponse=*/true, /*requestId=*/0);
+}
+
+// A slot is released before its frame is dispatched, so a NodeInfo among
+// the held frames cannot bring it round again.
+void MeshApp::_retryHeld(uint32_t node, uint32_t nowMs)
+{
+    for (HeldPkc& h : _held)
+    {
+        if (!h.occupied || h.from != node) continue;
+        h.occupied = false;
+        if (nowMs - h.atMs > PKC_HELD_EXPIRE_MS) continue;
+
+        Packet p;
+        _header(p, h.data, h.len, h.rssi, h.snr, nowMs);
+        p.pkc  = true;
+        p.held = true;
+
+        uint8_t plain[256] = {};
+        const size_t plainLen = _decryptPkc(p, h.data, plain);
+        if (plainLen == 0)
+        {
+            _onAppEvent(AppEvent::RetryFailed, { .pkt = &p });
+            continue;
+        }
+        _onAppEvent(AppEvent::Decrypted, { .pkt = &p, .flag = true });
+        _dispatch(p, plain, plainLen);
+    }
+}
+
+void MeshApp::_applyNeighbor(const Packet& p, const McNeighborUpdate& u)
+{
+    const McNeighborResult r = mc_neighborApply(_neighbors, p.from, p.atMs, u, _nbGuard);
+
+    // A replaced or dropped key makes the cached session key wrong.
+    if (r.keyChanged)
+        mc_pkcKeyCacheInvalidate(_pkcKeys, p.from);
+
+    // An evicted node takes its key with it; its session key goes too.
+    if (r.evictedId != 0)
+    {
+        mc_pkcKeyCacheInvalidate(_pkcKeys, r.evictedId);
+        _onAppEvent(AppEvent::NeighborEvicted, { .pkt = &p, .node = r.evictedId });
+    }
+}
+
+// ── _dispatch ─────────────────────────────────────────────────────────────
+// Decode the Data proto and act on its port.
+void MeshApp::_dispatch(Packet& p, const uint8_t* plain, size_t plainLen)
+{
+    const uint8_t* payload    = nullptr;
+    size_t         payloadLen = 0;
+    if (!mc_parseData(plain, plainLen, p.port, payload, payloadLen, p.wantResp) ||
+        ((payload == nullptr || payloadLen == 0) && p.port != PORT_TRACEROUTE))
+    {
+        _onAppEvent(AppEvent::DataInvalid, { .pkt = &p });
+        return;
+    }
+
+    const uint32_t self  = _appSelf();
+    const bool     forUs = p.to == self || p.to == MESH_BROADCAST;
+
+    switch (p.port)
+    {
+    case PORT_TEXT:
+        if (!forUs)
+        {
+            _onAppEvent(AppEvent::NotForUs, { .pkt = &p });
+            return;
+        }
+        _onAppText(p, payload, payloadLen, /*alert=*/false);
+        break;
+
+    case PORT_ALERT:
+        // Broadcast by nature: shown whatever the destination.
+        _onAppText(p, payload, payloadLen, /*alert=*/true);
+        break;
+
+    case PORT_POSITION:
+    {
+        MeshPosition pos = {};
+        pos.rssi = p.rssi;
+        pos.snr  = p.snr;
+        if (!mc_parsePosition(payload, payloadLen, pos))
+        {
+            _onAppEvent(AppEvent::PayloadInvalid, { .pkt = &p, .port = p.port });
+            return;
+        }
+        _applyNeighbor(p, { .rssi = p.rssi, .snr = p.snr, .pos = &pos });
+        _onAppEvent(AppEvent::Position, { .pkt = &p, .pos = &pos });
+        break;
+    }
+
+    case PORT_NODEINFO:
+    {
+        MeshUser user = {};
+        user.rssi = p.rssi;
+        user.snr  = p.snr;
+        if (!mc_parseUser(payload, payloadLen, user))
+        {
+            _onAppEvent(AppEvent::PayloadInvalid, { .pkt = &p, .port = p.port });
+            return;
+        }
+        _applyNeighbor(p, { .rssi = p.rssi, .snr = p.snr, .user = &user });
+        _onAppEvent(AppEvent::NodeInfo, { .pkt = &p, .user = &user });
+
+        if (user.hasPublicKey)
+            _retryHeld(p.from, p.atMs);
+        if (_appCfg.tx && p.wantResp && forUs)
+        {
+            _onAppEvent(AppEvent::Reply, { .pkt = &p, .port = PORT_NODEINFO, .node = p.from });
+            _appSendNodeInfo(p.from, /*wantResponse=*/false, /*requestId=*/p.id);
+        }
+        break;
+    }
+
+    case PORT_NODE_STATUS:
+    {
+        MeshNodeStatus ns = {};
+        ns.rssi = p.rssi;
+        ns.snr  = p.snr;
+        if (!mc_parseNodeStatus(payload, payloadLen, ns))
+        {
+            _onAppEvent(AppEvent::PayloadInvalid, { .pkt = &p, .port = p.port });
+            return;
+        }
+        _applyNeighbor(p, { .rssi = p.rssi, .snr = p.snr, .status = &ns });
+        _onAppEvent(AppEvent::NodeStatus, { .pkt = &p, .status = &ns });
+        break;
+    }
+
+    case PORT_KEY_VERIFICATION:
+    {
+        // The sender shares its X25519 key (PKIReport field 1); with
+        // want_response it wants ours back.  Identity is left as it was.
+        MeshPkiReport report = {};
+        if (!mc_parsePkiReport(payload, payloadLen, report))
+        {
+            _onAppEvent(AppEvent::PayloadInvalid, { .pkt = &p, .port = p.port });
+            return;
+        }
+        if (report.hasPublicKey)
+            _applyNeighbor(p, { .rssi = p.rssi, .snr = p.snr,
+                                .publicKey = report.publicKey });
+        _onAppEvent(AppEvent::KeyVerification, { .pkt = &p, .pki = &report });
+
+        if (report.hasPublicKey)
+            _retryHeld(p.from, p.atMs);
+        if (_appCfg.tx && p.wantResp)
+        {
+            _onAppEvent(AppEvent::Reply,
+                        { .pkt = &p, .port = PORT_KEY_VERIFICATION, .node = p.from });
+            _appSendKey(p.from);
+        }
+        break;
+    }
+
+    case PORT_TRACEROUTE:
+    {
+        if (p.to != self)
+        {
+            _onAppEvent(AppEvent::Unhandled, { .pkt = &p, .port = p.port });
+            return;
+        }
+
+        // We are the destination: append our id and the SNR we heard the
+        // request at, and unicast the RouteDiscovery back with request_id
+        // = the request's id.  A malformed one still gets a reply carrying
+        // whatever hops decoded before the error.
+        MeshRouteDiscovery rd;
+        if (!mc_parseRouteDiscovery(payload, payloadLen, rd))
+            _onAppEvent(AppEvent::PayloadInvalid, { .pkt = &p, .port = p.port });
+        if (rd.routeLen < MC_ROUTE_MAX)
+            rd.route[rd.routeLen++] = self;
+        if (rd.snrLen < MC_ROUTE_MAX)
+            rd.snrTowards[rd.snrLen++] = static_cast<int32_t>(p.snr * 4.0f);
+        _onAppEvent(AppEvent::Traceroute, { .pkt = &p, .route = &rd });
+
+        if (!_appCfg.tx) break;
+        uint8_t frame[MESH_HDR + MESH_MAX_DATA];
+        const uint8_t n = _appBuildFrame(frame, PORT_TRACEROUTE,
+                                         [&](PbWriter& w) { mc_writeRouteDiscovery(w, rd); },
+                                         /*wantResponse=*/false, p.from, p.id);
+        if (n == 0) break;
+        _onAppEvent(AppEvent::Reply, { .pkt = &p, .port = PORT_TRACEROUTE, .node = p.from,
+                                        .route = &rd });
+        _appSend(frame, n, mc_txPriorityFor(PORT_TRACEROUTE, true));
+        break;
+    }
+
+    default:
+        _onAppEvent(AppEvent::Unhandled, { .pkt = &p, .port = p.port });
+        break;
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// Transmit
+// ─────────────────────────────────────────────────────────────────────────
+
+// ── _appBuildFrame ────────────────────────────────────────────────────────
+// Layout of out[]:
+//   [0..15]  OTA header (plaintext)
+//   [16..]   Data proto: AES-128-CTR with the default PSK (chanHash 0x08),
+//            AES-256-CCM to the peer's key plus the tag (chanHash 0x00), or
+//            plaintext in licensed mode (chanHash 0x0A)
+//
+// Licensed (FCC Part 97) operators must not encrypt.  Meshtastic enforces
+// it at the protocol layer: NodeDB::updateUser() rejects an is_licensed
+// NodeInfo that arrived on an encrypted channel hash, so only nodes on the
+// unencrypted channel hear a licensed node.
+//
+// The Data proto is written straight behind the header and the channel
+// cipher runs in place, so there is no intermediate payload buffer; a PKC
+// frame stages it once, as CCM appends its tag.
+uint8_t MeshApp::_appBuildFrame(uint8_t* out, uint32_t portnum, PbBody payload,
+                                bool wantResponse, uint32_t to, uint32_t requestId,
+                                bool pkc)
+{
+    // An empty payload is always a caller bug — nothing worth airtime.
+    {
+        PbWriter sizer(nullptr, 0);
+        payload(sizer);
+        if (sizer.size() == 0) return 0;
+    }
+
+    const uint32_t self    = _appSelf();
+    const bool     unicast = to != MESH_BROADCAST;
+
+    uint8_t key[32];
+    if (pkc && (!unicast || _appCfg.licensed || !_peerKey(to, key))) return 0;
+
+    // NodeInfo keeps dest out of the Data proto, as Meshtastic 2.7.x does;
+    // other unicasts carry it for routing.
+    const bool destInData = unicast && portnum != PORT_NODEINFO;
+
+    uint8_t  staged[MESH_MAX_DATA];
+    uint8_t* data = pkc ? staged : out + MESH_HDR;
+    PbWriter w(data, MESH_MAX_DATA - (pkc ? MC_PKC_OVERHEAD : 0));
+    mc_writeData(w, portnum, payload, wantResponse,
+                 destInData ? to : 0, unicast ? requestId : 0);
+    const size_t dataLen = w.finish();
+    if (dataLen == 0)
+    {
+        if (pkc) mbedtls_platform_zeroize(key, sizeof(key));
+        _onAppEvent(AppEvent::FrameTooLong, { .port = portnum });
+        return 0;
+    }
+
+    const uint32_t id   = _appPacketId();
+    const uint8_t  hops = _appCfg.hopLimit & 0x07;
+    _put32(out,     to);
+    _put32(out + 4, self);
+    _put32(out + 8, id);
+    out[12] = static_cast<uint8_t>(hops | hops << 5 | (unicast ? FLAG_WANT_ACK : 0));
+    out[13] = pkc ? 0x00 : _appCfg.licensed ? UNENCRYPTED_CHAN_HASH : DEFAULT_CHAN_HASH;
+    out[14] = 0x00;     // next_hop
+    out[15] = 0x00;     // relay_node
+
+    size_t bodyLen = dataLen;
+    bool   ok      = true;
+    if (pkc)
+    {
+        ok = mc_pkcEncryptWithKey(key, id, self, staged, dataLen, out + MESH_HDR);
+        mbedtls_platform_zeroize(key, sizeof(key));
+        mbedtls_platform_zeroize(staged, dataLen);
+        bodyLen += MC_PKC_OVERHEAD;
+    }
+    else if (!_appCfg.licensed)
+    {
+        ok = mc_channelCrypt(MC_DEFAULT_PSK, id, self, data, dataLen, data);
+    }
+    if (!ok) return 0;
+
+    const uint8_t len = static_cast<uint8_t>(MESH_HDR + bodyLen);
+    _onAppEvent(AppEvent::FrameBuilt, { .port = portnum, .node = to, .frame = out, .len = len });
+    return len;
+}
+
+bool MeshApp::_appSendKey(uint32_t to)
+{
+    const uint8_t* pub = _appPublicKey();
+    if (!_appCfg.tx || _appCfg.licensed || pub == nullptr) return false;
+
+    const uint32_t self = _appSelf();
+    uint8_t frame[MESH_HDR + MESH_MAX_DATA];
+    const uint8_t len = _appBuildFrame(frame, PORT_KEY_VERIFICATION,
+                                       [&](PbWriter& w) { mc_writePkiReport(w, pub, self); },
+                                       /*wantResponse=*/false, to);
+    return len > 0 && _appSend(frame, len, mc_txPriorityFor(PORT_KEY_VERIFICATION, true));
+}
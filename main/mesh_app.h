@@ -0,0 +1,215 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * mesh_app.h — the LoRa task's application layer: what happens to a frame
+ * once MeshRadio has admitted it, and how our own frames are built.
+ *
+ * _appReceive() takes one admitted frame through
+ *
+ *   decrypt     chanHash 0x00: PKC AES-256-CCM, DMs to us only, with the
+ *               per-peer session key from mc_pkcKeyCache.  Otherwise the
+ *               channel AES-128-CTR with the default PSK, falling back to
+ *               the raw bytes when that does not parse (plaintext nodes)
+ *   decode      mc_parseData, then the port's payload
+ *   neighbours  mc_neighborApply for Position, NodeInfo, NodeStatus and
+ *               KeyVerification; a replaced or evicted key drops its
+ *               cached session key
+ *   dispatch    text and alerts → _onAppText(); NodeInfo, traceroute and
+ *               key requests answered
+ *
+ * A PKC DM from a node whose key we lack is held (PKC_HELD_MAX, for
+ * PKC_HELD_EXPIRE_MS), the sender's NodeInfo is requested at most once per
+ * PKC_REQ_COOLDOWN_MS, and the held frame is dispatched once the key
+ * arrives.
+ *
+ * _appBuildFrame() is the other direction: header, Data proto, channel or
+ * PKC encryption for every frame we originate.
+ *
+ * The owner supplies this node's identity and packet ids, the TX path, our
+ * NodeInfo and the delivery of messages; counting and logging go through
+ * _onAppEvent(), as MeshRadio's do through _onRadioEvent().  LoRa is one
+ * owner and the mesh simulator's SimNode the other.
+ *
+ * Times are milliseconds on a free-running uint32_t clock.  Not
+ * thread-safe: the neighbour table is written only from here, under the
+ * owner's guard, and read here without it.
+ */
+
+#pragma once
+
+#include "mesh_codec.h"
+#include "mesh_crypto.h"
+#include "mesh_neighbors.h"
+#include "mesh_txqueue.h"
+#include "pb_writer.h"
+#include <cstddef>
+#include <cstdint>
+
+/// Node policy; LoRa fills it from Kconfig.
+struct MeshAppConfig {
+    bool    licensed = false;   ///< CONFIG_LORA_IS_LICENSED: plaintext channel, no PKC
+    bool    tx       = true;    ///< CONFIG_LORA_TX_ENABLED: answer requests
+    uint8_t hopLimit = 3;       ///< hop_start = hop_limit of frames we originate
+};
+
+class MeshApp
+{
+public:
+    static constexpr size_t   PKC_HELD_MAX        = 4;
+    static constexpr uint32_t PKC_HELD_EXPIRE_MS  = 300000; ///< stale DMs are not worth a retry
+    static constexpr size_t   PKC_REQ_RING_MAX    = 4;
+    static constexpr uint32_t PKC_REQ_COOLDOWN_MS = 60000;  ///< per node
+
+    /// One received frame: OTA header, signal and what decoding found.
+    struct Packet {
+        uint32_t to        = 0;
+        uint32_t from      = 0;
+        uint32_t id        = 0;
+        uint8_t  hopLimit  = 0;
+        uint8_t  hopStart  = 0;
+        uint8_t  chanHash  = 0;
+        uint8_t  len       = 0;     ///< frame bytes, header included
+        int16_t  rssi      = 0;
+        float    snr       = 0.f;
+        uint32_t atMs      = 0;     ///< reception (or retry) time
+        uint32_t port      = 0;     ///< valid once decoded
+        bool     wantResp  = false; ///< valid once decoded
+        bool     pkc       = false; ///< arrived as a PKC DM
+        bool     held      = false; ///< PKC DM dispatched from the held buffer
+    };
+
+    /// Outcomes reported to _onAppEvent().  The AppEventInfo fields each one
+    /// fills are listed alongside; pkt is set for every received frame.
+    enum class AppEvent : uint8_t {
+        Received,       ///< header parsed, before decryption
+        NoKeyPair,      ///< PKC DM but no key pair of our own (licensed, or none loaded)
+        PkcHeld,        ///< PKC DM to us without the sender's key: held for retry
+        KeyRequest,     ///< sender's NodeInfo wanted for its key (node); flag = on cooldown, not sent
+        Decrypted,      ///< flag = PKC
+        RetryFailed,    ///< held DM still unreadable with the sender's new key; dropped
+        DataInvalid,    ///< Data proto did not parse, or carried no payload
+        PayloadInvalid, ///< port payload did not parse (port)
+        NotForUs,       ///< text addressed to another node
+        Position,       ///< (pos), after the neighbour table is updated
+        NodeInfo,       ///< (user), after the neighbour table is updated
+        NodeStatus,     ///< (status), after the neighbour table is updated
+        KeyVerification,///< (pki), after the neighbour table is updated
+        Traceroute,     ///< traceroute to us (route, with our hop appended)
+        Reply,          ///< answering a request (port, node, route for traceroute)
+        Unhandled,      ///< port not dispatched (port)
+        NeighborEvicted,///< table full; node dropped with its session key (node)
+        FrameBuilt,     ///< _appBuildFrame() output (port, node = to, frame, len)
+        FrameTooLong,   ///< Data proto over the frame budget (port)
+    };
+
+    struct AppEventInfo {
+        const Packet*             pkt    = nullptr;
+        uint32_t                  port   = 0;
+        uint32_t                  node   = 0;
+        bool                      flag   = false;
+        const MeshPosition*       pos    = nullptr;
+        const MeshUser*           user   = nullptr;
+        const MeshNodeStatus*     status = nullptr;
+        const MeshPkiReport*      pki    = nullptr;
+        const MeshRouteDiscovery* route  = nullptr;
+        const uint8_t*            frame  = nullptr;
+        uint8_t                   len    = 0;
+    };
+
+    /// True when a public key is on file for @p node.
+    bool hasKeyFor(uint32_t node) const;
+
+protected:
+    /// @p guard brackets neighbour-table writes for the owner's readers.
+    MeshApp(const MeshAppConfig& cfg, const McNeighborGuard& guard = {});
+    ~MeshApp() = default;
+
+    // ── Owner hooks ───────────────────────────────────────────────────────
+    virtual uint32_t       _appSelf() const = 0;
+    /// X25519 key pair; nullptr when none is loaded (PKC is then off).
+    virtual const uint8_t* _appPrivateKey() const = 0;
+    virtual const uint8_t* _appPublicKey() const = 0;
+    /// Fresh non-zero packet id.
+    virtual uint32_t       _appPacketId() = 0;
+    /// Queue a frame from _appBuildFrame() for transmission.
+    virtual bool           _appSend(const uint8_t* frame, uint8_t len, McTxPriority prio) = 0;
+    /// Build and send our NodeInfo (its content is the owner's).
+    virtual bool           _appSendNodeInfo(uint32_t to, bool wantResponse,
+                                            uint32_t requestId) = 0;
+    /// Text or alert for this node; @p text is not NUL-terminated.
+    virtual void           _onAppText(const Packet& p, const uint8_t* text, size_t len,
+                                      bool alert) = 0;
+    virtual void           _onAppEvent(AppEvent e, const AppEventInfo& info) { (void)e; (void)info; }
+
+    // ── Entry points ──────────────────────────────────────────────────────
+    /// Decrypt, decode and dispatch a frame _admitRx() accepted.
+    void    _appReceive(const uint8_t* buf, uint8_t len, int16_t rssi, float snr,
+                        uint32_t nowMs);
+    /// Build one of our frames into @p out (at least 255 bytes).  @p pkc
+    /// encrypts to @p to's key instead of the channel.  Returns the frame
+    /// length; 0 when the payload is empty, the Data proto does not fit or
+    /// there is no key for a PKC frame.
+    uint8_t _appBuildFrame(uint8_t* out, uint32_t portnum, PbBody payload,
+                           bool wantResponse = false, uint32_t to = MESH_BROADCAST,
+                           uint32_t requestId = 0, bool pkc = false);
+    /// Unicast our public key on KEY_VERIFICATION_APP.
+    bool    _appSendKey(uint32_t to);
+    /// Forget every neighbour, session key, held DM and key request.
+    void    _appReset();
+
+    MeshAppConfig   _appCfg;
+    McNeighborGuard _nbGuard;
+    McNeighborTable _neighbors = {};
+    McPkcKeyCache   _pkcKeys   = {};
+
+private:
+    struct HeldPkc {
+        uint8_t  data[255] = {};
+        uint8_t  len       = 0;
+        int16_t  rssi      = 0;
+        float    snr       = 0.f;
+        uint32_t from      = 0;
+        uint32_t id        = 0;
+        uint32_t atMs      = 0;
+        bool     occupied  = false;
+    };
+    struct KeyReq {
+        uint32_t node = 0;
+        uint32_t atMs = 0;
+    };
+
+    HeldPkc _held[PKC_HELD_MAX]        = {};
+    KeyReq  _keyReqs[PKC_REQ_RING_MAX] = {};
+    size_t  _keyReqCursor = 0;
+
+    /// Parse the OTA header of @p buf into @p p.
+    static void _header(Packet& p, const uint8_t* buf, uint8_t len, int16_t rssi,
+                        float snr, uint32_t nowMs);
+    /// Session key for @p node; false without a public key on file.
+    bool _peerKey(uint32_t node, uint8_t key[32]);
+    /// PKC-decrypt @p p's payload into @p plain.  Returns the plaintext
+    /// length, 0 on failure.
+    size_t _decryptPkc(const Packet& p, const uint8_t* buf, uint8_t* plain);
+    void _hold(const Packet& p, const uint8_t* buf);
+    void _requestKey(const Packet& p);
+    /// Dispatch every held DM from @p node now that its key is known.
+    void _retryHeld(uint32_t node, uint32_t nowMs);
+    void _dispatch(Packet& p, const uint8_t* plain, size_t plainLen);
+    void _applyNeighbor(const Packet& p, const McNeighborUpdate& u);
+};
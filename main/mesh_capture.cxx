@@ -0,0 +1,191 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * mesh_capture.cxx — lock-free frame capture ring and pcap export
+ * (see mesh_capture.h).
+ */
+
+#include "mesh_capture.h"
+#include <cmath>
+#include <cstring>
+
+static inline void _putLe16(uint8_t* p, uint16_t v)
+{
+    p[0] = static_cast<uint8_t>(v);
+    p[1] = static_cast<uint8_t>(v >> 8);
+}
+
+static inline void _putLe32(uint8_t* p, uint32_t v)
+{
+    p[0] = static_cast<uint8_t>(v);       p[1] = static_cast<uint8_t>(v >> 8);
+    p[2] = static_cast<uint8_t>(v >> 16); p[3] = static_cast<uint8_t>(v >> 24);
+}
+
+static inline void _putBe32(uint8_t* p, uint32_t v)
+{
+    p[0] = static_cast<uint8_t>(v >> 24); p[1] = static_cast<uint8_t>(v >> 16);
+    p[2] = static_cast<uint8_t>(v >> 8);  p[3] = static_cast<uint8_t>(v);
+}
+
+// ── Ring ──────────────────────────────────────────────────────────────────
+
+uint8_t* mc_captureBegin(McCapture& c)
+{
+    const uint32_t n = c.head.load(std::memory_order_relaxed);
+    McCaptureSlot& s = c.slots[n % MC_CAPTURE_DEPTH];
+    s.seq.store(2 * n + 1, std::memory_order_relaxed);
+    // Readers must see the slot as busy before any of its bytes change.
+    std::atomic_thread_fence(std::memory_order_release);
+    return s.data;
+}
+
+void mc_captureCommit(McCapture& c, uint8_t len, int16_t rssi, float snr,
+                      uint32_t tickMs)
+{
+    const uint32_t n = c.head.load(std::memory_order_relaxed);
+    McCaptureSlot& s = c.slots[n % MC_CAPTURE_DEPTH];
+
+    long q = std::lround(snr * 4.f);
+    if (q < -128) q = -128;
+    if (q > 127)  q = 127;
+
+    s.tickMs = tickMs;
+    s.rssi   = rssi;
+    s.snrQ4  = static_cast<int8_t>(q);
+    s.len    = len;
+    s.seq.store(2 * n + 2, std::memory_order_release);
+    c.head.store(n + 1, std::memory_order_release);
+}
+
+uint32_t mc_captureHead(const McCapture& c)
+{
+    return c.head.load(std::memory_order_acquire);
+}
+
+uint32_t mc_captureOldest(const McCapture& c)
+{
+    const uint32_t h = mc_captureHead(c);
+    return h > MC_CAPTURE_DEPTH ? h - MC_CAPTURE_DEPTH : 0;
+}
+
+bool mc_captureRead(const McCapture& c, uint32_t n, McCaptureFrame& out)
+{
+    const McCaptureSlot& s = c.slots[n % MC_CAPTURE_DEPTH];
+    const uint32_t want = 2 * n + 2;
+    if (s.seq.load(std::memory_order_acquire) != want) return false;
+
+    out.n      = n;
+    out.tickMs = s.tickMs;
+    out.rssi   = s.rssi;
+    out.snr    = static_cast<float>(s.snrQ4) / 4.f;
+    out.len    = s.len;
+    memcpy(out.data, s.data, out.len);
+
+    // The copy only counts if the writer did not reclaim the slot meanwhile.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return s.seq.load(std::memory_order_relaxed) == want;
+}
+
+// ── pcap ──────────────────────────────────────────────────────────────────
+
+size_t mc_loraTapHeader(uint8_t* out, const McLoraTapChannel& ch,
+                        int16_t rssi, float snr)
+{
+    long q = std::lround(snr * 4.f);
+    if (q < -128) q = -128;
+    if (q > 127)  q = 127;
+    const int r = rssi + 139;
+
+    out[0] = 0;                                     // lt_version
+    out[1] = 0;                                     // lt_padding
+    out[2] = 0;                                     // lt_length, big-endian
+    out[3] = static_cast<uint8_t>(MC_LORATAP_HDR);
+    _putBe32(out + 4, ch.freqHz);
+    out[8]  = static_cast<uint8_t>(ch.bwHz / 125000);
+    out[9]  = ch.sf;
+    out[10] = static_cast<uint8_t>(r < 0 ? 0 : (r > 255 ? 255 : r));
+    out[11] = 0;                                    // max_rssi
+    out[12] = 0;                                    // current_rssi
+    out[13] = static_cast<uint8_t>(static_cast<int8_t>(q));
+    out[14] = ch.syncWord;
+    return MC_LORATAP_HDR;
+}
+
+void mc_pcapBegin(McPcapStream& s, const McCapture& c, const McLoraTapChannel& ch)
+{
+    s.ch   = ch;
+    s.next = mc_captureOldest(c);
+    s.end  = mc_captureHead(c);
+    s.sent = 0;
+    s.lost = 0;
+    s.off  = 0;
+
+    uint8_t* h = s.buf;
+    _putLe32(h,      0xA1B2C3D4);                   // magic, µs timestamps
+    _putLe16(h + 4,  2);                            // version 2.4
+    _putLe16(h + 6,  4);
+    _putLe32(h + 8,  0);                            // thiszone
+    _putLe32(h + 12, 0);                            // sigfigs
+    _putLe32(h + 16, MC_LORATAP_HDR + 255);         // snaplen
+    _putLe32(h + 20, MC_LINKTYPE_LORATAP);
+    s.len = MC_PCAP_FILE_HDR;
+}
+
+// Stage the next readable frame as a pcap record.  False when the
+// snapshot is exhausted.
+static bool _stageRecord(McPcapStream& s, const McCapture& c)
+{
+    McCaptureFrame f;
+    while (s.next != s.end)
+    {
+        if (!mc_captureRead(c, s.next++, f))
+        {
+            s.lost++;
+            continue;
+        }
+        const uint32_t incl = static_cast<uint32_t>(MC_LORATAP_HDR + f.len);
+        uint8_t* r = s.buf;
+        _putLe32(r,      f.tickMs / 1000);
+        _putLe32(r + 4,  (f.tickMs % 1000) * 1000);
+        _putLe32(r + 8,  incl);
+        _putLe32(r + 12, incl);
+        mc_loraTapHeader(r + MC_PCAP_REC_HDR, s.ch, f.rssi, f.snr);
+        memcpy(r + MC_PCAP_REC_HDR + MC_LORATAP_HDR, f.data, f.len);
+        s.off = 0;
+        s.len = static_cast<uint16_t>(MC_PCAP_REC_HDR + incl);
+        s.sent++;
+        return true;
+    }
+    return false;
+}
+
+size_t mc_pcapRead(McPcapStream& s, const McCapture& c, uint8_t* out, size_t cap)
+{
+    size_t n = 0;
+    while (n < cap)
+    {
+        if (s.off == s.len && !_stageRecord(s, c)) break;
+        size_t k = static_cast<size_t>(s.len - s.off);
+        if (k > cap - n) k = cap - n;
+        memcpy(out + n, s.buf + s.off, k);
+        s.off = static_cast<uint16_t>(s.off + k);
+        n += k;
+    }
+    return n;
+}
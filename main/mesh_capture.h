@@ -0,0 +1,146 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * mesh_capture.h — ring of recently received LoRa frames, exported as pcap.
+ *
+ * Every good frame is kept as it came off the air — OTA header and
+ * ciphertext — with its RSSI, SNR and tick, so field problems can be
+ * replayed on a desk.  The run loop asks mc_captureBegin() for the next
+ * slot, has ReadBuffer land the payload there and parses it in place, so
+ * capture adds no copy to the receive path and never allocates.  When the
+ * ring is full the oldest frame is overwritten.
+ *
+ * One writer, any number of readers, no locks.  Each slot carries a
+ * sequence number: odd while frame n is being written into it (2n + 1),
+ * even once complete (2n + 2).  A reader copies the slot and keeps the
+ * copy only if it saw the expected even value before and after, so a
+ * reader that falls behind loses frames but never returns a torn one.
+ *
+ * McPcapStream turns a snapshot of the ring into a pcap file
+ * (LINKTYPE_LORATAP, one LoRaTap v0 header per frame) delivered in
+ * caller-sized chunks, for a BLE characteristic to send one notification
+ * at a time.
+ *
+ * Capacity is MC_CAPTURE_DEPTH, set from CONFIG_LORA_CAPTURE_FRAMES by
+ * main/CMakeLists.txt.  Writer: LoRa task only.  Readers: any task.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+
+#ifndef MC_CAPTURE_DEPTH
+#  define MC_CAPTURE_DEPTH 32
+#endif
+
+static_assert(MC_CAPTURE_DEPTH >= 2 && MC_CAPTURE_DEPTH <= 1024,
+              "MC_CAPTURE_DEPTH out of range");
+
+struct McCaptureSlot {
+    std::atomic<uint32_t> seq{0};   ///< 2n+1 while frame n is written, 2n+2 once complete
+    uint32_t tickMs = 0;
+    int16_t  rssi   = 0;            ///< dBm
+    int8_t   snrQ4  = 0;            ///< SNR × 4, as GetPacketStatus reports it
+    uint8_t  len    = 0;
+    uint8_t  data[255] = {};
+};
+
+struct McCapture {
+    McCaptureSlot         slots[MC_CAPTURE_DEPTH];
+    std::atomic<uint32_t> head{0};  ///< frames committed since boot
+};
+
+/// A frame copied out of the ring.
+struct McCaptureFrame {
+    uint32_t n      = 0;            ///< frame number since boot
+    uint32_t tickMs = 0;
+    int16_t  rssi   = 0;
+    float    snr    = 0.f;
+    uint8_t  len    = 0;
+    uint8_t  data[255] = {};
+};
+
+/**
+ * Claim the slot for the next frame and return its 255-byte data buffer.
+ * The slot reads as busy until mc_captureCommit().  Writer only.
+ */
+uint8_t* mc_captureBegin(McCapture& c);
+
+/// Publish the frame written into the buffer from mc_captureBegin().
+void mc_captureCommit(McCapture& c, uint8_t len, int16_t rssi, float snr,
+                      uint32_t tickMs);
+
+/// Frames committed since boot; frame numbers run 0 … head − 1.
+uint32_t mc_captureHead(const McCapture& c);
+
+/// Oldest frame number that may still be in the ring.
+uint32_t mc_captureOldest(const McCapture& c);
+
+/**
+ * Copy frame @p n into @p out.  Returns false when it has not been
+ * committed yet, has been overwritten, or was overwritten during the copy.
+ */
+bool mc_captureRead(const McCapture& c, uint32_t n, McCaptureFrame& out);
+
+// ── pcap export ───────────────────────────────────────────────────────────
+
+static constexpr uint32_t MC_LINKTYPE_LORATAP = 270;
+static constexpr size_t   MC_PCAP_FILE_HDR    = 24;
+static constexpr size_t   MC_PCAP_REC_HDR     = 16;
+static constexpr size_t   MC_LORATAP_HDR      = 15;   ///< LoRaTap v0
+
+/// Radio settings recorded in every LoRaTap header.
+struct McLoraTapChannel {
+    uint32_t freqHz   = 0;
+    uint32_t bwHz     = 0;
+    uint8_t  sf       = 0;
+    uint8_t  syncWord = 0;          ///< 0x2B for Meshtastic
+};
+
+/**
+ * Write a LoRaTap v0 header: version, padding, length (BE), frequency
+ * (BE, Hz), bandwidth (125 kHz steps), SF, packet RSSI (dBm + 139, 0 if
+ * below −139), max and current RSSI (0 — not measured), SNR (quarter dB,
+ * signed), sync word.  Returns MC_LORATAP_HDR.
+ */
+size_t mc_loraTapHeader(uint8_t* out, const McLoraTapChannel& ch,
+                        int16_t rssi, float snr);
+
+/// Export cursor over a snapshot of the ring.
+struct McPcapStream {
+    McLoraTapChannel ch;
+    uint32_t next = 0;              ///< next frame number to emit
+    uint32_t end  = 0;              ///< one past the last frame in the snapshot
+    uint32_t sent = 0;              ///< frames emitted
+    uint32_t lost = 0;              ///< frames overwritten before they were read
+    uint16_t off  = 0;              ///< bytes of buf already handed out
+    uint16_t len  = 0;              ///< bytes staged in buf
+    uint8_t  buf[MC_PCAP_REC_HDR + MC_LORATAP_HDR + 255] = {};
+};
+
+/// Start an export of every frame now in the ring, file header first.
+void mc_pcapBegin(McPcapStream& s, const McCapture& c, const McLoraTapChannel& ch);
+
+/**
+ * Copy up to @p cap bytes of the pcap stream into @p out.  Returns the
+ * byte count; 0 once the whole snapshot has been delivered.
+ */
+size_t mc_pcapRead(McPcapStream& s, const McCapture& c, uint8_t* out, size_t cap);
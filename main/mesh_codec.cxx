@@ -23,7 +23,7 @@
  */
 
 #include "mesh_codec.h"
-#include <bit>        // std::bit_cast (C++20)
+#include "pb_reader.h"
 #include <cinttypes>
 #include <cstdio>
 #include <algorithm>
@@ -67,36 +67,20 @@ size_t mc_pbString(uint8_t* buf, uint8_t tag, const char* s)
 
 // ── mc_encodePosition ─────────────────────────────────────────────────────
 
-size_t mc_encodePosition(uint8_t* buf, size_t /*cap*/,
-                          int32_t lat_i, int32_t lon_i, int32_t alt_m,
-                          uint32_t sats, uint32_t unixTime,
-                          uint32_t speed_cm_s, uint32_t track_x100)
+void mc_writePosition(PbWriter& w,
+                      int32_t lat_i, int32_t lon_i, int32_t alt_m,
+                      uint32_t sats, uint32_t unixTime,
+                      uint32_t speed_cm_s, uint32_t track_x100)
 {
-    size_t n = 0;
+    w.sfixed32(1, lat_i);                       // Field 1: latitude_i (sfixed32)
+    w.sfixed32(2, lon_i);                       // Field 2: longitude_i (sfixed32)
 
-    auto writeFixed32 = [&](uint8_t tag, uint32_t val) {
-        buf[n++] = tag;
-        buf[n++] = static_cast<uint8_t>(val);
-        buf[n++] = static_cast<uint8_t>(val >>  8);
-        buf[n++] = static_cast<uint8_t>(val >> 16);
-        buf[n++] = static_cast<uint8_t>(val >> 24);
-    };
-
-    auto writeVarint = [&](uint8_t tag, uint64_t val) {
-        buf[n++] = tag;
-        n += mc_pbVarint(buf + n, val);
-    };
-
-    writeFixed32(0x0D, static_cast<uint32_t>(lat_i));   // Field 1: latitude_i (sfixed32)
-    writeFixed32(0x15, static_cast<uint32_t>(lon_i));   // Field 2: longitude_i (sfixed32)
-
-    if (alt_m != 0)
-        writeVarint(0x18, static_cast<uint64_t>(static_cast<int64_t>(alt_m))); // Field 3: altitude
+    if (alt_m != 0) w.int32(3, alt_m);          // Field 3: altitude
 
     if (unixTime != 0)
-        writeFixed32(0x25, unixTime);                   // Field 4: time — GPS fix timestamp
+        w.fixed32(4, unixTime);                 // Field 4: time — GPS fix timestamp
 
-    writeVarint(0x28, 2);                               // Field 5: location_source = GPS
+    w.varint(5, 2);                             // Field 5: location_source = GPS
 
     // Field 7: timestamp — device wall-clock time when position was last determined.
     // Distinct from field 4 (GPS fix epoch): this is always the current device time.
@@ -104,215 +88,212 @@ size_t mc_encodePosition(uint8_t* buf, size_t /*cap*/,
     // map rely on it for the "last seen" display even when field 4 is absent.
     // Tag = (7<<3)|5 = 0x3D (fixed32, wire type 5).
     if (unixTime != 0)
-        writeFixed32(0x3D, unixTime);                   // Field 7: timestamp (device time)
+        w.fixed32(7, unixTime);                 // Field 7: timestamp (device time)
 
-    if (speed_cm_s != 0) writeVarint(0x50, speed_cm_s); // Field 10: ground_speed
-    if (track_x100 != 0) writeVarint(0x58, track_x100); // Field 11: ground_track
-    if (sats != 0)       writeVarint(0x70, sats);       // Field 14: sats_in_view ← NOT field 7
+    if (speed_cm_s != 0) w.varint(10, speed_cm_s); // Field 10: ground_speed
+    if (track_x100 != 0) w.varint(11, track_x100); // Field 11: ground_track
+    if (sats != 0)       w.varint(14, sats);       // Field 14: sats_in_view ← NOT field 7
 
-    // Field 18: precision_bits = 32 — 2-byte tag (field > 15)
-    buf[n++] = 0x90; buf[n++] = 0x01;
-    n += mc_pbVarint(buf + n, 32);
+    w.varint(18, 32);                           // Field 18: precision_bits (2-byte tag 0x90 0x01)
+}
 
-    return n;
+size_t mc_encodePosition(uint8_t* buf, size_t cap,
+                          int32_t lat_i, int32_t lon_i, int32_t alt_m,
+                          uint32_t sats, uint32_t unixTime,
+                          uint32_t speed_cm_s, uint32_t track_x100)
+{
+    PbWriter w(buf, cap);
+    mc_writePosition(w, lat_i, lon_i, alt_m, sats, unixTime, speed_cm_s, track_x100);
+    return w.finish();
 }
 
 // ── mc_encodeUser ─────────────────────────────────────────────────────────
 
-size_t mc_encodeUser(uint8_t* buf, size_t /*cap*/,
-                     uint32_t nodeId,
-                     const char* longName, const char* shortName,
-                     const uint8_t macaddr[6],
-                     uint32_t hwModel,
-                     uint8_t  deviceRole,
-                     const uint8_t* publicKey,
-                     bool isLicensed,
-                     bool isUnmessageable)
+void mc_writeUser(PbWriter& w,
+                  uint32_t nodeId,
+                  const char* longName, const char* shortName,
+                  const uint8_t macaddr[6],
+                  uint32_t hwModel,
+                  uint8_t  deviceRole,
+                  const uint8_t* publicKey,
+                  bool isLicensed,
+                  bool isUnmessageable)
 {
-    size_t n = 0;
-
     // Field 1: id — "!xxxxxxxx"
     char idStr[12] = {};
     snprintf(idStr, sizeof(idStr), "!%08" PRIx32, nodeId);
-    n += mc_pbString(buf + n, 0x0A, idStr);
+    w.string(1, idStr);
 
-    n += mc_pbString(buf + n, 0x12, longName);   // Field 2: long_name
-    n += mc_pbString(buf + n, 0x1A, shortName);  // Field 3: short_name
+    w.string(2, longName);                      // Field 2: long_name
+    w.string(3, shortName);                     // Field 3: short_name
 
     if (macaddr)
-        n += mc_pbLenField(buf + n, 0x22, macaddr, 6); // Field 4: macaddr (6 bytes)
+        w.bytes(4, macaddr, 6);                 // Field 4: macaddr (6 bytes)
 
-    buf[n++] = 0x28;                             // Field 5: hw_model (varint)
-    n += mc_pbVarint(buf + n, hwModel);
+    w.varint(5, hwModel);                       // Field 5: hw_model (varint)
 
     // Fields 6–8 must be emitted in ascending order to match Meshtastic
     // v2.7.15 nanopb output.  is_licensed and public_key are mutually
     // exclusive: licensed mode sets field 6 and suppresses field 8.
     if (isLicensed)
-    {
-        buf[n++] = 0x30; buf[n++] = 0x01;       // Field 6: is_licensed = true
-    }
+        w.boolean(6, true);                     // Field 6: is_licensed = true
 
     if (deviceRole != 0)
-    {
-        buf[n++] = 0x38;                         // Field 7: role (varint)
-        n += mc_pbVarint(buf + n, deviceRole);
-    }
+        w.varint(7, deviceRole);                // Field 7: role (varint)
 
     if (!isLicensed && publicKey != nullptr)
-    {
-        n += mc_pbLenField(buf + n, 0x42, publicKey, 32); // Field 8: public_key (32 bytes)
-    }
+        w.bytes(8, publicKey, 32);              // Field 8: public_key (32 bytes)
 
     // Field 9: is_unmessageable — always emitted (required by Meshtastic 2.5+).
     // true for headless nodes (sensors, plain trackers) that cannot receive DMs.
-    buf[n++] = 0x48;
-    buf[n++] = isUnmessageable ? 0x01 : 0x00;
-    return n;
+    w.boolean(9, isUnmessageable);
 }
 
-// ── mc_encodeData ─────────────────────────────────────────────────────────
-
-size_t mc_encodeData(uint8_t* buf, size_t /*cap*/,
-                     uint32_t portnum,
-                     const uint8_t* payload, size_t payloadLen,
-                     bool want_response,
-                     uint32_t dest,
-                     uint32_t requestId)
+size_t mc_encodeUser(uint8_t* buf, size_t cap,
+                     uint32_t nodeId,
+                     const char* longName, const char* shortName,
+                     const uint8_t macaddr[6],
+                     uint32_t hwModel,
+                     uint8_t  deviceRole,
+                     const uint8_t* publicKey,
+                     bool isLicensed,
+                     bool isUnmessageable)
 {
-    size_t n = 0;
-
-    auto writeFixed32 = [&](uint8_t tag, uint32_t val) {
-        buf[n++] = tag;
-        buf[n++] = static_cast<uint8_t>(val);
-        buf[n++] = static_cast<uint8_t>(val >>  8);
-        buf[n++] = static_cast<uint8_t>(val >> 16);
-        buf[n++] = static_cast<uint8_t>(val >> 24);
-    };
+    PbWriter w(buf, cap);
+    mc_writeUser(w, nodeId, longName, shortName, macaddr, hwModel, deviceRole,
+                 publicKey, isLicensed, isUnmessageable);
+    return w.finish();
+}
 
-    buf[n++] = 0x08;                                    // Field 1: portnum (varint)
-    n += mc_pbVarint(buf + n, portnum);
+// ── mc_encodeData ─────────────────────────────────────────────────────────
 
-    n += mc_pbLenField(buf + n, 0x12, payload, payloadLen); // Field 2: payload (bytes)
+void mc_writeData(PbWriter& w,
+                  uint32_t portnum,
+                  PbBody   payload,
+                  bool want_response,
+                  uint32_t dest,
+                  uint32_t requestId)
+{
+    w.varint(1, portnum);                       // Field 1: portnum (varint)
+    w.message(2, payload);                      // Field 2: payload (bytes)
 
-    if (want_response) { buf[n++] = 0x18; buf[n++] = 0x01; } // Field 3: want_response
+    if (want_response) w.boolean(3, true);      // Field 3: want_response
 
-    if (dest != 0) writeFixed32(0x25, dest);            // Field 4: dest (fixed32)
+    if (dest != 0) w.fixed32(4, dest);          // Field 4: dest (fixed32)
 
     // source (field 5) intentionally omitted — only relay nodes set it
 
     if (requestId != 0)
-        writeFixed32(0x35, requestId);                  // Field 6: request_id ← tag 0x35 NOT 0x3D
+        w.fixed32(6, requestId);                // Field 6: request_id ← tag 0x35 NOT 0x3D
 
-    buf[n++] = 0x48; buf[n++] = 0x00;              // Field 9: ok_to_mqtt = false (always)
+    w.boolean(9, false);                        // Field 9: ok_to_mqtt = false (always)
+}
 
-    return n;
+size_t mc_encodeData(uint8_t* buf, size_t cap,
+                     uint32_t portnum,
+                     const uint8_t* payload, size_t payloadLen,
+                     bool want_response,
+                     uint32_t dest,
+                     uint32_t requestId)
+{
+    PbWriter w(buf, cap);
+    mc_writeData(w, portnum,
+                 [&](PbWriter& p) { p.raw(payload, payloadLen); },
+                 want_response, dest, requestId);
+    return w.finish();
 }
 
 // ── mc_encodeTelemetry ────────────────────────────────────────────────────
 
-size_t mc_encodeTelemetry(uint8_t* buf, size_t /*cap*/,
-                           uint32_t unixTime, uint32_t uptimeSec,
-                           uint8_t batteryLevel, float batteryVoltage)
+void mc_writeTelemetry(PbWriter& w,
+                       uint32_t unixTime, uint32_t uptimeSec,
+                       uint8_t batteryLevel, float batteryVoltage,
+                       float channelUtil, float airUtilTx)
 {
-    auto writeFixed32 = [](uint8_t* dst, uint8_t tag, uint32_t val) -> size_t {
-        dst[0] = tag;
-        dst[1] = static_cast<uint8_t>(val);
-        dst[2] = static_cast<uint8_t>(val >> 8);
-        dst[3] = static_cast<uint8_t>(val >> 16);
-        dst[4] = static_cast<uint8_t>(val >> 24);
-        return 5;
-    };
+    w.fixed32(1, unixTime);                     // Telemetry Field 1: time
 
-    // Inner DeviceMetrics submessage.
+    // Telemetry Field 2: device_metrics, sized and written in place.
     // All five defined fields are emitted — Meshtastic firmware always sends
     // channel_utilization and air_util_tx even when their value is 0.0, and
     // the app displays "0%" rather than "N/A" when explicit zeros are present.
-    uint8_t dm[32] = {};
-    size_t  dmn    = 0;
-
-    dm[dmn++] = 0x08;                                  // DeviceMetrics Field 1: battery_level
-    dmn += mc_pbVarint(dm + dmn, batteryLevel);
-
-    // std::bit_cast<uint32_t> reinterprets the float bits without undefined
-    // behaviour — the C++20 replacement for the memcpy type-pun idiom.
-    dmn += writeFixed32(dm + dmn, 0x15,
-                        std::bit_cast<uint32_t>(batteryVoltage)); // Field 2: voltage
-
-    // Field 3: channel_utilization (float, tag 0x1D = (3<<3)|5).
-    // We have no airtime tracking infrastructure; emit 0.0f explicitly so the
-    // Meshtastic app shows "0%" instead of "N/A".
-    dmn += writeFixed32(dm + dmn, 0x1D, 0x00000000u);  // DeviceMetrics Field 3: channel_utilization = 0.0f
-
-    // Field 4: air_util_tx (float, tag 0x25 = (4<<3)|5).
-    dmn += writeFixed32(dm + dmn, 0x25, 0x00000000u);  // DeviceMetrics Field 4: air_util_tx = 0.0f
-
-    dm[dmn++] = 0x28;                                  // DeviceMetrics Field 5: uptime_seconds
-    dmn += mc_pbVarint(dm + dmn, uptimeSec);
+    w.message(2, [&](PbWriter& dm) {
+        dm.varint(1, batteryLevel);             // DeviceMetrics Field 1: battery_level
+        dm.float32(2, batteryVoltage);          // DeviceMetrics Field 2: voltage
+
+        // Fields 3/4: channel_utilization / air_util_tx (float, tags 0x1D / 0x25),
+        // percent, from the LoRa airtime ledger.  Written even at 0.0f so the
+        // Meshtastic app shows "0%" instead of "N/A".
+        dm.float32(3, channelUtil);             // DeviceMetrics Field 3: channel_utilization
+        dm.float32(4, airUtilTx);               // DeviceMetrics Field 4: air_util_tx
+
+        dm.varint(5, uptimeSec);                // DeviceMetrics Field 5: uptime_seconds
+    });
+}
 
-    size_t n = 0;
-    n += writeFixed32(buf + n, 0x0D, unixTime);        // Telemetry Field 1: time
-    n += mc_pbLenField(buf + n, 0x12, dm, dmn);        // Telemetry Field 2: device_metrics
-    return n;
+size_t mc_encodeTelemetry(uint8_t* buf, size_t cap,
+                           uint32_t unixTime, uint32_t uptimeSec,
+                           uint8_t batteryLevel, float batteryVoltage,
+                           float channelUtil, float airUtilTx)
+{
+    PbWriter w(buf, cap);
+    mc_writeTelemetry(w, unixTime, uptimeSec, batteryLevel, batteryVoltage,
+                      channelUtil, airUtilTx);
+    return w.finish();
 }
 
 // ── mc_encodeMapReport ────────────────────────────────────────────────────
 
-size_t mc_encodeMapReport(uint8_t* buf, size_t /*cap*/,
-                           const char* longName, const char* shortName,
-                           int32_t lat_i, int32_t lon_i, int32_t alt_m,
-                           uint32_t numNeighbors,
-                           uint32_t hwModel,
-                           uint8_t  regionCode,
-                           uint8_t  modemPreset,
-                           const char* firmwareVersion,
-                           bool hasPosition)
+void mc_writeMapReport(PbWriter& w,
+                       const char* longName, const char* shortName,
+                       int32_t lat_i, int32_t lon_i, int32_t alt_m,
+                       uint32_t numNeighbors,
+                       uint32_t hwModel,
+                       uint8_t  regionCode,
+                       uint8_t  modemPreset,
+                       const char* firmwareVersion,
+                       bool hasPosition)
 {
-    size_t n = 0;
-
-    auto writeFixed32 = [&](uint8_t tag, uint32_t val) {
-        buf[n++] = tag;
-        buf[n++] = static_cast<uint8_t>(val);
-        buf[n++] = static_cast<uint8_t>(val >>  8);
-        buf[n++] = static_cast<uint8_t>(val >> 16);
-        buf[n++] = static_cast<uint8_t>(val >> 24);
-    };
-
-    n += mc_pbString(buf + n, 0x0A, longName);         // Field 1: long_name
-    n += mc_pbString(buf + n, 0x12, shortName);        // Field 2: short_name
-    buf[n++] = 0x18; n += mc_pbVarint(buf + n, hwModel);    // Field 3: hw_model
+    w.string(1, longName);                      // Field 1: long_name
+    w.string(2, shortName);                     // Field 2: short_name
+    w.varint(3, hwModel);                       // Field 3: hw_model
 
     // Field 4: firmware_version (string) — new in Meshtastic 2.7.x.
     // Identifies this node's firmware to MQTT bridges and the public map.
     // Omit when nullptr or empty (backward compatible with 2.5/2.6 receivers).
     if (firmwareVersion && firmwareVersion[0] != '\0')
-        n += mc_pbString(buf + n, 0x22, firmwareVersion); // Field 4: firmware_version
+        w.string(4, firmwareVersion);           // Field 4: firmware_version
 
-    buf[n++] = 0x28; n += mc_pbVarint(buf + n, regionCode); // Field 5: region
-    buf[n++] = 0x30; n += mc_pbVarint(buf + n, modemPreset);// Field 6: modem_preset
-    buf[n++] = 0x38; buf[n++] = 0x01;                 // Field 7: has_default_channel = true
+    w.varint(5, regionCode);                    // Field 5: region
+    w.varint(6, modemPreset);                   // Field 6: modem_preset
+    w.boolean(7, true);                         // Field 7: has_default_channel = true
 
     // Fields 8–11: position data — omit when no GPS fix.
     // Receivers still get identity/firmware/region info; position appears absent.
     if (hasPosition) {
-        writeFixed32(0x45, static_cast<uint32_t>(lat_i)); // Field 8: latitude_i
-        writeFixed32(0x4D, static_cast<uint32_t>(lon_i)); // Field 9: longitude_i
-
-        if (alt_m != 0)
-        {
-            buf[n++] = 0x50;
-            n += mc_pbVarint(buf + n, static_cast<uint64_t>(static_cast<int64_t>(alt_m))); // Field 10
-        }
-
-        buf[n++] = 0x58; n += mc_pbVarint(buf + n, 32);   // Field 11: position_precision
+        w.sfixed32(8, lat_i);                   // Field 8: latitude_i
+        w.sfixed32(9, lon_i);                   // Field 9: longitude_i
+        if (alt_m != 0) w.int32(10, alt_m);     // Field 10: altitude
+        w.varint(11, 32);                       // Field 11: position_precision
     }
 
     if (numNeighbors > 0)
-    {
-        buf[n++] = 0x60; n += mc_pbVarint(buf + n, numNeighbors); // Field 12
-    }
+        w.varint(12, numNeighbors);             // Field 12: num_online_local_nodes
+}
 
-    return n;
+size_t mc_encodeMapReport(uint8_t* buf, size_t cap,
+                           const char* longName, const char* shortName,
+                           int32_t lat_i, int32_t lon_i, int32_t alt_m,
+                           uint32_t numNeighbors,
+                           uint32_t hwModel,
+                           uint8_t  regionCode,
+                           uint8_t  modemPreset,
+                           const char* firmwareVersion,
+                           bool hasPosition)
+{
+    PbWriter w(buf, cap);
+    mc_writeMapReport(w, longName, shortName, lat_i, lon_i, alt_m, numNeighbors,
+                      hwModel, regionCode, modemPreset, firmwareVersion, hasPosition);
+    return w.finish();
 }
 
 // ── mc_parseData ──────────────────────────────────────────────────────────
@@ -329,58 +310,15 @@ bool mc_parseData(const uint8_t* data, size_t len,
 
     if (data == nullptr || len == 0) return false;
 
-    size_t pos = 0;
-    while (pos < len)
+    PbReader r(data, len);
+    PbField  f;
+    while (r.next(f))
     {
-        uint32_t tag   = 0;
-        int      shift = 0;
-        while (pos < len)
-        {
-            uint8_t b = data[pos++];
-            tag |= static_cast<uint32_t>(b & 0x7F) << shift;
-            if (!(b & 0x80)) break;
-            shift += 7;
-            if (shift > 28) return false;
-        }
-
-        const uint32_t fieldNum = tag >> 3;
-        const uint8_t  wireType = tag & 0x07;
-
-        if (wireType == 0) // varint
-        {
-            uint64_t val    = 0;
-            int      vshift = 0;
-            while (pos < len)
-            {
-                uint8_t b = data[pos++];
-                val |= static_cast<uint64_t>(b & 0x7F) << vshift;
-                if (!(b & 0x80)) break;
-                vshift += 7;
-                if (vshift > 63) return false;
-            }
-            if (fieldNum == 1) portnum      = static_cast<uint32_t>(val);
-            if (fieldNum == 3) wantResponse = (val != 0);
-        }
-        else if (wireType == 2) // length-delimited
-        {
-            uint32_t msgLen = 0;
-            int      lshift = 0;
-            while (pos < len)
-            {
-                uint8_t b = data[pos++];
-                msgLen |= static_cast<uint32_t>(b & 0x7F) << lshift;
-                if (!(b & 0x80)) break;
-                lshift += 7;
-                if (lshift > 28) return false;
-            }
-            if (pos + msgLen > len) return false;
-            if (fieldNum == 2) { payload = data + pos; payloadLen = msgLen; }
-            pos += msgLen;
-        }
-        else if (wireType == 5) { if (pos + 4 > len) return false; pos += 4; }
-        else if (wireType == 1) { if (pos + 8 > len) return false; pos += 8; }
-        else return false;
+        if      (f.is(1, PB_WT_VARINT)) portnum      = f.u32();
+        else if (f.is(3, PB_WT_VARINT)) wantResponse = f.boolean();
+        else if (f.is(2, PB_WT_LEN))    { payload = f.data; payloadLen = f.len; }
     }
+    if (r.failed()) return false;
 
     return portnum != 0;
 }
@@ -391,156 +329,96 @@ bool mc_parsePosition(const uint8_t* data, size_t len, MeshPosition& pos)
 {
     if (data == nullptr || len == 0) return false;
 
-    size_t p       = 0;
     bool gotLatLon = false;
 
-    auto readFixed32 = [&]() -> uint32_t {
-        uint32_t v = data[p] | (uint32_t)data[p+1]<<8
-                   | (uint32_t)data[p+2]<<16 | (uint32_t)data[p+3]<<24;
-        p += 4;
-        return v;
-    };
-
-    while (p < len)
+    PbReader r(data, len);
+    PbField  f;
+    while (r.next(f))
     {
-        uint32_t tag = 0; int shift = 0;
-        while (p < len) {
-            uint8_t b = data[p++];
-            tag |= (uint32_t)(b & 0x7F) << shift;
-            if (!(b & 0x80)) break;
-            shift += 7; if (shift > 28) return false;
-        }
-        const uint32_t field    = tag >> 3;
-        const uint8_t  wireType = tag & 0x07;
-
-        if (wireType == 0) // varint
+        if (f.wireType == PB_WT_VARINT)
         {
-            uint64_t val = 0; int vs = 0;
-            while (p < len) {
-                uint8_t b = data[p++];
-                val |= (uint64_t)(b & 0x7F) << vs;
-                if (!(b & 0x80)) break;
-                vs += 7; if (vs > 63) return false;
-            }
-            switch (field) {
-                case 3:  pos.alt_m      = (int32_t)(int64_t)val; break;
-                case 10: pos.speed_cm_s = (uint32_t)val; break;  // ground_speed
-                case 11: pos.track_x100 = (uint32_t)val; break;  // ground_track
+            switch (f.number) {
+                case 3:  pos.alt_m      = f.i32(); break;
+                case 10: pos.speed_cm_s = f.u32(); break;  // ground_speed
+                case 11: pos.track_x100 = f.u32(); break;  // ground_track
                 // field 9 = pos_flags (varint) — NOT time; skip silently
-                case 14: pos.sats       = (uint32_t)val; break;  // NOT field 7
+                case 14: pos.sats       = f.u32(); break;  // NOT field 7
                 default: break;
             }
         }
-        else if (wireType == 5) // fixed32 / sfixed32
+        else if (f.wireType == PB_WT_FIXED32) // fixed32 / sfixed32
         {
-            if (p + 4 > len) return false;
-            uint32_t val = readFixed32();
-            switch (field) {
-                case 1: pos.lat_i    = static_cast<int32_t>(val); gotLatLon = true; break;
-                case 2: pos.lon_i    = static_cast<int32_t>(val); break;
-                case 4: pos.unixTime = val; break;  // GPS fix time — highest priority
+            switch (f.number) {
+                case 1: pos.lat_i    = f.i32(); gotLatLon = true; break;
+                case 2: pos.lon_i    = f.i32(); break;
+                case 4: pos.unixTime = f.u32(); break;  // GPS fix time — highest priority
                 // Field 7: timestamp (device wall-clock time).  Use as fallback when
                 // field 4 (GPS time) was not present — e.g. packets from non-GPS nodes
                 // that only carry the device clock.  If field 4 already set unixTime,
                 // don't overwrite it.
-                case 7: if (pos.unixTime == 0) pos.unixTime = val; break;
+                case 7: if (pos.unixTime == 0) pos.unixTime = f.u32(); break;
                 default: break;
             }
         }
-        else if (wireType == 2) // length-delimited — skip (e.g. field 7 = google_plus_code)
-        {
-            uint32_t msgLen = 0; int ls = 0;
-            while (p < len) {
-                uint8_t b = data[p++];
-                msgLen |= (uint32_t)(b & 0x7F) << ls;
-                if (!(b & 0x80)) break;
-                ls += 7; if (ls > 28) return false;
-            }
-            if (p + msgLen > len) return false;
-            p += msgLen;
-        }
-        else if (wireType == 1) { if (p + 8 > len) return false; p += 8; }
-        else return false;
+        // LEN fields (e.g. pre-2.7.x field 7 = google_plus_code) are skipped.
     }
+    if (r.failed()) return false;
     return gotLatLon;
 }
 
 // ── mc_parseUser ──────────────────────────────────────────────────────────
 
+// Copy a string field into a fixed char buffer, truncating and terminating.
+static void _copyPbString(char* dst, size_t cap, const PbField& f)
+{
+    const size_t n = std::min(f.len, cap - 1);
+    memcpy(dst, f.data, n);
+    dst[n] = '\0';
+}
+
 bool mc_parseUser(const uint8_t* data, size_t len, MeshUser& user)
 {
     if (data == nullptr || len == 0) return false;
 
-    size_t p   = 0;
     bool gotId = false;
 
-    auto readVarint = [&](uint64_t& out) -> bool {
-        out = 0; int s = 0;
-        while (p < len) {
-            uint8_t b = data[p++];
-            out |= (uint64_t)(b & 0x7F) << s;
-            if (!(b & 0x80)) return true;
-            s += 7; if (s > 63) return false;
-        }
-        return false;
-    };
-
-    while (p < len)
+    PbReader r(data, len);
+    PbField  f;
+    while (r.next(f))
     {
-        uint64_t tag64 = 0;
-        if (!readVarint(tag64)) break;
-        const uint32_t field    = (uint32_t)(tag64 >> 3);
-        const uint8_t  wireType = (uint8_t)(tag64 & 0x07);
-
-        if (wireType == 2) // string / bytes
+        if (f.wireType == PB_WT_LEN) // string / bytes
         {
-            uint64_t slen = 0;
-            if (!readVarint(slen)) return false;
-            if (p + slen > len) return false;
-            const char* src = reinterpret_cast<const char*>(data + p);
-            switch (field) {
+            switch (f.number) {
                 case 1:
-                    snprintf(user.id, sizeof(user.id), "%.*s",
-                             (int)std::min(slen, (uint64_t)(sizeof(user.id) - 1)), src);
+                    _copyPbString(user.id, sizeof(user.id), f);
                     gotId = true;
                     break;
-                case 2:
-                    snprintf(user.longName, sizeof(user.longName), "%.*s",
-                             (int)std::min(slen, (uint64_t)(sizeof(user.longName) - 1)), src);
-                    break;
-                case 3:
-                    snprintf(user.shortName, sizeof(user.shortName), "%.*s",
-                             (int)std::min(slen, (uint64_t)(sizeof(user.shortName) - 1)), src);
-                    break;
+                case 2: _copyPbString(user.longName,  sizeof(user.longName),  f); break;
+                case 3: _copyPbString(user.shortName, sizeof(user.shortName), f); break;
                 case 4:
-                    if (slen == 6) {
-                        memcpy(user.macaddr, src, 6);
+                    if (f.len == 6) {
+                        memcpy(user.macaddr, f.data, 6);
                         user.hasMacaddr = true;
                     }
                     break;
                 case 8:
-                    if (slen == 32) { memcpy(user.publicKey, src, 32); user.hasPublicKey = true; }
+                    if (f.len == 32) { memcpy(user.publicKey, f.data, 32); user.hasPublicKey = true; }
                     break;
                 default: break;
             }
-            p += (size_t)slen;
         }
-        else if (wireType == 0)
+        else if (f.wireType == PB_WT_VARINT)
         {
-            uint64_t val = 0;
-            if (!readVarint(val)) return false;
-            switch (field) {
-                case 5: user.hwModel        = (uint32_t)val; break;
-                case 6: user.isLicensed     = (val != 0);    break;
-                case 7: user.role           = (uint8_t)val;  break;
-                case 9: user.isUnmessageable= (val != 0);    break;
+            switch (f.number) {
+                case 5: user.hwModel        = f.u32();     break;
+                case 6: user.isLicensed     = f.boolean(); break;
+                case 7: user.role           = (uint8_t)f.value; break;
+                case 9: user.isUnmessageable= f.boolean(); break;
                 default: break;
             }
         }
-        else if (wireType == 5) { if (p + 4 > len) return false; p += 4; }
-        else if (wireType == 1) { if (p + 8 > len) return false; p += 8; }
-        else return false;
     }
+    if (r.failed()) return false;
     return gotId;
 }
 
@@ -559,49 +437,21 @@ bool mc_parseNodeStatus(const uint8_t* data, size_t len, MeshNodeStatus& status)
 {
     if (data == nullptr || len == 0) return false;
 
-    size_t p = 0;
     bool gotUptime = false;
 
-    auto readVarint = [&](uint64_t& out) -> bool {
-        out = 0; int s = 0;
-        while (p < len) {
-            uint8_t b = data[p++];
-            out |= (uint64_t)(b & 0x7F) << s;
-            if (!(b & 0x80)) return true;
-            s += 7; if (s > 63) return false;
-        }
-        return false;
-    };
-
-    while (p < len)
+    PbReader r(data, len);
+    PbField  f;
+    while (r.next(f))
     {
-        uint64_t tag64 = 0;
-        if (!readVarint(tag64)) break;
-        const uint32_t field    = (uint32_t)(tag64 >> 3);
-        const uint8_t  wireType = (uint8_t)(tag64 & 0x07);
-
-        if (wireType == 0) // varint
-        {
-            uint64_t val = 0;
-            if (!readVarint(val)) return false;
-            switch (field) {
-                case 1: status.uptimeSec       = (uint32_t)val; gotUptime = true; break;
-                case 2: status.isMqttConnected = (val != 0);    break;
-                case 3: status.isRouter        = (val != 0);    break;
-                default: break;
-            }
-        }
-        else if (wireType == 2) // length-delimited — skip unknown
-        {
-            uint64_t slen = 0;
-            if (!readVarint(slen)) return false;
-            if (p + slen > len) return false;
-            p += (size_t)slen;
+        if (f.wireType != PB_WT_VARINT) continue;
+        switch (f.number) {
+            case 1: status.uptimeSec       = f.u32(); gotUptime = true; break;
+            case 2: status.isMqttConnected = f.boolean(); break;
+            case 3: status.isRouter        = f.boolean(); break;
+            default: break;
         }
-        else if (wireType == 5) { if (p + 4 > len) return false; p += 4; }
-        else if (wireType == 1) { if (p + 8 > len) return false; p += 8; }
-        else return false;
     }
+    if (r.failed()) return false;
 
     // A NodeStatus is considered valid even when uptime==0 (just-booted node),
     // as long as we successfully parsed the message.  We track gotUptime to
@@ -620,51 +470,81 @@ bool mc_parsePkiReport(const uint8_t* data, size_t len, MeshPkiReport& report)
 {
     if (data == nullptr || len == 0) return false;
 
-    size_t p = 0;
-
-    auto readVarint = [&](uint64_t& out) -> bool {
-        out = 0; int s = 0;
-        while (p < len) {
-            uint8_t b = data[p++];
-            out |= (uint64_t)(b & 0x7F) << s;
-            if (!(b & 0x80)) return true;
-            s += 7; if (s > 63) return false;
+    PbReader r(data, len);
+    PbField  f;
+    while (r.next(f))
+    {
+        if (f.is(2, PB_WT_VARINT))
+        {
+            report.requestorNodeNum = f.u32();
+        }
+        else if (f.is(1, PB_WT_LEN) && f.len == 32)
+        {
+            memcpy(report.publicKey, f.data, 32);
+            report.hasPublicKey = true;
         }
-        return false;
+    }
+    if (r.failed()) return false;
+
+    report.valid = report.hasPublicKey;
+    return report.valid;
+}
+
+// ── mc_parseRouteDiscovery ────────────────────────────────────────────────
+// Decode a Meshtastic RouteDiscovery proto (TRACEROUTE_APP, portnum 70).
+//
+//   Field 1 (route,       repeated fixed32): tag 0x0D unpacked, 0x0A packed
+//   Field 2 (snr_towards, repeated sint32):  tag 0x10 unpacked, 0x12 packed
+//
+// Both encodings are accepted — proto3 parsers must handle either.
+
+bool mc_parseRouteDiscovery(const uint8_t* data, size_t len, MeshRouteDiscovery& rd)
+{
+    rd.routeLen = 0;
+    rd.snrLen   = 0;
+    if (data == nullptr || len == 0) return true;
+
+    auto addRoute = [&rd](uint32_t id) {
+        if (rd.routeLen < MC_ROUTE_MAX) rd.route[rd.routeLen++] = id;
+    };
+    auto addSnr = [&rd](uint64_t zz) {
+        const uint32_t z = static_cast<uint32_t>(zz);
+        if (rd.snrLen < MC_ROUTE_MAX)
+            rd.snrTowards[rd.snrLen++] = static_cast<int32_t>((z >> 1) ^ (0u - (z & 1)));
     };
 
-    while (p < len)
+    PbReader r(data, len);
+    PbField  f;
+    while (r.next(f))
     {
-        uint64_t tag64 = 0;
-        if (!readVarint(tag64)) break;
-        const uint32_t field    = (uint32_t)(tag64 >> 3);
-        const uint8_t  wireType = (uint8_t)(tag64 & 0x07);
-
-        if (wireType == 0)
+        if      (f.is(1, PB_WT_FIXED32)) addRoute(f.u32());
+        else if (f.is(2, PB_WT_VARINT))  addSnr(f.value);
+        else if (f.is(1, PB_WT_LEN))
         {
-            uint64_t val = 0;
-            if (!readVarint(val)) return false;
-            if (field == 2) report.requestorNodeNum = (uint32_t)val;
+            PbReader packed(f.data, f.len);
+            uint32_t id = 0;
+            while (packed.readFixed32(id)) addRoute(id);
+            if (packed.failed()) return false;
         }
-        else if (wireType == 2)
+        else if (f.is(2, PB_WT_LEN))
         {
-            uint64_t slen = 0;
-            if (!readVarint(slen)) return false;
-            if (p + slen > len) return false;
-            if (field == 1 && slen == 32)
-            {
-                memcpy(report.publicKey, data + p, 32);
-                report.hasPublicKey = true;
-            }
-            p += (size_t)slen;
+            PbReader packed(f.data, f.len);
+            uint64_t zz = 0;
+            while (packed.readVarint(zz)) addSnr(zz);
+            if (packed.failed()) return false;
         }
-        else if (wireType == 5) { if (p + 4 > len) return false; p += 4; }
-        else if (wireType == 1) { if (p + 8 > len) return false; p += 8; }
-        else return false;
     }
+    return !r.failed();
+}
 
-    report.valid = report.hasPublicKey;
-    return report.valid;
+// ── mc_writeRouteDiscovery ────────────────────────────────────────────────
+
+void mc_writeRouteDiscovery(PbWriter& w, const MeshRouteDiscovery& rd)
+{
+    for (size_t i = 0; i < rd.routeLen; i++)
+        w.fixed32(1, rd.route[i]);              // Field 1: route (tag 0x0D)
+    for (size_t i = 0; i < rd.snrLen; i++)
+        w.sint32(2, rd.snrTowards[i]);          // Field 2: snr_towards (tag 0x10, zigzag)
 }
 
 // ── mc_encodePkiReport ────────────────────────────────────────────────────
@@ -673,16 +553,20 @@ bool mc_parsePkiReport(const uint8_t* data, size_t len, MeshPkiReport& report)
 //   Field 1 (public_key,         bytes,  LEN):   tag 0x0A — 32-byte key (always)
 //   Field 2 (requestor_node_num, uint32, varint): tag 0x10 — omit when 0
 
-size_t mc_encodePkiReport(uint8_t* buf, size_t /*cap*/,
+void mc_writePkiReport(PbWriter& w,
+                       const uint8_t publicKey[32],
+                       uint32_t requestorNodeNum)
+{
+    w.bytes(1, publicKey, 32);                  // Field 1: public_key
+    if (requestorNodeNum != 0)
+        w.varint(2, requestorNodeNum);          // Field 2: requestor_node_num
+}
+
+size_t mc_encodePkiReport(uint8_t* buf, size_t cap,
                            const uint8_t publicKey[32],
                            uint32_t requestorNodeNum)
 {
-    size_t n = 0;
-    n += mc_pbLenField(buf + n, 0x0A, publicKey, 32); // Field 1: public_key
-    if (requestorNodeNum != 0)
-    {
-        buf[n++] = 0x10;                               // Field 2: requestor_node_num
-        n += mc_pbVarint(buf + n, requestorNodeNum);
-    }
-    return n;
+    PbWriter w(buf, cap);
+    mc_writePkiReport(w, publicKey, requestorNodeNum);
+    return w.finish();
 }
@@ -36,6 +36,67 @@
 #include <cstdint>
 #include <cstddef>
 #include <cstring>
+#include "pb_writer.h"
+
+// ── Meshtastic PortNum values ───────────────────────────────────────────────
+// Verified against meshtastic firmware v2.7.15.567b8ea
+// src/mesh/generated/meshtastic/portnums.pb.h
+// Ports 0-63:  Core Meshtastic use
+// Ports 64-127: Registered 3rd-party apps
+// Ports 256-511: Private / unregistered apps
+static constexpr uint32_t PORT_UNKNOWN                   = 0;  ///< UNKNOWN_APP - Message sent from outside the mesh in a form that is not understood
+static constexpr uint32_t PORT_TEXT                      = 1;  ///< TEXT_MESSAGE_APP
+static constexpr uint32_t PORT_REMOTE_HARDWARE           = 2;  ///< REMOTE_HARDWARE_APP (received, not dispatched)
+static constexpr uint32_t PORT_POSITION                  = 3;  ///< POSITION_APP
+static constexpr uint32_t PORT_NODEINFO                  = 4;  ///< NODEINFO_APP
+static constexpr uint32_t PORT_ROUTING                   = 5;  ///< ROUTING_APP — ACK/NACK
+static constexpr uint32_t PORT_ADMIN                     = 6;  ///< ADMIN_APP (received, not dispatched)
+static constexpr uint32_t PORT_TEXT_COMPRESSED           = 7;  ///< TEXT_MESSAGE_COMPRESSED_APP (received, not dispatched)
+static constexpr uint32_t PORT_WAYPOINT                  = 8;  ///< WAYPOINT_APP (received, not dispatched)
+static constexpr uint32_t PORT_AUDIO                     = 9;  ///< AUDIO_APP (received, not dispatched)
+static constexpr uint32_t PORT_DETECTION_SENSOR          = 10; ///< DETECTION_SENSOR_APP (received, not dispatched)
+static constexpr uint32_t PORT_ALERT                     = 11; ///< ALERT_APP — critical alert message
+static constexpr uint32_t PORT_KEY_VERIFICATION          = 12; ///< KEY_VERIFICATION_APP — PKC key exchange
+static constexpr uint32_t PORT_REPLY                     = 32; ///< REPLY_APP (received, not dispatched)
+static constexpr uint32_t PORT_PAXCOUNTER                = 34; ///< PAXCOUNTER_APP (received, not dispatched)
+static constexpr uint32_t PORT_NODE_STATUS               = 36; ///< NODE_STATUS_APP — node status string, broadcasts on change/timer
+static constexpr uint32_t PORT_SERIAL                    = 64; ///< SERIAL_APP (received, not dispatched)
+static constexpr uint32_t PORT_STORE_FORWARD             = 65; ///< STORE_FORWARD_APP (received, not dispatched)
+static constexpr uint32_t PORT_RANGE_TEST                = 66; ///< RANGE_TEST_APP (received, not dispatched)
+static constexpr uint32_t PORT_TELEMETRY                 = 67; ///< TELEMETRY_APP
+static constexpr uint32_t PORT_ZPS                       = 68; ///< ZPS_APP (received, not dispatched)
+static constexpr uint32_t PORT_SIMULATOR                 = 69; ///< SIMULATOR_APP (received, not dispatched)
+static constexpr uint32_t PORT_TRACEROUTE                = 70; ///< TRACEROUTE_APP — route discovery
+static constexpr uint32_t PORT_NEIGHBORINFO              = 71; ///< NEIGHBORINFO_APP (received, not dispatched)
+static constexpr uint32_t PORT_ATAK_PLUGIN               = 72; ///< ATAK_PLUGIN (received, not dispatched)
+static constexpr uint32_t PORT_MAP_REPORT                = 73; ///< MAP_REPORT_APP — public mesh map
+static constexpr uint32_t PORT_POWERSTRESS               = 74; ///< POWERSTRESS_APP (received, not dispatched)
+static constexpr uint32_t PORT_RETICULUM_TUNNEL          = 76; ///< RETICULUM_TUNNEL_APP (received, not dispatched)
+static constexpr uint32_t PORT_CAYENNE                   = 77; ///< CAYENNE_APP (received, not dispatched)
+
+// ── Meshtastic over-the-air header ─────────────────────────────────────────
+// [to(4), from(4), id(4), flags(1), chan(1), pad(2)], little-endian.
+static constexpr size_t   MESH_HDR       = 16;
+// Largest Data proto that fits behind the header in one 255-byte SX1262 frame.
+static constexpr size_t   MESH_MAX_DATA  = 255 - MESH_HDR;
+static constexpr uint32_t MESH_BROADCAST = 0xFFFFFFFF;
+
+// DEFAULT_CHAN_HASH: 1-byte channel hash placed in OTA header byte [13].
+// Default "LongFast" channel with the default AES-128 PSK:
+//   xorHash("LongFast", 8) = 0x0A
+//   xorHash(expanded_default_PSK, 16) = 0x02
+//   hash = 0x0A ^ 0x02 = 0x08
+//
+// Always use this on TX so stock encrypted Meshtastic nodes match it to
+// their encrypted "LongFast" channel and AES-CTR decrypt our payload.
+static constexpr uint8_t DEFAULT_CHAN_HASH = 0x08;
+
+// UNENCRYPTED_CHAN_HASH: hash for a channel with an EMPTY PSK.
+//   xorHash("LongFast", 8) = 0x0A,  xorHash("", 0) = 0x00
+//   hash = 0x0A ^ 0x00 = 0x0A
+// Used when matching RX packets from other truly-unencrypted nodes.
+// NOT used on TX (stock encrypted nodes would ignore it).
+static constexpr uint8_t UNENCRYPTED_CHAN_HASH = 0x0A;
 
 // ── Meshtastic application-layer message structs ───────────────────────────
 // All plain-old-data, safe to copy across tasks.
@@ -124,6 +185,13 @@ size_t   mc_pbLenField(uint8_t* buf, uint8_t tag, const uint8_t* data, size_t da
 size_t   mc_pbString(uint8_t* buf, uint8_t tag, const char* s);
 
 // ── Meshtastic proto encoders ─────────────────────────────────────────────
+// Each message has two entry points:
+//   mc_writeX(PbWriter&, …)      appends the fields to a writer — used to nest
+//                                 a message inside Data without a scratch buffer.
+//   mc_encodeX(buf, cap, …)      standalone encode.  Never writes past cap;
+//                                 returns bytes written, or 0 if the message
+//                                 does not fit.  buf == nullptr returns the
+//                                 exact encoded size without writing.
 
 /**
  * Encode a Meshtastic Position proto into buf.
@@ -143,8 +211,12 @@ size_t   mc_pbString(uint8_t* buf, uint8_t tag, const char* s);
  *   Field 14 (sats_in_view,   varint):  satellite count; omit when 0
  *   Field 18 (precision_bits, varint):  32 = full GPS precision (always emitted)
  *
- * buf must be at least 90 bytes.  Returns bytes written.
+ * Returns bytes written, 0 if cap is too small.
  */
+void   mc_writePosition(PbWriter& w,
+                        int32_t lat_i, int32_t lon_i, int32_t alt_m,
+                        uint32_t sats, uint32_t unixTime,
+                        uint32_t speed_cm_s = 0, uint32_t track_x100 = 0);
 size_t mc_encodePosition(uint8_t* buf, size_t cap,
                           int32_t lat_i, int32_t lon_i, int32_t alt_m,
                           uint32_t sats, uint32_t unixTime,
@@ -168,8 +240,17 @@ size_t mc_encodePosition(uint8_t* buf, size_t cap,
  * isLicensed=true → emit field 6 and suppress field 8 (no PKC in licensed mode).
  * isUnmessageable=false → emit field 9 = 0 (always required by Meshtastic 2.5+).
  *
- * buf must be at least 120 bytes.  Returns bytes written.
+ * Returns bytes written, 0 if cap is too small.
  */
+void   mc_writeUser(PbWriter& w,
+                    uint32_t nodeId,
+                    const char* longName, const char* shortName,
+                    const uint8_t macaddr[6],
+                    uint32_t hwModel,
+                    uint8_t  deviceRole,
+                    const uint8_t* publicKey,
+                    bool isLicensed      = false,
+                    bool isUnmessageable = false);
 size_t mc_encodeUser(uint8_t* buf, size_t cap,
                      uint32_t nodeId,
                      const char* longName, const char* shortName,
@@ -190,8 +271,18 @@ size_t mc_encodeUser(uint8_t* buf, size_t cap,
  *   Field 6 (request_id,    fixed32):  tag 0x35  ← NOT field 7 (reply_id, 0x3D)
  *   Field 9 (ok_to_mqtt,    bool):     false, emitted alongside request_id
  *
- * buf must be at least payloadLen + 32 bytes.  Returns bytes written.
+ * mc_writeData takes the payload as a body and writes it straight into field 2
+ * (e.g. [&](PbWriter& p) { mc_writePosition(p, …); }), so the inner message
+ * is never staged in a separate buffer.
+ *
+ * Returns bytes written, 0 if cap is too small.
  */
+void   mc_writeData(PbWriter& w,
+                    uint32_t portnum,
+                    PbBody   payload,
+                    bool want_response = false,
+                    uint32_t dest      = 0,
+                    uint32_t requestId = 0);
 size_t mc_encodeData(uint8_t* buf, size_t cap,
                      uint32_t portnum,
                      const uint8_t* payload, size_t payloadLen,
@@ -207,17 +298,22 @@ size_t mc_encodeData(uint8_t* buf, size_t cap,
  *       Inner DeviceMetrics (Meshtastic 2.7.x):
  *         Field 1 (battery_level,       uint32): 0-100 %
  *         Field 2 (voltage,             float):  volts
- *         Field 3 (channel_utilization, float):  0.0 — no airtime tracking
- *         Field 4 (air_util_tx,         float):  0.0 — no airtime tracking
+ *         Field 3 (channel_utilization, float):  percent, TX + RX, last minute
+ *         Field 4 (air_util_tx,         float):  percent, TX, last hour
  *         Field 5 (uptime_seconds,      uint32): seconds
- *       Fields 3 and 4 are always emitted as 0.0f; real Meshtastic firmware
- *       always sends them so the app shows "0%" rather than "N/A".
+ *       Fields 3 and 4 are always emitted, even as 0.0f; real Meshtastic
+ *       firmware always sends them so the app shows "0%" rather than "N/A".
  *
- * buf must be at least 48 bytes.  Returns bytes written.
+ * Returns bytes written, 0 if cap is too small.
  */
+void   mc_writeTelemetry(PbWriter& w,
+                         uint32_t unixTime, uint32_t uptimeSec,
+                         uint8_t batteryLevel, float batteryVoltage,
+                         float channelUtil = 0.0f, float airUtilTx = 0.0f);
 size_t mc_encodeTelemetry(uint8_t* buf, size_t cap,
                            uint32_t unixTime, uint32_t uptimeSec,
-                           uint8_t batteryLevel, float batteryVoltage);
+                           uint8_t batteryLevel, float batteryVoltage,
+                           float channelUtil = 0.0f, float airUtilTx = 0.0f);
 
 /**
  * Encode a Meshtastic MapReport proto (MAP_REPORT_APP payload, port 73).
@@ -236,8 +332,17 @@ size_t mc_encodeTelemetry(uint8_t* buf, size_t cap,
  *   Field 11 (position_precision,  varint):  tag 0x58  32 = full GPS precision
  *   Field 12 (num_online_local_nodes,varint):tag 0x60  omit when 0
  *
- * buf must be at least 160 bytes.  Returns bytes written.
+ * Returns bytes written, 0 if cap is too small.
  */
+void   mc_writeMapReport(PbWriter& w,
+                         const char* longName, const char* shortName,
+                         int32_t lat_i, int32_t lon_i, int32_t alt_m,
+                         uint32_t numNeighbors,
+                         uint32_t hwModel,
+                         uint8_t  regionCode,
+                         uint8_t  modemPreset,
+                         const char* firmwareVersion = nullptr,
+                         bool hasPosition = true);
 size_t mc_encodeMapReport(uint8_t* buf, size_t cap,
                            const char* longName, const char* shortName,
                            int32_t lat_i, int32_t lon_i, int32_t alt_m,
@@ -345,8 +450,43 @@ bool mc_parsePkiReport(const uint8_t* data, size_t len, MeshPkiReport& report);
  * Encode a PKIReport proto into buf.
  *   Field 1 (public_key,         bytes):  publicKey[32]     — always emitted
  *   Field 2 (requestor_node_num, uint32): requestorNodeNum  — omitted when 0
- * buf must be at least 38 bytes.  Returns bytes written.
+ * Returns bytes written, 0 if cap is too small.
  */
+void   mc_writePkiReport(PbWriter& w,
+                         const uint8_t publicKey[32],
+                         uint32_t requestorNodeNum = 0);
 size_t mc_encodePkiReport(uint8_t* buf, size_t cap,
                            const uint8_t publicKey[32],
                            uint32_t requestorNodeNum = 0);
+
+/// Maximum hops kept from a RouteDiscovery (route / snr_towards each).
+static constexpr size_t MC_ROUTE_MAX = 8;
+
+/**
+ * RouteDiscovery — TRACEROUTE_APP payload (portnum 70).
+ *
+ * Proto: meshtastic/mesh.proto, message RouteDiscovery:
+ *   Field 1 (route,       repeated fixed32): node ids, one per hop
+ *   Field 2 (snr_towards, repeated sint32):  SNR × 4 (dB) per hop
+ * Entries beyond MC_ROUTE_MAX are dropped.
+ */
+struct MeshRouteDiscovery {
+    uint32_t route[MC_ROUTE_MAX]      = {};
+    int32_t  snrTowards[MC_ROUTE_MAX] = {}; ///< SNR × 4, zigzag-decoded
+    size_t   routeLen                 = 0;
+    size_t   snrLen                   = 0;
+};
+
+/**
+ * Decode a RouteDiscovery proto.  Accepts packed and unpacked repeated
+ * encodings.  An empty payload is valid (a fresh traceroute request).
+ * Returns false on malformed input; rd then holds whatever hops were
+ * decoded before the error.
+ */
+bool mc_parseRouteDiscovery(const uint8_t* data, size_t len, MeshRouteDiscovery& rd);
+
+/**
+ * Append a RouteDiscovery proto to w — unpacked, route entries first, then
+ * snr_towards, matching what mc_parseRouteDiscovery accepts.
+ */
+void mc_writeRouteDiscovery(PbWriter& w, const MeshRouteDiscovery& rd);
@@ -46,6 +46,24 @@
 #include <cstring>
 #include <cstdint>
 
+// ── X25519 field backend selection ────────────────────────────────────────
+// MC_X25519_FE32 = 1  10 × int32 limbs in radix 2^25.5 (ref10 / donna
+//                     layout) with a dedicated squaring routine and an
+//                     addition-chain inversion.  32×32→64 multiplies map
+//                     directly onto the Xtensa MULL/MULSH pair.  Default.
+// MC_X25519_FE32 = 0  16 × int64 limbs of 16 bits (TweetNaCl reference).
+//                     Kept as a cross-check; select with
+//                     CONFIG_MESH_X25519_FE_TWEETNACL on the device.
+// Both produce identical output for every RFC 7748 vector.
+#ifndef MC_X25519_FE32
+#  define MC_X25519_FE32 1
+#endif
+
+// Diagnostic counter — see mc_x25519ScalarMultCount().
+static uint32_t s_scalarMults = 0;
+
+#if !MC_X25519_FE32
+
 // ═════════════════════════════════════════════════════════════════════════
 // Standalone X25519 — derived from TweetNaCl (public domain)
 //
@@ -56,6 +74,8 @@
 // all RFC 7748 test vectors on every platform.
 // ═════════════════════════════════════════════════════════════════════════
 
+static const char* const FE_BACKEND_NAME = "tweetnacl-16x16";
+
 typedef int64_t gf[16];
 
 static void _car25519(gf o)
@@ -144,6 +164,8 @@ static void _finv(gf o, const gf inp)
 // RFC 7748 X25519 scalar multiplication: q = clamp(n) * p
 static void _scalarmult(uint8_t q[32], const uint8_t n[32], const uint8_t p[32])
 {
+    s_scalarMults++;
+
     uint8_t z[32];
     memcpy(z, n, 32);
     z[0]  &= 248;
@@ -191,6 +213,497 @@ static void _scalarmult(uint8_t q[32], const uint8_t n[32], const uint8_t p[32])
     _pack25519(q, a);
 }
 
+#else  // MC_X25519_FE32
+
+// ═════════════════════════════════════════════════════════════════════════
+// Standalone X25519 — 10-limb radix-2^25.5 field arithmetic
+// (after the SUPERCOP ref10 / curve25519-donna layout, public domain)
+//
+// Field element h = h[0] + h[1]·2^26 + h[2]·2^51 + h[3]·2^77 + … + h[9]·2^230.
+// Even limbs carry 26 bits, odd limbs 25 bits.  Limbs are signed int32;
+// products are accumulated in int64.  Between carries, limb magnitudes
+// stay below ~1.7·2^26, which keeps every fe_mul column sum under 2^63.
+//
+// Constant-time: no secret-dependent branches or table lookups.
+// ═════════════════════════════════════════════════════════════════════════
+
+static const char* const FE_BACKEND_NAME = "ref10-10x25.5";
+
+typedef int32_t fe[10];
+
+static inline int64_t _load3(const uint8_t* in)
+{
+    return static_cast<int64_t>(in[0])
+         | static_cast<int64_t>(in[1]) << 8
+         | static_cast<int64_t>(in[2]) << 16;
+}
+
+static inline int64_t _load4(const uint8_t* in)
+{
+    return _load3(in) | static_cast<int64_t>(in[3]) << 24;
+}
+
+// Move the excess above `bits` from h[i] into h[i+1] (rounding carry, so
+// the remainder is centred around zero).
+#define FE_CARRY(h, i, bits)                                          \
+    do {                                                              \
+        const int64_t c = ((h)[i] + (INT64_C(1) << ((bits) - 1))) >> (bits); \
+        (h)[(i) + 1] += c;                                            \
+        (h)[i]       -= c * (INT64_C(1) << (bits));                   \
+    } while (0)
+
+// Limb 9 wraps into limb 0 with factor 19 (2^255 ≡ 19 mod p).
+#define FE_CARRY9(h)                                                  \
+    do {                                                              \
+        const int64_t c = ((h)[9] + (INT64_C(1) << 24)) >> 25;        \
+        (h)[0] += c * 19;                                             \
+        (h)[9] -= c * (INT64_C(1) << 25);                             \
+    } while (0)
+
+// Reduce 64-bit column sums back to int32 limbs.  Interleaved carry order
+// from ref10 — two independent chains keep the dependency depth short.
+static inline void _feReduce(fe o, int64_t h[10])
+{
+    FE_CARRY(h, 0, 26); FE_CARRY(h, 4, 26);
+    FE_CARRY(h, 1, 25); FE_CARRY(h, 5, 25);
+    FE_CARRY(h, 2, 26); FE_CARRY(h, 6, 26);
+    FE_CARRY(h, 3, 25); FE_CARRY(h, 7, 25);
+    FE_CARRY(h, 4, 26); FE_CARRY(h, 8, 26);
+    FE_CARRY9(h);
+    FE_CARRY(h, 0, 26);
+    for (int i = 0; i < 10; i++) o[i] = static_cast<int32_t>(h[i]);
+}
+
+static void _fe0(fe h) { for (int i = 0; i < 10; i++) h[i] = 0; }
+static void _fe1(fe h) { _fe0(h); h[0] = 1; }
+static void _feCopy(fe h, const fe f) { for (int i = 0; i < 10; i++) h[i] = f[i]; }
+
+static void _feAdd(fe h, const fe f, const fe g)
+{
+    for (int i = 0; i < 10; i++) h[i] = f[i] + g[i];
+}
+
+static void _feSub(fe h, const fe f, const fe g)
+{
+    for (int i = 0; i < 10; i++) h[i] = f[i] - g[i];
+}
+
+// Constant-time conditional swap: b must be 0 or 1.
+static void _feCswap(fe f, fe g, int32_t b)
+{
+    const int32_t mask = -b;
+    for (int i = 0; i < 10; i++) {
+        const int32_t x = mask & (f[i] ^ g[i]);
+        f[i] ^= x;
+        g[i] ^= x;
+    }
+}
+
+static void _feFromBytes(fe o, const uint8_t s[32])
+{
+    int64_t h[10];
+    h[0] =  _load4(s);
+    h[1] =  _load3(s +  4) << 6;
+    h[2] =  _load3(s +  7) << 5;
+    h[3] =  _load3(s + 10) << 3;
+    h[4] =  _load3(s + 13) << 2;
+    h[5] =  _load4(s + 16);
+    h[6] =  _load3(s + 20) << 7;
+    h[7] =  _load3(s + 23) << 5;
+    h[8] =  _load3(s + 26) << 4;
+    h[9] = (_load3(s + 29) & 0x7fffff) << 2;   // drop bit 255 (RFC 7748 §5)
+
+    FE_CARRY9(h);
+    FE_CARRY(h, 1, 25); FE_CARRY(h, 3, 25); FE_CARRY(h, 5, 25); FE_CARRY(h, 7, 25);
+    FE_CARRY(h, 0, 26); FE_CARRY(h, 2, 26); FE_CARRY(h, 4, 26);
+    FE_CARRY(h, 6, 26); FE_CARRY(h, 8, 26);
+    for (int i = 0; i < 10; i++) o[i] = static_cast<int32_t>(h[i]);
+}
+
+// Fully reduce mod p and serialise little-endian.
+static void _feToBytes(uint8_t s[32], const fe f)
+{
+    int32_t h[10];
+    for (int i = 0; i < 10; i++) h[i] = f[i];
+
+    // q = floor(h / p), computed by propagating an estimate through the limbs.
+    int32_t q = (19 * h[9] + (1 << 24)) >> 25;
+    for (int i = 0; i < 10; i++)
+        q = (h[i] + q) >> ((i & 1) ? 25 : 26);
+
+    // h − q·p = h + 19q − q·2^255; the 2^255 term falls off the top.
+    h[0] += 19 * q;
+    for (int i = 0; i < 9; i++) {
+        const int bits = (i & 1) ? 25 : 26;
+        const int32_t c = h[i] >> bits;
+        h[i + 1] += c;
+        h[i]     -= c * (1 << bits);
+    }
+    h[9] &= (1 << 25) - 1;
+
+    s[ 0] = static_cast<uint8_t>(h[0]);
+    s[ 1] = static_cast<uint8_t>(h[0] >> 8);
+    s[ 2] = static_cast<uint8_t>(h[0] >> 16);
+    s[ 3] = static_cast<uint8_t>((h[0] >> 24) | (h[1] << 2));
+    s[ 4] = static_cast<uint8_t>(h[1] >> 6);
+    s[ 5] = static_cast<uint8_t>(h[1] >> 14);
+    s[ 6] = static_cast<uint8_t>((h[1] >> 22) | (h[2] << 3));
+    s[ 7] = static_cast<uint8_t>(h[2] >> 5);
+    s[ 8] = static_cast<uint8_t>(h[2] >> 13);
+    s[ 9] = static_cast<uint8_t>((h[2] >> 21) | (h[3] << 5));
+    s[10] = static_cast<uint8_t>(h[3] >> 3);
+    s[11] = static_cast<uint8_t>(h[3] >> 11);
+    s[12] = static_cast<uint8_t>((h[3] >> 19) | (h[4] << 6));
+    s[13] = static_cast<uint8_t>(h[4] >> 2);
+    s[14] = static_cast<uint8_t>(h[4] >> 10);
+    s[15] = static_cast<uint8_t>(h[4] >> 18);
+    s[16] = static_cast<uint8_t>(h[5]);
+    s[17] = static_cast<uint8_t>(h[5] >> 8);
+    s[18] = static_cast<uint8_t>(h[5] >> 16);
+    s[19] = static_cast<uint8_t>((h[5] >> 24) | (h[6] << 1));
+    s[20] = static_cast<uint8_t>(h[6] >> 7);
+    s[21] = static_cast<uint8_t>(h[6] >> 15);
+    s[22] = static_cast<uint8_t>((h[6] >> 23) | (h[7] << 3));
+    s[23] = static_cast<uint8_t>(h[7] >> 5);
+    s[24] = static_cast<uint8_t>(h[7] >> 13);
+    s[25] = static_cast<uint8_t>((h[7] >> 21) | (h[8] << 4));
+    s[26] = static_cast<uint8_t>(h[8] >> 4);
+    s[27] = static_cast<uint8_t>(h[8] >> 12);
+    s[28] = static_cast<uint8_t>((h[8] >> 20) | (h[9] << 6));
+    s[29] = static_cast<uint8_t>(h[9] >> 2);
+    s[30] = static_cast<uint8_t>(h[9] >> 10);
+    s[31] = static_cast<uint8_t>(h[9] >> 18);
+}
+
+// h = f · g.  100 32×32→64 products.  A product of two odd limbs picks up
+// a factor 2 (2^25.5 · 2^25.5 = 2 · 2^51); columns ≥ 10 wrap with ×19.
+static void _feMul(fe h, const fe f, const fe g)
+{
+    int32_t g19[10], f2[10];
+    for (int i = 0; i < 10; i++) {
+        g19[i] = 19 * g[i];
+        f2[i]  = (i & 1) ? 2 * f[i] : f[i];
+    }
+
+    int64_t t[10] = {};
+    for (int i = 0; i < 10; i++) {
+        // Odd f-limbs are doubled only when paired with odd g-limbs.
+        const int64_t fi  = f[i];
+        const int64_t fi2 = f2[i];
+        for (int j = 0; j < 10; j++) {
+            const int64_t fij = (j & 1) ? fi2 : fi;
+            const int     k   = i + j;
+            if (k < 10) t[k]      += fij * g[j];
+            else        t[k - 10] += fij * g19[j];
+        }
+    }
+    _feReduce(h, t);
+}
+
+// Column sums of f².  Symmetric cross terms are computed once and doubled:
+// 55 products instead of 100.
+static inline void _feSqCols(int64_t t[10], const fe f)
+{
+    for (int i = 0; i < 10; i++) {
+        const int64_t fi = f[i];
+        // Diagonal term: odd·odd picks up the factor 2.
+        {
+            const int64_t p = fi * fi * ((i & 1) ? 2 : 1);
+            const int     k = 2 * i;
+            if (k < 10) t[k] += p; else t[k - 10] += 19 * p;
+        }
+        for (int j = i + 1; j < 10; j++) {
+            const int64_t p = 2 * fi * f[j] * (((i & j) & 1) ? 2 : 1);
+            const int     k = i + j;
+            if (k < 10) t[k] += p; else t[k - 10] += 19 * p;
+        }
+    }
+}
+
+// h = f².
+static void _feSq(fe h, const fe f)
+{
+    int64_t t[10] = {};
+    _feSqCols(t, f);
+    _feReduce(h, t);
+}
+
+// h = 2·f², doubled before the carry so the result is fully reduced.
+static void _feSq2(fe h, const fe f)
+{
+    int64_t t[10] = {};
+    _feSqCols(t, f);
+    for (int i = 0; i < 10; i++) t[i] += t[i];
+    _feReduce(h, t);
+}
+
+// h = f · 121665 (a24 for RFC 7748 ladder).
+static void _feMul121665(fe h, const fe f)
+{
+    int64_t t[10];
+    for (int i = 0; i < 10; i++) t[i] = static_cast<int64_t>(f[i]) * 121665;
+    _feReduce(h, t);
+}
+
+static void _feSqN(fe h, const fe f, int n)
+{
+    _feSq(h, f);
+    for (int i = 1; i < n; i++) _feSq(h, h);
+}
+
+// o = z^(p−2) = z^(2^255 − 21) via the standard addition chain:
+// 254 squarings + 11 multiplications (vs 254 + 252 for square-and-multiply).
+static void _feInvert(fe o, const fe z)
+{
+    fe t0, t1, t2, t3;
+    _feSq(t0, z);                  // z^2
+    _feSqN(t1, t0, 2);             // z^8
+    _feMul(t1, z, t1);             // z^9
+    _feMul(t0, t0, t1);            // z^11
+    _feSq(t2, t0);                 // z^22
+    _feMul(t1, t1, t2);            // z^(2^5 − 1)
+    _feSqN(t2, t1, 5);
+    _feMul(t1, t2, t1);            // z^(2^10 − 1)
+    _feSqN(t2, t1, 10);
+    _feMul(t2, t2, t1);            // z^(2^20 − 1)
+    _feSqN(t3, t2, 20);
+    _feMul(t2, t3, t2);            // z^(2^40 − 1)
+    _feSqN(t2, t2, 10);
+    _feMul(t1, t2, t1);            // z^(2^50 − 1)
+    _feSqN(t2, t1, 50);
+    _feMul(t2, t2, t1);            // z^(2^100 − 1)
+    _feSqN(t3, t2, 100);
+    _feMul(t2, t3, t2);            // z^(2^200 − 1)
+    _feSqN(t2, t2, 50);
+    _feMul(t1, t2, t1);            // z^(2^250 − 1)
+    _feSqN(t1, t1, 5);             // z^(2^255 − 2^5)
+    _feMul(o, t1, t0);             // z^(2^255 − 21)
+}
+
+#undef FE_CARRY
+#undef FE_CARRY9
+
+// ── Fixed-base scalar multiplication (public key derivation) ─────────────
+// The X25519 base point u = 9 is the image of the Ed25519 base point B under
+// the birational map u = (1 + y) / (1 − y).  Multiplying on the twisted
+// Edwards curve lets us use a precomputed table of multiples of B
+// (x25519_base_table.h, 30 KiB in flash): the clamped scalar is recoded
+// into 64 signed radix-16 digits and kB is accumulated with 64 mixed
+// additions and 4 doublings, versus 255 ladder steps.  Point formulas and
+// the table layout follow SUPERCOP ref10 ge_scalarmult_base.
+//
+// Constant-time: every table row is scanned in full with masked moves.
+
+#include "x25519_base_table.h"
+
+struct GeP2   { fe X, Y, Z; };            // projective
+struct GeP3   { fe X, Y, Z, T; };         // extended, x = X/Z, y = Y/Z, xy = T/Z
+struct GeP1P1 { fe X, Y, Z, T; };         // completed, x = X/Z, y = Y/T
+
+// Constant-time conditional move: f = g when b == 1, unchanged when b == 0.
+static void _feCmov(fe f, const fe g, int32_t b)
+{
+    const int32_t mask = -b;
+    for (int i = 0; i < 10; i++) f[i] ^= mask & (f[i] ^ g[i]);
+}
+
+static void _geP1P1ToP2(GeP2& r, const GeP1P1& p)
+{
+    _feMul(r.X, p.X, p.T);
+    _feMul(r.Y, p.Y, p.Z);
+    _feMul(r.Z, p.Z, p.T);
+}
+
+static void _geP1P1ToP3(GeP3& r, const GeP1P1& p)
+{
+    _feMul(r.X, p.X, p.T);
+    _feMul(r.Y, p.Y, p.Z);
+    _feMul(r.Z, p.Z, p.T);
+    _feMul(r.T, p.X, p.Y);
+}
+
+// r = 2p (dbl-2008-hwcd, a = −1).
+static void _geP2Dbl(GeP1P1& r, const GeP2& p)
+{
+    fe t0;
+    _feSq(r.X, p.X);
+    _feSq(r.Z, p.Y);
+    _feSq2(r.T, p.Z);
+    _feAdd(r.Y, p.X, p.Y);
+    _feSq(t0, r.Y);
+    _feAdd(r.Y, r.Z, r.X);
+    _feSub(r.Z, r.Z, r.X);
+    _feSub(r.X, t0, r.Y);
+    _feSub(r.T, r.T, r.Z);
+}
+
+// r = p + q, q in precomputed (y + x, y − x, 2dxy) form with Z = 1.
+static void _geMadd(GeP1P1& r, const GeP3& p, const X25519BasePrecomp& q)
+{
+    fe t0;
+    _feAdd(r.X, p.Y, p.X);
+    _feSub(r.Y, p.Y, p.X);
+    _feMul(r.Z, r.X, q.yplusx);
+    _feMul(r.Y, r.Y, q.yminusx);
+    _feMul(r.T, q.xy2d, p.T);
+    _feAdd(t0, p.Z, p.Z);
+    _feSub(r.X, r.Z, r.Y);
+    _feAdd(r.Y, r.Z, r.Y);
+    _feAdd(r.Z, t0, r.T);
+    _feSub(r.T, t0, r.T);
+}
+
+// t = b · 256^pos · B for b in [−8, 8], touching all eight row entries.
+static void _geSelect(X25519BasePrecomp& t, int pos, int8_t b)
+{
+    const uint8_t bneg = static_cast<uint8_t>(static_cast<uint8_t>(b) >> 7);
+    const uint8_t babs = static_cast<uint8_t>(b - ((-bneg & b) << 1));
+
+    _fe1(t.yplusx);
+    _fe1(t.yminusx);
+    _fe0(t.xy2d);
+    for (int j = 0; j < 8; j++) {
+        // eq = 1 iff babs == j + 1, without a branch.
+        const uint32_t diff = static_cast<uint32_t>(babs ^ (j + 1));
+        const int32_t  eq   = static_cast<int32_t>((diff - 1) >> 31);
+        const X25519BasePrecomp& e = X25519_BASE_TABLE[pos][j];
+        _feCmov(t.yplusx,  e.yplusx,  eq);
+        _feCmov(t.yminusx, e.yminusx, eq);
+        _feCmov(t.xy2d,    e.xy2d,    eq);
+    }
+
+    // −(x, y) = (−x, y): swap y ± x and negate 2dxy.
+    X25519BasePrecomp neg;
+    _feCopy(neg.yplusx,  t.yminusx);
+    _feCopy(neg.yminusx, t.yplusx);
+    _fe0(neg.xy2d);
+    _feSub(neg.xy2d, neg.xy2d, t.xy2d);
+    _feCmov(t.yplusx,  neg.yplusx,  bneg);
+    _feCmov(t.yminusx, neg.yminusx, bneg);
+    _feCmov(t.xy2d,    neg.xy2d,    bneg);
+}
+
+// q = clamp(n) · (u = 9)
+static void _scalarmultBase(uint8_t q[32], const uint8_t n[32])
+{
+    s_scalarMults++;
+
+    uint8_t a[32];
+    memcpy(a, n, 32);
+    a[0]  &= 248;
+    a[31] &= 127;
+    a[31] |= 64;
+
+    // Signed radix-16 recoding: a = Σ e[i]·16^i, e[i] in [−8, 8).  The top
+    // digit absorbs the final carry and stays ≤ 8 because a < 2^255.
+    int8_t e[64];
+    for (int i = 0; i < 32; i++) {
+        e[2 * i]     = static_cast<int8_t>(a[i] & 15);
+        e[2 * i + 1] = static_cast<int8_t>(a[i] >> 4);
+    }
+    int8_t carry = 0;
+    for (int i = 0; i < 63; i++) {
+        e[i]  = static_cast<int8_t>(e[i] + carry);
+        carry = static_cast<int8_t>((e[i] + 8) >> 4);
+        e[i]  = static_cast<int8_t>(e[i] - (carry << 4));
+    }
+    e[63] = static_cast<int8_t>(e[63] + carry);
+
+    GeP3   h;
+    GeP2   s;
+    GeP1P1 r;
+    X25519BasePrecomp t;
+
+    _fe0(h.X); _fe1(h.Y); _fe1(h.Z); _fe0(h.T);   // neutral element
+
+    // Odd digits first, then ×16, then the even digits.
+    for (int i = 1; i < 64; i += 2) {
+        _geSelect(t, i / 2, e[i]);
+        _geMadd(r, h, t);
+        _geP1P1ToP3(h, r);
+    }
+
+    _feCopy(s.X, h.X); _feCopy(s.Y, h.Y); _feCopy(s.Z, h.Z);
+    _geP2Dbl(r, s); _geP1P1ToP2(s, r);
+    _geP2Dbl(r, s); _geP1P1ToP2(s, r);
+    _geP2Dbl(r, s); _geP1P1ToP2(s, r);
+    _geP2Dbl(r, s); _geP1P1ToP3(h, r);
+
+    for (int i = 0; i < 64; i += 2) {
+        _geSelect(t, i / 2, e[i]);
+        _geMadd(r, h, t);
+        _geP1P1ToP3(h, r);
+    }
+
+    // Montgomery u = (1 + y) / (1 − y) = (Z + Y) / (Z − Y).
+    fe num, den;
+    _feAdd(num, h.Z, h.Y);
+    _feSub(den, h.Z, h.Y);
+    _feInvert(den, den);
+    _feMul(num, num, den);
+    _feToBytes(q, num);
+
+    mbedtls_platform_zeroize(a, sizeof(a));
+    mbedtls_platform_zeroize(e, sizeof(e));
+}
+
+// RFC 7748 §5 X25519 scalar multiplication: q = clamp(n) * p
+static void _scalarmult(uint8_t q[32], const uint8_t n[32], const uint8_t p[32])
+{
+    s_scalarMults++;
+
+    uint8_t e[32];
+    memcpy(e, n, 32);
+    e[0]  &= 248;
+    e[31] &= 127;
+    e[31] |= 64;
+
+    fe x1, x2, z2, x3, z3, a, b, aa, bb, c, d, da, cb, t;
+    _feFromBytes(x1, p);
+    _fe1(x2);
+    _fe0(z2);
+    _feCopy(x3, x1);
+    _fe1(z3);
+
+    int32_t swap = 0;
+    for (int pos = 254; pos >= 0; --pos) {
+        const int32_t bit = (e[pos >> 3] >> (pos & 7)) & 1;
+        swap ^= bit;
+        _feCswap(x2, x3, swap);
+        _feCswap(z2, z3, swap);
+        swap = bit;
+
+        _feAdd(a, x2, z2);         // A  = x2 + z2
+        _feSub(b, x2, z2);         // B  = x2 − z2
+        _feAdd(c, x3, z3);         // C  = x3 + z3
+        _feSub(d, x3, z3);         // D  = x3 − z3
+        _feSq(aa, a);              // AA = A²
+        _feSq(bb, b);              // BB = B²
+        _feMul(da, d, a);          // DA = D·A
+        _feMul(cb, c, b);          // CB = C·B
+        _feSub(t, aa, bb);         // E  = AA − BB
+        _feMul(x2, aa, bb);        // x2 = AA·BB
+        _feAdd(x3, da, cb);
+        _feSq(x3, x3);             // x3 = (DA + CB)²
+        _feSub(z3, da, cb);
+        _feSq(z3, z3);
+        _feMul(z3, x1, z3);        // z3 = x1·(DA − CB)²
+        _feMul121665(z2, t);
+        _feAdd(z2, aa, z2);
+        _feMul(z2, t, z2);         // z2 = E·(AA + a24·E)
+    }
+    _feCswap(x2, x3, swap);
+    _feCswap(z2, z3, swap);
+
+    _feInvert(z2, z2);
+    _feMul(x2, x2, z2);
+    _feToBytes(q, x2);
+
+    mbedtls_platform_zeroize(e, sizeof(e));
+}
+
+#endif // MC_X25519_FE32
+
 // ── mc_buildNonce ─────────────────────────────────────────────────────────
 void mc_buildNonce(uint32_t packetId, uint32_t fromNode, uint8_t nonce[16])
 {
@@ -251,6 +764,19 @@ bool mc_aes256ctr(const uint8_t key[32], const uint8_t nonce_in[16],
     return ok;
 }
 
+// AES-128 key for the default LongFast channel (factory default on every
+// Meshtastic device).  Used for both RX decryption and TX encryption.
+//
+// Even in IsLicensed mode, TX packets are encrypted with this PSK so that
+// stock Meshtastic nodes (matching chanHash=0x08) can decrypt and parse them.
+// The PSK is publicly known (published in Meshtastic docs and source code),
+// so using it does not violate ham-radio regulations — it only provides
+// transport-layer framing that the mesh expects.
+const uint8_t MC_DEFAULT_PSK[16] = {
+    0xd4, 0xf1, 0xbb, 0x3a, 0x20, 0x29, 0x07, 0x59,
+    0xf0, 0xbc, 0xff, 0xab, 0xcf, 0x4e, 0x69, 0x01
+};
+
 // ── mc_channelCrypt ───────────────────────────────────────────────────────
 bool mc_channelCrypt(const uint8_t psk[16],
                      uint32_t packetId, uint32_t fromNode,
@@ -262,10 +788,16 @@ bool mc_channelCrypt(const uint8_t psk[16],
 }
 
 // ── mc_x25519PublicKey ────────────────────────────────────────────────────
+// The 10-limb backend has a table-driven fixed-base path; the TweetNaCl
+// backend runs the generic ladder on u = 9.
 bool mc_x25519PublicKey(const uint8_t privateKey[32], uint8_t publicKeyOut[32])
 {
+#if MC_X25519_FE32
+    _scalarmultBase(publicKeyOut, privateKey);
+#else
     static const uint8_t basepoint[32] = {9};
     _scalarmult(publicKeyOut, privateKey, basepoint);
+#endif
     return true;
 }
 
@@ -405,6 +937,16 @@ bool mc_pkcEncrypt(const uint8_t ourPrivKey[32], const uint8_t remotePubKey[32],
     if (!_derivePkcKey(ourPrivKey, remotePubKey, key))
         return false;
 
+    const bool ok = mc_pkcEncryptWithKey(key, packetId, fromNode, in, len, out);
+    mbedtls_platform_zeroize(key, 32);
+    return ok;
+}
+
+// ── mc_pkcEncryptWithKey ──────────────────────────────────────────────────
+bool mc_pkcEncryptWithKey(const uint8_t key[32],
+                          uint32_t packetId, uint32_t fromNode,
+                          const uint8_t* in, size_t len, uint8_t* out)
+{
     uint8_t ccmNonce[13];
     _buildPkcNonce(packetId, fromNode, /*extraNonce=*/0, ccmNonce);
 
@@ -424,7 +966,6 @@ bool mc_pkcEncrypt(const uint8_t ourPrivKey[32], const uint8_t remotePubKey[32],
                 tag, 8) == 0);         // M=8 tag
     }
     mbedtls_ccm_free(&ccm);
-    mbedtls_platform_zeroize(key, 32);
 
     if (ok)
     {
@@ -442,6 +983,22 @@ bool mc_pkcEncrypt(const uint8_t ourPrivKey[32], const uint8_t remotePubKey[32],
 bool mc_pkcDecrypt(const uint8_t ourPrivKey[32], const uint8_t remotePubKey[32],
                    uint32_t packetId, uint32_t fromNode,
                    const uint8_t* in, size_t len, uint8_t* out)
+{
+    if (len <= MC_PKC_OVERHEAD) return false;
+
+    uint8_t key[32] = {};
+    if (!_derivePkcKey(ourPrivKey, remotePubKey, key))
+        return false;
+
+    const bool ok = mc_pkcDecryptWithKey(key, packetId, fromNode, in, len, out);
+    mbedtls_platform_zeroize(key, 32);
+    return ok;
+}
+
+// ── mc_pkcDecryptWithKey ──────────────────────────────────────────────────
+bool mc_pkcDecryptWithKey(const uint8_t key[32],
+                          uint32_t packetId, uint32_t fromNode,
+                          const uint8_t* in, size_t len, uint8_t* out)
 {
     static constexpr size_t TAG_SIZE = 8;
     if (len <= TAG_SIZE) return false;
@@ -449,10 +1006,6 @@ bool mc_pkcDecrypt(const uint8_t ourPrivKey[32], const uint8_t remotePubKey[32],
     const size_t cipherLen = len - TAG_SIZE;
     const uint8_t* tag     = in + cipherLen;
 
-    uint8_t key[32] = {};
-    if (!_derivePkcKey(ourPrivKey, remotePubKey, key))
-        return false;
-
     uint8_t ccmNonce[13];
     _buildPkcNonce(packetId, fromNode, /*extraNonce=*/0, ccmNonce);
 
@@ -469,7 +1022,6 @@ bool mc_pkcDecrypt(const uint8_t ourPrivKey[32], const uint8_t remotePubKey[32],
                 tag, TAG_SIZE) == 0);   // verify 8-byte tag
     }
     mbedtls_ccm_free(&ccm);
-    mbedtls_platform_zeroize(key, 32);
     return ok;
 }
 
@@ -637,3 +1189,94 @@ bool mc_pkcDecryptCtrRaw(const uint8_t ourPrivKey[32], const uint8_t remotePubKe
     mbedtls_platform_zeroize(key, 32);
     return ok;
 }
+
+// ── mc_x25519ScalarMultCount ──────────────────────────────────────────────
+uint32_t mc_x25519ScalarMultCount()      { return s_scalarMults; }
+void     mc_x25519ResetScalarMultCount() { s_scalarMults = 0; }
+
+// ── mc_x25519FieldBackend ─────────────────────────────────────────────────
+const char* mc_x25519FieldBackend() { return FE_BACKEND_NAME; }
+
+// ── PKC session-key cache ─────────────────────────────────────────────────
+// 64-bit FNV-1a over the 32-byte public key.  Only used to detect key
+// rotation for a known node id; not a security boundary (a collision just
+// yields a stale key, which then fails CCM authentication).
+static uint64_t _pubKeyHash(const uint8_t pub[32])
+{
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (int i = 0; i < 32; i++) {
+        h ^= pub[i];
+        h *= 0x100000001b3ULL;
+    }
+    return h;
+}
+
+static void _evictEntry(McPkcKeyCacheEntry& e)
+{
+    mbedtls_platform_zeroize(e.key, sizeof(e.key));
+    e.nodeId   = 0;
+    e.pubHash  = 0;
+    e.lastUse  = 0;
+    e.occupied = false;
+}
+
+bool mc_pkcKeyCacheGet(McPkcKeyCache& cache,
+                       const uint8_t ourPrivKey[32],
+                       uint32_t nodeId, const uint8_t remotePubKey[32],
+                       uint8_t keyOut[32])
+{
+    const uint64_t h = _pubKeyHash(remotePubKey);
+
+    // Single pass: look for a hit, remember the node's stale slot (if its
+    // key changed), the first free slot and the LRU slot.
+    int hit = -1, stale = -1, freeSlot = -1, lru = 0;
+    for (int i = 0; i < (int)MC_PKC_KEY_CACHE_MAX; i++) {
+        const McPkcKeyCacheEntry& e = cache.entries[i];
+        if (!e.occupied) {
+            if (freeSlot < 0) freeSlot = i;
+            continue;
+        }
+        if (e.nodeId == nodeId) {
+            if (e.pubHash == h) { hit = i; break; }
+            stale = i;
+        }
+        if (e.lastUse < cache.entries[lru].lastUse) lru = i;
+    }
+
+    if (hit >= 0) {
+        cache.entries[hit].lastUse = ++cache.clock;
+        memcpy(keyOut, cache.entries[hit].key, 32);
+        cache.hits++;
+        return true;
+    }
+
+    cache.misses++;
+    if (!_derivePkcKey(ourPrivKey, remotePubKey, keyOut))
+        return false;
+
+    const int slot = (stale >= 0) ? stale : (freeSlot >= 0) ? freeSlot : lru;
+    McPkcKeyCacheEntry& e = cache.entries[slot];
+    _evictEntry(e);
+    e.nodeId   = nodeId;
+    e.pubHash  = h;
+    e.lastUse  = ++cache.clock;
+    memcpy(e.key, keyOut, 32);
+    e.occupied = true;
+    return true;
+}
+
+void mc_pkcKeyCacheInvalidate(McPkcKeyCache& cache, uint32_t nodeId)
+{
+    for (size_t i = 0; i < MC_PKC_KEY_CACHE_MAX; i++)
+        if (cache.entries[i].occupied && cache.entries[i].nodeId == nodeId)
+            _evictEntry(cache.entries[i]);
+}
+
+void mc_pkcKeyCacheClear(McPkcKeyCache& cache)
+{
+    for (size_t i = 0; i < MC_PKC_KEY_CACHE_MAX; i++)
+        _evictEntry(cache.entries[i]);
+    cache.clock  = 0;
+    cache.hits   = 0;
+    cache.misses = 0;
+}
@@ -77,11 +77,14 @@ bool mc_aes128ctr(const uint8_t key[16], const uint8_t nonce_in[16],
 bool mc_aes256ctr(const uint8_t key[32], const uint8_t nonce_in[16],
                   const uint8_t* in, size_t len, uint8_t* out);
 
+/// Meshtastic default channel AES-128 PSK (factory LongFast).
+extern const uint8_t MC_DEFAULT_PSK[16];
+
 /**
  * Meshtastic channel cipher — AES-128-CTR using the standard Meshtastic
  * nonce layout.  Combines mc_buildNonce() + mc_aes128ctr().
  *
- * @param psk      16-byte channel PSK (DEFAULT_PSK for the LongFast channel).
+ * @param psk      16-byte channel PSK (MC_DEFAULT_PSK for the LongFast channel).
  * @param packetId From the 4-byte OTA header field bytes [8:11].
  * @param fromNode From the 4-byte OTA header field bytes [4:7].
  */
@@ -152,3 +155,83 @@ bool mc_pkcDecryptCcmFlex(const uint8_t key[32],
                           const uint8_t* nonce, size_t nonceLen,
                           const uint8_t* in, size_t wireLen,
                           uint8_t* out, size_t tagSize);
+
+/**
+ * AES-256-CCM (M=8, L=2) encrypt with an already-derived PKC key.
+ * Same nonce and wire layout as mc_pkcEncrypt(); skips the ECDH + SHA-256
+ * step so callers holding a cached session key pay only for the cipher.
+ * @param out  Must hold at least len + MC_PKC_OVERHEAD bytes.
+ */
+bool mc_pkcEncryptWithKey(const uint8_t key[32],
+                          uint32_t packetId, uint32_t fromNode,
+                          const uint8_t* in, size_t len, uint8_t* out);
+
+/**
+ * AES-256-CCM (M=8, L=2) decrypt with an already-derived PKC key.
+ * Wire layout: [ciphertext] [8-byte CCM tag].
+ */
+bool mc_pkcDecryptWithKey(const uint8_t key[32],
+                          uint32_t packetId, uint32_t fromNode,
+                          const uint8_t* in, size_t len, uint8_t* out);
+
+/**
+ * Number of X25519 scalar multiplications performed since boot (or since
+ * the last reset).  Diagnostic only — lets tests and Diag verify that the
+ * session-key cache is actually avoiding ECDH work.
+ */
+uint32_t mc_x25519ScalarMultCount();
+void     mc_x25519ResetScalarMultCount();
+
+/**
+ * Name of the compiled-in GF(2^255 − 19) backend ("ref10-10x25.5" or
+ * "tweetnacl-16x16"), selected at build time by MC_X25519_FE32.
+ */
+const char* mc_x25519FieldBackend();
+
+// ── PKC session-key cache ─────────────────────────────────────────────────
+//
+// Every PKC DM needs AES key = SHA-256(X25519(ourPriv, remotePub)).  The
+// scalar multiplication dominates the cost, and the result only changes
+// when the peer rotates its key, so derived keys are cached per peer.
+//
+// Entries are keyed by (node id, 64-bit FNV-1a fingerprint of the public
+// key): a lookup with a different key for the same node is a miss and
+// replaces the stale entry.  Evicted and invalidated keys are zeroized.
+//
+// The cache is bound to one local private key — call mc_pkcKeyCacheClear()
+// if it ever changes.  Not thread-safe; the owner serialises access (the
+// LoRa task is the only user in firmware).
+
+static constexpr size_t MC_PKC_KEY_CACHE_MAX = 8;
+
+struct McPkcKeyCacheEntry {
+    uint32_t nodeId   = 0;
+    uint64_t pubHash  = 0;     ///< FNV-1a of the remote public key
+    uint32_t lastUse  = 0;     ///< cache clock value at last hit/insert (LRU)
+    uint8_t  key[32]  = {};    ///< SHA-256(X25519 shared secret)
+    bool     occupied = false;
+};
+
+struct McPkcKeyCache {
+    McPkcKeyCacheEntry entries[MC_PKC_KEY_CACHE_MAX] = {};
+    uint32_t clock  = 0;       ///< monotonically increasing use counter
+    uint32_t hits   = 0;
+    uint32_t misses = 0;
+};
+
+/**
+ * Return the AES-256 PKC key for (nodeId, remotePubKey), deriving and
+ * caching it on a miss.  The least-recently-used entry is evicted when
+ * the cache is full.
+ * @return false if ECDH fails (low-order public key); nothing is cached.
+ */
+bool mc_pkcKeyCacheGet(McPkcKeyCache& cache,
+                       const uint8_t ourPrivKey[32],
+                       uint32_t nodeId, const uint8_t remotePubKey[32],
+                       uint8_t keyOut[32]);
+
+/// Drop (and zeroize) the cached key for nodeId, if any.
+void mc_pkcKeyCacheInvalidate(McPkcKeyCache& cache, uint32_t nodeId);
+
+/// Drop (and zeroize) every cached key and reset the hit/miss counters.
+void mc_pkcKeyCacheClear(McPkcKeyCache& cache);
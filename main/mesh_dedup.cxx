@@ -0,0 +1,174 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * mesh_dedup.cxx — exact set + rotating Bloom filters (see mesh_dedup.h).
+ */
+
+#include "mesh_dedup.h"
+#include <cstring>
+
+static constexpr uint32_t EXACT_SETS = MC_DEDUP_EXACT / 2;
+static constexpr uint32_t BLOOM_MASK = MC_DEDUP_BLOOM_BITS - 1;
+static constexpr int      BLOOM_K    = 4;   // optimal for ~20 bits per key
+
+// ── Hashing ───────────────────────────────────────────────────────────────
+
+// splitmix64 finaliser over the packed key.  The low half picks the exact
+// set; both halves drive the Bloom probes (Kirsch–Mitzenmacher double
+// hashing: h1 + i·h2).
+static inline uint64_t _hash(uint32_t from, uint32_t id)
+{
+    uint64_t x = (static_cast<uint64_t>(from) << 32) | id;
+    x ^= x >> 30; x *= 0xBF58476D1CE4E5B9ull;
+    x ^= x >> 27; x *= 0x94D049BB133111EBull;
+    x ^= x >> 31;
+    return x;
+}
+
+static bool _bloomTest(const uint32_t* bits, uint64_t h)
+{
+    const uint32_t h1 = static_cast<uint32_t>(h);
+    const uint32_t h2 = static_cast<uint32_t>(h >> 32) | 1;
+    for (int i = 0; i < BLOOM_K; i++)
+    {
+        const uint32_t b = (h1 + i * h2) & BLOOM_MASK;
+        if (!(bits[b >> 5] & (1u << (b & 31)))) return false;
+    }
+    return true;
+}
+
+static void _bloomSet(uint32_t* bits, uint64_t h)
+{
+    const uint32_t h1 = static_cast<uint32_t>(h);
+    const uint32_t h2 = static_cast<uint32_t>(h >> 32) | 1;
+    for (int i = 0; i < BLOOM_K; i++)
+    {
+        const uint32_t b = (h1 + i * h2) & BLOOM_MASK;
+        bits[b >> 5] |= 1u << (b & 31);
+    }
+}
+
+// ── Generations ───────────────────────────────────────────────────────────
+
+static void _rotate(McDedup& d, uint32_t now)
+{
+    d.cur ^= 1;
+    memset(d.bloom[d.cur], 0, sizeof(d.bloom[d.cur]));
+    d.curCount = 0;
+    d.genStart = now;
+    d.rotations++;
+}
+
+static void _age(McDedup& d, uint32_t now)
+{
+    if (!d.started)
+    {
+        d.started  = true;
+        d.genStart = now;
+        return;
+    }
+    const uint32_t elapsed = now - d.genStart;
+    if (elapsed >= 2 * d.window)
+    {
+        // Idle for two windows: both generations have expired.
+        _rotate(d, now);
+        _rotate(d, now);
+    }
+    else if (elapsed >= d.window || d.curCount >= MC_DEDUP_GEN_CAPACITY)
+    {
+        _rotate(d, now);
+    }
+}
+
+// ── Exact set ─────────────────────────────────────────────────────────────
+
+static McDedupSlot* _exactFind(McDedup& d, uint32_t from, uint32_t id, uint64_t h)
+{
+    McDedupSlot* set = &d.exact[(h & (EXACT_SETS - 1)) * 2];
+    for (int w = 0; w < 2; w++)
+        if (set[w].id == id && set[w].from == from) return &set[w];
+    return nullptr;
+}
+
+// Empty way if any, else the older of the two.
+static void _exactInsert(McDedup& d, uint32_t from, uint32_t id, uint64_t h, uint32_t now)
+{
+    McDedupSlot* set = &d.exact[(h & (EXACT_SETS - 1)) * 2];
+    McDedupSlot* victim;
+    if      (set[0].id == 0) victim = &set[0];
+    else if (set[1].id == 0) victim = &set[1];
+    else victim = (now - set[0].tick >= now - set[1].tick) ? &set[0] : &set[1];
+    victim->from = from;
+    victim->id   = id;
+    victim->tick = now;
+}
+
+// ── Public API ────────────────────────────────────────────────────────────
+
+void mc_dedupInit(McDedup& d, uint32_t windowTicks)
+{
+    d        = {};
+    d.window = windowTicks ? windowTicks : 1;
+}
+
+void mc_dedupRecord(McDedup& d, uint32_t from, uint32_t pktId, uint32_t now)
+{
+    if (pktId == 0) return;
+    _age(d, now);
+    const uint64_t h = _hash(from, pktId);
+    if (McDedupSlot* s = _exactFind(d, from, pktId, h)) s->tick = now;
+    else _exactInsert(d, from, pktId, h, now);
+    _bloomSet(d.bloom[d.cur], h);
+    d.curCount++;
+}
+
+McDedupResult mc_dedupCheck(McDedup& d, uint32_t from, uint32_t pktId, uint32_t now)
+{
+    if (pktId == 0) return McDedupResult::New;
+    _age(d, now);
+    const uint64_t h = _hash(from, pktId);
+
+    if (McDedupSlot* s = _exactFind(d, from, pktId, h))
+    {
+        if (now - s->tick < d.window)
+        {
+            s->tick = now;
+            d.exactHits++;
+            return McDedupResult::Exact;
+        }
+        // Known and expired — definitely new, whatever the Bloom bits say.
+        s->tick = now;
+        _bloomSet(d.bloom[d.cur], h);
+        d.curCount++;
+        return McDedupResult::New;
+    }
+
+    if (_bloomTest(d.bloom[d.cur], h) || _bloomTest(d.bloom[d.cur ^ 1], h))
+    {
+        // Pull it back into the exact set so further echoes hit exactly.
+        _exactInsert(d, from, pktId, h, now);
+        d.probableHits++;
+        return McDedupResult::Probable;
+    }
+
+    _exactInsert(d, from, pktId, h, now);
+    _bloomSet(d.bloom[d.cur], h);
+    d.curCount++;
+    return McDedupResult::New;
+}
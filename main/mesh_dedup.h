@@ -0,0 +1,106 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * mesh_dedup.h — time-windowed duplicate filter for received packets.
+ *
+ * A flooded packet reaches us once per neighbour that rebroadcasts it,
+ * sometimes minutes apart.  McDedup remembers (from, packetId) pairs for
+ * at least windowTicks using two structures:
+ *
+ *   - An exact recent set: MC_DEDUP_EXACT (from, id, tick) slots, 2-way
+ *     set-associative on a hash of the key.  Answers exactly for recently
+ *     seen packets and knows their age, so an expired key is reported as
+ *     new even while a Bloom generation still holds it.
+ *   - Two Bloom generations of MC_DEDUP_BLOOM_BITS each.  New keys go into
+ *     the current generation; every windowTicks (or once the current one
+ *     holds MC_DEDUP_GEN_CAPACITY keys) the older generation is cleared and
+ *     becomes current.  A key therefore stays visible for between one and
+ *     two windows after its last insert.
+ *
+ * Both lookups are O(1) and memory is fixed (~3.5 KB at the defaults).
+ * False negatives are impossible within the window unless more than
+ * MC_DEDUP_GEN_CAPACITY new packets arrive in it and the key has also been
+ * pushed out of the exact set.  False positives — a new packet reported as
+ * a duplicate — come only from the Bloom filters; at the defaults that is
+ * about 0.2 % with both generations full.
+ *
+ * Packet id 0 is not a valid Meshtastic id and is never treated as a
+ * duplicate.  Not thread-safe; LoRa uses it from its task only.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+#ifndef MC_DEDUP_EXACT
+#  define MC_DEDUP_EXACT 128          ///< exact slots; even, power of two
+#endif
+#ifndef MC_DEDUP_BLOOM_BITS
+#  define MC_DEDUP_BLOOM_BITS 8192    ///< bits per Bloom generation; power of two
+#endif
+#ifndef MC_DEDUP_GEN_CAPACITY
+#  define MC_DEDUP_GEN_CAPACITY 400   ///< inserts before a generation is rotated early
+#endif
+
+static_assert((MC_DEDUP_EXACT & (MC_DEDUP_EXACT - 1)) == 0 && MC_DEDUP_EXACT >= 2,
+              "MC_DEDUP_EXACT must be a power of two >= 2");
+static_assert((MC_DEDUP_BLOOM_BITS & (MC_DEDUP_BLOOM_BITS - 1)) == 0 &&
+              MC_DEDUP_BLOOM_BITS >= 64,
+              "MC_DEDUP_BLOOM_BITS must be a power of two >= 64");
+
+enum class McDedupResult : uint8_t {
+    New,        ///< not seen within the window — now recorded
+    Exact,      ///< found in the exact recent set
+    Probable,   ///< Bloom filter hit (true duplicate, or a false positive)
+};
+
+struct McDedupSlot {
+    uint32_t from = 0;
+    uint32_t id   = 0;    ///< 0 = empty
+    uint32_t tick = 0;    ///< last time this key was recorded
+};
+
+struct McDedup {
+    McDedupSlot exact[MC_DEDUP_EXACT]                 = {};
+    uint32_t    bloom[2][MC_DEDUP_BLOOM_BITS / 32]    = {};
+    uint8_t     cur         = 0;   ///< generation receiving inserts
+    uint16_t    curCount    = 0;   ///< keys inserted into bloom[cur]
+    uint32_t    genStart    = 0;   ///< tick bloom[cur] was cleared
+    uint32_t    window      = 0;   ///< minimum retention, in ticks
+    bool        started     = false;
+
+    // Counters since init
+    uint32_t    exactHits    = 0;
+    uint32_t    probableHits = 0;
+    uint32_t    rotations    = 0;
+};
+
+/// Reset d and set the retention window (ticks, > 0).
+void mc_dedupInit(McDedup& d, uint32_t windowTicks);
+
+/**
+ * Look up (from, pktId) at tick now.  A key not seen within the window is
+ * recorded and reported New; anything else is a duplicate.  An exact hit
+ * refreshes the key's age, so a packet that keeps echoing stays filtered.
+ */
+McDedupResult mc_dedupCheck(McDedup& d, uint32_t from, uint32_t pktId, uint32_t now);
+
+/// Record (from, pktId) without looking it up — e.g. packets we transmit.
+void mc_dedupRecord(McDedup& d, uint32_t from, uint32_t pktId, uint32_t now);
@@ -0,0 +1,133 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * mesh_inbox.cxx — lock-free SPSC message inbox (see mesh_inbox.h).
+ */
+
+#include "mesh_inbox.h"
+
+// ── Producer ──────────────────────────────────────────────────────────────
+
+void mc_inboxPush(McInbox& b, const MeshMessage& msg)
+{
+    const uint32_t n = b.head.load(std::memory_order_relaxed);
+    McInboxSlot& s = b.slots[n % MC_INBOX_DEPTH];
+
+    s.seq.store(2 * n + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    s.msg = msg;
+    s.seq.store(2 * n + 2, std::memory_order_release);
+    b.head.store(n + 1, std::memory_order_release);
+}
+
+// ── Any task ──────────────────────────────────────────────────────────────
+
+uint32_t mc_inboxHead(const McInbox& b)
+{
+    return b.head.load(std::memory_order_acquire);
+}
+
+uint32_t mc_inboxOldest(const McInbox& b)
+{
+    const uint32_t h = mc_inboxHead(b);
+    return h > MC_INBOX_DEPTH ? h - MC_INBOX_DEPTH : 0;
+}
+
+uint32_t mc_inboxFirstUnread(const McInbox& b)
+{
+    const uint32_t o = mc_inboxOldest(b);
+    const uint32_t r = b.readMark.load(std::memory_order_relaxed);
+    return r > o ? r : o;
+}
+
+uint32_t mc_inboxUnread(const McInbox& b)
+{
+    const uint32_t h = mc_inboxHead(b);
+    const uint32_t o = h > MC_INBOX_DEPTH ? h - MC_INBOX_DEPTH : 0;
+    const uint32_t r = b.readMark.load(std::memory_order_relaxed);
+    return h - (r > o ? r : o);
+}
+
+uint32_t mc_inboxOverflows(const McInbox& b)
+{
+    // Counted so far, plus any overwritten since the consumer last looked.
+    const uint32_t o = mc_inboxOldest(b);
+    const uint32_t r = b.readMark.load(std::memory_order_relaxed);
+    return b.lost.load(std::memory_order_relaxed) + (o > r ? o - r : 0);
+}
+
+bool mc_inboxGet(const McInbox& b, uint32_t n, MeshMessage& out)
+{
+    const McInboxSlot& s = b.slots[n % MC_INBOX_DEPTH];
+    const uint32_t want = 2 * n + 2;
+    if (s.seq.load(std::memory_order_acquire) != want) return false;
+
+    out = s.msg;
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return s.seq.load(std::memory_order_relaxed) == want;
+}
+
+// ── Consumer ──────────────────────────────────────────────────────────────
+
+void mc_inboxMarkReadTo(McInbox& b, uint32_t n)
+{
+    const uint32_t h = mc_inboxHead(b);
+    if (n > h) n = h;
+    const uint32_t r = b.readMark.load(std::memory_order_relaxed);
+    if (n <= r) return;
+
+    // Skipping messages on purpose is not an overflow; only those already
+    // gone before the mark moved are.
+    const uint32_t o = h > MC_INBOX_DEPTH ? h - MC_INBOX_DEPTH : 0;
+    if (o > r)
+        b.lost.store(b.lost.load(std::memory_order_relaxed) + ((o < n ? o : n) - r),
+                     std::memory_order_relaxed);
+    b.readMark.store(n, std::memory_order_relaxed);
+}
+
+bool mc_inboxTakeUnread(McInbox& b, MeshMessage& out, uint32_t& n)
+{
+    for (;;)
+    {
+        const uint32_t h = mc_inboxHead(b);
+        const uint32_t o = h > MC_INBOX_DEPTH ? h - MC_INBOX_DEPTH : 0;
+        uint32_t r = b.readMark.load(std::memory_order_relaxed);
+        if (o > r)
+        {
+            b.lost.store(b.lost.load(std::memory_order_relaxed) + (o - r),
+                         std::memory_order_relaxed);
+            r = o;
+            b.readMark.store(r, std::memory_order_relaxed);
+        }
+        if (r >= h) return false;
+
+        // r < head, so it was committed: a failed copy means the producer
+        // has reclaimed the slot since.
+        const bool ok = mc_inboxGet(b, r, out);
+        b.readMark.store(r + 1, std::memory_order_relaxed);
+        if (ok)
+        {
+            n = r;
+            return true;
+        }
+        b.lost.store(b.lost.load(std::memory_order_relaxed) + 1,
+                     std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,103 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * mesh_inbox.h — bounded inbox of received text messages, LoRa → display.
+ *
+ * The LoRa task pushes every text and alert it decodes; the draw task
+ * takes them oldest first and can page back through those still held.
+ * Each message gets a sequence number (0, 1, 2 … since boot).  When the
+ * inbox is full the oldest message is overwritten — the producer never
+ * waits on the display — and an unread message lost that way is counted
+ * as an overflow.
+ *
+ * Single producer, single consumer, no locks.  Slots use the same
+ * odd/even sequence scheme as the capture ring (mesh_capture.h): 2n + 1
+ * while message n is written, 2n + 2 once complete, so a copy that raced
+ * the producer is detected and discarded.  The read mark is written by the
+ * consumer only.  Other tasks may read the counters.
+ *
+ * Capacity is MC_INBOX_DEPTH, set from CONFIG_LORA_INBOX_MESSAGES by
+ * main/CMakeLists.txt.
+ */
+
+#pragma once
+
+#include "mesh_codec.h"
+#include <atomic>
+#include <cstdint>
+
+#ifndef MC_INBOX_DEPTH
+#  define MC_INBOX_DEPTH 8
+#endif
+
+static_assert(MC_INBOX_DEPTH >= 2 && MC_INBOX_DEPTH <= 256,
+              "MC_INBOX_DEPTH out of range");
+
+struct McInboxSlot {
+    std::atomic<uint32_t> seq{0};   ///< 2n+1 while message n is written, 2n+2 once complete
+    MeshMessage msg;
+};
+
+struct McInbox {
+    McInboxSlot           slots[MC_INBOX_DEPTH];
+    std::atomic<uint32_t> head{0};      ///< messages pushed since boot (producer)
+    std::atomic<uint32_t> readMark{0};  ///< messages before this one have been read (consumer)
+    std::atomic<uint32_t> lost{0};      ///< unread messages the consumer found overwritten
+};
+
+// ── Producer ──────────────────────────────────────────────────────────────
+
+/// Append @p msg, overwriting the oldest message when full.
+void mc_inboxPush(McInbox& b, const MeshMessage& msg);
+
+// ── Consumer ──────────────────────────────────────────────────────────────
+
+/**
+ * Copy the oldest unread message into @p out, set @p n to its sequence
+ * number and mark it read.  Unread messages that were overwritten are
+ * skipped and added to the overflow count.  Returns false when nothing is
+ * unread.
+ */
+bool mc_inboxTakeUnread(McInbox& b, MeshMessage& out, uint32_t& n);
+
+/// Mark every message before @p n read, without copying them.
+void mc_inboxMarkReadTo(McInbox& b, uint32_t n);
+
+// ── Any task ──────────────────────────────────────────────────────────────
+
+/// Messages pushed since boot; sequence numbers run 0 … head − 1.
+uint32_t mc_inboxHead(const McInbox& b);
+
+/// Oldest sequence number that may still be held.
+uint32_t mc_inboxOldest(const McInbox& b);
+
+/// Sequence number of the oldest unread message still held (head if none).
+uint32_t mc_inboxFirstUnread(const McInbox& b);
+
+/// Unread messages still held.
+uint32_t mc_inboxUnread(const McInbox& b);
+
+/// Unread messages overwritten before the consumer got to them.
+uint32_t mc_inboxOverflows(const McInbox& b);
+
+/**
+ * Copy message @p n into @p out — for paging back through read ones.
+ * Returns false when it has not been pushed yet or has been overwritten.
+ */
+bool mc_inboxGet(const McInbox& b, uint32_t n, MeshMessage& out);
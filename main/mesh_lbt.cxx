@@ -0,0 +1,77 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * mesh_lbt.cxx — listen-before-talk backoff policy (see mesh_lbt.h).
+ */
+
+#include "mesh_lbt.h"
+
+// EWMA with α = 1/8 on a 0–256 scale.
+static void _fold(McLbt& l, uint16_t sample)
+{
+    l.util = static_cast<uint16_t>((l.util * 7u + sample) / 8u);
+}
+
+uint8_t mc_lbtWindow(const McLbt& l)
+{
+    // Busy channel widens the starting window by up to 3 doublings; each
+    // consecutive busy scan for this frame doubles it again.
+    const uint32_t base = MC_LBT_CW_MIN + (l.util * 4u) / 257u;
+    const uint32_t cw   = base + (l.attempt > 0 ? l.attempt - 1u : 0u);
+    return static_cast<uint8_t>(cw > MC_LBT_CW_MAX ? MC_LBT_CW_MAX : cw);
+}
+
+McLbtDecision mc_lbtOnCad(McLbt& l, bool busy, uint32_t slotMs, uint32_t rnd)
+{
+    _fold(l, busy ? 256 : 0);
+
+    if (!busy)
+    {
+        l.clear++;
+        l.attempt = 0;
+        return {true, 0};
+    }
+
+    l.busy++;
+    if (++l.attempt >= MC_LBT_MAX_ATTEMPTS)
+    {
+        l.forced++;
+        l.attempt = 0;
+        return {true, 0};
+    }
+
+    // At least one slot, so the scan never repeats straight into the same
+    // preamble.
+    const uint32_t slots = 1u + rnd % (1u << mc_lbtWindow(l));
+    const uint32_t ms    = slots * slotMs;
+    l.backoffs++;
+    l.backoffMs += ms;
+    return {false, ms};
+}
+
+void mc_lbtNoteUtilisation(McLbt& l, uint8_t percent)
+{
+    if (percent > 100) percent = 100;
+    _fold(l, static_cast<uint16_t>(percent * 256u / 100u));
+}
+
+uint8_t mc_lbtUtilisation(const McLbt& l)
+{
+    return static_cast<uint8_t>((l.util * 100u + 128u) / 256u);
+}
@@ -0,0 +1,76 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * mesh_lbt.h — listen-before-talk backoff policy.
+ *
+ * Before every transmission LoRa runs a channel-activity detection (CAD)
+ * scan.  A clear channel transmits at once.  A busy one backs off a random
+ * number of contention slots and scans again.  The window doubles with
+ * each consecutive busy scan, binary exponential backoff, and starts wider
+ * when the channel has recently been busy.  After MC_LBT_MAX_ATTEMPTS busy
+ * scans the frame goes out anyway rather than starving.
+ *
+ * Channel utilisation is an exponentially weighted average of busy
+ * observations — CAD results, plus anything the caller feeds in through
+ * mc_lbtNoteUtilisation() — kept as a fraction of 256.
+ *
+ * Not thread-safe; LoRa uses it from its task only.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+static constexpr uint8_t MC_LBT_CW_MIN       = 2;   ///< log2 slots, idle channel, first backoff
+static constexpr uint8_t MC_LBT_CW_MAX       = 7;   ///< log2 slots, cap
+static constexpr uint8_t MC_LBT_MAX_ATTEMPTS = 8;   ///< busy scans before sending regardless
+
+struct McLbt {
+    uint8_t  attempt  = 0;      ///< consecutive busy scans for the current frame
+    uint16_t util     = 0;      ///< busy fraction × 256 (EWMA, α = 1/8)
+
+    // Counters since init
+    uint32_t clear     = 0;     ///< scans that found the channel free
+    uint32_t busy      = 0;     ///< scans that found activity
+    uint32_t backoffs  = 0;     ///< backoff periods started
+    uint32_t backoffMs = 0;     ///< total time spent backing off
+    uint32_t forced    = 0;     ///< frames sent after MC_LBT_MAX_ATTEMPTS busy scans
+};
+
+/// What to do after a CAD scan.
+struct McLbtDecision {
+    bool     transmit;          ///< send now (channel clear, or attempts exhausted)
+    uint32_t backoffMs;         ///< otherwise: wait this long, then scan again
+};
+
+/**
+ * Record a CAD result and decide.  @p slotMs is the contention slot
+ * (mc_relaySlotTimeMs); @p rnd is any uniformly distributed 32-bit value.
+ * A transmit decision resets the attempt count for the next frame.
+ */
+McLbtDecision mc_lbtOnCad(McLbt& l, bool busy, uint32_t slotMs, uint32_t rnd);
+
+/// Fold an external channel-busy observation (0–100 %) into the average.
+void mc_lbtNoteUtilisation(McLbt& l, uint8_t percent);
+
+/// Current utilisation estimate in percent.
+uint8_t mc_lbtUtilisation(const McLbt& l);
+
+/// log2 of the contention window the next backoff would draw from.
+uint8_t mc_lbtWindow(const McLbt& l);
@@ -0,0 +1,373 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * mesh_neighbors.cxx — open-addressing neighbour table (see mesh_neighbors.h).
+ */
+
+#include "mesh_neighbors.h"
+#include <cstring>
+
+static_assert((MC_NEIGHBOR_INDEX_SIZE & (MC_NEIGHBOR_INDEX_SIZE - 1)) == 0,
+              "index size must be a power of two");
+static_assert(MC_NEIGHBOR_MAX < 0xFFFF, "index stores slot + 1 in a uint16_t");
+
+static constexpr size_t INDEX_MASK = MC_NEIGHBOR_INDEX_SIZE - 1;
+
+// ── Index helpers ─────────────────────────────────────────────────────────
+
+// Node ids are often sequential or share a vendor prefix, so mix all 32 bits
+// before masking (murmur3 fmix32).
+static inline size_t _home(uint32_t id)
+{
+    id ^= id >> 16;
+    id *= 0x85EBCA6Bu;
+    id ^= id >> 13;
+    id *= 0xC2B2AE35u;
+    id ^= id >> 16;
+    return id & INDEX_MASK;
+}
+
+// Bucket holding nodeId, or the empty bucket where it would go.  The index
+// is never more than half full, so the probe always terminates.
+static size_t _probe(const McNeighborTable& t, uint32_t nodeId)
+{
+    size_t b = _home(nodeId);
+    while (t.index[b] != 0 && t.hot[t.index[b] - 1].nodeId != nodeId)
+        b = (b + 1) & INDEX_MASK;
+    return b;
+}
+
+// Clear bucket b and shift later members of its probe run back so every
+// remaining key stays reachable from its home bucket (no tombstones).
+static void _indexErase(McNeighborTable& t, size_t b)
+{
+    size_t hole = b;
+    size_t j    = b;
+    for (;;)
+    {
+        j = (j + 1) & INDEX_MASK;
+        if (t.index[j] == 0) break;
+        const size_t home = _home(t.hot[t.index[j] - 1].nodeId);
+        // Move j into the hole unless its home lies cyclically in (hole, j].
+        const bool homeBetween = (hole <= j) ? (home > hole && home <= j)
+                                             : (home > hole || home <= j);
+        if (!homeBetween)
+        {
+            t.index[hole] = t.index[j];
+            hole = j;
+        }
+    }
+    t.index[hole] = 0;
+}
+
+// ── Lookup ────────────────────────────────────────────────────────────────
+
+int mc_neighborFind(const McNeighborTable& t, uint32_t nodeId)
+{
+    const size_t b = _probe(t, nodeId);
+    return t.index[b] ? static_cast<int>(t.index[b] - 1) : -1;
+}
+
+// ── Upsert ────────────────────────────────────────────────────────────────
+
+size_t mc_neighborUpsert(McNeighborTable& t, uint32_t nodeId, uint32_t now,
+                         bool* created, uint32_t* evictedId)
+{
+    size_t b = _probe(t, nodeId);
+    if (t.index[b] != 0)
+    {
+        const size_t slot = t.index[b] - 1;
+        t.hot[slot].lastSeen = now;
+        if (created) *created = false;
+        return slot;
+    }
+
+    size_t slot;
+    if (t.count < MC_NEIGHBOR_MAX)
+    {
+        slot = t.count++;
+    }
+    else
+    {
+        // Full: recycle the least-recently-seen slot.  Ages are computed
+        // as now - lastSeen so a tick-counter wrap does not invert the order.
+        slot = 0;
+        uint32_t oldestAge = 0;
+        for (size_t i = 0; i < MC_NEIGHBOR_MAX; i++)
+        {
+            const uint32_t age = now - t.hot[i].lastSeen;
+            if (age > oldestAge) { oldestAge = age; slot = i; }
+        }
+        if (evictedId) *evictedId = t.hot[slot].nodeId;
+        _indexErase(t, _probe(t, t.hot[slot].nodeId));
+        t.evictions++;
+        b = _probe(t, nodeId);   // the erase may have shifted our empty bucket
+    }
+
+    // Cold blocks keep the previous occupant's bytes; flags == 0 hides them.
+    McNeighborHot& h = t.hot[slot];
+    h          = {};
+    h.nodeId   = nodeId;
+    h.lastSeen = now;
+    t.index[b] = static_cast<uint16_t>(slot + 1);
+    if (created) *created = true;
+    return slot;
+}
+
+// ── Remove / clear ────────────────────────────────────────────────────────
+
+bool mc_neighborRemove(McNeighborTable& t, uint32_t nodeId)
+{
+    const size_t b = _probe(t, nodeId);
+    if (t.index[b] == 0) return false;
+
+    const size_t slot = t.index[b] - 1;
+    _indexErase(t, b);
+
+    // Keep slots dense: move the last one into the vacated slot.
+    const size_t last = t.count - 1;
+    if (slot != last)
+    {
+        t.index[_probe(t, t.hot[last].nodeId)] = static_cast<uint16_t>(slot + 1);
+        t.hot[slot]    = t.hot[last];
+        t.user[slot]   = t.user[last];
+        t.pos[slot]    = t.pos[last];
+        t.status[slot] = t.status[last];
+        memcpy(t.key[slot], t.key[last], sizeof(t.key[slot]));
+    }
+    t.hot[last] = {};
+    t.count--;
+    return true;
+}
+
+void mc_neighborClear(McNeighborTable& t)
+{
+    for (size_t i = 0; i < t.count; i++) t.hot[i] = {};
+    for (size_t i = 0; i < MC_NEIGHBOR_INDEX_SIZE; i++) t.index[i] = 0;
+    t.count     = 0;
+    t.evictions = 0;
+}
+
+// ── Guarded updates ───────────────────────────────────────────────────────
+
+namespace {
+
+// One guarded section: body runs between enter/exit and its byte count is
+// folded into the result.
+template <typename F>
+void _section(const McNeighborGuard& g, McNeighborResult& r, size_t bytes, F&& body)
+{
+    if (g.enter) g.enter(g.ctx);
+    body();
+    if (g.exit) g.exit(g.ctx);
+    r.bytesCopied += bytes;
+    if (bytes > r.maxSection) r.maxSection = bytes;
+    r.sections++;
+}
+
+// McNeighborIdentity has no padding (asserted in the header), so a byte
+// compare is a field compare.
+bool _same(const McNeighborIdentity& a, const McNeighborIdentity& b)
+{
+    return memcmp(&a, &b, sizeof(a)) == 0;
+}
+
+bool _same(const McNeighborStatus& a, const McNeighborStatus& b)
+{
+    return a.uptimeSec       == b.uptimeSec
+        && a.isMqttConnected == b.isMqttConnected
+        && a.isRouter        == b.isRouter;
+}
+
+McNeighborIdentity _packIdentity(const MeshUser& u)
+{
+    McNeighborIdentity id;
+    memcpy(id.id,        u.id,        sizeof(id.id));
+    memcpy(id.longName,  u.longName,  sizeof(id.longName));
+    memcpy(id.shortName, u.shortName, sizeof(id.shortName));
+    memcpy(id.macaddr,   u.macaddr,   sizeof(id.macaddr));
+    id.hasMacaddr      = u.hasMacaddr;
+    id.isLicensed      = u.isLicensed;
+    id.isUnmessageable = u.isUnmessageable;
+    id.role            = u.role;
+    id.hwModel         = u.hwModel;
+    return id;
+}
+
+McNeighborPos _packPosition(const MeshPosition& p, uint32_t now)
+{
+    McNeighborPos c;
+    c.lat_i      = p.lat_i;
+    c.lon_i      = p.lon_i;
+    c.alt_m      = p.alt_m;
+    c.sats       = p.sats;
+    c.speed_cm_s = p.speed_cm_s;
+    c.track_x100 = p.track_x100;
+    c.unixTime   = p.unixTime;
+    c.lastSeen   = now;
+    return c;
+}
+
+} // namespace
+
+McNeighborResult mc_neighborApply(McNeighborTable& t, uint32_t nodeId, uint32_t now,
+                                  const McNeighborUpdate& u, const McNeighborGuard& g)
+{
+    McNeighborResult r;
+
+    // ── Hot record ────────────────────────────────────────────────────────
+    _section(g, r, sizeof(McNeighborHot), [&] {
+        r.slot = mc_neighborUpsert(t, nodeId, now, &r.created, &r.evictedId);
+        t.hot[r.slot].rssi = u.rssi;
+        t.hot[r.slot].snr  = u.snr;
+    });
+    const size_t slot  = r.slot;
+    // Single writer: nothing else changes flags between our sections.
+    const uint8_t flags = t.hot[slot].flags;
+
+    // ── Position ──────────────────────────────────────────────────────────
+    // Always rewritten: lastSeen inside the block moves on every update.
+    if (u.pos)
+    {
+        const McNeighborPos p = _packPosition(*u.pos, now);
+        _section(g, r, sizeof(p), [&] {
+            t.pos[slot] = p;
+            t.hot[slot].flags |= MC_NB_POS;
+        });
+    }
+
+    // ── Identity ──────────────────────────────────────────────────────────
+    if (u.user)
+    {
+        const McNeighborIdentity id = _packIdentity(*u.user);
+        if (!(flags & MC_NB_USER) || !_same(t.user[slot], id))
+            _section(g, r, sizeof(id), [&] {
+                t.user[slot] = id;
+                t.hot[slot].flags |= MC_NB_USER;
+            });
+    }
+
+    // ── Public key ────────────────────────────────────────────────────────
+    const uint8_t* key = u.publicKey ? u.publicKey
+                       : (u.user && u.user->hasPublicKey) ? u.user->publicKey
+                       : nullptr;
+    if (key)
+    {
+        const bool had = flags & MC_NB_KEY;
+        if (!had || memcmp(t.key[slot], key, 32) != 0)
+        {
+            r.keyChanged = had;
+            _section(g, r, 32, [&] {
+                memcpy(t.key[slot], key, 32);
+                t.hot[slot].flags |= MC_NB_KEY;
+            });
+        }
+    }
+    else if (u.user && (flags & MC_NB_KEY))
+    {
+        // NodeInfo without a key (licensed mode) — forget the old one.
+        r.keyChanged = true;
+        _section(g, r, 0, [&] { t.hot[slot].flags &= ~MC_NB_KEY; });
+    }
+
+    // ── Node status ───────────────────────────────────────────────────────
+    if (u.status)
+    {
+        McNeighborStatus s;
+        s.uptimeSec       = u.status->uptimeSec;
+        s.isMqttConnected = u.status->isMqttConnected;
+        s.isRouter        = u.status->isRouter;
+        if (!(flags & MC_NB_STATUS) || !_same(t.status[slot], s))
+            _section(g, r, sizeof(s), [&] {
+                t.status[slot] = s;
+                t.hot[slot].flags |= MC_NB_STATUS;
+            });
+    }
+
+    return r;
+}
+
+// ── Readers ───────────────────────────────────────────────────────────────
+
+bool mc_neighborPosition(const McNeighborTable& t, size_t slot, MeshPosition& out)
+{
+    if (slot >= t.count || !(t.hot[slot].flags & MC_NB_POS)) return false;
+    const McNeighborHot& h = t.hot[slot];
+    const McNeighborPos& p = t.pos[slot];
+    out            = {};
+    out.fromNode   = h.nodeId;
+    out.lat_i      = p.lat_i;
+    out.lon_i      = p.lon_i;
+    out.alt_m      = p.alt_m;
+    out.sats       = p.sats;
+    out.speed_cm_s = p.speed_cm_s;
+    out.track_x100 = p.track_x100;
+    out.unixTime   = p.unixTime;
+    out.lastSeen   = p.lastSeen;
+    out.rssi       = h.rssi;
+    out.snr        = h.snr;
+    out.valid      = true;
+    return true;
+}
+
+bool mc_neighborUser(const McNeighborTable& t, size_t slot, MeshUser& out)
+{
+    if (slot >= t.count) return false;
+    const McNeighborHot& h = t.hot[slot];
+    if (!(h.flags & (MC_NB_USER | MC_NB_KEY))) return false;
+    out          = {};
+    out.fromNode = h.nodeId;
+    if (h.flags & MC_NB_USER)
+    {
+        const McNeighborIdentity& id = t.user[slot];
+        memcpy(out.id,        id.id,        sizeof(out.id));
+        memcpy(out.longName,  id.longName,  sizeof(out.longName));
+        memcpy(out.shortName, id.shortName, sizeof(out.shortName));
+        memcpy(out.macaddr,   id.macaddr,   sizeof(out.macaddr));
+        out.hasMacaddr      = id.hasMacaddr;
+        out.isLicensed      = id.isLicensed;
+        out.isUnmessageable = id.isUnmessageable;
+        out.role            = id.role;
+        out.hwModel         = id.hwModel;
+    }
+    if (h.flags & MC_NB_KEY)
+    {
+        memcpy(out.publicKey, t.key[slot], 32);
+        out.hasPublicKey = true;
+    }
+    out.rssi  = h.rssi;
+    out.snr   = h.snr;
+    out.valid = true;
+    return true;
+}
+
+bool mc_neighborStatus(const McNeighborTable& t, size_t slot, MeshNodeStatus& out)
+{
+    if (slot >= t.count || !(t.hot[slot].flags & MC_NB_STATUS)) return false;
+    const McNeighborHot&    h = t.hot[slot];
+    const McNeighborStatus& s = t.status[slot];
+    out                 = {};
+    out.fromNode        = h.nodeId;
+    out.uptimeSec       = s.uptimeSec;
+    out.isMqttConnected = s.isMqttConnected;
+    out.isRouter        = s.isRouter;
+    out.rssi            = h.rssi;
+    out.snr             = h.snr;
+    out.valid           = true;
+    return true;
+}
@@ -0,0 +1,194 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * mesh_neighbors.h — platform-free neighbour table keyed by node id.
+ *
+ * Structure-of-arrays layout.  Each slot is split into a 16-byte hot record
+ * (node id, lastSeen, last RSSI/SNR, presence flags) and separate cold
+ * blocks for identity, public key, position and node status.  Lookups, LRU
+ * scans and most updates touch only the hot array; a cold block is written
+ * only when its packet type arrives and its contents actually changed.
+ *
+ * Slots are dense (0 .. count-1 are always occupied) and found through an
+ * open-addressing index: linear probing over a power-of-two table at most
+ * half full, with backward-shift deletion so no tombstones accumulate under
+ * churn.  When the table is full, inserting a new node recycles the slot
+ * with the oldest lastSeen (wrap-safe tick comparison) — an O(capacity)
+ * scan over the hot array that only runs on a miss against a full table.
+ *
+ * A recycled slot's cold blocks are not cleared; they are hidden by the
+ * hot flags until rewritten, so eviction copies 16 bytes, not a whole entry.
+ *
+ * Capacity is MC_NEIGHBOR_MAX, set from CONFIG_MESH_NEIGHBOR_MAX by
+ * main/CMakeLists.txt so every translation unit sees the same layout.
+ *
+ * Concurrency: one writer (the LoRa task) and any number of readers.
+ * mc_neighborApply brackets each hot/cold write with a caller-supplied
+ * guard (LoRa passes its portMUX critical section) and does all packing and
+ * change detection outside it.  Readers hold the same lock for one
+ * find/get at a time.
+ */
+
+#pragma once
+
+#include "mesh_codec.h"
+#include <cstdint>
+#include <cstddef>
+
+#ifndef MC_NEIGHBOR_MAX
+#  define MC_NEIGHBOR_MAX 64
+#endif
+
+static_assert(MC_NEIGHBOR_MAX >= 1 && MC_NEIGHBOR_MAX <= 1024,
+              "MC_NEIGHBOR_MAX out of range");
+
+/// Open-addressing index size: smallest power of two ≥ 2 × MC_NEIGHBOR_MAX.
+static constexpr size_t MC_NEIGHBOR_INDEX_SIZE = [] {
+    size_t n = 1;
+    while (n < 2 * static_cast<size_t>(MC_NEIGHBOR_MAX)) n <<= 1;
+    return n;
+}();
+
+/// McNeighborHot::flags — which cold blocks hold data for this node.
+enum : uint8_t {
+    MC_NB_POS    = 0x01,
+    MC_NB_USER   = 0x02,
+    MC_NB_KEY    = 0x04,
+    MC_NB_STATUS = 0x08,
+};
+
+struct McNeighborHot {
+    uint32_t nodeId   = 0;
+    uint32_t lastSeen = 0;    ///< tick of the last update from this node (LRU key)
+    float    snr      = 0.f;  ///< of the last update
+    int16_t  rssi     = 0;
+    uint8_t  flags    = 0;    ///< MC_NB_*
+};
+static_assert(sizeof(McNeighborHot) == 16, "hot record should stay 16 bytes");
+
+/// MeshUser minus the key, RSSI/SNR and bookkeeping (those live elsewhere).
+struct McNeighborIdentity {
+    char     id[12]          = {};
+    char     longName[33]    = {};
+    char     shortName[5]    = {};
+    uint8_t  macaddr[6]      = {};
+    bool     hasMacaddr      = false;
+    bool     isLicensed      = false;
+    bool     isUnmessageable = false;
+    uint8_t  role            = 0;
+    uint32_t hwModel         = 0;
+};
+static_assert(sizeof(McNeighborIdentity) == 64, "identity block must have no padding");
+
+struct McNeighborPos {
+    int32_t  lat_i      = 0;
+    int32_t  lon_i      = 0;
+    int32_t  alt_m      = 0;
+    uint32_t sats       = 0;
+    uint32_t speed_cm_s = 0;
+    uint32_t track_x100 = 0;
+    uint32_t unixTime   = 0;
+    uint32_t lastSeen   = 0;  ///< tick of the last position update
+};
+
+struct McNeighborStatus {
+    uint32_t uptimeSec       = 0;
+    bool     isMqttConnected = false;
+    bool     isRouter        = false;
+};
+
+struct McNeighborTable {
+    McNeighborHot      hot[MC_NEIGHBOR_MAX]     = {};
+    McNeighborIdentity user[MC_NEIGHBOR_MAX]    = {};
+    uint8_t            key[MC_NEIGHBOR_MAX][32] = {};
+    McNeighborPos      pos[MC_NEIGHBOR_MAX]     = {};
+    McNeighborStatus   status[MC_NEIGHBOR_MAX]  = {};
+    uint16_t   index[MC_NEIGHBOR_INDEX_SIZE] = {}; ///< slot + 1; 0 = empty bucket
+    size_t     count     = 0;
+    uint32_t   evictions = 0;   ///< LRU evictions since the last clear
+};
+
+// ── Slot-level operations ─────────────────────────────────────────────────
+
+/// Slot holding nodeId, or -1 if absent.
+int mc_neighborFind(const McNeighborTable& t, uint32_t nodeId);
+
+/**
+ * Find or create the slot for nodeId and stamp hot.lastSeen = now.
+ *
+ * A new slot starts with flags == 0.  When the table is full the
+ * least-recently-seen slot is recycled; its node id is reported through
+ * evictedId (if non-null, else left untouched) so the caller can drop state
+ * keyed on it.
+ *
+ * @param created  Set to true when the node was not present before.
+ */
+size_t mc_neighborUpsert(McNeighborTable& t, uint32_t nodeId, uint32_t now,
+                         bool* created = nullptr, uint32_t* evictedId = nullptr);
+
+/// Remove nodeId.  Returns false if it was not present.
+bool mc_neighborRemove(McNeighborTable& t, uint32_t nodeId);
+
+/// Drop every entry and reset the eviction counter.
+void mc_neighborClear(McNeighborTable& t);
+
+// ── Guarded updates ───────────────────────────────────────────────────────
+
+/// Brackets one table write.  Null function pointers mean no locking.
+struct McNeighborGuard {
+    void (*enter)(void* ctx) = nullptr;
+    void (*exit)(void* ctx)  = nullptr;
+    void* ctx                = nullptr;
+};
+
+/// One received packet's worth of neighbour data.  nullptr = no update.
+struct McNeighborUpdate {
+    int16_t               rssi      = 0;
+    float                 snr       = 0.f;
+    const MeshPosition*   pos       = nullptr;
+    const MeshUser*       user      = nullptr; ///< identity; key too if user->hasPublicKey, else the key is dropped
+    const uint8_t*        publicKey = nullptr; ///< key-only update (KEY_VERIFICATION_APP), identity untouched
+    const MeshNodeStatus* status    = nullptr;
+};
+
+struct McNeighborResult {
+    size_t   slot        = 0;
+    uint32_t evictedId   = 0;     ///< node pushed out to make room, 0 if none
+    bool     created     = false;
+    bool     keyChanged  = false; ///< a previously held key was replaced or dropped
+    size_t   bytesCopied = 0;     ///< bytes written into the table
+    size_t   maxSection  = 0;     ///< largest write made inside one guard section
+    uint8_t  sections    = 0;     ///< guard enter/exit pairs taken
+};
+
+/**
+ * Apply u to nodeId's slot: one guarded section for the hot record, then
+ * one per cold block that changed.  Must only be called from the single
+ * writer — it reads the table unguarded to detect unchanged blocks.
+ */
+McNeighborResult mc_neighborApply(McNeighborTable& t, uint32_t nodeId, uint32_t now,
+                                  const McNeighborUpdate& u,
+                                  const McNeighborGuard& g = {});
+
+// ── Readers (caller holds the writer's lock) ──────────────────────────────
+
+/// Rebuild the decoded structs for slot.  Return false when slot ≥ count or
+/// the block has never been written for this node (out is then left as-is).
+bool mc_neighborPosition(const McNeighborTable& t, size_t slot, MeshPosition& out);
+bool mc_neighborUser(const McNeighborTable& t, size_t slot, MeshUser& out);
+bool mc_neighborStatus(const McNeighborTable& t, size_t slot, MeshNodeStatus& out);
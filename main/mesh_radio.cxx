@@ -0,0 +1,374 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * mesh_radio.cxx — LoRa radio core (see mesh_radio.h).
+ */
+
+#include "mesh_radio.h"
+#include "mesh_codec.h"
+#include "sx1262_defs.h"
+
+static inline uint32_t _le32(const uint8_t* p)
+{
+    return p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+MeshRadio::MeshRadio(SxBus& bus, const MeshRadioConfig& cfg)
+:   _bus(bus)
+,   _radioCfg(cfg)
+,   _slotMs(mc_relaySlotTimeMs(cfg.sf, cfg.bwHz))
+{
+    mc_dedupInit(_dedup, cfg.dedupWindowMs);
+}
+
+uint32_t MeshRadio::_airtimeMs(uint8_t len) const
+{
+    return (mc_airtimeUs(_radioCfg.sf, _radioCfg.bwHz, _radioCfg.cr,
+                         _radioCfg.preambleLen, _radioCfg.ldro, len) + 999u) / 1000u;
+}
+
+void MeshRadio::_radioStart(uint32_t nowMs)
+{
+    _txPhase = TxPhase::Idle;
+    mc_airtimeInit(_airtime, nowMs);
+    sx_setRx(_bus);
+}
+
+// ── Wakeup ────────────────────────────────────────────────────────────────
+// While a CAD scan runs or a frame is on the air, DIO1 carries CAD_DONE /
+// TX_DONE; the IRQ status is re-read every TX_POLL_MS in case its edge was
+// missed.  Otherwise the loop sleeps until a queued relay or the held
+// frame's backoff is due.
+uint32_t MeshRadio::_radioWaitMs(uint32_t nowMs) const
+{
+    if (_txOwnsRadio()) return TX_POLL_MS;
+
+    uint32_t wait = IDLE_WAIT_MS;
+    const uint32_t relayWait = mc_relayNextDue(_relay, nowMs);
+    if (relayWait < wait) wait = relayWait;
+    if (_txPhase == TxPhase::Backoff)
+    {
+        const uint32_t left = static_cast<int32_t>(_txResume - nowMs) > 0
+                            ? _txResume - nowMs : 0;
+        if (left < wait) wait = left;
+    }
+    else if (_txq.depth > 0)
+    {
+        wait = 0;
+    }
+    return wait;
+}
+
+bool MeshRadio::_radioService(uint32_t nowMs)
+{
+    // IRQ, RX buffer and packet status plus ClearIrq in one batch; the
+    // buffer and packet fields are only meaningful after RX_DONE or a
+    // header/CRC error, which is the only time they are used.
+    const SxStatus st  = sx_readStatus(_bus);
+    const uint16_t irq = st.irq;
+
+    EventInfo info;
+    info.irq  = irq;
+    info.rssi = st.rssi;
+    info.snr  = st.snr;
+
+    // Not routed to DIO1, but latched in GetIrqStatus.
+    if (irq & IRQ_PREAMBLE_DET) _onRadioEvent(Event::Preamble, info);
+    if (irq & IRQ_HEADER_VALID) _onRadioEvent(Event::HeaderValid, info);
+
+    // A preamble or valid header with no end-of-packet event yet means
+    // someone is mid-frame: LBT treats the channel as busy.
+    const bool rxBusy = (irq & (IRQ_PREAMBLE_DET | IRQ_HEADER_VALID))
+                     && !(irq & IRQ_RX_DIO1);
+
+    // DIO1 is mapped to TX_DONE | TIMEOUT while a frame is on the air,
+    // and to CAD_DONE while the channel is being scanned.
+    if (_txPhase == TxPhase::Air)
+    {
+        if (irq & IRQ_TX_MASK)
+            _finishTx(irq, nowMs);
+        else if (nowMs - _txStarted >= TX_DEADLINE_MS)
+            _finishTx(0, nowMs);
+    }
+    else if (_txPhase == TxPhase::Cad)
+    {
+        if (irq & IRQ_CAD_DONE)
+        {
+            _onCadDone(irq & IRQ_CAD_DETECTED, nowMs);
+        }
+        else if (nowMs - _txStarted >= CAD_DEADLINE_MS)
+        {
+            // No verdict from the chip — send rather than hold the queue.
+            info.ms = nowMs - _txStarted;
+            _onRadioEvent(Event::CadDeadline, info);
+            _startTx(nowMs);
+        }
+    }
+    else if (irq & IRQ_RX_DONE)
+    {
+        mc_airtimeNoteRx(_airtime, nowMs, _airtimeMs(st.payloadLen));
+        info.len = st.payloadLen;
+
+        // The SX1262 sets BOTH RX_DONE and CRC_ERROR for a packet that
+        // completed but failed the LoRa CRC; AES-CTR would "decrypt" it
+        // into garbage without complaint.
+        if (irq & IRQ_CRC_ERROR)
+        {
+            info.flag = true;
+            _onRadioEvent(Event::CrcError, info);
+        }
+        else
+        {
+            _onRadioEvent(Event::RxPacket, info);
+            if (st.payloadLen > 0)
+            {
+                uint8_t* payload = _rxSlot();
+                sx_readBuffer(_bus, st.rxPtr, st.payloadLen, payload);
+                _onRxFrame(payload, st.payloadLen, st.rssi, st.snr, nowMs);
+            }
+        }
+    }
+    else if (irq & IRQ_HEADER_ERR)
+    {
+        mc_airtimeNoteRx(_airtime, nowMs, _airtimeMs(0));
+        _onRadioEvent(Event::HeaderError, info);
+    }
+    else if (irq & IRQ_CRC_ERROR)
+    {
+        _onRadioEvent(Event::CrcError, info);
+    }
+    else if (irq & IRQ_TIMEOUT)
+    {
+        _onRadioEvent(Event::RxTimeout, info);
+    }
+    // else: idle wakeup — just re-enter RX
+
+    // Each completed minute feeds the measured channel utilisation into the
+    // LBT backoff base, alongside the CAD results it gathers itself.
+    if (mc_airtimeAdvance(_airtime, nowMs))
+    {
+        mc_lbtNoteUtilisation(_lbt, static_cast<uint8_t>(
+            mc_airtimeChannelPermille(_airtime, nowMs) / 10));
+        _onRadioEvent(Event::AirtimeRolled, EventInfo());
+    }
+
+    // Re-enter RX — required after every RX_DONE or error.  Not while a
+    // frame is arriving: the chip is plainly in RX and SetRx would restart
+    // it mid-packet.
+    if (!_txOwnsRadio() && !rxBusy)
+        sx_setRx(_bus);
+
+    return rxBusy;
+}
+
+// ── Transmit ──────────────────────────────────────────────────────────────
+// One frame at a time: the next one is popped after _finishTx() has put
+// the chip back in RX, so receptions get a look-in between our
+// transmissions.
+//
+// Duty cycle: near the limit, NodeInfo and background frames are dropped
+// as they come off the queue; any frame that would overrun it is held
+// until the ledger frees enough airtime.
+void MeshRadio::_pumpTx(bool rxBusy, uint32_t nowMs)
+{
+    if (_txOwnsRadio()) return;
+
+    EventInfo info;
+    if (_txPhase == TxPhase::Backoff)
+    {
+        if (static_cast<int32_t>(nowMs - _txResume) < 0) return;
+    }
+    else
+    {
+        McTxPriority prio;
+        while (true)
+        {
+            _txLen = mc_txqPop(_txq, nowMs, _txFrame, &prio);
+            if (_txLen == 0) return;
+            if (prio < McTxPriority::NodeInfo ||
+                mc_airtimeAllows(_airtime, nowMs, _airtimeMs(_txLen),
+                                 _radioCfg.dutyPct, /*periodic=*/true))
+                break;
+
+            info.prio = prio;
+            _onRadioEvent(Event::DutyDropped, info);
+        }
+        info.prio = prio;
+        info.len  = _txLen;
+        _onRadioEvent(Event::TxDequeued, info);
+    }
+
+    if (!mc_airtimeAllows(_airtime, nowMs, _airtimeMs(_txLen),
+                          _radioCfg.dutyPct, /*periodic=*/false))
+    {
+        info.ms = mc_airtimeNextReleaseMs(_airtime, nowMs);
+        _onRadioEvent(Event::DutyHeld, info);
+        _txPhase  = TxPhase::Backoff;
+        _txResume = nowMs + info.ms;
+        return;
+    }
+
+    // A frame arriving right now is as good as a CAD hit, and cheaper.
+    if (!_radioCfg.lbt)
+        _startTx(nowMs);
+    else if (rxBusy)
+        _onCadDone(true, nowMs);
+    else
+        _startCad(nowMs);
+}
+
+// CAD_DONE (with CAD_DETECTED if a preamble or payload chirps were seen)
+// arrives on DIO1 and is handled by _onCadDone().
+void MeshRadio::_startCad(uint32_t nowMs)
+{
+    sx_startCad(_bus, _radioCfg.sf);
+    _txPhase   = TxPhase::Cad;
+    _txStarted = nowMs;
+}
+
+// Clear channel (or too many busy scans in a row): transmit.  Busy: return
+// to RX for a random number of contention slots, sized by mc_lbtOnCad from
+// recent channel utilisation, then scan again from _pumpTx().
+void MeshRadio::_onCadDone(bool busy, uint32_t nowMs)
+{
+    EventInfo info;
+    info.flag = busy;
+    info.lbt  = mc_lbtOnCad(_lbt, busy, _slotMs, _radioRandom());
+    _onRadioEvent(Event::CadResult, info);
+
+    if (info.lbt.transmit)
+    {
+        _startTx(nowMs);
+        return;
+    }
+
+    // After a CAD scan the chip sits in STBY_RC; without one (rxBusy) it
+    // never left RX and must not be disturbed.
+    if (_txPhase == TxPhase::Cad)
+    {
+        sx_setRxIrq(_bus);
+        sx_setRx(_bus);
+    }
+    _txPhase  = TxPhase::Backoff;
+    _txResume = nowMs + info.lbt.backoffMs;
+}
+
+// Completion arrives as TX_DONE (or the chip's own TIMEOUT) on DIO1.  A
+// rising edge can still be missed if DIO1 never dropped before SetTx; the
+// loop therefore re-reads the status every TX_POLL_MS, and gives up after
+// TX_DEADLINE_MS.
+void MeshRadio::_startTx(uint32_t nowMs)
+{
+    sx_startTx(_bus, _radioCfg.freqHz, _txFrame, _txLen, TX_HW_TIMEOUT);
+    _txPhase   = TxPhase::Air;
+    _txStarted = nowMs;
+
+    // Book the airtime now: once SetTx is issued the chip is on the air,
+    // whether or not TX_DONE arrives.
+    mc_airtimeNoteTx(_airtime, nowMs, _airtimeMs(_txLen));
+
+    EventInfo info;
+    info.len = _txLen;
+    _onRadioEvent(Event::TxStarted, info);
+}
+
+void MeshRadio::_finishTx(uint16_t irq, uint32_t nowMs)
+{
+    _txPhase = TxPhase::Idle;
+
+    EventInfo info;
+    info.irq = irq;
+    info.len = _txLen;
+    info.ms  = nowMs - _txStarted;
+    if (!(irq & IRQ_TX_DONE))
+        info.errs = sx_getDeviceErrors(_bus);
+
+    sx_endTx(_bus);
+
+    if (irq & IRQ_TX_DONE)
+    {
+        _onRadioEvent(Event::TxDone, info);
+        sx_setRx(_bus);
+        return;
+    }
+
+    _onRadioEvent(Event::TxFailed, info);
+    _radioReset();
+    sx_setRx(_bus);
+}
+
+// ── Relay ─────────────────────────────────────────────────────────────────
+// Frames were queued by _admitRx with hop_limit already decremented; they
+// go out byte-for-byte otherwise.  Still encrypted, so the priority comes
+// from the destination alone.
+void MeshRadio::_sendDueRelays(uint32_t nowMs)
+{
+    uint8_t frame[255];
+    while (const uint8_t len = mc_relayPop(_relay, nowMs, frame))
+    {
+        EventInfo info;
+        info.pktId = _le32(frame + 8);
+        info.hop   = frame[12] & 0x07;
+        const bool ok = mc_txqPush(_txq, frame, len,
+                                   mc_txPriorityFor(0, _le32(frame) != MESH_BROADCAST),
+                                   nowMs);
+        _onRadioEvent(ok ? Event::Relayed : Event::RelayRefused, info);
+    }
+}
+
+// ── Receive admission ─────────────────────────────────────────────────────
+// Rebroadcasts of a flooded packet keep arriving for minutes; any (from, id)
+// already handled within the dedup window is dropped.  A duplicate is
+// another node's rebroadcast: if ours is still waiting out its contention
+// delay, that node has covered the area.
+//
+// A new frame from another node is queued for relay as received — still
+// encrypted — before any decrypt attempt, so channels we hold no key for
+// and PKC DMs to other nodes are relayed too.  Weak packets get shorter
+// delays (Meshtastic getTxDelayMsecWeighted).
+MeshRadio::RxAdmit MeshRadio::_admitRx(const uint8_t* buf, uint8_t len, float snr,
+                                       uint32_t self, uint32_t nowMs)
+{
+    if (len < MESH_HDR + 1) return RxAdmit::Short;
+
+    EventInfo info;
+    info.from  = _le32(buf + 4);
+    info.pktId = _le32(buf + 8);
+
+    const McDedupResult seen = mc_dedupCheck(_dedup, info.from, info.pktId, nowMs);
+    if (seen != McDedupResult::New)
+    {
+        info.flag      = seen == McDedupResult::Exact;
+        info.cancelled = mc_relayCancel(_relay, info.from, info.pktId);
+        _onRadioEvent(Event::Duplicate, info);
+        return RxAdmit::Duplicate;
+    }
+
+    if (info.from == self) return RxAdmit::OwnEcho;
+
+    if (_radioCfg.relay && mc_relayShouldForward(buf, len, self, _radioCfg.role))
+    {
+        info.ms  = mc_relayDelayMs(snr, _radioCfg.role, _slotMs, _radioRandom());
+        info.hop = static_cast<uint8_t>((buf[12] & 0x07) - 1);   // after the decrement
+        _onRadioEvent(mc_relaySchedule(_relay, buf, len, self, nowMs + info.ms)
+                          ? Event::RelayScheduled : Event::RelayDropped,
+                      info);
+    }
+    return RxAdmit::Accept;
+}
@@ -0,0 +1,203 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * mesh_radio.h — the LoRa task's radio core: wakeup timing, IRQ dispatch,
+ * the listen-before-talk transmit state machine and receive admission.
+ *
+ * One wakeup of the run loop, in order:
+ *
+ *   _radioWaitMs()   how long the loop may sleep: TX_POLL_MS while a CAD
+ *                    scan or frame is in flight, else until the next relay
+ *                    or backoff is due, 0 with frames queued, at most
+ *                    IDLE_WAIT_MS
+ *   _radioService()  one status batch (sx_readStatus), then TX_DONE /
+ *                    TIMEOUT, CAD_DONE, RX_DONE, HEADER_ERR, CRC_ERROR and
+ *                    the TX_DEADLINE_MS / CAD_DEADLINE_MS backstops; rolls
+ *                    the airtime ledger into LBT; re-enters RX
+ *   _sendDueRelays() rebroadcasts whose contention delay has run out → TX queue
+ *   _pumpTx()        mc_txqueue → duty cycle → CAD → mc_lbt backoff → SetTx
+ *
+ * and for every good frame the owner calls _admitRx() before decrypting:
+ * length check, mc_dedup (a duplicate cancels our pending relay), own echo,
+ * mc_relay scheduling.
+ *
+ * The owner supplies the SX1262 as an SxBus, random numbers, the buffer a
+ * payload is read into and a reset for a radio that failed to transmit.
+ * Counting and logging are the owner's too: every outcome is reported
+ * through _onRadioEvent().  LoRa is one owner; the host-side mesh
+ * simulator's nodes are the other, so both run this code.
+ *
+ * Times are milliseconds on a free-running uint32_t clock.  Not
+ * thread-safe; LoRa uses it from its task only.
+ */
+
+#pragma once
+
+#include "mesh_airtime.h"
+#include "mesh_dedup.h"
+#include "mesh_lbt.h"
+#include "mesh_relay.h"
+#include "mesh_txqueue.h"
+#include "sx1262_batch.h"
+#include <cstdint>
+
+/// Modem and policy settings; LoRa fills them from Kconfig.
+struct MeshRadioConfig {
+    uint32_t freqHz        = 0;         ///< SetRfFrequency before every TX
+    uint8_t  sf            = 11;        ///< LongFast
+    uint32_t bwHz          = 250000;
+    uint8_t  cr            = 1;         ///< 4/5
+    uint16_t preambleLen   = 16;
+    bool     ldro          = false;
+    uint8_t  dutyPct       = 100;       ///< CONFIG_LORA_DUTY_CYCLE_PCT
+    uint8_t  role          = 0;         ///< DeviceRole, for relay decisions
+    bool     relay         = true;      ///< schedule rebroadcasts (TX enabled)
+    bool     lbt           = true;      ///< CAD before every frame
+    uint32_t dedupWindowMs = 600000;    ///< CONFIG_MESH_DEDUP_WINDOW_SEC
+};
+
+class MeshRadio
+{
+public:
+    static constexpr uint32_t TX_HW_TIMEOUT   = 320000; ///< SetTx timeout, 15.625 µs units (5 s)
+    static constexpr uint32_t TX_DEADLINE_MS  = 6000;   ///< software backstop past TX_HW_TIMEOUT
+    static constexpr uint32_t TX_POLL_MS      = 250;    ///< IRQ re-read interval while CAD / TX runs
+    static constexpr uint32_t CAD_DEADLINE_MS = 500;    ///< CAD_DONE backstop (SF12 scan ≈ 70 ms)
+    static constexpr uint32_t IDLE_WAIT_MS    = 30000;  ///< longest sleep; re-enters RX if DIO1 was missed
+
+    enum class TxPhase : uint8_t {
+        Idle,       ///< radio in RX, no frame held
+        Cad,        ///< CAD scan running for _txFrame
+        Backoff,    ///< radio in RX, _txFrame waits for _txResume
+        Air,        ///< _txFrame is being transmitted
+    };
+
+    /// _admitRx() verdict.
+    enum class RxAdmit : uint8_t {
+        Accept,     ///< new frame from another node: decrypt and dispatch
+        Short,      ///< no payload behind the header
+        Duplicate,  ///< (from, id) already seen; reported as Event::Duplicate
+        OwnEcho,    ///< our own frame rebroadcast by a neighbour
+    };
+
+    /// Outcomes reported to _onRadioEvent().  The EventInfo fields each one
+    /// fills are listed alongside.
+    enum class Event : uint8_t {
+        Preamble,       ///< PREAMBLE_DET seen (irq)
+        HeaderValid,    ///< HEADER_VALID seen (irq)
+        RxPacket,       ///< RX_DONE with good CRC; len may be 0 (irq, len, rssi, snr)
+        CrcError,       ///< CRC_ERROR; flag = with RX_DONE (irq, len, rssi, snr)
+        HeaderError,    ///< HEADER_ERR (irq, rssi, snr)
+        RxTimeout,      ///< TIMEOUT while receiving (irq)
+        TxStarted,      ///< SetTx issued (len)
+        TxDone,         ///< TX_DONE (len, ms = time on the air)
+        TxFailed,       ///< no TX_DONE; irq 0 = TX_DEADLINE_MS hit (irq, errs, len, ms).
+                        ///< _radioReset() follows.
+        CadDeadline,    ///< no CAD_DONE within CAD_DEADLINE_MS; transmitting (ms)
+        CadResult,      ///< LBT verdict; flag = channel busy (lbt)
+        TxDequeued,     ///< frame taken from the TX queue (prio, len)
+        DutyDropped,    ///< NodeInfo-or-lower frame dropped over the duty budget (prio)
+        DutyHeld,       ///< frame held for the duty cycle (ms = hold)
+        AirtimeRolled,  ///< airtime ledger completed a minute; LBT fed
+        Duplicate,      ///< already seen; flag = exact, not Bloom (from, pktId, cancelled = our relay dropped)
+        RelayScheduled, ///< rebroadcast queued (pktId, hop, ms = delay)
+        RelayDropped,   ///< relay queue full (pktId)
+        Relayed,        ///< due rebroadcast moved to the TX queue (pktId, hop)
+        RelayRefused,   ///< TX queue refused a due rebroadcast (pktId)
+    };
+
+    struct EventInfo {
+        uint16_t      irq       = 0;
+        uint16_t      errs      = 0;    ///< GetDeviceErrors
+        uint32_t      ms        = 0;
+        uint32_t      from      = 0;
+        uint32_t      pktId     = 0;
+        uint8_t       len       = 0;
+        uint8_t       hop       = 0;    ///< hop_limit now in the frame
+        McTxPriority  prio      = McTxPriority::Background;
+        bool          flag      = false;
+        bool          cancelled = false;
+        McLbtDecision lbt       = { false, 0 };
+        int16_t       rssi      = 0;
+        float         snr       = 0.f;
+    };
+
+protected:
+    /// @p bus is only stored; the owner may pass a member constructed later.
+    MeshRadio(SxBus& bus, const MeshRadioConfig& cfg);
+    ~MeshRadio() = default;
+
+    // ── Owner hooks ───────────────────────────────────────────────────────
+    /// Uniformly distributed 32-bit value (LBT and relay jitter).
+    virtual uint32_t _radioRandom() = 0;
+    /// Buffer of at least 255 bytes the next payload is read into.
+    virtual uint8_t* _rxSlot() = 0;
+    /// A good frame, read into the buffer from _rxSlot().
+    virtual void     _onRxFrame(uint8_t* buf, uint8_t len, int16_t rssi, float snr,
+                                uint32_t nowMs) = 0;
+    /// Put the chip back in its boot configuration after a failed TX.
+    virtual void     _radioReset() = 0;
+    virtual void     _onRadioEvent(Event e, const EventInfo& info) { (void)e; (void)info; }
+
+    // ── Run loop ──────────────────────────────────────────────────────────
+    /// Start the airtime ledger and enter RX.
+    void     _radioStart(uint32_t nowMs);
+    /// Longest the loop may sleep before calling _radioService() again.
+    uint32_t _radioWaitMs(uint32_t nowMs) const;
+    /// Handle one wakeup.  Returns whether a reception is under way.
+    bool     _radioService(uint32_t nowMs);
+    /// Move every rebroadcast whose contention delay has elapsed to _txq.
+    void     _sendDueRelays(uint32_t nowMs);
+    /// Move the TX pipeline on when the radio is free: pop the next frame,
+    /// or end a backoff.  @p rxBusy: a reception is under way right now.
+    void     _pumpTx(bool rxBusy, uint32_t nowMs);
+    /// Screen a good frame before the app layer sees it.  @p self is this
+    /// node's id.
+    RxAdmit  _admitRx(const uint8_t* buf, uint8_t len, float snr, uint32_t self,
+                      uint32_t nowMs);
+
+    /// True while the chip is out of RX on our behalf (CAD or TX).
+    bool _txOwnsRadio() const
+    { return _txPhase == TxPhase::Cad || _txPhase == TxPhase::Air; }
+    /// Time on air of a @p len-byte frame, rounded up to ms.
+    uint32_t _airtimeMs(uint8_t len) const;
+
+    SxBus&          _bus;
+    MeshRadioConfig _radioCfg;
+    uint32_t        _slotMs;            ///< relay and LBT contention slot
+
+    McTxQueue    _txq     = {};
+    McLbt        _lbt     = {};
+    McAirtime    _airtime = {};
+    McRelayQueue _relay   = {};
+    McDedup      _dedup   = {};
+
+    TxPhase  _txPhase   = TxPhase::Idle;
+    uint32_t _txStarted = 0;            ///< SetCad / SetTx time for the current phase
+    uint32_t _txResume  = 0;            ///< Backoff: time of the next CAD scan
+    uint8_t  _txFrame[255] = {};        ///< frame popped from _txq, held through CAD / backoff
+    uint8_t  _txLen     = 0;
+
+private:
+    void _startCad(uint32_t nowMs);
+    void _onCadDone(bool busy, uint32_t nowMs);
+    void _startTx(uint32_t nowMs);
+    /// Complete the frame on the air given the IRQ status (0 = deadline hit).
+    void _finishTx(uint16_t irq, uint32_t nowMs);
+};
@@ -0,0 +1,156 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * mesh_relay.cxx — managed-flood rebroadcast queue (see mesh_relay.h).
+ */
+
+#include "mesh_relay.h"
+#include <cstring>
+
+// OTA header: [to(4), from(4), id(4), flags(1), chan(1), next_hop(1), relay_node(1)]
+static constexpr size_t  HDR_LEN        = 16;
+static constexpr size_t  OFF_FLAGS      = 12;
+static constexpr size_t  OFF_RELAY_NODE = 15;
+static constexpr uint8_t HOP_LIMIT_MASK = 0x07;
+
+static inline uint32_t _le32(const uint8_t* p)
+{
+    return p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+// Tick comparison that survives counter wrap.
+static inline bool _reached(uint32_t now, uint32_t due)
+{
+    return static_cast<int32_t>(now - due) >= 0;
+}
+
+// ── Policy ────────────────────────────────────────────────────────────────
+
+bool mc_relayRoleForwards(uint8_t role)
+{
+    return role == MC_ROLE_ROUTER || role == MC_ROLE_ROUTER_CLIENT
+        || role == MC_ROLE_REPEATER;
+}
+
+uint32_t mc_relaySlotTimeMs(uint8_t sf, uint32_t bwHz)
+{
+    // 8.5 symbols + 0.2 ms turnaround + 0.4 ms propagation + 7 ms MAC, in
+    // tenths of a millisecond, rounded to the nearest ms.
+    if (bwHz == 0) return 0;
+    const uint64_t tenths = (static_cast<uint64_t>(17) << sf) * 5000u / bwHz + 76;
+    return static_cast<uint32_t>((tenths + 5) / 10);
+}
+
+uint32_t mc_relayDelayMs(float snr, uint8_t role, uint32_t slotMs, uint32_t rnd)
+{
+    int s = static_cast<int>(snr);
+    if (s < MC_RELAY_SNR_MIN) s = MC_RELAY_SNR_MIN;
+    if (s > MC_RELAY_SNR_MAX) s = MC_RELAY_SNR_MAX;
+    const uint32_t cw = MC_RELAY_CW_MIN
+                      + (s - MC_RELAY_SNR_MIN) * (MC_RELAY_CW_MAX - MC_RELAY_CW_MIN)
+                        / (MC_RELAY_SNR_MAX - MC_RELAY_SNR_MIN);
+
+    if (role == MC_ROLE_ROUTER || role == MC_ROLE_REPEATER)
+        return (rnd % (2 * cw)) * slotMs;
+    return 2u * MC_RELAY_CW_MAX * slotMs + (rnd % (1u << cw)) * slotMs;
+}
+
+bool mc_relayShouldForward(const uint8_t* frame, size_t len,
+                           uint32_t self, uint8_t role)
+{
+    if (!frame || len <= HDR_LEN || len > 255) return false;
+    if (!mc_relayRoleForwards(role)) return false;
+    if ((frame[OFF_FLAGS] & HOP_LIMIT_MASK) == 0) return false;
+    if (_le32(frame + 4) == self) return false;       // our own packet echoed
+    if (_le32(frame) == self) return false;           // addressed to us
+    return true;
+}
+
+// ── Queue ─────────────────────────────────────────────────────────────────
+
+bool mc_relaySchedule(McRelayQueue& q, const uint8_t* frame, size_t len,
+                      uint32_t self, uint32_t due)
+{
+    if (!frame || len <= HDR_LEN || len > 255) return false;
+    if ((frame[OFF_FLAGS] & HOP_LIMIT_MASK) == 0) return false;
+
+    McRelayFrame* slot = nullptr;
+    for (McRelayFrame& f : q.slots)
+        if (f.len == 0) { slot = &f; break; }
+    if (!slot)
+    {
+        q.dropped++;
+        return false;
+    }
+
+    memcpy(slot->data, frame, len);
+    const uint8_t flags = frame[OFF_FLAGS];
+    slot->data[OFF_FLAGS]      = static_cast<uint8_t>((flags & ~HOP_LIMIT_MASK)
+                                                      | ((flags & HOP_LIMIT_MASK) - 1));
+    slot->data[OFF_RELAY_NODE] = static_cast<uint8_t>(self & 0xFF);
+    slot->len  = static_cast<uint8_t>(len);
+    slot->from = _le32(frame + 4);
+    slot->id   = _le32(frame + 8);
+    slot->due  = due;
+    q.scheduled++;
+    return true;
+}
+
+bool mc_relayCancel(McRelayQueue& q, uint32_t from, uint32_t id)
+{
+    for (McRelayFrame& f : q.slots)
+    {
+        if (f.len != 0 && f.from == from && f.id == id)
+        {
+            f.len = 0;
+            q.cancelled++;
+            return true;
+        }
+    }
+    return false;
+}
+
+uint8_t mc_relayPop(McRelayQueue& q, uint32_t now, uint8_t* out)
+{
+    McRelayFrame* best = nullptr;
+    for (McRelayFrame& f : q.slots)
+    {
+        if (f.len == 0 || !_reached(now, f.due)) continue;
+        if (!best || static_cast<int32_t>(f.due - best->due) < 0) best = &f;
+    }
+    if (!best) return 0;
+
+    const uint8_t len = best->len;
+    memcpy(out, best->data, len);
+    best->len = 0;
+    q.sent++;
+    return len;
+}
+
+uint32_t mc_relayNextDue(const McRelayQueue& q, uint32_t now)
+{
+    uint32_t wait = UINT32_MAX;
+    for (const McRelayFrame& f : q.slots)
+    {
+        if (f.len == 0) continue;
+        if (_reached(now, f.due)) return 0;
+        if (f.due - now < wait) wait = f.due - now;
+    }
+    return wait;
+}
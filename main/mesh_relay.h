@@ -0,0 +1,129 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * mesh_relay.h — managed-flood rebroadcast queue for relaying roles.
+ *
+ * Follows Meshtastic's FloodingRouter: a relaying node that hears a new
+ * packet with hops left waits a contention-window delay, then rebroadcasts
+ * it with hop_limit decremented.  If a neighbour's rebroadcast of the same
+ * (from, id) is heard first the pending copy is cancelled — that neighbour
+ * has already covered the area.
+ *
+ * The delay is weighted by the SNR the packet was received at: a weak
+ * packet most likely came from far away, so this node is likely to reach
+ * new ground and should go first.  ROUTER and REPEATER draw from a window
+ * with no fixed offset; ROUTER_CLIENT waits out the full router window
+ * first, so dedicated routers win contention.
+ *
+ * Frames are relayed as received — only the OTA header's hop_limit and
+ * relay_node bytes change.  The payload is never decrypted or re-encrypted,
+ * so packets on channels we hold no key for, and PKC DMs to other nodes,
+ * are relayed the same way.
+ *
+ * Not thread-safe; LoRa uses it from its task only.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+#ifndef MC_RELAY_PENDING
+#  define MC_RELAY_PENDING 8          ///< rebroadcasts that may wait at once
+#endif
+
+/// Meshtastic DeviceRole values (mesh.proto) that affect relaying.
+static constexpr uint8_t MC_ROLE_ROUTER        = 2;
+static constexpr uint8_t MC_ROLE_ROUTER_CLIENT = 3;
+static constexpr uint8_t MC_ROLE_REPEATER      = 4;
+
+/// Contention window bounds (slots, log2) and the SNR range mapped onto
+/// them — RadioInterface.h in Meshtastic firmware 2.7.x.
+static constexpr uint8_t MC_RELAY_CW_MIN  = 3;
+static constexpr uint8_t MC_RELAY_CW_MAX  = 8;
+static constexpr int     MC_RELAY_SNR_MIN = -20;
+static constexpr int     MC_RELAY_SNR_MAX = 10;
+
+struct McRelayFrame {
+    uint8_t  data[255] = {};
+    uint8_t  len       = 0;     ///< 0 = free slot
+    uint32_t from      = 0;
+    uint32_t id        = 0;
+    uint32_t due       = 0;     ///< tick at which the frame may go out
+};
+
+struct McRelayQueue {
+    McRelayFrame slots[MC_RELAY_PENDING] = {};
+
+    // Counters since init
+    uint32_t scheduled = 0;     ///< frames queued for rebroadcast
+    uint32_t cancelled = 0;     ///< pending frames dropped: neighbour went first
+    uint32_t dropped   = 0;     ///< frames not queued: every slot busy
+    uint32_t sent      = 0;     ///< frames handed back by mc_relayPop
+};
+
+/// True for roles that rebroadcast (ROUTER, ROUTER_CLIENT, REPEATER).
+bool mc_relayRoleForwards(uint8_t role);
+
+/**
+ * One contention slot in ms for a LoRa modem setting: long enough for a
+ * neighbour to detect a preamble that started in the previous slot.
+ * Meshtastic's formula — 8.5 symbols plus radio turnaround, propagation and
+ * MAC processing margins.  LongFast (SF11, 250 kHz) is 77 ms.
+ */
+uint32_t mc_relaySlotTimeMs(uint8_t sf, uint32_t bwHz);
+
+/**
+ * Rebroadcast delay in ms for a packet received at @p snr dB.  @p rnd is
+ * any uniformly distributed 32-bit value (esp_random() on target) and
+ * picks the slot inside the window.
+ */
+uint32_t mc_relayDelayMs(float snr, uint8_t role, uint32_t slotMs, uint32_t rnd);
+
+/**
+ * Whether a received frame should be rebroadcast by @p self in @p role.
+ * Requires a full OTA header, hops left, a relaying role, a sender other
+ * than us and a destination other than us.  Duplicate filtering is the
+ * caller's job: only call this for packets seen for the first time.
+ */
+bool mc_relayShouldForward(const uint8_t* frame, size_t len,
+                           uint32_t self, uint8_t role);
+
+/**
+ * Queue a copy of @p frame for rebroadcast at tick @p due, with hop_limit
+ * decremented and relay_node set to the low byte of @p self.  Returns
+ * false (and counts a drop) when every slot is already pending.
+ */
+bool mc_relaySchedule(McRelayQueue& q, const uint8_t* frame, size_t len,
+                      uint32_t self, uint32_t due);
+
+/// Drop the pending rebroadcast of (from, id), if any.  Call whenever a
+/// duplicate of a packet is heard.  Returns true if one was cancelled.
+bool mc_relayCancel(McRelayQueue& q, uint32_t from, uint32_t id);
+
+/**
+ * Remove the earliest frame whose due tick has been reached at @p now and
+ * copy it into @p out (255 bytes).  Returns its length, or 0 when nothing
+ * is due yet.
+ */
+uint8_t mc_relayPop(McRelayQueue& q, uint32_t now, uint8_t* out);
+
+/// Ticks from @p now until the next pending frame is due (0 if one is
+/// overdue), or UINT32_MAX when the queue is empty.
+uint32_t mc_relayNextDue(const McRelayQueue& q, uint32_t now);
@@ -0,0 +1,116 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * mesh_txqueue.cxx — prioritized TX frame queue (see mesh_txqueue.h).
+ */
+
+#include "mesh_txqueue.h"
+#include "mesh_codec.h"
+#include <cstring>
+
+McTxPriority mc_txPriorityFor(uint32_t portnum, bool unicast)
+{
+    switch (portnum)
+    {
+    case PORT_ROUTING:
+    case PORT_TRACEROUTE:
+        return McTxPriority::Routing;
+    case PORT_NODEINFO:
+    case PORT_POSITION:
+        return McTxPriority::NodeInfo;
+    case PORT_TELEMETRY:
+    case PORT_MAP_REPORT:
+        return McTxPriority::Background;
+    case PORT_TEXT:
+    default:
+        return unicast ? McTxPriority::Direct : McTxPriority::Text;
+    }
+}
+
+// ── Queue ─────────────────────────────────────────────────────────────────
+
+// True if slot a should be sent before slot b.
+static inline bool _before(const McTxSlot& a, const McTxSlot& b)
+{
+    if (a.prio != b.prio) return a.prio < b.prio;
+    return static_cast<int32_t>(a.seq - b.seq) < 0;
+}
+
+bool mc_txqPush(McTxQueue& q, const uint8_t* data, size_t len,
+                McTxPriority prio, uint32_t now)
+{
+    if (!data || len == 0 || len > 255) return false;
+
+    McTxSlot* slot = nullptr;
+    for (McTxSlot& s : q.slots)
+        if (s.len == 0) { slot = &s; break; }
+
+    if (!slot)
+    {
+        // Full: displace the frame that would be sent last, if it ranks
+        // strictly below this one.
+        McTxSlot* last = &q.slots[0];
+        for (McTxSlot& s : q.slots)
+            if (_before(*last, s)) last = &s;
+        if (last->prio <= prio)
+        {
+            q.refused++;
+            return false;
+        }
+        slot = last;
+        q.displaced++;
+        q.depth--;
+    }
+
+    memcpy(slot->data, data, len);
+    slot->len      = static_cast<uint8_t>(len);
+    slot->prio     = prio;
+    slot->seq      = q.nextSeq++;
+    slot->queuedAt = now;
+    q.depth++;
+    if (q.depth > q.highWater) q.highWater = q.depth;
+    return true;
+}
+
+uint8_t mc_txqPop(McTxQueue& q, uint32_t now, uint8_t* out, McTxPriority* prio)
+{
+    McTxSlot* next = nullptr;
+    for (McTxSlot& s : q.slots)
+        if (s.len != 0 && (!next || _before(s, *next))) next = &s;
+    if (!next) return 0;
+
+    const size_t   p    = static_cast<size_t>(next->prio);
+    const uint32_t wait = now - next->queuedAt;
+    q.sent[p]++;
+    q.waitTotal[p] += wait;
+    if (wait > q.waitMax[p]) q.waitMax[p] = wait;
+
+    const uint8_t len = next->len;
+    memcpy(out, next->data, len);
+    if (prio) *prio = next->prio;
+    next->len = 0;
+    q.depth--;
+    return len;
+}
+
+uint32_t mc_txqWaitAvg(const McTxQueue& q, McTxPriority prio)
+{
+    const size_t p = static_cast<size_t>(prio);
+    return q.sent[p] ? static_cast<uint32_t>(q.waitTotal[p] / q.sent[p]) : 0;
+}
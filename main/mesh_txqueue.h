@@ -0,0 +1,99 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * mesh_txqueue.h — fixed-size prioritized queue of outgoing LoRa frames.
+ *
+ * Everything the node sends — its own broadcasts, replies built inside
+ * _processPacket, and relays — is pushed here as a finished OTA frame.  The
+ * LoRa task pops one frame whenever the radio is idle, so building a reply
+ * never waits for the airtime of another packet.
+ *
+ * Frames leave in priority order, first-in first-out within a priority.
+ * When the queue is full a frame may displace the newest frame of a
+ * strictly lower priority; otherwise it is refused.  Per-priority wait
+ * times (push to pop) are accumulated for LoRaStats.
+ *
+ * Not thread-safe; LoRa uses it from its task only.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+#ifndef MC_TXQ_DEPTH
+#  define MC_TXQ_DEPTH 8              ///< frames that may wait at once
+#endif
+
+/// Send order, highest first.
+enum class McTxPriority : uint8_t {
+    Routing,      ///< ACK / routing / traceroute replies
+    Direct,       ///< unicast to one node (DMs, key exchange)
+    Text,         ///< broadcast user traffic, relayed broadcasts
+    NodeInfo,     ///< NodeInfo and position announcements
+    Background,   ///< telemetry, map reports
+};
+static constexpr size_t MC_TX_PRIORITIES = 5;
+
+/**
+ * Priority for a frame by Meshtastic portnum and destination.  Relayed
+ * frames are still encrypted, so callers pass portnum 0 and only the
+ * destination decides.
+ */
+McTxPriority mc_txPriorityFor(uint32_t portnum, bool unicast);
+
+struct McTxSlot {
+    uint8_t      data[255] = {};
+    uint8_t      len       = 0;     ///< 0 = free slot
+    McTxPriority prio      = McTxPriority::Background;
+    uint32_t     seq       = 0;     ///< push order, for FIFO within a priority
+    uint32_t     queuedAt  = 0;     ///< tick of push
+};
+
+struct McTxQueue {
+    McTxSlot slots[MC_TXQ_DEPTH] = {};
+    uint32_t nextSeq   = 0;
+    uint8_t  depth     = 0;         ///< frames waiting now
+    uint8_t  highWater = 0;         ///< largest depth since init
+
+    // Counters since init
+    uint32_t refused   = 0;         ///< pushes rejected: full of equal/higher priority
+    uint32_t displaced = 0;         ///< queued frames dropped for a higher priority
+    uint32_t sent[MC_TX_PRIORITIES]      = {};   ///< frames popped, per priority
+    uint64_t waitTotal[MC_TX_PRIORITIES] = {};   ///< sum of push→pop ticks
+    uint32_t waitMax[MC_TX_PRIORITIES]   = {};   ///< longest push→pop ticks
+};
+
+/**
+ * Queue a copy of @p data (1–255 bytes) at tick @p now.  Returns false when
+ * the frame was refused.
+ */
+bool mc_txqPush(McTxQueue& q, const uint8_t* data, size_t len,
+                McTxPriority prio, uint32_t now);
+
+/**
+ * Remove the next frame to send and copy it into @p out (255 bytes).
+ * Returns its length, or 0 when the queue is empty.  @p prio, if given,
+ * receives the frame's priority.
+ */
+uint8_t mc_txqPop(McTxQueue& q, uint32_t now, uint8_t* out,
+                  McTxPriority* prio = nullptr);
+
+/// Average push→pop wait for @p prio in ticks (0 if nothing sent yet).
+uint32_t mc_txqWaitAvg(const McTxQueue& q, McTxPriority prio);
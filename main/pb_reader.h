@@ -0,0 +1,184 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * pb_reader.h — zero-copy, header-only protobuf wire-format cursor.
+ *
+ * PbReader walks a serialised message and yields one PbField per wire
+ * field: the field number, the wire type, the decoded scalar (varint or
+ * fixed) and a span pointing back INTO the source buffer.  Nothing is
+ * copied and nothing is allocated; the source buffer must outlive every
+ * PbField taken from it.
+ *
+ * Typical use:
+ *
+ *   PbReader r(data, len);
+ *   PbField  f;
+ *   while (r.next(f)) {
+ *       if (f.number == 1 && f.wireType == PB_WT_VARINT) portnum = f.value;
+ *   }
+ *   if (r.failed()) return false;
+ *
+ * Malformed input (overlong varint, length past the end, group wire types
+ * 3/4, wire types 6/7) stops iteration and latches failed().  Callers that
+ * need packed repeated fields open a nested PbReader over f.data/f.len and
+ * pull elements with readVarint() / readFixed32().
+ *
+ * No ESP-IDF or FreeRTOS dependencies — shared by mesh_codec.cxx and the
+ * host tests.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+/// Protobuf wire types (encoding.md).  3 and 4 (groups) are rejected.
+enum PbWireType : uint8_t {
+    PB_WT_VARINT  = 0,
+    PB_WT_FIXED64 = 1,
+    PB_WT_LEN     = 2,
+    PB_WT_FIXED32 = 5,
+};
+
+/// One decoded wire field — a view into the reader's source buffer.
+struct PbField {
+    uint32_t       number   = 0;
+    uint8_t        wireType = 0;
+    uint64_t       value    = 0;       ///< VARINT value, or little-endian FIXED32/FIXED64 value
+    const uint8_t* data     = nullptr; ///< LEN payload, or the raw fixed/varint bytes
+    size_t         len      = 0;
+
+    bool is(uint32_t num, uint8_t wt) const { return number == num && wireType == wt; }
+
+    uint32_t u32()     const { return static_cast<uint32_t>(value); }
+    int32_t  i32()     const { return static_cast<int32_t>(static_cast<int64_t>(value)); }
+    bool     boolean() const { return value != 0; }
+};
+
+class PbReader
+{
+public:
+    PbReader(const uint8_t* data, size_t len)
+        : _p(data), _end(data ? data + len : data) {}
+
+    /// Advance to the next field.  Returns false at end of input or on the
+    /// first malformed field (see failed()).
+    bool next(PbField& f)
+    {
+        if (_failed || _p >= _end) return false;
+
+        uint64_t tag = 0;
+        if (!_varint(tag, 5) || (tag >> 32) != 0) return _fail();
+
+        f.number   = static_cast<uint32_t>(tag >> 3);
+        f.wireType = static_cast<uint8_t>(tag & 0x07);
+        f.value    = 0;
+        f.data     = _p;
+
+        switch (f.wireType)
+        {
+        case PB_WT_VARINT:
+            if (!_varint(f.value, 10)) return _fail();
+            break;
+        case PB_WT_FIXED32:
+            if (_remaining() < 4) return _fail();
+            f.value = _le(_p, 4);
+            _p += 4;
+            break;
+        case PB_WT_FIXED64:
+            if (_remaining() < 8) return _fail();
+            f.value = _le(_p, 8);
+            _p += 8;
+            break;
+        case PB_WT_LEN:
+        {
+            uint64_t n = 0;
+            if (!_varint(n, 5) || n > _remaining()) return _fail();
+            f.data = _p;
+            _p += n;
+            break;
+        }
+        default:
+            return _fail();
+        }
+
+        f.len = static_cast<size_t>(_p - f.data);
+        return true;
+    }
+
+    /// Read one bare varint (element of a packed repeated field).
+    bool readVarint(uint64_t& out)
+    {
+        if (_failed || _p >= _end) return false;
+        return _varint(out, 10) || _fail();
+    }
+
+    /// Read one bare little-endian fixed32 (element of a packed field).
+    bool readFixed32(uint32_t& out)
+    {
+        if (_failed || _remaining() < 4) return (_p >= _end) ? false : _fail();
+        out = static_cast<uint32_t>(_le(_p, 4));
+        _p += 4;
+        return true;
+    }
+
+    bool   failed()    const { return _failed; }
+    bool   atEnd()     const { return _p >= _end; }
+    size_t remaining() const { return _remaining(); }
+
+private:
+    const uint8_t* _p;
+    const uint8_t* _end;
+    bool           _failed = false;
+
+    size_t _remaining() const { return static_cast<size_t>(_end - _p); }
+
+    bool _fail() { _failed = true; return false; }
+
+    // Base-128 varint of at most maxBytes bytes.  Does not advance on error.
+    // Tags and most values on the wire are a single byte; test that first.
+    bool _varint(uint64_t& out, int maxBytes)
+    {
+        if (_p < _end && !(*_p & 0x80))
+        {
+            out = *_p++;
+            return true;
+        }
+        const uint8_t* p = _p;
+        uint64_t v = 0;
+        for (int i = 0; i < maxBytes && p < _end; i++)
+        {
+            const uint8_t b = *p++;
+            v |= static_cast<uint64_t>(b & 0x7F) << (7 * i);
+            if (!(b & 0x80))
+            {
+                out = v;
+                _p  = p;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static uint64_t _le(const uint8_t* p, int n)
+    {
+        uint64_t v = 0;
+        for (int i = n - 1; i >= 0; i--) v = (v << 8) | p[i];
+        return v;
+    }
+};
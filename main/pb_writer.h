@@ -0,0 +1,183 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * pb_writer.h — bounds-checked, header-only protobuf wire-format writer.
+ *
+ * Counterpart of pb_reader.h.  A PbWriter appends fields to a caller-owned
+ * buffer and never writes past its capacity: the first field that does not
+ * fit latches overflowed(), later writes are dropped, and finish() returns 0.
+ *
+ * A writer constructed with buf == nullptr is a sizing pass — it counts the
+ * bytes that would be written and touches no memory.  Submessages use that
+ * to get their exact length before the tag/length prefix is emitted, so a
+ * nested message (Telemetry → DeviceMetrics, Data → Position, …) is written
+ * in one forward pass directly into the destination with no scratch buffer:
+ *
+ *   PbWriter w(buf, cap);
+ *   w.fixed32(1, unixTime);
+ *   w.message(2, [&](PbWriter& dm) {
+ *       dm.varint(1, batteryLevel);
+ *       dm.float32(2, voltage);
+ *   });
+ *   return w.finish();            // bytes written, or 0 on overflow
+ *
+ * The body passed to message() runs twice (sizing, then writing) and must
+ * emit the same fields both times.  No heap, no ESP-IDF dependencies.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <bit>
+#include <type_traits>
+
+class PbWriter;
+
+/// Non-owning reference to a callable `void(PbWriter&)` — a message body.
+/// Only valid for the duration of the call it is passed to.
+class PbBody
+{
+public:
+    template <typename F,
+              typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, PbBody>>>
+    PbBody(F&& fn)
+        : _obj(const_cast<void*>(static_cast<const void*>(&fn)))
+        , _call([](void* o, PbWriter& w) { (*static_cast<std::remove_reference_t<F>*>(o))(w); })
+    {}
+
+    void operator()(PbWriter& w) const { _call(_obj, w); }
+
+private:
+    void* _obj;
+    void (*_call)(void*, PbWriter&);
+};
+
+class PbWriter
+{
+public:
+    /// buf == nullptr → sizing pass (cap is ignored).
+    PbWriter(uint8_t* buf, size_t cap) : _buf(buf), _cap(buf ? cap : SIZE_MAX) {}
+
+    // ── Fields ────────────────────────────────────────────────────────────
+    void varint(uint32_t field, uint64_t v)   { _tag(field, 0); _varint(v); }
+    void int32(uint32_t field, int32_t v)     { varint(field, static_cast<uint64_t>(static_cast<int64_t>(v))); }
+    void sint32(uint32_t field, int32_t v)
+    {
+        varint(field, (static_cast<uint32_t>(v) << 1) ^ static_cast<uint32_t>(v >> 31));
+    }
+    void boolean(uint32_t field, bool v)      { varint(field, v ? 1 : 0); }
+    void fixed32(uint32_t field, uint32_t v)  { _tag(field, 5); _le32(v); }
+    void sfixed32(uint32_t field, int32_t v)  { fixed32(field, static_cast<uint32_t>(v)); }
+    void float32(uint32_t field, float v)     { fixed32(field, std::bit_cast<uint32_t>(v)); }
+
+    void bytes(uint32_t field, const uint8_t* data, size_t len)
+    {
+        _tag(field, 2);
+        _varint(len);
+        raw(data, len);
+    }
+
+    /// String field from a NUL-terminated source; nullptr encodes as "".
+    void string(uint32_t field, const char* s)
+    {
+        bytes(field, reinterpret_cast<const uint8_t*>(s ? s : ""), s ? strlen(s) : 0);
+    }
+
+    /// Length-delimited submessage.  body is run once to size and once to write.
+    void message(uint32_t field, PbBody body)
+    {
+        PbWriter sizer(nullptr, 0);
+        body(sizer);
+        _tag(field, 2);
+        _varint(sizer.size());
+        if (!_room(sizer.size())) return;
+
+        PbWriter sub(_buf ? _buf + _n : nullptr, sizer.size());
+        body(sub);
+        if (sub.overflowed() || sub.size() != sizer.size()) { _overflow = true; return; }
+        _n += sub.size();
+    }
+
+    /// Append pre-encoded bytes verbatim.
+    void raw(const uint8_t* data, size_t len)
+    {
+        if (!_room(len)) return;
+        if (_buf && len) memcpy(_buf + _n, data, len);
+        _n += len;
+    }
+
+    // ── Result ────────────────────────────────────────────────────────────
+    size_t size()       const { return _n; }
+    bool   overflowed() const { return _overflow; }
+    bool   sizing()     const { return _buf == nullptr; }
+
+    /// Bytes written, or 0 if anything failed to fit.
+    size_t finish()     const { return _overflow ? 0 : _n; }
+
+    /// Bytes a base-128 varint of v occupies (1–10).
+    static size_t varintSize(uint64_t v)
+    {
+        size_t n = 1;
+        while (v > 0x7F) { v >>= 7; n++; }
+        return n;
+    }
+
+private:
+    uint8_t* _buf;
+    size_t   _cap;
+    size_t   _n        = 0;
+    bool     _overflow = false;
+
+    bool _room(size_t len)
+    {
+        if (_overflow) return false;
+        if (len > _cap - _n) { _overflow = true; return false; }
+        return true;
+    }
+
+    void _byte(uint8_t b)
+    {
+        if (!_room(1)) return;
+        if (_buf) _buf[_n] = b;
+        _n++;
+    }
+
+    void _varint(uint64_t v)
+    {
+        if (!_room(varintSize(v))) return;
+        while (v > 0x7F)
+        {
+            _byte(static_cast<uint8_t>((v & 0x7F) | 0x80));
+            v >>= 7;
+        }
+        _byte(static_cast<uint8_t>(v));
+    }
+
+    void _tag(uint32_t field, uint8_t wireType)
+    {
+        _varint((static_cast<uint64_t>(field) << 3) | wireType);
+    }
+
+    void _le32(uint32_t v)
+    {
+        if (!_room(4)) return;
+        for (int i = 0; i < 4; i++) _byte(static_cast<uint8_t>(v >> (8 * i)));
+    }
+};
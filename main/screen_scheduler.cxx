@@ -0,0 +1,184 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * screen_scheduler.cxx — screen deadlines and preemption for the draw task
+ * (see screen_scheduler.h).
+ */
+
+#include "screen_scheduler.h"
+#include "ancs.h"
+
+uint8_t ScreenScheduler::_rank(Screen s)
+{
+    switch (s) {
+        case Screen::Call:         return 3;
+        case Screen::Alert:        return 2;
+        case Screen::Notification:
+        case Screen::Mesh:         return 1;
+        case Screen::Standby:      break;
+    }
+    return 0;
+}
+
+bool ScreenScheduler::_preempts(Screen incoming, Screen current)
+{
+    // Only calls and alerts cut in; ordinary content waits its turn.
+    return _rank(incoming) >= 2 && _rank(incoming) > _rank(current);
+}
+
+bool ScreenScheduler::_expired(uint32_t nowMs) const
+{
+    return _current == Screen::Standby || !_before(nowMs, _deadline);
+}
+
+Screen ScreenScheduler::_best() const
+{
+    if (pending(Screen::Call))  return Screen::Call;
+    if (pending(Screen::Alert)) return Screen::Alert;
+
+    const bool notif = pending(Screen::Notification);
+    const bool mesh  = pending(Screen::Mesh);
+    if (notif && mesh)
+        return _lastBody == Screen::Mesh ? Screen::Notification : Screen::Mesh;
+    if (notif) return Screen::Notification;
+    if (mesh)  return Screen::Mesh;
+    return Screen::Standby;
+}
+
+// ── Sources ───────────────────────────────────────────────────────────────
+
+void ScreenScheduler::post(Screen s, uint32_t nowMs)
+{
+    if (s == Screen::Standby) return;
+    _pending |= _bit(s);
+
+    // A backlog behind an ordinary screen cuts its dwell short; calls and
+    // alerts always get theirs.
+    const bool bodyNow  = _current == Screen::Notification || _current == Screen::Mesh;
+    const bool bodyNext = s == Screen::Notification || s == Screen::Mesh;
+    if (bodyNow && bodyNext && !_expired(nowMs)) {
+        const uint32_t cut = _startMs + _dwell.backlogMs;
+        if (_before(cut, _deadline)) _deadline = cut;
+    }
+}
+
+void ScreenScheduler::drained(Screen s)
+{
+    _pending &= static_cast<uint8_t>(~_bit(s));
+}
+
+void ScreenScheduler::shown(Screen s, uint32_t nowMs, uint32_t dwellMs)
+{
+    _current  = s;
+    _drawn    = true;
+    _startMs  = nowMs;
+    _deadline = nowMs + dwellMs;
+    if (s == Screen::Notification || s == Screen::Mesh) _lastBody = s;
+}
+
+void ScreenScheduler::finish(Screen s, uint32_t nowMs)
+{
+    drained(s);
+    if (_resume == s) _resume = Screen::Standby;
+    if (_current == s && !_expired(nowMs)) _deadline = nowMs;
+}
+
+// ── Decision ──────────────────────────────────────────────────────────────
+
+bool ScreenScheduler::next(uint32_t nowMs, ScreenPick& out)
+{
+    const Screen best = _best();
+
+    if (!_expired(nowMs)) {
+        if (!_preempts(best, _current)) return false;
+
+        // Park the screen being cut short.  Only one is kept: a call
+        // arriving over an alert that already displaced a text drops the
+        // text's remainder, not the alert's.
+        if (_rank(_current) > _rank(_resume) || _resume == Screen::Standby) {
+            _resume   = _current;
+            _resumeMs = _deadline - nowMs;
+        }
+    }
+    else if (_resume != Screen::Standby && _rank(_resume) >= _rank(best)) {
+        _current  = _resume;
+        _resume   = Screen::Standby;
+        _drawn    = true;
+        _startMs  = nowMs;
+        _deadline = nowMs + _resumeMs;
+        out = { _current, true };
+        return true;
+    }
+
+    if (best != Screen::Standby) {
+        // Expired until shown() says otherwise, so a drained pick falls
+        // straight through to the next candidate.
+        _current  = best;
+        _drawn    = false;
+        _startMs  = nowMs;
+        _deadline = nowMs;
+        out = { best, false };
+        return true;
+    }
+
+    if (_current != Screen::Standby || !_drawn) {
+        _current = Screen::Standby;
+        _drawn   = true;
+        out = { Screen::Standby, false };
+        return true;
+    }
+    return false;
+}
+
+uint32_t ScreenScheduler::waitMs(uint32_t nowMs) const
+{
+    if (_current == Screen::Standby)
+        return (_drawn && !_pending) ? UINT32_MAX : 0;
+    return _before(nowMs, _deadline) ? _deadline - nowMs : 0;
+}
+
+// ── Dwell ─────────────────────────────────────────────────────────────────
+
+uint32_t ScreenScheduler::notificationDwell(uint8_t categoryId) const
+{
+    switch (categoryId) {
+        case ANCS::CategoryIDIncomingCall:
+            return _dwell.callMs;
+        case ANCS::CategoryIDSchedule:
+            return _dwell.scheduleMs;
+        case ANCS::CategoryIDEmail:
+        case ANCS::CategoryIDNews:
+        case ANCS::CategoryIDHealthAndFitness:
+        case ANCS::CategoryIDBusinessAndFinance:
+        case ANCS::CategoryIDLocation:
+        case ANCS::CategoryIDEntertainment:
+            return _dwell.infoMs;
+        case ANCS::CategoryIDOther:
+        case ANCS::CategoryIDMissedCall:
+        case ANCS::CategoryIDVoicemail:
+        case ANCS::CategoryIDSocial:
+        default:
+            return _dwell.messageMs;
+    }
+}
+
+uint32_t ScreenScheduler::dwell(uint32_t dwellMs, bool more) const
+{
+    return (more && _dwell.backlogMs < dwellMs) ? _dwell.backlogMs : dwellMs;
+}
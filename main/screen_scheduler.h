@@ -0,0 +1,132 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * screen_scheduler.h — what the TFT body shows, and until when.
+ *
+ * The draw task used to show a screen and then vTaskDelay() through its
+ * dwell, deaf to every other DRAW_* bit.  ScreenScheduler instead keeps a
+ * deadline per screen; the draw task waits for its next notification with
+ * waitMs() as the timeout and asks next() what to draw after every wakeup,
+ * so header updates are handled at once, whatever the body is showing.
+ *
+ *   Call          ringing call       preempts everything
+ *   Alert         mesh ALERT_APP     preempts notifications and mesh texts
+ *   Notification  ANCS notification  \  take turns; neither preempts,
+ *   Mesh          mesh text          /  but a backlog shortens the dwell
+ *   Standby       idle screen        when nothing else is pending
+ *
+ * Sources post() when they may have something to show.  When next() picks
+ * one, the caller takes the content and reports shown() with its dwell, or
+ * drained() if the source was empty after all.  A screen cut short by a
+ * preemption resumes with its remaining dwell once the preempting one is
+ * done; the caller keeps its content and just redraws it.
+ *
+ * Times are caller-supplied milliseconds, wrap-safe.  Not thread-safe:
+ * draw task only.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+enum class Screen : uint8_t {
+    Standby,
+    Notification,
+    Mesh,
+    Alert,
+    Call,
+};
+
+static constexpr uint8_t SCREEN_COUNT = 5;
+
+/// Screen to draw, from ScreenScheduler::next().
+struct ScreenPick {
+    Screen screen = Screen::Standby;
+    bool   resume = false;  ///< redraw the content that was preempted; no shown() needed
+};
+
+/// Dwell times, milliseconds.
+struct ScreenDwell {
+    uint32_t callMs     = 15000;
+    uint32_t alertMs    = 15000;
+    uint32_t meshMs     = 10000;
+    uint32_t messageMs  = 15000;  ///< ANCS Other, MissedCall, Voicemail, Social
+    uint32_t scheduleMs = 15000;  ///< ANCS Schedule
+    uint32_t infoMs     =  8000;  ///< ANCS Email, News, Health, Business, Location, Entertainment
+    uint32_t backlogMs  =  4000;  ///< any screen with more waiting behind it
+};
+
+class ScreenScheduler {
+public:
+    explicit ScreenScheduler(const ScreenDwell& dwell = {}) : _dwell(dwell) {}
+
+    /// Source @p s may have something to show.  Stays pending until drained().
+    void post(Screen s, uint32_t nowMs);
+
+    /// Source @p s turned out to be empty.
+    void drained(Screen s);
+
+    /// @p s was drawn at @p nowMs and should stay up for @p dwellMs.
+    void shown(Screen s, uint32_t nowMs, uint32_t dwellMs);
+
+    /// End @p s now if it is on screen (a call hung up), or drop it if it
+    /// is waiting to resume.
+    void finish(Screen s, uint32_t nowMs);
+
+    /**
+     * Decide what to draw at @p nowMs.  Returns false when the current
+     * screen stays.  Call repeatedly until it does — a pick the caller
+     * drains leads straight to the next candidate.
+     */
+    bool next(uint32_t nowMs, ScreenPick& out);
+
+    /// Milliseconds until next() may pick something without a new post();
+    /// UINT32_MAX when only an event can change the screen.
+    uint32_t waitMs(uint32_t nowMs) const;
+
+    Screen current() const { return _current; }
+    bool   pending(Screen s) const { return _pending & _bit(s); }
+
+    /// Dwell for an ANCS notification of @p categoryId.
+    uint32_t notificationDwell(uint8_t categoryId) const;
+
+    /// @p dwellMs, or the backlog dwell if @p more is waiting behind it.
+    uint32_t dwell(uint32_t dwellMs, bool more) const;
+
+    const ScreenDwell& dwellTimes() const { return _dwell; }
+
+private:
+    static uint8_t _bit(Screen s) { return static_cast<uint8_t>(1u << static_cast<uint8_t>(s)); }
+    static uint8_t _rank(Screen s);
+    static bool    _preempts(Screen incoming, Screen current);
+    static bool    _before(uint32_t a, uint32_t b) { return static_cast<int32_t>(a - b) < 0; }
+
+    bool   _expired(uint32_t nowMs) const;
+    Screen _best() const;
+
+    ScreenDwell _dwell;
+    uint8_t     _pending   = 0;                 ///< bit per Screen
+    Screen      _current   = Screen::Standby;
+    bool        _drawn     = false;             ///< _current is actually on the TFT
+    uint32_t    _startMs   = 0;
+    uint32_t    _deadline  = 0;
+    Screen      _lastBody  = Screen::Mesh;      ///< Notification/Mesh turn-taking
+    Screen      _resume    = Screen::Standby;   ///< preempted screen, Standby = none
+    uint32_t    _resumeMs  = 0;                 ///< its remaining dwell
+};
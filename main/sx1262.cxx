@@ -18,8 +18,12 @@
 /**
  * sx1262.cxx — SX1262 SPI hardware driver layer.
  *
- * Implements all low-level SX1262 commands (init, calibration, modulation,
- * frequency, RX/TX control, IRQ handling) and the blocking transmit() method.
+ * Implements the SX1262 bring-up (_initSx1262: reset, TCXO, calibration,
+ * modulation, sync word) and the diagnostic reads.  LoRa is also the
+ * SxBus that runs the command sequences in sx1262_batch.cxx — register
+ * access, RX entry, CAD, TX start and completion — as queued DMA
+ * transactions; the TX state machine driving them is MeshRadio
+ * (mesh_radio.cxx).
  *
  * Higher-level Meshtastic protocol concerns live in meshtastic_proto.cxx.
  * The FreeRTOS task entry point and receive loop live in lora.cxx.
@@ -30,9 +34,13 @@
 
 #include <driver/spi_master.h>
 #include <driver/gpio.h>
+#include <hal/gpio_ll.h>
 #include <esp_log.h>
+#include <esp_rom_sys.h>
 #include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
 #include <freertos/task.h>
+#include <cinttypes>
 #include <cstring>
 
 static const char* TAG = "lora";
@@ -46,9 +54,51 @@ static const char* TAG = "lora";
     portYIELD_FROM_ISR(higher);
 }
 
+// ── BUSY ISR ──────────────────────────────────────────────────────────────
+// Armed only while _waitBusy is blocked; fires once BUSY falls.
+/* static */ void IRAM_ATTR LoRa::_busyIsr(void* arg)
+{
+    LoRa* self = static_cast<LoRa*>(arg);
+    BaseType_t higher = pdFALSE;
+    xSemaphoreGiveFromISR(self->_busySem, &higher);
+    portYIELD_FROM_ISR(higher);
+}
+
+// ── SPI pre-transfer callback ─────────────────────────────────────────────
+// Runs before every transaction, from the SPI ISR when queued.  After each
+// command BUSY pulses high for a few µs while the chip parses it; the next
+// queued command must not assert NSS until it drops.  Register read only —
+// gpio_get_level is not guaranteed to be in IRAM.
+/* static */ void IRAM_ATTR LoRa::_busyPreCb(spi_transaction_t* /*t*/)
+{
+    for (uint32_t us = 0; us < BUSY_SPIN_US && gpio_ll_get_level(&GPIO, PIN_BUSY); us++)
+        esp_rom_delay_us(1);
+}
+
 // ── _waitBusy ─────────────────────────────────────────────────────────────
+// Returns at once if BUSY is already low (the usual case for Get commands).
+// Otherwise blocks on the falling-edge interrupt — calibration and mode
+// changes hold BUSY for hundreds of µs to milliseconds, and the old
+// once-per-tick poll rounded every one of those up to a full tick.
 void LoRa::_waitBusy(uint32_t timeoutMs) const
 {
+    if (!gpio_get_level(PIN_BUSY)) return;
+
+    if (_busySem)
+    {
+        xSemaphoreTake(_busySem, 0);        // drop an edge left from earlier
+        gpio_intr_enable(PIN_BUSY);
+        // Re-check after arming: an edge between the first read and
+        // gpio_intr_enable would otherwise be missed.
+        const bool ok = !gpio_get_level(PIN_BUSY)
+                     || xSemaphoreTake(_busySem, pdMS_TO_TICKS(timeoutMs)) == pdTRUE
+                     || !gpio_get_level(PIN_BUSY);
+        gpio_intr_disable(PIN_BUSY);
+        if (!ok) ESP_LOGW(TAG, "BUSY timeout");
+        return;
+    }
+
+    // Before the ISR service is up: poll.
     const TickType_t deadline = xTaskGetTickCount() + pdMS_TO_TICKS(timeoutMs);
     while (gpio_get_level(PIN_BUSY))
     {
@@ -66,63 +116,64 @@ void LoRa::_waitBusy(uint32_t timeoutMs) const
 // rx may be nullptr if results are not needed.
 void LoRa::_transact(const uint8_t* tx, uint8_t* rx, size_t len)
 {
-    _waitBusy();
-
-    spi_transaction_t t = {};
-    t.length    = len * 8;
-    t.tx_buffer = tx;
-    t.rx_buffer = rx;  // nullptr is fine — IDF ignores rx when null
-
-    spi_device_polling_transmit(_spi, &t);
+    const SxXfer x = { tx, rx, static_cast<uint16_t>(len) };
+    transfer(&x, 1);
 }
 
-// ── _writeReg ─────────────────────────────────────────────────────────────
-void LoRa::_writeReg(uint16_t addr, uint8_t val)
+// ── transfer (SxBus) ──────────────────────────────────────────────────────
+// A single command goes out as a polling transaction, which is cheaper than
+// the queue for a few bytes.  A batch is queued in full (queue_size is
+// SX_BATCH_MAX) and collected afterwards, so the task blocks once per batch
+// and the driver chains the transfers from its ISR with the pre-callback
+// holding each one until BUSY drops.
+void LoRa::transfer(const SxXfer* xfers, size_t n)
 {
-    uint8_t tx[4] = {
-        CMD_WRITE_REGISTER,
-        static_cast<uint8_t>(addr >> 8),
-        static_cast<uint8_t>(addr & 0xFF),
-        val
-    };
-    _transact(tx, nullptr, sizeof(tx));
-}
+    _waitBusy();
 
-// ── _readReg ──────────────────────────────────────────────────────────────
-// SX1262 ReadRegister (0x1D) layout — 5 bytes total:
-//   TX:  [0x1D] [addrH] [addrL] [NOP#1]  [NOP#2]
-//   RX:  [0x00] [0x00]  [0x00]  [status] [data]
-// The status byte arrives on NOP#1; actual register data arrives on NOP#2.
-// Sending only 4 bytes returns rx[3] = status (0xA2 for STBY_RC), never
-// clocking out the data byte — hence the "got 0xA2A2" symptom.
-uint8_t LoRa::_readReg(uint16_t addr)
-{
-    uint8_t tx[5] = {
-        CMD_READ_REGISTER,
-        static_cast<uint8_t>(addr >> 8),
-        static_cast<uint8_t>(addr & 0xFF),
-        0x00,   // NOP#1 — status byte returned here (discarded)
-        0x00    // NOP#2 — actual register data returned here
-    };
-    uint8_t rx[5] = {};
-    _transact(tx, rx, sizeof(tx));
-    return rx[4];
+    if (n == 1)
+    {
+        spi_transaction_t t = {};
+        t.length    = xfers[0].len * 8;
+        t.tx_buffer = xfers[0].tx;
+        t.rx_buffer = xfers[0].rx;  // nullptr is fine — IDF ignores rx when null
+        spi_device_polling_transmit(_spi, &t);
+        return;
+    }
+
+    spi_transaction_t t[SX_BATCH_MAX];
+    for (size_t base = 0; base < n; base += SX_BATCH_MAX)
+    {
+        const size_t chunk = (n - base) < SX_BATCH_MAX ? (n - base) : SX_BATCH_MAX;
+        size_t queued = 0;
+        for (; queued < chunk; queued++)
+        {
+            const SxXfer& x = xfers[base + queued];
+            t[queued] = {};
+            t[queued].length    = x.len * 8;
+            t[queued].tx_buffer = x.tx;
+            t[queued].rx_buffer = x.rx;
+            const esp_err_t err = spi_device_queue_trans(_spi, &t[queued], portMAX_DELAY);
+            if (err != ESP_OK)
+            {
+                ESP_LOGW(TAG, "spi_device_queue_trans: %s", esp_err_to_name(err));
+                break;
+            }
+        }
+        for (size_t i = 0; i < queued; i++)
+        {
+            spi_transaction_t* done = nullptr;
+            spi_device_get_trans_result(_spi, &done, portMAX_DELAY);
+        }
+    }
 }
 
-// ── _setFrequency ─────────────────────────────────────────────────────────
-void LoRa::_setFrequency(uint32_t freqHz)
+// ── dio1Remapped (SxBus) ──────────────────────────────────────────────────
+// The sequences in sx1262_batch.cxx call this after SetDioIrqParams and
+// before ClearIrq: a DIO1 edge raised under the old mapping must not wake
+// the run loop once the new one is armed.
+void LoRa::dio1Remapped()
 {
-    // freq_reg = freqHz * 2^25 / 32_000_000
-    const uint32_t reg =
-        static_cast<uint32_t>((static_cast<uint64_t>(freqHz) << 25) / 32000000ULL);
-    uint8_t tx[5] = {
-        CMD_SET_RF_FREQ,
-        static_cast<uint8_t>(reg >> 24),
-        static_cast<uint8_t>(reg >> 16),
-        static_cast<uint8_t>(reg >>  8),
-        static_cast<uint8_t>(reg)
-    };
-    _transact(tx, nullptr, sizeof(tx));
+    ulTaskNotifyTake(pdTRUE, 0);
 }
 
 // ── _calibrateImage ───────────────────────────────────────────────────────
@@ -151,105 +202,6 @@ void LoRa::_setModulation(uint8_t sf, uint8_t bw, uint8_t cr, uint8_t ldro)
     _transact(tx, nullptr, sizeof(tx));
 }
 
-// ── _fixIqPolarity ────────────────────────────────────────────────────────
-// SX1262 Errata 15.3 — Inverted IQ Operation
-//
-// After reset, register 0x0736 bit 2 defaults to 1 (inverted IQ polarity).
-// SetPacketParams with IQ=standard (0x00) is supposed to clear it, but per
-// the errata it does NOT — the register retains the power-on default.
-//
-// Result: preamble and sync word are detected (they're symmetric /
-// correlator-based), but every header CRC fails because the data symbols
-// are decoded with inverted chirp direction.  This produces the symptom:
-// hdr_err increments, rx=0 forever, RSSI/SNR are stale.
-//
-// Fix: after any SetPacketParams call, read-modify-write register 0x0736
-// to enforce the correct polarity.  Standard IQ: clear bit 2 (val &= ~0x04).
-void LoRa::_fixIqPolarity()
-{
-    uint8_t val = _readReg(REG_IQ_CONFIG);
-    val &= ~0x04u; // clear bit 2 for standard (non-inverted) IQ
-    _writeReg(REG_IQ_CONFIG, val);
-}
-
-// ── _setRx ────────────────────────────────────────────────────────────────
-// Enter continuous RX (no timeout; chip stays in RX, fires DIO1 on each
-// packet or error, and automatically restarts).
-void LoRa::_setRx()
-{
-    // Apply the IQ polarity errata fix before every RX entry.
-    _fixIqPolarity();
-
-    // 0xFFFFFF = Rx Continuous mode
-    uint8_t tx[4] = { CMD_SET_RX, 0xFF, 0xFF, 0xFF };
-    _transact(tx, nullptr, sizeof(tx));
-}
-
-// ── _getIrqStatus ─────────────────────────────────────────────────────────
-// SX1262 GetIrqStatus SPI layout — 4 bytes total:
-//   TX:  [0x12] [NOP]    [NOP]    [NOP]
-//   RX:  [0x00] [status] [IRQ_H]  [IRQ_L]
-// The previous 3-byte version captured only IRQ_H and missed IRQ_L entirely,
-// so IRQ_TX_DONE (bit 0) and IRQ_RX_DONE (bit 1) were never visible.
-uint16_t LoRa::_getIrqStatus()
-{
-    uint8_t tx[4] = { CMD_GET_IRQ_STATUS, 0, 0, 0 };
-    uint8_t rx[4] = {};
-    _transact(tx, rx, sizeof(tx));
-    return (static_cast<uint16_t>(rx[2]) << 8) | rx[3];
-}
-
-// ── _clearIrq ─────────────────────────────────────────────────────────────
-void LoRa::_clearIrq(uint16_t mask)
-{
-    uint8_t tx[3] = {
-        CMD_CLEAR_IRQ,
-        static_cast<uint8_t>(mask >> 8),
-        static_cast<uint8_t>(mask & 0xFF)
-    };
-    _transact(tx, nullptr, sizeof(tx));
-}
-
-// ── _writeBuffer ──────────────────────────────────────────────────────────
-// Write data into the SX1262 data buffer starting at `offset`.
-// SX1262 WriteBuffer layout: [0x0E, offset, data0, data1, …]
-void LoRa::_writeBuffer(uint8_t offset, const uint8_t* data, uint8_t len)
-{
-    uint8_t tx[2 + 255] = { CMD_WRITE_BUFFER, offset };
-    memcpy(tx + 2, data, len);
-    _transact(tx, nullptr, 2 + len);
-}
-
-// ── _setRxIrq ─────────────────────────────────────────────────────────────
-// Configure DIO1 IRQ mask for receive.
-// Global mask includes PREAMBLE_DETECTED and HEADER_VALID so they're visible
-// in GetIrqStatus for diagnostics, but only the DIO1 mask events trigger the
-// ISR (no extra wakeups for preamble/header-valid).
-void LoRa::_setRxIrq()
-{
-    uint8_t t[] = { CMD_SET_DIO_IRQ,
-                    static_cast<uint8_t>(IRQ_RX_GLOBAL >> 8),
-                    static_cast<uint8_t>(IRQ_RX_GLOBAL),       // global
-                    static_cast<uint8_t>(IRQ_RX_DIO1 >> 8),
-                    static_cast<uint8_t>(IRQ_RX_DIO1),         // DIO1
-                    0x00, 0x00,   // DIO2
-                    0x00, 0x00 }; // DIO3
-    _transact(t, nullptr, sizeof(t));
-}
-
-// ── _setTxIrq ─────────────────────────────────────────────────────────────
-// Configure DIO1 IRQ mask for transmit: TX_DONE | TIMEOUT.
-void LoRa::_setTxIrq()
-{
-    const uint16_t mask = IRQ_TX_MASK;
-    uint8_t t[] = { CMD_SET_DIO_IRQ,
-                    static_cast<uint8_t>(mask >> 8), static_cast<uint8_t>(mask),  // global
-                    static_cast<uint8_t>(mask >> 8), static_cast<uint8_t>(mask),  // DIO1
-                    0x00, 0x00,   // DIO2
-                    0x00, 0x00 }; // DIO3
-    _transact(t, nullptr, sizeof(t));
-}
-
 // ── _getChipMode ──────────────────────────────────────────────────────────
 // Returns the 3-bit chip mode from GetStatus bits [6:4]:
 //   2 = STBY_RC   3 = STBY_XOSC   4 = FS   5 = RX   6 = TX
@@ -262,21 +214,6 @@ uint8_t LoRa::_getChipMode()
     return (rx[1] >> 4) & 0x07;
 }
 
-// ── _getDeviceErrors ──────────────────────────────────────────────────────
-// Returns the 16-bit opError bitmask from GetDeviceErrors.
-//   bit 0  RC64K_CALIB_ERR     bit 1  RC13M_CALIB_ERR
-//   bit 2  PLL_CALIB_ERR       bit 3  ADC_CALIB_ERR
-//   bit 4  IMG_CALIB_ERR       bit 5  XOSC_START_ERR (TCXO didn't start)
-//   bit 6  PLL_LOCK_ERR        bit 8  PA_RAMP_ERR    (PA overcurrent / fault)
-// Layout: TX=[0x17,NOP,NOP,NOP]  RX=[0x00,status,err_H,err_L]
-uint16_t LoRa::_getDeviceErrors()
-{
-    uint8_t tx[4] = { CMD_GET_DEVICE_ERRORS, 0, 0, 0 };
-    uint8_t rx[4] = {};
-    _transact(tx, rx, sizeof(tx));
-    return (static_cast<uint16_t>(rx[2]) << 8) | rx[3];
-}
-
 // ── _getInstRssi ──────────────────────────────────────────────────────────
 // Returns the instantaneous RSSI reading while in RX mode (dBm, negative).
 // SX1262 GetRssiInst (0x15) layout — 3 bytes:
@@ -286,211 +223,12 @@ uint16_t LoRa::_getDeviceErrors()
 // Useful as a noise-floor check: −115 to −120 dBm = receiver is alive.
 int16_t LoRa::_getInstRssi()
 {
-    uint8_t tx[3] = { 0x15, 0x00, 0x00 };
+    uint8_t tx[3] = { CMD_GET_RSSI_INST, 0x00, 0x00 };
     uint8_t rx[3] = {};
     _transact(tx, rx, sizeof(tx));
     return -(static_cast<int16_t>(rx[2])) / 2;
 }
 
-// ── transmit ──────────────────────────────────────────────────────────────
-// Transmit a raw LoRa payload using direct GPIO polling — no ISR involvement.
-//
-// After SetTx the chip asserts BUSY HIGH during TCXO warm-up + PLL lock
-// (~5–10 ms on this board), then deasserts BUSY LOW when actively transmitting.
-// TX_DONE fires after the last bit leaves the antenna.
-//
-// Why polling instead of ISR:
-//   ulTaskNotifyTake fires on a rising edge of DIO1.  If DIO1 is already HIGH
-//   from an incompletely-cleared prior RX event, ClearIrq may not bring it LOW
-//   in time and there is NO rising edge when TX_DONE fires — the ISR never runs
-//   and ulTaskNotifyTake times out.
-//
-// Sequence:
-//   1  SetStandby(RC)        — valid from any state, including continuous RX
-//   2  ClearDeviceErrors     — clean slate for post-TX diagnostic
-//   3  SetRfFrequency        — force PLL recalibration (Rx→Tx errata)
-//   4  SetPktParams          — actual payload length
-//   5  WriteBuffer           — load payload
-//   6  SetDioIrqParams       — TX_DONE | TIMEOUT on DIO1
-//   7  Drain stale notifications
-//   8  ClearIrq              — bring DIO1 LOW before SetTx
-//   9  SetTx(0)              — begin transmission, no hardware timeout
-//  10  Poll BUSY HIGH        — confirms chip accepted SetTx
-//  11  Poll BUSY LOW         — chip entered TX mode (TCXO + PLL ready)
-//  12  Poll chip mode != TX  — TX_DONE (chip returns to STBY_RC)
-//  13  Read + clear IRQ, restore RX config, re-enter RX
-//
-// Must only be called from the LoRa task.
-bool LoRa::transmit(const uint8_t* data, uint8_t len)
-{
-#if !CONFIG_LORA_TX_ENABLED
-    return false;
-#endif
-
-    if (len == 0 || data == nullptr) return false;
-
-    ESP_LOGD(TAG, "TX: %u bytes", len);
-
-    // 1. Enter STBY_RC — always valid from any chip state
-    { uint8_t t[] = { CMD_SET_STANDBY, 0x00 };
-      _transact(t, nullptr, sizeof(t)); }
-
-    // 2. Clear any stale device errors from a previous failed TX
-    { uint8_t t[] = { CMD_CLEAR_DEVICE_ERRORS, 0x00, 0x00 };
-      _transact(t, nullptr, sizeof(t)); }
-
-    // 3. Re-issue SetRfFrequency to force a clean PLL lock (Rx→Tx errata)
-    _setFrequency(LORA_FREQ_HZ);
-
-    // 4. Set packet params with the exact TX payload length
-    { uint8_t t[] = { CMD_SET_PKT_PARAMS,
-                      0x00, 0x10, 0x00, len, 0x01, 0x00 };
-      _transact(t, nullptr, sizeof(t)); }
-
-    // 5. Load payload into SX1262 FIFO at TX base address (0x00)
-    _writeBuffer(0x00, data, len);
-
-    // 6. Configure DIO1 for TX events (TX_DONE | TIMEOUT)
-    _setTxIrq();
-
-    // 7. Discard any stale notification that the RX ISR may have queued
-    ulTaskNotifyTake(pdTRUE, 0);
-
-    // 8. Clear all IRQ flags and device errors before SetTx
-    _clearIrq(0xFFFF);
-
-    // 9. SetTx — no hardware timeout; chip transmits until TX_DONE
-    { uint8_t t[] = { CMD_SET_TX, 0x00, 0x00, 0x00 };
-      _transact(t, nullptr, sizeof(t)); }
-
-    // ── Phase A: confirm chip accepted SetTx (BUSY goes HIGH) ────────────
-    {
-        const TickType_t t0 = xTaskGetTickCount();
-        while (!gpio_get_level(PIN_BUSY))
-        {
-            if ((xTaskGetTickCount() - t0) >= pdMS_TO_TICKS(100))
-            {
-                const uint16_t errs = _getDeviceErrors();
-                const uint8_t  mode = _getChipMode();
-                ESP_LOGE(TAG,
-                    "TX: BUSY never HIGH — SetTx rejected "
-                    "(mode=0x%02x errs=0x%04x)", mode, errs);
-                portENTER_CRITICAL(&_statsLock);
-                _stats.txErrors++;
-                portEXIT_CRITICAL(&_statsLock);
-                _initSx1262(); _setRx();
-                return false;
-            }
-            vTaskDelay(1);
-        }
-    }
-
-    // ── Phase B: wait for BUSY LOW (TCXO warm + PLL locked, TX active) ───
-    _waitBusy(500);
-
-    // ── Phase B2: confirm chip is actually in TX mode (mode == 6) ────────
-    {
-        const uint8_t mode = _getChipMode();
-        if (mode != 0x06)
-        {
-            const uint16_t errs = _getDeviceErrors();
-            const uint16_t irqD = _getIrqStatus();
-            ESP_LOGE(TAG,
-                "TX: chip left TX mode immediately "
-                "(mode=0x%02x irq=0x%04x errs=0x%04x) — "
-                "PA_RAMP_ERR=%d XOSC_ERR=%d PLL_ERR=%d",
-                mode, irqD, errs,
-                (errs >> 8) & 1,   // bit 8 = PA_RAMP_ERR
-                (errs >> 5) & 1,   // bit 5 = XOSC_START_ERR
-                (errs >> 6) & 1);  // bit 6 = PLL_LOCK_ERR
-            _clearIrq(0xFFFF);
-            _setRxIrq();
-            { uint8_t t2[] = { CMD_SET_PKT_PARAMS,
-                               0x00, 0x10, 0x00, 0xFF, 0x01, 0x00 };
-              _transact(t2, nullptr, sizeof(t2)); }
-            portENTER_CRITICAL(&_statsLock);
-            _stats.txErrors++;
-            portEXIT_CRITICAL(&_statsLock);
-            _initSx1262(); _setRx();
-            return false;
-        }
-    }
-
-    // ── Phase C: poll GetStatus until chip exits TX mode ─────────────────
-    // The chip returns to STBY_RC (mode 2) when TX_DONE fires.
-    // Correct air time for SF11/BW250/CR4-5 @ ~80 bytes ≈ 970 ms.
-    // 4-second limit is generous for all supported presets.
-    {
-        const TickType_t t0 = xTaskGetTickCount();
-        while (true)
-        {
-            vTaskDelay(2); // 2 ms poll — well below the ~800 ms air time
-
-            const uint8_t mode = _getChipMode();
-            if (mode != 0x06)
-                break; // chip left TX mode — TX_DONE (or error)
-
-            if ((xTaskGetTickCount() - t0) >= pdMS_TO_TICKS(5000))
-            {
-                const uint16_t errs = _getDeviceErrors();
-                const uint16_t irqD = _getIrqStatus();
-                ESP_LOGE(TAG,
-                    "TX: chip stuck in TX after 5 s "
-                    "(mode=0x%02x irq=0x%04x errs=0x%04x)",
-                    mode, irqD, errs);
-                _clearIrq(0xFFFF);
-                _setRxIrq();
-                { uint8_t t2[] = { CMD_SET_PKT_PARAMS,
-                                   0x00, 0x10, 0x00, 0xFF, 0x01, 0x00 };
-                  _transact(t2, nullptr, sizeof(t2)); }
-                portENTER_CRITICAL(&_statsLock);
-                _stats.txTimeouts++;
-                portEXIT_CRITICAL(&_statsLock);
-                _initSx1262(); _setRx();
-                return false;
-            }
-        }
-    }
-
-    // ── Chip exited TX — check IRQ for TX_DONE ────────────────────────────
-    const uint16_t irq  = _getIrqStatus();
-    const uint16_t errs = _getDeviceErrors();
-    _clearIrq(0xFFFF);
-
-    // Restore RX IRQ mask and max-payload packet params
-    _setRxIrq();
-    { uint8_t t[] = { CMD_SET_PKT_PARAMS,
-                      0x00, 0x10, 0x00, 0xFF, 0x01, 0x00 };
-      _transact(t, nullptr, sizeof(t)); }
-
-    bool ok = false;
-    if (irq & IRQ_TX_DONE)
-    {
-        ESP_LOGD(TAG, "TX complete (%u bytes)", len);
-        portENTER_CRITICAL(&_statsLock);
-        _stats.txPackets++;
-        portEXIT_CRITICAL(&_statsLock);
-        ok = true;
-    }
-    else
-    {
-        ESP_LOGW(TAG,
-            "TX: chip exited TX but TX_DONE not set "
-            "(irq=0x%04x errs=0x%04x "
-            "PA_RAMP_ERR=%d XOSC_ERR=%d PLL_ERR=%d)",
-            irq, errs,
-            (errs >> 8) & 1,
-            (errs >> 5) & 1,
-            (errs >> 6) & 1);
-        portENTER_CRITICAL(&_statsLock);
-        _stats.txErrors++;
-        portEXIT_CRITICAL(&_statsLock);
-    }
-
-    _setRx();
-    return ok;
-}
-
 // ── _initSx1262 ───────────────────────────────────────────────────────────
 bool LoRa::_initSx1262()
 {
@@ -528,7 +266,7 @@ bool LoRa::_initSx1262()
     { uint8_t t[] = { CMD_SET_PACKET_TYPE, 0x01 }; _transact(t, nullptr, sizeof(t)); }
 
     // ── RF frequency ─────────────────────────────────────────────────────
-    _setFrequency(LORA_FREQ_HZ);
+    sx_setFrequency(*this, LORA_FREQ_HZ);
 
     // ── PA config for HP PA on SX1262 ─────────────────────────────────────
     // paDutyCycle=4, hpMax=7, deviceSel=0 (SX1262), paLut=1
@@ -573,7 +311,7 @@ bool LoRa::_initSx1262()
 
     // ── SX1262 Errata 15.3 — fix IQ polarity register ────────────────────
     // Must be called after every SetPacketParams.
-    _fixIqPolarity();
+    sx_fixIqPolarity(*this);
 
     // ── RX gain ──────────────────────────────────────────────────────────
     // 0x94 = normal LNA gain (default after reset, handles full input range).
@@ -581,7 +319,7 @@ bool LoRa::_initSx1262()
     // it reduces the maximum tolerable input level, causing CRC errors from
     // nearby nodes (e.g. at -29 dBm). With a noise floor of -104 dBm we
     // have >70 dB of link margin — sensitivity boost provides no benefit.
-    _writeReg(REG_RX_GAIN, 0x94);
+    sx_writeReg(*this, REG_RX_GAIN, 0x94);
 
     // ── Buffer base addresses (TX=0, RX=128 — separate regions to prevent
     //    overlap during the TX→RX transition) ────────────────────────────────
@@ -590,15 +328,15 @@ bool LoRa::_initSx1262()
 
     // ── LoRa sync word = Meshtastic (0x2B in RadioLib = 0x24B4 in regs)
     // RadioLib converts 0x2B → MSB=(sw & 0xF0)|0x04=0x24, LSB=((sw & 0x0F)<<4)|0x04=0xB4
-    _writeReg(REG_LORA_SYNC_MSB, SYNC_HI);
-    _writeReg(REG_LORA_SYNC_LSB, SYNC_LO);
+    sx_writeReg(*this, REG_LORA_SYNC_MSB, SYNC_HI);
+    sx_writeReg(*this, REG_LORA_SYNC_LSB, SYNC_LO);
 
     // ── DIO1 IRQ: RX_DONE | HEADER_ERR | CRC_ERROR | TIMEOUT ────────────
-    _setRxIrq();
+    sx_setRxIrq(*this);
 
     // ── Verify the sync word was written correctly ────────────────────────
-    const uint8_t s0 = _readReg(REG_LORA_SYNC_MSB);
-    const uint8_t s1 = _readReg(REG_LORA_SYNC_LSB);
+    const uint8_t s0 = sx_readReg(*this, REG_LORA_SYNC_MSB);
+    const uint8_t s1 = sx_readReg(*this, REG_LORA_SYNC_LSB);
     if (s0 != SYNC_HI || s1 != SYNC_LO)
     {
         ESP_LOGE(TAG, "SX1262 sync word readback failed (got 0x%02X%02X, want 0x%02X%02X) "
@@ -610,6 +348,6 @@ bool LoRa::_initSx1262()
              (unsigned)LORA_FREQ_HZ,
              (unsigned)((LORA_FREQ_HZ - 902125000) / 250000),
              SYNC_HI, SYNC_LO,
-             _readReg(REG_IQ_CONFIG), _readReg(REG_RX_GAIN));
+             sx_readReg(*this, REG_IQ_CONFIG), sx_readReg(*this, REG_RX_GAIN));
     return true;
 }
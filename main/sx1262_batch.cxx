@@ -0,0 +1,275 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * sx1262_batch.cxx — batched SX1262 command sequences (see sx1262_batch.h).
+ */
+
+#include "sx1262_batch.h"
+#include "sx1262_defs.h"
+#include <cstring>
+
+SxStatus sx_readStatus(SxBus& bus)
+{
+    // Reply layouts (byte 0 is clocked out during the opcode, byte 1 is the
+    // chip status):
+    //   GetIrqStatus       [-, status, irqH, irqL]
+    //   GetRxBufferStatus  [-, status, payloadLen, rxStartPtr]
+    //   GetPacketStatus    [-, status, rssiPkt, snrPkt, signalRssiPkt]
+    // Word-sized buffers keep DMA from bouncing through a copy.
+    alignas(4) uint8_t txIrq[4] = { CMD_GET_IRQ_STATUS, 0, 0, 0 };
+    alignas(4) uint8_t txBuf[4] = { CMD_GET_RX_BUF_STATUS, 0, 0, 0 };
+    alignas(4) uint8_t txPkt[4] = { CMD_GET_PKT_STATUS, 0, 0, 0 };
+    alignas(4) uint8_t txClr[4] = { CMD_CLEAR_IRQ, 0xFF, 0xFF, 0 };
+    alignas(4) uint8_t rxIrq[4] = {};
+    alignas(4) uint8_t rxBuf[4] = {};
+    alignas(4) uint8_t rxPkt[4] = {};
+
+    SxXfer x[4];
+    x[0] = { txIrq, rxIrq, 4 };
+    x[1] = { txBuf, rxBuf, 4 };
+    x[2] = { txPkt, rxPkt, 4 };
+    x[3] = { txClr, nullptr, 3 };
+    bus.transfer(x, 4);
+
+    SxStatus s;
+    s.irq        = static_cast<uint16_t>((rxIrq[2] << 8) | rxIrq[3]);
+    s.payloadLen = rxBuf[2];
+    s.rxPtr      = rxBuf[3];
+    s.rssi       = static_cast<int16_t>(-static_cast<int16_t>(rxPkt[2]) / 2);
+    s.snr        = static_cast<float>(static_cast<int8_t>(rxPkt[3])) / 4.0f;
+    return s;
+}
+
+void sx_readBuffer(SxBus& bus, uint8_t offset, uint8_t len, uint8_t* out)
+{
+    // ReadBuffer → [cmd, offset, NOP] then one byte per clocked NOP.
+    alignas(4) uint8_t tx[3 + 255] = { CMD_READ_BUFFER, offset, 0x00 };
+    alignas(4) uint8_t rx[3 + 255] = {};
+
+    const SxXfer x = { tx, rx, static_cast<uint16_t>(3 + len) };
+    bus.transfer(&x, 1);
+    memcpy(out, rx + 3, len);
+}
+
+// ReadRegister → [cmd, addrH, addrL, NOP, NOP]: the status byte comes back
+// on the first NOP and the register value on the second.
+uint8_t sx_readReg(SxBus& bus, uint16_t addr)
+{
+    alignas(4) uint8_t tx[5] = { CMD_READ_REGISTER,
+                                 static_cast<uint8_t>(addr >> 8),
+                                 static_cast<uint8_t>(addr), 0x00, 0x00 };
+    alignas(4) uint8_t rx[5] = {};
+
+    const SxXfer x = { tx, rx, 5 };
+    bus.transfer(&x, 1);
+    return rx[4];
+}
+
+void sx_writeReg(SxBus& bus, uint16_t addr, uint8_t val)
+{
+    alignas(4) uint8_t tx[4] = { CMD_WRITE_REGISTER,
+                                 static_cast<uint8_t>(addr >> 8),
+                                 static_cast<uint8_t>(addr), val };
+
+    const SxXfer x = { tx, nullptr, 4 };
+    bus.transfer(&x, 1);
+}
+
+// freq_reg = freqHz × 2^25 / 32 MHz, MSB first.
+static void _frequencyCmd(uint8_t (&tx)[8], uint32_t freqHz)
+{
+    const uint32_t reg =
+        static_cast<uint32_t>((static_cast<uint64_t>(freqHz) << 25) / 32000000ULL);
+    tx[0] = CMD_SET_RF_FREQ;
+    tx[1] = static_cast<uint8_t>(reg >> 24);
+    tx[2] = static_cast<uint8_t>(reg >> 16);
+    tx[3] = static_cast<uint8_t>(reg >>  8);
+    tx[4] = static_cast<uint8_t>(reg);
+}
+
+void sx_setFrequency(SxBus& bus, uint32_t freqHz)
+{
+    alignas(4) uint8_t tx[8];
+    _frequencyCmd(tx, freqHz);
+
+    const SxXfer x = { tx, nullptr, 5 };
+    bus.transfer(&x, 1);
+}
+
+// SetDioIrqParams → [cmd, globalH, globalL, dio1H, dio1L, dio2 ×2, dio3 ×2].
+// Events outside the DIO1 mask are still latched for GetIrqStatus.
+static void _dioIrqCmd(uint8_t (&tx)[12], uint16_t global, uint16_t dio1)
+{
+    tx[0] = CMD_SET_DIO_IRQ;
+    tx[1] = static_cast<uint8_t>(global >> 8);
+    tx[2] = static_cast<uint8_t>(global);
+    tx[3] = static_cast<uint8_t>(dio1 >> 8);
+    tx[4] = static_cast<uint8_t>(dio1);
+    tx[5] = tx[6] = tx[7] = tx[8] = 0x00;
+}
+
+// SetPacketParams: preamble 16, explicit header, @p len, CRC on, standard IQ.
+static void _pktParamsCmd(uint8_t (&tx)[8], uint8_t len)
+{
+    tx[0] = CMD_SET_PKT_PARAMS;
+    tx[1] = 0x00;
+    tx[2] = 0x10;
+    tx[3] = 0x00;
+    tx[4] = len;
+    tx[5] = 0x01;
+    tx[6] = 0x00;
+}
+
+void sx_setRxIrq(SxBus& bus)
+{
+    // PREAMBLE_DET and HEADER_VALID are visible in GetIrqStatus for the
+    // busy-channel check and diagnostics but do not wake the task.
+    alignas(4) uint8_t tx[12];
+    _dioIrqCmd(tx, IRQ_RX_GLOBAL, IRQ_RX_DIO1);
+
+    const SxXfer x = { tx, nullptr, 9 };
+    bus.transfer(&x, 1);
+}
+
+// SX1262 errata 15.3: register 0x0736 bit 2 resets to 1 (inverted IQ) and
+// SetPacketParams with standard IQ does not clear it.  Preamble and sync
+// word are still found, but every header fails.
+void sx_fixIqPolarity(SxBus& bus)
+{
+    const uint8_t val = sx_readReg(bus, REG_IQ_CONFIG);
+    sx_writeReg(bus, REG_IQ_CONFIG, static_cast<uint8_t>(val & ~0x04u));
+}
+
+void sx_setRx(SxBus& bus)
+{
+    // sx_fixIqPolarity() with its write batched together with SetRx.
+    // SetRx timeout 0xFFFFFF = continuous: the chip stays in RX and raises
+    // DIO1 for every packet or error.
+    const uint8_t iq = sx_readReg(bus, REG_IQ_CONFIG);
+
+    alignas(4) uint8_t txIq[4] = { CMD_WRITE_REGISTER,
+                                   static_cast<uint8_t>(REG_IQ_CONFIG >> 8),
+                                   static_cast<uint8_t>(REG_IQ_CONFIG),
+                                   static_cast<uint8_t>(iq & ~0x04u) };
+    alignas(4) uint8_t txRx[4] = { CMD_SET_RX, 0xFF, 0xFF, 0xFF };
+
+    SxXfer x[2];
+    x[0] = { txIq, nullptr, 4 };
+    x[1] = { txRx, nullptr, 4 };
+    bus.transfer(x, 2);
+}
+
+void sx_startCad(SxBus& bus, uint8_t sf)
+{
+    // 2 symbols, detPeak = SF + 13, detMin = 10: RadioLib's (and so stock
+    // Meshtastic's) values for 2-symbol scans.  Exit mode CAD_ONLY leaves
+    // the chip in STBY_RC, ready for SetTx.
+    alignas(4) uint8_t txStby[4] = { CMD_SET_STANDBY, 0x00 };
+    alignas(4) uint8_t txCad[8]  = { CMD_SET_CAD_PARAMS,
+                                     0x01,                               // CAD_ON_2_SYMB
+                                     static_cast<uint8_t>(sf + 13),      // cadDetPeak
+                                     10,                                 // cadDetMin
+                                     0x00,                               // CAD_ONLY
+                                     0x00, 0x00, 0x00 };                 // cadTimeout (CAD_RX only)
+    alignas(4) uint8_t txIrq[12];
+    _dioIrqCmd(txIrq, IRQ_CAD_MASK, IRQ_CAD_DONE);
+
+    SxXfer x[3];
+    x[0] = { txStby, nullptr, 2 };
+    x[1] = { txCad,  nullptr, 8 };
+    x[2] = { txIrq,  nullptr, 9 };
+    bus.transfer(x, 3);
+
+    bus.dio1Remapped();
+
+    alignas(4) uint8_t txClr[4] = { CMD_CLEAR_IRQ, 0xFF, 0xFF };
+    alignas(4) uint8_t txGo[4]  = { CMD_SET_CAD };
+    x[0] = { txClr, nullptr, 3 };
+    x[1] = { txGo,  nullptr, 1 };
+    bus.transfer(x, 2);
+}
+
+void sx_startTx(SxBus& bus, uint32_t freqHz, const uint8_t* data, uint8_t len,
+                uint32_t timeout)
+{
+    // STBY_RC is valid from any state, continuous RX included.  Device
+    // errors are cleared so a failure can be diagnosed afterwards, and
+    // SetRfFrequency is re-issued to force a clean PLL lock (Rx→Tx errata).
+    alignas(4) uint8_t txStby[4] = { CMD_SET_STANDBY, 0x00 };
+    alignas(4) uint8_t txErr[4]  = { CMD_CLEAR_DEVICE_ERRORS, 0x00, 0x00 };
+    alignas(4) uint8_t txFreq[8];
+    alignas(4) uint8_t txPkt[8];
+    _frequencyCmd(txFreq, freqHz);
+    _pktParamsCmd(txPkt, len);
+
+    SxXfer x[4];
+    x[0] = { txStby, nullptr, 2 };
+    x[1] = { txErr,  nullptr, 3 };
+    x[2] = { txFreq, nullptr, 5 };
+    x[3] = { txPkt,  nullptr, 7 };
+    bus.transfer(x, 4);
+
+    // WriteBuffer → [cmd, offset, data…] at the TX base address 0.
+    alignas(4) uint8_t txBuf[2 + 255] = { CMD_WRITE_BUFFER, 0x00 };
+    memcpy(txBuf + 2, data, len);
+    alignas(4) uint8_t txIrq[12];
+    _dioIrqCmd(txIrq, IRQ_TX_MASK, IRQ_TX_MASK);
+
+    x[0] = { txBuf, nullptr, static_cast<uint16_t>(2 + len) };
+    x[1] = { txIrq, nullptr, 9 };
+    bus.transfer(x, 2);
+
+    bus.dio1Remapped();
+
+    // ClearIrq brings DIO1 low so TX_DONE produces a rising edge.  The
+    // SetTx timeout is in units of 15.625 µs.
+    alignas(4) uint8_t txClr[4] = { CMD_CLEAR_IRQ, 0xFF, 0xFF };
+    alignas(4) uint8_t txGo[4]  = { CMD_SET_TX,
+                                    static_cast<uint8_t>(timeout >> 16),
+                                    static_cast<uint8_t>(timeout >> 8),
+                                    static_cast<uint8_t>(timeout) };
+    x[0] = { txClr, nullptr, 3 };
+    x[1] = { txGo,  nullptr, 4 };
+    bus.transfer(x, 2);
+}
+
+void sx_endTx(SxBus& bus)
+{
+    alignas(4) uint8_t txIrq[12];
+    alignas(4) uint8_t txPkt[8];
+    _dioIrqCmd(txIrq, IRQ_RX_GLOBAL, IRQ_RX_DIO1);
+    _pktParamsCmd(txPkt, 0xFF);
+
+    SxXfer x[2];
+    x[0] = { txIrq, nullptr, 9 };
+    x[1] = { txPkt, nullptr, 7 };
+    bus.transfer(x, 2);
+}
+
+// GetDeviceErrors → [-, status, errH, errL].  bit 5 XOSC_START_ERR,
+// bit 6 PLL_LOCK_ERR, bit 8 PA_RAMP_ERR; the low bits are calibration.
+uint16_t sx_getDeviceErrors(SxBus& bus)
+{
+    alignas(4) uint8_t tx[4] = { CMD_GET_DEVICE_ERRORS, 0, 0, 0 };
+    alignas(4) uint8_t rx[4] = {};
+
+    const SxXfer x = { tx, rx, 4 };
+    bus.transfer(&x, 1);
+    return static_cast<uint16_t>((rx[2] << 8) | rx[3]);
+}
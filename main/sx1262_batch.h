@@ -0,0 +1,123 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * sx1262_batch.h — batched SX1262 command sequences.
+ *
+ * Every SX1262 command is its own NSS frame, and the chip must have BUSY low
+ * before each one.  Rather than wait for BUSY and run a blocking transfer
+ * per command, callers hand whole sequences to an SxBus, which queues them
+ * back to back and waits once for the lot:
+ *
+ *   wakeup     GetIrqStatus, GetRxBufferStatus, GetPacketStatus, ClearIrq
+ *   payload    ReadBuffer                      (only after a good RX_DONE)
+ *   RX entry   ReadRegister(IQ) | WriteRegister(IQ), SetRx
+ *   CAD        SetStandby, SetCadParams, SetDioIrqParams | ClearIrq, SetCad
+ *   TX         SetStandby, ClearDeviceErrors, SetRfFrequency, SetPacketParams
+ *              | WriteBuffer, SetDioIrqParams | ClearIrq, SetTx
+ *   TX end     SetDioIrqParams, SetPacketParams
+ *
+ * ("|" separates round trips.)  Two bus round trips per received packet
+ * instead of five.  The ordering inside a batch is preserved, so ClearIrq
+ * still lands after the status it clears has been read.
+ *
+ * These are the only copies of the sequences: LoRa implements SxBus with
+ * queued DMA transactions, and the host tests run the same functions
+ * against a simulated chip.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+static constexpr size_t SX_BATCH_MAX = 4;   ///< transfers in the largest batch
+
+/// One SX1262 command: @p len bytes out of @p tx, the same number into @p rx.
+struct SxXfer {
+    const uint8_t* tx  = nullptr;
+    uint8_t*       rx  = nullptr;   ///< may be null when the reply is not needed
+    uint16_t       len = 0;
+};
+
+/**
+ * Transport for command batches.  transfer() runs @p n transfers in order,
+ * each in its own NSS frame with BUSY low before it, and returns when all
+ * of them have completed.
+ */
+class SxBus
+{
+public:
+    virtual void transfer(const SxXfer* xfers, size_t n) = 0;
+
+    /// Called once DIO1 has been pointed at new IRQ sources, before the
+    /// flags are cleared: drop any wakeup the old mapping already queued.
+    virtual void dio1Remapped() {}
+
+protected:
+    ~SxBus() = default;
+};
+
+/// Radio state read at the top of every run-loop wakeup.
+struct SxStatus {
+    uint16_t irq        = 0;    ///< IRQ flags, cleared on the chip by the same batch
+    uint8_t  payloadLen = 0;    ///< GetRxBufferStatus: last packet length
+    uint8_t  rxPtr      = 0;    ///< GetRxBufferStatus: last packet start
+    int16_t  rssi       = 0;    ///< GetPacketStatus: packet RSSI, dBm
+    float    snr        = 0.f;  ///< GetPacketStatus: packet SNR, dB
+};
+
+/// Read IRQ, RX buffer and packet status, then clear every IRQ: one batch.
+SxStatus sx_readStatus(SxBus& bus);
+
+/// Read @p len bytes of the data buffer at @p offset into @p out: one transfer.
+void sx_readBuffer(SxBus& bus, uint8_t offset, uint8_t len, uint8_t* out);
+
+/// ReadRegister: one transfer.
+uint8_t sx_readReg(SxBus& bus, uint16_t addr);
+
+/// WriteRegister: one transfer.
+void sx_writeReg(SxBus& bus, uint16_t addr, uint8_t val);
+
+/// SetRfFrequency: one transfer.
+void sx_setFrequency(SxBus& bus, uint32_t freqHz);
+
+/// Receive IRQ mapping: one transfer.
+void sx_setRxIrq(SxBus& bus);
+
+/// Clear the inverted-IQ bit left set by SetPacketParams (errata 15.3):
+/// read, then write back.
+void sx_fixIqPolarity(SxBus& bus);
+
+/// Fix the IQ polarity, then enter continuous RX: two round trips.
+void sx_setRx(SxBus& bus);
+
+/// Start a 2-symbol CAD scan at spreading factor @p sf: two round trips.
+void sx_startCad(SxBus& bus, uint8_t sf);
+
+/// Load @p len bytes and start transmitting on @p freqHz; the chip raises
+/// TIMEOUT after @p timeout × 15.625 µs without TX_DONE.  Three round trips.
+void sx_startTx(SxBus& bus, uint32_t freqHz, const uint8_t* data, uint8_t len,
+                uint32_t timeout);
+
+/// Restore the receive IRQ mapping and maximum payload length after a
+/// transmission: one batch.
+void sx_endTx(SxBus& bus);
+
+/// GetDeviceErrors opError bitmask: one transfer.
+uint16_t sx_getDeviceErrors(SxBus& bus);
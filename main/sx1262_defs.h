@@ -0,0 +1,88 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * sx1262_defs.h — SX1262 opcodes, register addresses and IRQ bits.
+ *
+ * SX1261/2 datasheet §13.  Platform-free: the driver (sx1262.cxx), the
+ * batched command sequences (sx1262_batch.cxx), the radio core
+ * (mesh_radio.cxx) and the host-side chip simulator all take the values
+ * from here.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+// ── SX1262 opcodes ────────────────────────────────────────────────────────
+static constexpr uint8_t CMD_SET_STANDBY         = 0x80;
+static constexpr uint8_t CMD_SET_RX              = 0x82;
+static constexpr uint8_t CMD_SET_TX              = 0x83;
+static constexpr uint8_t CMD_SET_PACKET_TYPE     = 0x8A;
+static constexpr uint8_t CMD_SET_RF_FREQ         = 0x86;
+static constexpr uint8_t CMD_SET_PA_CONFIG       = 0x95;
+static constexpr uint8_t CMD_SET_TX_PARAMS       = 0x8E;
+static constexpr uint8_t CMD_SET_MOD_PARAMS      = 0x8B;
+static constexpr uint8_t CMD_SET_PKT_PARAMS      = 0x8C;
+static constexpr uint8_t CMD_SET_BUF_BASE_ADDR   = 0x8F;
+static constexpr uint8_t CMD_SET_DIO_IRQ         = 0x08;
+static constexpr uint8_t CMD_GET_IRQ_STATUS      = 0x12;
+static constexpr uint8_t CMD_CLEAR_IRQ           = 0x02;
+static constexpr uint8_t CMD_GET_RX_BUF_STATUS   = 0x13;
+static constexpr uint8_t CMD_GET_PKT_STATUS      = 0x14;
+static constexpr uint8_t CMD_READ_BUFFER         = 0x1E;
+static constexpr uint8_t CMD_WRITE_BUFFER        = 0x0E;
+static constexpr uint8_t CMD_WRITE_REGISTER      = 0x0D;
+static constexpr uint8_t CMD_READ_REGISTER       = 0x1D;
+static constexpr uint8_t CMD_SET_REGULATOR_MODE  = 0x96;
+static constexpr uint8_t CMD_CALIBRATE           = 0x89;
+static constexpr uint8_t CMD_CALIBRATE_IMAGE     = 0x98;
+static constexpr uint8_t CMD_SET_DIO2_RF_SWITCH  = 0x9D;
+static constexpr uint8_t CMD_SET_DIO3_TCXO       = 0x97;
+static constexpr uint8_t CMD_GET_STATUS          = 0xC0;
+static constexpr uint8_t CMD_GET_DEVICE_ERRORS   = 0x17;
+static constexpr uint8_t CMD_CLEAR_DEVICE_ERRORS = 0x07;
+static constexpr uint8_t CMD_SET_CAD_PARAMS      = 0x88;
+static constexpr uint8_t CMD_SET_CAD             = 0xC5;
+static constexpr uint8_t CMD_GET_RSSI_INST       = 0x15;
+
+// ── SX1262 register addresses ─────────────────────────────────────────────
+static constexpr uint16_t REG_LORA_SYNC_MSB = 0x0740; // LoRa sync word byte 0
+static constexpr uint16_t REG_LORA_SYNC_LSB = 0x0741; // LoRa sync word byte 1
+static constexpr uint16_t REG_IQ_CONFIG     = 0x0736; // IQ polarity (errata 15.3)
+static constexpr uint16_t REG_RX_GAIN       = 0x08AC; // RX LNA gain mode
+
+// ── IRQ bit masks (SX1262 Table 13-29, verified against RadioLib) ─────────
+static constexpr uint16_t IRQ_TX_DONE      = (1u << 0);
+static constexpr uint16_t IRQ_RX_DONE      = (1u << 1);
+static constexpr uint16_t IRQ_PREAMBLE_DET = (1u << 2);
+static constexpr uint16_t IRQ_HEADER_VALID = (1u << 4);
+static constexpr uint16_t IRQ_HEADER_ERR   = (1u << 5);
+static constexpr uint16_t IRQ_CRC_ERROR    = (1u << 6);
+static constexpr uint16_t IRQ_CAD_DONE     = (1u << 7);
+static constexpr uint16_t IRQ_CAD_DETECTED = (1u << 8);
+static constexpr uint16_t IRQ_TIMEOUT      = (1u << 9);
+
+// DIO1 mask — events that wake the task via ISR
+static constexpr uint16_t IRQ_RX_DIO1   = IRQ_RX_DONE | IRQ_HEADER_ERR |
+                                           IRQ_CRC_ERROR | IRQ_TIMEOUT;
+// Global mask — events visible in GetIrqStatus (superset of DIO1).
+static constexpr uint16_t IRQ_RX_GLOBAL = IRQ_RX_DIO1 | IRQ_PREAMBLE_DET |
+                                           IRQ_HEADER_VALID;
+static constexpr uint16_t IRQ_TX_MASK   = IRQ_TX_DONE | IRQ_TIMEOUT;
+static constexpr uint16_t IRQ_CAD_MASK  = IRQ_CAD_DONE | IRQ_CAD_DETECTED;
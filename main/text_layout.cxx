@@ -0,0 +1,277 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * text_layout.cxx — UTF-8 decoding and word wrap for the TFT (see
+ * text_layout.h).
+ */
+
+#include "text_layout.h"
+
+#include <cstring>
+
+namespace {
+
+// ── Code point → glyphs ───────────────────────────────────────────────────
+
+// Base letter of U+00C0‥U+017F; '?' entries are in FOLD.
+const char LATIN_BASE[] =
+    "AAAAAA?CEEEEIIIIDNOOOOOxOUUUUY??"  // U+00C0
+    "aaaaaa?ceeeeiiiidnooooo/ouuuuy?y"  // U+00E0
+    "AaAaAaCcCcCcCcDdDdEeEeEeEeEeGgGg"  // U+0100
+    "GgGgHhHhIiIiIiIiIi??JjKkkLlLlLlL"  // U+0120
+    "lLlNnNnNnnNnOoOoOo??RrRrRrSsSsSs"  // U+0140
+    "SsTtTtTtUuUuUuUuUuUuWwYyYZzZzZzs"; // U+0160
+
+struct Fold {
+    uint32_t    cp;
+    const char* ascii;      ///< "" = zero width
+};
+
+// Sorted by code point.
+const Fold FOLD[] = {
+    { 0x00A0, " "   }, { 0x00A1, "!"   }, { 0x00A2, "c"   }, { 0x00A3, "GBP" },
+    { 0x00A5, "JPY" }, { 0x00A6, "|"   }, { 0x00A7, "S"   }, { 0x00A8, "\""  },
+    { 0x00A9, "(c)" }, { 0x00AA, "a"   }, { 0x00AB, "\""  }, { 0x00AC, "-"   },
+    { 0x00AD, ""    }, { 0x00AE, "(R)" }, { 0x00AF, "-"   }, { 0x00B0, "o"   },
+    { 0x00B1, "+-"  }, { 0x00B2, "2"   }, { 0x00B3, "3"   }, { 0x00B4, "'"   },
+    { 0x00B5, "u"   }, { 0x00B6, "P"   }, { 0x00B7, "."   }, { 0x00B8, ","   },
+    { 0x00B9, "1"   }, { 0x00BA, "o"   }, { 0x00BB, "\""  }, { 0x00BC, "1/4" },
+    { 0x00BD, "1/2" }, { 0x00BE, "3/4" }, { 0x00BF, "?"   }, { 0x00C6, "AE"  },
+    { 0x00DE, "Th"  }, { 0x00DF, "ss"  }, { 0x00E6, "ae"  }, { 0x00FE, "th"  },
+    { 0x0132, "IJ"  }, { 0x0133, "ij"  }, { 0x0152, "OE"  }, { 0x0153, "oe"  },
+    { 0x200B, ""    }, { 0x200C, ""    }, { 0x200E, ""    }, { 0x200F, ""    },
+    { 0x2010, "-"   }, { 0x2011, "-"   }, { 0x2012, "-"   }, { 0x2013, "-"   },
+    { 0x2014, "-"   }, { 0x2015, "-"   }, { 0x2018, "'"   }, { 0x2019, "'"   },
+    { 0x201A, ","   }, { 0x201B, "'"   }, { 0x201C, "\""  }, { 0x201D, "\""  },
+    { 0x201E, "\""  }, { 0x2020, "+"   }, { 0x2022, "*"   }, { 0x2026, "..." },
+    { 0x202F, " "   }, { 0x2032, "'"   }, { 0x2033, "\""  }, { 0x2039, "<"   },
+    { 0x203A, ">"   }, { 0x2060, ""    }, { 0x20AC, "EUR" }, { 0x2122, "TM"  },
+    { 0x2190, "<-"  }, { 0x2192, "->"  }, { 0x2212, "-"   }, { 0x2264, "<="  },
+    { 0x2265, ">="  }, { 0xFEFF, ""    },
+};
+
+const char* fold(uint32_t cp)
+{
+    size_t lo = 0, hi = sizeof(FOLD) / sizeof(FOLD[0]);
+    while (lo < hi)
+    {
+        const size_t mid = (lo + hi) / 2;
+        if (FOLD[mid].cp < cp)      lo = mid + 1;
+        else if (FOLD[mid].cp > cp) hi = mid;
+        else                        return FOLD[mid].ascii;
+    }
+    return nullptr;
+}
+
+bool isPictograph(uint32_t cp)
+{
+    return (cp >= 0x2300  && cp <= 0x23FF)  ||     // ⌚ ⏰
+           (cp >= 0x25A0  && cp <= 0x27BF)  ||     // shapes, ☀ ✅, dingbats
+           (cp >= 0x2B00  && cp <= 0x2BFF)  ||     // ⭐ ⬆
+           (cp >= 0x1F000 && cp <= 0x1FAFF);       // emoji proper
+}
+
+bool isZeroWidth(uint32_t cp)
+{
+    return (cp >= 0x0300  && cp <= 0x036F)  ||     // combining accents (after NFD)
+           (cp >= 0x20D0  && cp <= 0x20FF)  ||     // combining marks for symbols (keycap)
+           (cp >= 0xFE00  && cp <= 0xFE0F)  ||     // variation selectors
+           (cp >= 0x1F3FB && cp <= 0x1F3FF) ||     // skin tones
+           (cp >= 0xE0000 && cp <= 0xE01EF);       // tags, variation selectors supplement
+}
+
+// ── UTF-8 ─────────────────────────────────────────────────────────────────
+
+static constexpr uint32_t BAD       = 0xFFFFFFFF;   // malformed: one byte consumed
+static constexpr uint32_t TRUNCATED = 0xFFFFFFFE;   // sequence runs into the end or a NUL
+
+/// Next code point from [p, end); advances @p p.
+uint32_t next(const uint8_t*& p, const uint8_t* end)
+{
+    const uint8_t b = *p++;
+    if (b < 0x80) return b;
+
+    uint32_t cp;
+    size_t   more;
+    uint32_t min;
+    if      ((b & 0xE0) == 0xC0) { cp = b & 0x1F; more = 1; min = 0x80;    }
+    else if ((b & 0xF0) == 0xE0) { cp = b & 0x0F; more = 2; min = 0x800;   }
+    else if ((b & 0xF8) == 0xF0) { cp = b & 0x07; more = 3; min = 0x10000; }
+    else return BAD;
+
+    for (size_t i = 0; i < more; i++)
+    {
+        if (p == end || *p == 0) return TRUNCATED;
+        if ((*p & 0xC0) != 0x80) return BAD;
+        cp = cp << 6 | (*p++ & 0x3F);
+    }
+    if (cp < min || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) return BAD;
+    return cp;
+}
+
+/// text_decode(), also reporting whether glyphs were left out for lack
+/// of room.
+size_t decode(const char* utf8, size_t len, char* out, size_t cap, bool& cut)
+{
+    const uint8_t* p   = reinterpret_cast<const uint8_t*>(utf8);
+    const uint8_t* end = p + len;
+    size_t n       = 0;
+    bool   joined  = false;     // last code point was a ZWJ
+    bool   flag    = false;     // odd regional indicator: the next completes a flag
+    cut = false;
+
+    while (p < end && *p)
+    {
+        const uint32_t cp = next(p, end);
+        if (cp == TRUNCATED) break;
+
+        const char* glyphs;
+        char        one[2] = {};
+        const bool  wasJoined = joined;
+        joined = false;
+
+        if (cp == BAD)                          { one[0] = TEXT_FALLBACK; glyphs = one; }
+        else if (cp == '\n')                    glyphs = "\n";
+        else if (cp == '\t')                    glyphs = " ";
+        else if (cp < 0x20 || cp == 0x7F ||
+                 (cp >= 0x80 && cp < 0xA0))     glyphs = "";
+        else if (cp < 0x7F)                     { one[0] = static_cast<char>(cp); glyphs = one; }
+        else if (cp == 0x200D)                  { joined = true; glyphs = ""; }
+        else if (cp >= 0x1F1E6 && cp <= 0x1F1FF)
+        {
+            flag   = !flag;
+            one[0] = TEXT_PICTOGRAPH;
+            glyphs = flag ? one : "";           // two letters, one flag
+        }
+        else if (const char* f = fold(cp))      glyphs = f;
+        else if (cp >= 0xC0 && cp < 0x180)      { one[0] = LATIN_BASE[cp - 0xC0]; glyphs = one; }
+        else if (cp >= 0x2000 && cp <= 0x200A)  glyphs = " ";
+        else if (isZeroWidth(cp))               glyphs = "";
+        else if (isPictograph(cp))
+        {
+            one[0] = TEXT_PICTOGRAPH;
+            glyphs = wasJoined ? "" : one;      // 👨‍👩‍👧 is one family
+        }
+        else                                    { one[0] = TEXT_FALLBACK; glyphs = one; }
+
+        const size_t k = strlen(glyphs);
+        if (n + k > cap)
+        {
+            cut = true;
+            break;
+        }
+        memcpy(out + n, glyphs, k);
+        n += k;
+    }
+    return n;
+}
+
+uint32_t measure(const FontDef& font, const char* g, size_t n)
+{
+    uint32_t w = 0;
+    for (size_t i = 0; i < n; i++) w += font_advance(font, g[i]);
+    return w;
+}
+
+} // namespace
+
+size_t text_decode(const char* utf8, size_t len, char* out, size_t cap)
+{
+    bool cut;
+    return decode(utf8, len, out, cap, cut);
+}
+
+void text_layout(TextLayout& out, const char* utf8, size_t len,
+                 const FontDef& font, uint16_t maxWidth, uint8_t maxLines)
+{
+    out = TextLayout{};
+    if (maxLines > TEXT_MAX_LINES) maxLines = TEXT_MAX_LINES;
+
+    char   g[TEXT_MAX_GLYPHS];
+    bool   cut;
+    const size_t n = decode(utf8, len, g, sizeof(g), cut);
+
+    // ── Wrap: [s, e) of g per line ────────────────────────────────────────
+    size_t ls[TEXT_MAX_LINES], le[TEXT_MAX_LINES];
+    size_t i = 0;
+    while (i < n && out.lines < maxLines)
+    {
+        const size_t s = i;
+        size_t   j     = s;
+        size_t   space = n;             // last space that fitted
+        uint32_t w     = 0;
+        while (j < n && g[j] != '\n')
+        {
+            const uint32_t a = font_advance(font, g[j]);
+            if (w + a > maxWidth) break;
+            if (g[j] == ' ') space = j;
+            w += a;
+            j++;
+        }
+
+        // Break at the newline, at the space that overflowed, after the
+        // last space that fitted, or — one word wider than the line —
+        // inside the word.
+        const bool hard = j < n && g[j] == '\n';
+        size_t e, next;
+        if (j == n || hard)              { e = j;     next = hard ? j + 1 : j; }
+        else if (g[j] == ' ')            { e = j;     next = j + 1; }
+        else if (space < n && space > s) { e = space; next = space + 1; }
+        else                             { e = j > s ? j : s + 1; next = e; }
+
+        while (e > s && g[e - 1] == ' ') e--;
+        if (!hard)
+            while (next < n && g[next] == ' ') next++;     // no leading spaces on a wrapped line
+
+        ls[out.lines] = s;
+        le[out.lines] = e;
+        out.lines++;
+        i = next;
+    }
+    out.truncated = cut || i < n;
+
+    // ── Ellipsis on the last line ─────────────────────────────────────────
+    if (out.truncated && out.lines > 0)
+    {
+        const size_t   s    = ls[out.lines - 1];
+        size_t&        e    = le[out.lines - 1];
+        const uint32_t dots = 3 * font_advance(font, '.');
+        while (e > s && measure(font, g + s, e - s) + dots > maxWidth) e--;
+        while (e > s && g[e - 1] == ' ') e--;
+    }
+
+    // ── Lines into text, NUL-terminated ───────────────────────────────────
+    size_t pos = 0;
+    for (uint8_t k = 0; k < out.lines; k++)
+    {
+        const size_t count = le[k] - ls[k];
+        out.start[k] = static_cast<uint16_t>(pos);
+        memcpy(out.text + pos, g + ls[k], count);
+        pos += count;
+        uint32_t w = measure(font, g + ls[k], count);
+        if (out.truncated && k == out.lines - 1)
+        {
+            memcpy(out.text + pos, "...", 3);
+            pos += 3;
+            w   += 3 * font_advance(font, '.');
+        }
+        out.text[pos++] = '\0';
+        out.width[k] = static_cast<uint8_t>(w);
+    }
+}
@@ -0,0 +1,80 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * text_layout.h — UTF-8 text laid out in lines for the TFT.
+ *
+ * iOS sends notification titles and messages as UTF-8; the TFT fonts have
+ * the 95 printable ASCII glyphs.  text_decode() turns UTF-8 into glyphs
+ * once: accented Latin letters fold to their base letter (é → e, ß → ss),
+ * typographic punctuation to its ASCII look-alike (’ → ', … → ...),
+ * pictographs — a whole emoji sequence, modifiers and joiners included —
+ * to TEXT_PICTOGRAPH, and anything else to TEXT_FALLBACK.  Newlines break
+ * lines; malformed bytes show as TEXT_FALLBACK; a sequence cut off by the
+ * end of the buffer (ANCS truncates attributes) is dropped.
+ *
+ * text_layout() measures the glyphs in a font and word-wraps them into at
+ * most maxLines lines of maxWidth pixels, ending the last one with "..."
+ * when the text does not fit.  The lines are kept NUL-terminated in the
+ * TextLayout, ready for TFT::drawText(), so a screen drawn again from the
+ * same layout costs no decoding or measuring.
+ */
+
+#pragma once
+
+#include "fonts.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#ifndef TEXT_MAX_GLYPHS
+#define TEXT_MAX_GLYPHS 192     ///< decoded glyphs per text; the rest is cut
+#endif
+
+#ifndef TEXT_MAX_LINES
+#define TEXT_MAX_LINES 8
+#endif
+
+static constexpr char TEXT_FALLBACK   = '?';
+static constexpr char TEXT_PICTOGRAPH = '*';
+
+struct TextLayout {
+    /// Lines, each NUL-terminated, one after the other; "..." included.
+    char     text[TEXT_MAX_GLYPHS + TEXT_MAX_LINES + 4] = {};
+    uint16_t start[TEXT_MAX_LINES] = {};     ///< offset of each line in text
+    uint8_t  width[TEXT_MAX_LINES] = {};     ///< pixels, ≤ maxWidth
+    uint8_t  lines     = 0;
+    bool     truncated = false;              ///< text did not fit; last line ends "..."
+
+    const char* line(uint8_t i) const { return text + start[i]; }
+};
+
+/**
+ * Decode @p len bytes of UTF-8 at @p utf8 (stopping early at a NUL) into
+ * printable ASCII glyphs and '\n', at most @p cap of them.
+ * @return glyphs written to @p out (not NUL-terminated).
+ */
+size_t text_decode(const char* utf8, size_t len, char* out, size_t cap);
+
+/**
+ * Lay out @p utf8 (up to @p len bytes or a NUL) in @p font, wrapping at
+ * spaces — or inside a word too long for a line — into at most
+ * @p maxLines (≤ TEXT_MAX_LINES) lines no wider than @p maxWidth.
+ */
+void text_layout(TextLayout& out, const char* utf8, size_t len,
+                 const FontDef& font, uint16_t maxWidth, uint8_t maxLines);
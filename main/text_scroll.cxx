@@ -0,0 +1,137 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * text_scroll.cxx — scroll timing and row-band text drawing (see
+ * text_scroll.h).
+ */
+
+#include "text_scroll.h"
+
+void TextScroll::start(uint16_t textRows, uint16_t windowRows, uint32_t nowMs)
+{
+    _window = windowRows;
+    _max    = textRows > windowRows ? static_cast<uint16_t>(textRows - windowRows) : 0;
+    _offset = 0;
+    _since  = nowMs;
+    _phase  = _max ? Phase::Top : Phase::Idle;
+}
+
+bool TextScroll::step(uint32_t nowMs, TextScrollStep& out)
+{
+    const uint32_t stepMs = _timing.stepMs ? _timing.stepMs : 1;
+
+    switch (_phase) {
+        case Phase::Idle:
+            return false;
+
+        case Phase::Top:
+            if (nowMs - _since < _timing.holdMs) return false;
+            _phase  = Phase::Scroll;
+            _since += _timing.holdMs;       // keep the cadence if woken late
+            [[fallthrough]];
+
+        case Phase::Scroll: {
+            const uint32_t moved  = (nowMs - _since) / stepMs * _timing.stepPx;
+            const uint16_t target = moved < _max ? static_cast<uint16_t>(moved) : _max;
+            if (target == _offset) return false;
+            out.offset = target;
+            out.delta  = static_cast<uint16_t>(target - _offset);
+            out.full   = out.delta >= _window;
+            _offset = target;
+            if (_offset == _max) {
+                _phase = Phase::End;
+                _since = nowMs;
+            }
+            return true;
+        }
+
+        case Phase::End:
+            if (nowMs - _since < _timing.endHoldMs) return false;
+            _phase  = Phase::Top;
+            _since  = nowMs;
+            _offset = 0;
+            out.offset = 0;
+            out.delta  = 0;
+            out.full   = true;
+            return true;
+    }
+    return false;
+}
+
+uint32_t TextScroll::waitMs(uint32_t nowMs) const
+{
+    const uint32_t elapsed = nowMs - _since;
+    switch (_phase) {
+        case Phase::Idle:
+            break;
+        case Phase::Top:
+            return elapsed < _timing.holdMs ? _timing.holdMs - elapsed : 0;
+        case Phase::Scroll: {
+            const uint32_t stepMs = _timing.stepMs ? _timing.stepMs : 1;
+            return stepMs - elapsed % stepMs;
+        }
+        case Phase::End:
+            return elapsed < _timing.endHoldMs ? _timing.endHoldMs - elapsed : 0;
+    }
+    return UINT32_MAX;
+}
+
+void text_drawRows(const TextLayout& layout, const FontDef& font,
+                   uint16_t fg, uint16_t bg, uint16_t firstRow, uint16_t rows,
+                   uint16_t* dst, uint16_t width, uint32_t stride)
+{
+    uint16_t r = 0;
+    while (r < rows)
+    {
+        // The part of one line of text that falls in the band.
+        const uint32_t row  = firstRow + r;
+        const uint32_t line = row / font.height;
+        const uint32_t top  = row % font.height;
+        const uint32_t left = static_cast<uint32_t>(rows - r);
+        const uint32_t n    = font.height - top < left ? font.height - top : left;
+        uint16_t* const out = dst + r * stride;
+
+        uint32_t x = 0;
+        if (line < layout.lines)
+        {
+            for (const char* s = layout.line(static_cast<uint8_t>(line)); *s; s++)
+            {
+                const uint32_t w = font_advance(font, *s);
+                if (x + w > width) break;
+                if (*s >= FONT_FIRST && static_cast<uint32_t>(*s - FONT_FIRST) < FONT_GLYPHS)
+                {
+                    GlyphRows g(font, *s);
+                    g.skip(top);
+                    for (uint32_t i = 0; i < n; i++)
+                        g.row(fg, bg, out + i * stride + x);
+                }
+                else
+                {
+                    for (uint32_t i = 0; i < n; i++)
+                        font_fill(out + i * stride + x, bg, w);
+                }
+                x += w;
+            }
+        }
+        for (uint32_t i = 0; i < n; i++)
+            font_fill(out + i * stride + x, bg, width - x);
+
+        r = static_cast<uint16_t>(r + n);
+    }
+}
@@ -0,0 +1,103 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * text_scroll.h — smooth vertical scrolling of a laid-out text that is
+ * taller than its window on the TFT.
+ *
+ * The ST7735's own vertical scroll (VSCRDEF / VSCSAD) moves gate lines,
+ * and with the panel turned landscape (MADCTL MV) those run across the
+ * screen: it would scroll sideways, header and all.  So the window is
+ * scrolled in the framebuffer instead.  Each step moves the rows already
+ * drawn up by the step's distance and draws only the rows it exposes at
+ * the bottom — with 1 px steps, one row of glyphs rather than the whole
+ * window — and the flush sends the window alone, not the screen.
+ *
+ * TextScroll is the timing.  It holds at the top, steps at a fixed rate
+ * to the end, holds there and starts over from the top.  Positions follow
+ * the clock, not the number of steps taken, so a draw task that wakes
+ * late jumps ahead rather than falling behind; waitMs() is the timeout
+ * for its next wait, as with ScreenScheduler.
+ *
+ * text_drawRows() draws any band of pixel rows of a TextLayout — the rows
+ * a step exposes, or the whole window after a jump.
+ *
+ * Times are caller-supplied milliseconds, wrap-safe.  Not thread-safe:
+ * draw task only.
+ */
+
+#pragma once
+
+#include "fonts.h"
+#include "text_layout.h"
+
+#include <cstdint>
+
+/// Scroll pacing, milliseconds and pixels.
+struct TextScrollTiming {
+    uint32_t holdMs    = 1500;  ///< at the top before moving
+    uint32_t stepMs    = 40;    ///< between steps: 25 steps/s
+    uint8_t  stepPx    = 1;
+    uint32_t endHoldMs = 2000;  ///< at the end before starting over
+};
+
+/// What one TextScroll::step() changed.
+struct TextScrollStep {
+    uint16_t offset = 0;        ///< text row now at the top of the window
+    uint16_t delta  = 0;        ///< rows moved up since the last step
+    bool     full   = false;    ///< redraw the window: moved back to the top, or ≥ its height
+};
+
+class TextScroll {
+public:
+    explicit TextScroll(const TextScrollTiming& timing = {}) : _timing(timing) {}
+
+    /// Show @p textRows rows of text in a @p windowRows window from @p nowMs.
+    /// Stays idle when the text fits.
+    void start(uint16_t textRows, uint16_t windowRows, uint32_t nowMs);
+    void stop() { _phase = Phase::Idle; }
+
+    bool     active() const { return _phase != Phase::Idle; }
+    uint16_t offset() const { return _offset; }
+
+    /// Advance to @p nowMs.  Returns false when the window stays as it is.
+    bool step(uint32_t nowMs, TextScrollStep& out);
+
+    /// Milliseconds until step() has something to do; UINT32_MAX when idle.
+    uint32_t waitMs(uint32_t nowMs) const;
+
+private:
+    enum class Phase : uint8_t { Idle, Top, Scroll, End };
+
+    TextScrollTiming _timing;
+    Phase            _phase  = Phase::Idle;
+    uint16_t         _window = 0;
+    uint16_t         _max    = 0;       ///< last offset: text rows − window rows
+    uint16_t         _offset = 0;
+    uint32_t         _since  = 0;       ///< start of the current phase
+};
+
+/**
+ * Draw text rows @p firstRow .. @p firstRow + @p rows − 1 of @p layout —
+ * line n is rows n × font.height onwards — into @p dst, @p width pixels a
+ * row and @p stride apart.  Past the text, and right of each line, is
+ * @p bg.  Colours are written as given.
+ */
+void text_drawRows(const TextLayout& layout, const FontDef& font,
+                   uint16_t fg, uint16_t bg, uint16_t firstRow, uint16_t rows,
+                   uint16_t* dst, uint16_t width, uint32_t stride);
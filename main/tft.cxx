@@ -24,6 +24,7 @@
 #include <freertos/task.h>
 #include <driver/spi_master.h>
 #include <driver/gpio.h>
+#include <driver/ledc.h>
 #include <esp_heap_caps.h>
 #include <esp_log.h>
 
@@ -37,8 +38,25 @@ static constexpr spi_host_device_t TFT_SPI_HOST = SPI3_HOST;
 // GPIO matrix on ESP32-S3 with short PCB traces.
 static constexpr int TFT_SPI_FREQ_HZ = 40 * 1000 * 1000;
 
+// Backlight PWM.  5 kHz is well above visible flicker; 8 bits give 1 %
+// steps.  Duty 256 holds the pin high — full brightness.
+static constexpr ledc_mode_t    BL_SPEED_MODE = LEDC_LOW_SPEED_MODE;
+static constexpr ledc_timer_t   BL_TIMER      = LEDC_TIMER_1;
+static constexpr ledc_channel_t BL_CHANNEL    = LEDC_CHANNEL_1;
+static constexpr uint32_t       BL_FREQ_HZ    = 5000;
+static constexpr uint32_t       BL_DUTY_FULL  = 1u << LEDC_TIMER_8_BIT;
+
+// ST7735: SLPOUT needs 120 ms before the panel is driven again, and
+// SLPIN and SLPOUT must be at least that far apart.
+static constexpr uint32_t SLEEP_SETTLE_MS = 120;
+
+// Staging buffer for flushing rectangles narrower than the panel: 4 KB,
+// enough for any header icon or text line.  Larger ones go as full rows.
+static constexpr size_t FB_STAGE_PIXELS = 2048;
+
 // ── DC-pin pre-transfer callback ──────────────────────────────────────────
-// Called by spi_device_polling_transmit() before every transaction.
+// Called by the SPI driver just before every transaction starts on the
+// wire — polled or queued, so DC stays right for rows sent behind the CPU.
 // t->user encodes the DC level: 0 = command (DC LOW), 1 = data (DC HIGH).
 // Stored file-scope because the IDF callback has no user-data pointer.
 static gpio_num_t s_dc_pin = GPIO_NUM_NC;
@@ -75,6 +93,7 @@ void TFT::reset(void)
 // Send one command byte (DC = LOW).
 void TFT::writeCommand(uint8_t cmd)
 {
+    drain();
     spi_transaction_t t = {};
     t.flags     = SPI_TRANS_USE_TXDATA;
     t.length    = 8;
@@ -86,6 +105,7 @@ void TFT::writeCommand(uint8_t cmd)
 // Send one data byte (DC = HIGH).
 void TFT::writeData(uint8_t data)
 {
+    drain();
     spi_transaction_t t = {};
     t.flags     = SPI_TRANS_USE_TXDATA;
     t.length    = 8;
@@ -100,6 +120,7 @@ void TFT::writeData(uint8_t data)
 void TFT::writeData(uint8_t* buff, size_t buff_size)
 {
     if (buff_size == 0) return;
+    drain();
     spi_transaction_t t = {};
     t.length = buff_size * 8;
     t.user   = reinterpret_cast<void*>(1);      // DC HIGH
@@ -129,9 +150,79 @@ void TFT::setAddressWindow(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2)
     writeCommand(RAMWR);
 }
 
+void TFT::openRows(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+    if (_fb.active())
+        _fb.markDirty(x, y, w, h);
+    else
+        setAddressWindow(x, y, x + w - 1, y + h - 1);
+}
+
+uint16_t* TFT::rowBuf(uint16_t x, uint16_t y)
+{
+    if (_fb.active()) return _fb.row(x, y);
+
+    // Both lines queued: the older one is this buffer — wait it out.
+    if (_dma_inflight == DMA_LINES) reapRow();
+    return _dma_buf[_dma_next];
+}
+
+void TFT::closeRow(uint16_t w)
+{
+    if (_fb.active()) return;
+
+    spi_transaction_t& t = _dma_txn[_dma_next];
+    t = {};
+    t.length    = static_cast<size_t>(w) * 16;
+    t.tx_buffer = _dma_buf[_dma_next];
+    t.user      = reinterpret_cast<void*>(1);
+    spi_device_queue_trans(_spi, &t, portMAX_DELAY);
+    _dma_inflight++;
+    _dma_next = (_dma_next + 1) % DMA_LINES;
+}
+
+void TFT::reapRow(void)
+{
+    spi_transaction_t* done = nullptr;
+    spi_device_get_trans_result(_spi, &done, portMAX_DELAY);
+    _dma_inflight--;
+}
+
+void TFT::drain(void)
+{
+    while (_dma_inflight > 0) reapRow();
+}
+
+// ── TftBus ────────────────────────────────────────────────────────────────
+
+void TFT::window(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1)
+{
+    setAddressWindow(x0, y0, x1, y1);
+}
+
+// One transaction for the whole rectangle; px is in the frame or the
+// staging buffer, both allocated DMA-capable.
+void TFT::pixels(const uint16_t* px, size_t n)
+{
+    drain();
+    spi_transaction_t t = {};
+    t.length    = n * 16;
+    t.tx_buffer = px;
+    t.user      = reinterpret_cast<void*>(1);
+    spi_device_polling_transmit(_spi, &t);
+}
+
+void TFT::flush(void)
+{
+    if (_fb.active())
+        _fb.flush(*this);
+    else
+        drain();
+}
+
 // ── init ──────────────────────────────────────────────────────────────────
 
-void TFT::init(void)
+void TFT::init(bool framebuffer, size_t glyphSlots)
 {
     if ((_dc_pin < 0) || (_cs_pin < 0) || (_rest_pin < 0) || (_led_k_pin < 0)) {
         ESP_LOGW(TAG, "Pin error: dc=%d cs=%d rst=%d led=%d",
@@ -142,13 +233,43 @@ void TFT::init(void)
     // ── DMA pixel buffer ──────────────────────────────────────────────────
     // Allocated before the SPI init sequence so writeData can use it for
     // gamma tables (> 4 bytes but guaranteed DRAM from heap).
-    _dma_buf = static_cast<uint16_t*>(
-        heap_caps_malloc(ST7735_WIDTH * sizeof(uint16_t),
+    uint16_t* lines = static_cast<uint16_t*>(
+        heap_caps_malloc(DMA_LINES * ST7735_WIDTH * sizeof(uint16_t),
                          MALLOC_CAP_DMA | MALLOC_CAP_8BIT));
-    if (!_dma_buf) {
+    if (!lines) {
         ESP_LOGE(TAG, "DMA buffer allocation failed");
         return;
     }
+    for (uint8_t i = 0; i < DMA_LINES; i++)
+        _dma_buf[i] = lines + i * ST7735_WIDTH;
+
+    // ── Optional frame (25.6 KB) + staging buffer ─────────────────────────
+    const size_t framePixels = static_cast<size_t>(_width) * _height;
+    if (framebuffer) {
+        uint16_t* frame = static_cast<uint16_t*>(
+            heap_caps_malloc(framePixels * sizeof(uint16_t), MALLOC_CAP_DMA | MALLOC_CAP_8BIT));
+        uint16_t* stage = static_cast<uint16_t*>(
+            heap_caps_malloc(FB_STAGE_PIXELS * sizeof(uint16_t), MALLOC_CAP_DMA | MALLOC_CAP_8BIT));
+        if (frame && stage) {
+            _fb.attach(frame, _width, _height, stage, FB_STAGE_PIXELS);
+        } else {
+            ESP_LOGW(TAG, "Framebuffer allocation failed — drawing direct");
+            heap_caps_free(frame);
+            heap_caps_free(stage);
+        }
+    }
+
+    // ── Optional glyph cache (432 B per slot), direct drawing only ────────
+    if (glyphSlots > GLYPH_CACHE_MAX_SLOTS) glyphSlots = GLYPH_CACHE_MAX_SLOTS;
+    if (glyphSlots > 0 && !_fb.active()) {
+        uint16_t* glyphs = static_cast<uint16_t*>(
+            heap_caps_malloc(glyphSlots * GLYPH_MAX_PIXELS * sizeof(uint16_t),
+                             MALLOC_CAP_DMA | MALLOC_CAP_8BIT));
+        if (glyphs)
+            _glyphs.attach(glyphs, glyphSlots);
+        else
+            ESP_LOGW(TAG, "Glyph cache allocation failed — expanding every glyph");
+    }
 
     // ── GPIO: all non-SPI output pins in one config call ─────────────────
     // DC is driven by spi_pre_transfer_cb; RST, LED_K, and optionally
@@ -172,6 +293,26 @@ void TFT::init(void)
     gpio_set_level(static_cast<gpio_num_t>(_rest_pin),  1);           // RST idle-high
     gpio_set_level(static_cast<gpio_num_t>(_dc_pin),    1);           // DC harmless default
 
+    // ── Backlight PWM — LEDC takes LED_K over from the GPIO set above ────
+    ledc_timer_config_t bl_timer = {};
+    bl_timer.speed_mode      = BL_SPEED_MODE;
+    bl_timer.duty_resolution = LEDC_TIMER_8_BIT;
+    bl_timer.timer_num       = BL_TIMER;
+    bl_timer.freq_hz         = BL_FREQ_HZ;
+    bl_timer.clk_cfg         = LEDC_AUTO_CLK;
+    ledc_channel_config_t bl_chan = {};
+    bl_chan.gpio_num   = _led_k_pin;
+    bl_chan.speed_mode = BL_SPEED_MODE;
+    bl_chan.channel    = BL_CHANNEL;
+    bl_chan.intr_type  = LEDC_INTR_DISABLE;
+    bl_chan.timer_sel  = BL_TIMER;
+    bl_chan.duty       = BL_DUTY_FULL;
+    bl_chan.hpoint     = 0;
+    _backlight_pwm = ledc_timer_config(&bl_timer) == ESP_OK &&
+                     ledc_channel_config(&bl_chan) == ESP_OK;
+    if (!_backlight_pwm)
+        ESP_LOGW(TAG, "Backlight PWM setup failed — on/off only");
+
     // ── IDF SPI bus + device ──────────────────────────────────────────────
     // CS is managed by the SPI driver; do NOT call pinMode for it here.
     spi_bus_config_t buscfg = {};
@@ -180,7 +321,12 @@ void TFT::init(void)
     buscfg.sclk_io_num     = _sclk_pin;
     buscfg.quadwp_io_num   = -1;
     buscfg.quadhd_io_num   = -1;
-    buscfg.max_transfer_sz = static_cast<int>(_width) * static_cast<int>(sizeof(uint16_t));
+    // A flush sends a whole rectangle — up to the full frame — at once; a
+    // cached glyph goes out whole too.
+    size_t maxPixels = _width;
+    if (_glyphs.active() && maxPixels < GLYPH_MAX_PIXELS) maxPixels = GLYPH_MAX_PIXELS;
+    if (_fb.active()) maxPixels = framePixels;
+    buscfg.max_transfer_sz = static_cast<int>(maxPixels * sizeof(uint16_t));
     esp_err_t ret = spi_bus_initialize(TFT_SPI_HOST, &buscfg, SPI_DMA_CH_AUTO);
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "spi_bus_initialize: %s", esp_err_to_name(ret));
@@ -195,15 +341,16 @@ void TFT::init(void)
     devcfg.mode           = 0;                    // CPOL=0 CPHA=0
     devcfg.clock_speed_hz = TFT_SPI_FREQ_HZ;
     devcfg.spics_io_num   = _cs_pin;
-    devcfg.queue_size     = 1;
+    devcfg.queue_size     = DMA_LINES;          // one row per line buffer in flight
     devcfg.pre_cb         = spi_pre_transfer_cb;
     ret = spi_bus_add_device(TFT_SPI_HOST, &devcfg, &_spi);
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "spi_bus_add_device: %s", esp_err_to_name(ret));
         return;
     }
-    ESP_LOGI(TAG, "ST7735 device added (CS=GPIO%d @ %d MHz)",
-             _cs_pin, TFT_SPI_FREQ_HZ / 1000000);
+    ESP_LOGI(TAG, "ST7735 device added (CS=GPIO%d @ %d MHz, %s)",
+             _cs_pin, TFT_SPI_FREQ_HZ / 1000000,
+             _fb.active() ? "framebuffer" : "direct");
 
     // ── ST7735 init sequence ──────────────────────────────────────────────
     reset();
@@ -248,6 +395,39 @@ void TFT::init(void)
 
     writeCommand(NORON);  vTaskDelay(pdMS_TO_TICKS(10));
     writeCommand(DISPON); vTaskDelay(pdMS_TO_TICKS(100));
+    _sleep_tick = xTaskGetTickCount();
+}
+
+// ── Power ─────────────────────────────────────────────────────────────────
+
+void TFT::backlight(uint8_t percent)
+{
+    if (percent > 100) percent = 100;
+    if (!_backlight_pwm) {
+        gpio_set_level(static_cast<gpio_num_t>(_led_k_pin), percent ? 1 : 0);
+        return;
+    }
+    ledc_set_duty(BL_SPEED_MODE, BL_CHANNEL, BL_DUTY_FULL * percent / 100);
+    ledc_update_duty(BL_SPEED_MODE, BL_CHANNEL);
+}
+
+void TFT::sleep(bool on)
+{
+    if (!_spi || on == _asleep) return;
+
+    const TickType_t since  = xTaskGetTickCount() - _sleep_tick;
+    const TickType_t settle = pdMS_TO_TICKS(SLEEP_SETTLE_MS);
+    if (since < settle) vTaskDelay(settle - since);
+
+    if (on) {
+        writeCommand(DISPOFF);
+        writeCommand(SLPIN);
+    } else {
+        writeCommand(SLPOUT); vTaskDelay(settle);
+        writeCommand(DISPON);
+    }
+    _sleep_tick = xTaskGetTickCount();
+    _asleep     = on;
 }
 
 // ── Drawing primitives ────────────────────────────────────────────────────
@@ -256,56 +436,120 @@ void TFT::drawPixel(uint16_t x, uint16_t y, uint16_t color)
 {
     if ((x >= _width) || (y >= _height)) return;
 
+    if (_fb.active()) {
+        *_fb.row(x, y) = __builtin_bswap16(color);
+        _fb.markDirty(x, y, 1, 1);
+        return;
+    }
+
     setAddressWindow(x, y, x, y);
-    _dma_buf[0] = __builtin_bswap16(color);
+    _dma_buf[0][0] = __builtin_bswap16(color);
 
     spi_transaction_t t = {};
     t.length    = 16;
-    t.tx_buffer = _dma_buf;
+    t.tx_buffer = _dma_buf[0];
     t.user      = reinterpret_cast<void*>(1);
     spi_device_polling_transmit(_spi, &t);
 }
 
 void TFT::drawChar(uint16_t x, uint16_t y, char ch, FontDef font, uint16_t color, uint16_t bgcolor)
 {
-    if (ch < 32 || ch >= 127) return;
-
-    setAddressWindow(x, y, x + font.width - 1, y + font.height - 1);
+    if (ch < FONT_FIRST || ch >= 127) return;
+    const uint8_t w = font_advance(font, ch);
+    if (x + w > _width || y + font.height > _height) return;
 
-    // Pre-swap colors once; font data is in flash (.rodata) so read via CPU
-    // and expand each row into _dma_buf before the DMA transaction.
     const uint16_t color_be   = __builtin_bswap16(color);
     const uint16_t bgcolor_be = __builtin_bswap16(bgcolor);
 
-    spi_transaction_t t = {};
-    t.length    = font.width * 16;
-    t.tx_buffer = _dma_buf;
-    t.user      = reinterpret_cast<void*>(1);
+    // Cached (direct drawing only): the whole glyph in one transaction.
+    if (const uint16_t* glyph = _glyphs.get(font, ch, color_be, bgcolor_be)) {
+        setAddressWindow(x, y, x + w - 1, y + font.height - 1);
+        spi_transaction_t t = {};
+        t.length    = static_cast<size_t>(w) * font.height * 16;
+        t.tx_buffer = glyph;
+        t.user      = reinterpret_cast<void*>(1);
+        spi_device_polling_transmit(_spi, &t);
+        return;
+    }
 
+    // Font runs are in flash (.rodata) and read via CPU: blitted whole into
+    // the frame, or expanded a row at a time into the DMA line buffers.
+    if (_fb.active()) {
+        _fb.markDirty(x, y, w, font.height);
+        font_blit(font, ch, color_be, bgcolor_be, _fb.row(x, y), _width);
+        return;
+    }
+    GlyphRows glyph(font, ch);
+    openRows(x, y, w, font.height);
     for (uint32_t row = 0; row < font.height; row++) {
-        uint32_t bits = font.data[(ch - 32) * font.height + row];
-        for (uint32_t col = 0; col < font.width; col++) {
-            _dma_buf[col] = ((bits << col) & 0x8000) ? color_be : bgcolor_be;
-        }
-        spi_device_polling_transmit(_spi, &t);
+        glyph.row(color_be, bgcolor_be, rowBuf(x, y + row));
+        closeRow(w);
     }
 }
 
 void TFT::drawStr(uint16_t x, uint16_t y, const char* str, FontDef font, uint16_t color, uint16_t bgcolor)
 {
     while (*str) {
-        if (x + font.width >= _width) {
+        const uint8_t w = font_advance(font, *str);
+        if (x + w >= _width) {
             x = 0;
             y += font.height;
             if (y + font.height >= _height) break;
             if (*str == ' ') { str++; continue; }
         }
         drawChar(x, y, *str, font, color, bgcolor);
-        x += font.width;
+        x += w;
         str++;
     }
 }
 
+void TFT::drawText(uint16_t x, uint16_t y, const char* str, FontDef font, uint16_t color, uint16_t bgcolor)
+{
+    for (; *str; str++) {
+        const uint8_t w = font_advance(font, *str);
+        if (x + w > _width) break;
+        drawChar(x, y, *str, font, color, bgcolor);
+        x += w;
+    }
+}
+
+void TFT::drawTextRows(uint16_t y, uint16_t h, const TextLayout& layout, FontDef font,
+                       uint16_t firstRow, uint16_t color, uint16_t bgcolor)
+{
+    if (y >= _height || h == 0) return;
+    if (y + h > _height) h = _height - y;
+
+    const uint16_t color_be   = __builtin_bswap16(color);
+    const uint16_t bgcolor_be = __builtin_bswap16(bgcolor);
+
+    if (_fb.active()) {
+        _fb.markDirty(0, y, _width, h);
+        text_drawRows(layout, font, color_be, bgcolor_be, firstRow, h,
+                      _fb.row(0, y), _width, _width);
+        return;
+    }
+
+    openRows(0, y, _width, h);
+    for (uint16_t row = 0; row < h; row++) {
+        text_drawRows(layout, font, color_be, bgcolor_be, firstRow + row, 1,
+                      rowBuf(0, y + row), _width, _width);
+        closeRow(_width);
+    }
+}
+
+bool TFT::scrollUp(uint16_t y, uint16_t h, uint16_t dy)
+{
+    if (!_fb.active() || y >= _height) return false;
+    if (y + h > _height) h = _height - y;
+    if (dy >= h) return false;
+
+    // Full-width rows are contiguous in the frame: one move.
+    memmove(_fb.row(0, y), _fb.row(0, y + dy),
+            static_cast<size_t>(h - dy) * _width * sizeof(uint16_t));
+    _fb.markDirty(0, y, _width, h);
+    return true;
+}
+
 void TFT::fillRectangle(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color)
 {
     if ((x >= _width) || (y >= _height)) {
@@ -315,22 +559,27 @@ void TFT::fillRectangle(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t
     if ((x + w - 1) >= _width)  w = _width  - x;
     if ((y + h - 1) >= _height) h = _height - y;
 
-    setAddressWindow(x, y, x + w - 1, y + h - 1);
-
-    // Pre-fill the DMA buffer with the byte-swapped colour once, then blast
-    // each row in a single DMA transaction — avoids per-pixel SPI overhead.
     const uint16_t color_be = __builtin_bswap16(color);
-    for (uint16_t i = 0; i < w; i++) {
-        _dma_buf[i] = color_be;
+
+    if (_fb.active()) {
+        _fb.markDirty(x, y, w, h);
+        for (uint16_t row = 0; row < h; row++) {
+            uint16_t* dst = _fb.row(x, y + row);
+            for (uint16_t i = 0; i < w; i++) dst[i] = color_be;
+        }
+        return;
     }
 
-    spi_transaction_t t = {};
-    t.length    = static_cast<size_t>(w) * 16;
-    t.tx_buffer = _dma_buf;
-    t.user      = reinterpret_cast<void*>(1);
+    openRows(x, y, w, h);
 
+    // Fill each line buffer with the byte-swapped colour once, then queue
+    // one DMA transaction per row — avoids per-pixel SPI overhead.
     for (uint16_t row = 0; row < h; row++) {
-        spi_device_polling_transmit(_spi, &t);
+        uint16_t* dst = rowBuf(x, y + row);
+        if (row < DMA_LINES) {
+            for (uint16_t i = 0; i < w; i++) dst[i] = color_be;
+        }
+        closeRow(w);
     }
 }
 
@@ -348,21 +597,17 @@ void TFT::drawImage(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint16
         return;
     }
 
-    setAddressWindow(x, y, x + w - 1, y + h - 1);
+    openRows(x, y, w, h);
 
     // data[] is in flash (.rodata) — not DMA-accessible.  Copy one row at a
-    // time into _dma_buf (DRAM) with byte-swap, then DMA to display.
-    spi_transaction_t t = {};
-    t.length    = static_cast<size_t>(w) * 16;
-    t.tx_buffer = _dma_buf;
-    t.user      = reinterpret_cast<void*>(1);
-
+    // time (into the frame, or into a line buffer and out) with byte-swap.
     for (uint16_t row = 0; row < h; row++) {
+        uint16_t*       dst = rowBuf(x, y + row);
         const uint16_t* src = data + static_cast<size_t>(row) * w;
         for (uint16_t col = 0; col < w; col++) {
-            _dma_buf[col] = __builtin_bswap16(src[col]);
+            dst[col] = __builtin_bswap16(src[col]);
         }
-        spi_device_polling_transmit(_spi, &t);
+        closeRow(w);
     }
 }
 
@@ -376,30 +621,26 @@ void TFT::drawXbm(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
         return;
     }
 
-    setAddressWindow(x, y, x + w - 1, y + h - 1);
+    openRows(x, y, w, h);
 
     const uint16_t color_be   = __builtin_bswap16(color);
     const uint16_t bgcolor_be = __builtin_bswap16(bgcolor);
     const uint16_t widthInXbm = (w + 7) >> 3;
 
     // XBM bit ordering: LSB of each byte = leftmost pixel.
-    // Read byte-by-byte from flash via CPU cache, expand into _dma_buf, DMA per row.
-    spi_transaction_t t = {};
-    t.length    = static_cast<size_t>(w) * 16;
-    t.tx_buffer = _dma_buf;
-    t.user      = reinterpret_cast<void*>(1);
-
+    // Read byte-by-byte from flash via CPU cache and expand row by row.
     for (uint16_t row = 0; row < h; row++) {
-        uint8_t xbm_byte = 0;
+        uint16_t* dst      = rowBuf(x, y + row);
+        uint8_t   xbm_byte = 0;
         for (uint16_t col = 0; col < w; col++) {
             if (!(col & 7)) {
                 xbm_byte = xbm[(col >> 3) + row * widthInXbm];
             } else {
                 xbm_byte >>= 1;
             }
-            _dma_buf[col] = (xbm_byte & 0x01) ? color_be : bgcolor_be;
+            dst[col] = (xbm_byte & 0x01) ? color_be : bgcolor_be;
         }
-        spi_device_polling_transmit(_spi, &t);
+        closeRow(w);
     }
 }
 
@@ -22,6 +22,9 @@
 
 #include <driver/spi_master.h>
 #include "fonts.h"
+#include "framebuffer.h"
+#include "glyph_cache.h"
+#include "text_scroll.h"
 
 #define ST7735_IS_160X80 1
 #define ST7735_XSTART 1
@@ -32,7 +35,7 @@
 
 // call before initializing any SPI devices
 
-class TFT
+class TFT : private TftBus
 {
 public:
 	typedef enum : uint16_t {
@@ -69,16 +72,59 @@ public:
 
 	TFT(int8_t cs_pin, int8_t rest_pin, int8_t dc_pin, int8_t sclk_pin, int8_t mosi_pin, int8_t led_k_pin, int8_t vtft_ctrl_pin);
 	~TFT() = default;
-	void init(void);
+	/// @param framebuffer Compose into an off-screen frame and send only
+	///        what changed on flush().  Falls back to drawing straight to
+	///        the panel if the frame cannot be allocated.
+	/// @param glyphSlots  Pre-expanded glyphs to cache when drawing direct
+	///        (0 = no cache; ignored with a framebuffer).
+	void init(bool framebuffer = false, size_t glyphSlots = 0);
+	/// Send the dirty rectangles of the frame; drawing direct, wait for the
+	/// pixel rows still in flight.
+	void flush(void);
+	bool hasFramebuffer() const { return _fb.active(); }
+	const GlyphCache& glyphCache() const { return _glyphs; }
 	void drawPixel(uint16_t x, uint16_t y, uint16_t color);
 	void drawChar(uint16_t x, uint16_t y, char ch, FontDef font, uint16_t color, uint16_t bgcolor);
 	void drawStr(uint16_t x, uint16_t y, const char *str, FontDef font=Font_11x18, uint16_t color=BLUE, uint16_t bgcolor=BLACK);
+	/// One line, no wrapping: stops at the first glyph that would run off
+	/// the panel.  For lines from text_layout().
+	void drawText(uint16_t x, uint16_t y, const char *str, FontDef font, uint16_t color, uint16_t bgcolor);
+	/// Full-width band at rows @p y .. @p y + @p h - 1 showing text rows
+	/// @p firstRow onwards of @p layout (text_drawRows()).
+	void drawTextRows(uint16_t y, uint16_t h, const TextLayout& layout, FontDef font,
+	                  uint16_t firstRow, uint16_t color, uint16_t bgcolor);
+	/// Move the full-width band at rows @p y .. @p y + @p h - 1 up @p dy
+	/// rows in the frame; its bottom @p dy rows are left to be drawn.
+	/// False drawing direct — the panel is not read back.
+	bool scrollUp(uint16_t y, uint16_t h, uint16_t dy);
+	/// @p w × @p h block at (@p x, @p y), each row written by
+	/// @p row(y, dst) as big-endian pixels — one address window for the
+	/// lot.  Dropped if it does not fit the panel.
+	template <typename RowFn>
+	void drawRows(uint16_t x, uint16_t y, uint16_t w, uint16_t h, RowFn row)
+	{
+		if (w == 0 || h == 0 || x + w > _width || y + h > _height) return;
+		openRows(x, y, w, h);
+		for (uint16_t i = 0; i < h; i++) {
+			row(y + i, rowBuf(x, y + i));
+			closeRow(w);
+		}
+	}
 	void fillRectangle(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
 	void fillScreen(uint16_t color);
 	void drawImage(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint16_t* data);
 	void drawXbm(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint8_t* xbm, uint16_t color=BLUE, uint16_t bgcolor=BLACK);
 	void invertColors(bool invert);
 	void setGamma(GammaDef gamma);
+	/// Backlight brightness, 0..100 %, by LEDC PWM on the LED_K pin
+	/// (just on/off if the LEDC channel could not be set up).
+	void backlight(uint8_t percent);
+	/// Put the panel to sleep (DISPOFF, SLPIN) or wake it (SLPOUT,
+	/// DISPON).  GRAM is kept: awake again, the panel shows what it
+	/// showed, and drawing may go on while it sleeps.  Blocks up to
+	/// 120 ms — SLPOUT settling, and SLPIN/SLPOUT spacing.
+	void sleep(bool on);
+	bool asleep() const { return _asleep; }
 
 	uint8_t width() const { return _width; }
 	uint8_t height() const { return _height; }
@@ -139,6 +185,22 @@ private:
 	void writeData(uint8_t data);
 	void writeData(uint8_t* buff, size_t buff_size);
 	void setAddressWindow(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2);
+
+	// Row-by-row output shared by the drawing primitives: rows are
+	// expanded into the frame, or into the line buffers in turn and queued
+	// so the next row is expanded while this one is on the wire.
+	void openRows(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+	uint16_t* rowBuf(uint16_t x, uint16_t y);
+	void closeRow(uint16_t w);
+	// Wait for the oldest queued row / for every queued row.  Polled
+	// transactions may not start while queued ones are pending.
+	void reapRow(void);
+	void drain(void);
+
+	// TftBus — flush() target.
+	void window(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1) override;
+	void pixels(const uint16_t* px, size_t n) override;
+
 	int8_t 	  _cs_pin;
 	int8_t    _rest_pin;
 	int8_t    _dc_pin;
@@ -153,9 +215,23 @@ private:
 
 	// IDF SPI master driver handle
 	spi_device_handle_t _spi = nullptr;
-	// One-row DMA-capable pixel buffer (ST7735_WIDTH × 2 bytes).
-	// Allocated in init(); used by fillRectangle / drawChar / drawXbm / drawImage.
-	uint16_t* _dma_buf = nullptr;
+	// Two DMA-capable pixel rows (ST7735_WIDTH × 2 bytes each), used in
+	// turn: one is filled while the other is sent.  Allocated in init().
+	static constexpr uint8_t DMA_LINES = 2;
+	uint16_t*         _dma_buf[DMA_LINES] = {};
+	spi_transaction_t _dma_txn[DMA_LINES] = {};  // must outlive the queued transfer
+	uint8_t           _dma_next     = 0;          // line buffer to fill next
+	uint8_t           _dma_inflight = 0;          // queued rows not yet reaped
+	// Backlight PWM; LEDC timer 0 / channel 0 belong to the buzzer.
+	bool     _backlight_pwm = false;
+	bool     _asleep        = false;
+	uint32_t _sleep_tick    = 0;                   // tick of the last SLPIN/SLPOUT
+	// Off-screen frame and its staging buffer, both DMA-capable; inactive
+	// unless init() was asked for one.
+	FrameBuffer _fb;
+	// Pre-expanded glyphs (DMA-capable pixels); inactive with 0 slots or
+	// a framebuffer.
+	GlyphCache  _glyphs;
 };
 
 #endif // TFT_H_
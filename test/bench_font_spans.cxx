@@ -0,0 +1,162 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * bench_font_spans.cxx — glyph expansion speed and table size, bitmap
+ * fonts vs run tables.
+ *
+ * For each font, expands every printable glyph into RGB565 over and over:
+ *
+ *   bitmap   the old drawChar loop: a bit test and a store per pixel,
+ *            a row at a time
+ *   rows     GlyphRows a row at a time, as TFT draws direct without the
+ *            glyph cache
+ *   glyph    font_blit into a glyph-sized buffer, as a glyph cache fill
+ *   frame    font_blit into a 160-pixel-wide frame, as the framebuffer
+ *
+ * and prints glyphs/sec for each (best of five), the flash each format
+ * takes, and whether all four produce the same pixels.
+ *
+ *   ./build/bench_font_spans [passes]
+ *
+ * Not registered with CTest — glyphs/sec is machine-dependent.
+ */
+
+#include "fonts.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+
+static constexpr uint16_t FG      = 0x0000;
+static constexpr uint16_t BG      = 0xFFFF;
+static constexpr uint32_t FRAME_W = 160;
+
+void bitmapRow(const FontBitmap& font, char ch, uint32_t row, uint16_t* dst)
+{
+    const uint32_t bits = font.data[(ch - FONT_FIRST) * font.height + row];
+    for (uint32_t col = 0; col < font.width; col++)
+        dst[col] = ((bits << col) & 0x8000) ? FG : BG;
+}
+
+alignas(4) uint16_t g_row[32];
+alignas(4) uint16_t g_glyph[32 * 26];
+alignas(4) uint16_t g_frame[FRAME_W * 80];
+uint32_t            g_sink;
+
+// Best of five runs: the host is shared, the slow runs are noise.
+template <typename Expand>
+double glyphsPerSec(int passes, Expand expand)
+{
+    double best = 0;
+    for (int rep = 0; rep < 5; rep++)
+    {
+        const auto t0 = std::chrono::steady_clock::now();
+        for (int p = 0; p < passes; p++)
+            for (char ch = FONT_FIRST; ch < 127; ch++)
+                g_sink += expand(ch);
+        const auto t1 = std::chrono::steady_clock::now();
+        const double rate = passes * FONT_GLYPHS / std::chrono::duration<double>(t1 - t0).count();
+        if (rate > best) best = rate;
+    }
+    return best;
+}
+
+bool samePixels(const FontDef& font, const FontBitmap& bitmap)
+{
+    for (char ch = FONT_FIRST; ch < 127; ch++)
+    {
+        font_blit(font, ch, FG, BG, g_glyph, font.width);
+        font_blit(font, ch, FG, BG, g_frame + 3, FRAME_W);      // odd alignment too
+        GlyphRows rows(font, ch);
+        for (uint32_t row = 0; row < font.height; row++)
+        {
+            uint16_t want[32], got[32];
+            bitmapRow(bitmap, ch, row, want);
+            rows.row(FG, BG, got);
+            const size_t bytes = font.width * sizeof(uint16_t);
+            if (memcmp(want, got, bytes) != 0 ||
+                memcmp(want, g_glyph + row * font.width, bytes) != 0 ||
+                memcmp(want, g_frame + 3 + row * FRAME_W, bytes) != 0)
+                return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const int passes = argc > 1 ? atoi(argv[1]) : 5000;
+
+    struct { const char* name; const FontDef* font; const FontBitmap* bitmap; } fonts[] = {
+        { "7x10",  &Font_7x10,  &FontBitmap_7x10  },
+        { "11x18", &Font_11x18, &FontBitmap_11x18 },
+        { "16x26", &Font_16x26, &FontBitmap_16x26 },
+    };
+
+    printf("# %d passes over %u glyphs, glyphs/s (x bitmap)\n", passes, FONT_GLYPHS);
+    printf("%-6s %10s %17s %17s %17s %9s %7s %7s\n",
+           "font", "bitmap", "rows", "glyph", "frame", "bitmap B", "runs B", "pixels");
+
+    bool   ok = true;
+    size_t bitmapTotal = 0, runTotal = 0;
+    for (const auto& f : fonts)
+    {
+        const FontDef&    font   = *f.font;
+        const FontBitmap& bitmap = *f.bitmap;
+
+        const double bits = glyphsPerSec(passes, [&](char ch) {
+            for (uint32_t row = 0; row < bitmap.height; row++)
+                bitmapRow(bitmap, ch, row, g_row);
+            return g_row[0];
+        });
+        const double rows = glyphsPerSec(passes, [&](char ch) {
+            GlyphRows glyph(font, ch);
+            for (uint32_t row = 0; row < font.height; row++)
+                glyph.row(FG, BG, g_row);
+            return g_row[0];
+        });
+        const double glyph = glyphsPerSec(passes, [&](char ch) {
+            font_blit(font, ch, FG, BG, g_glyph, font.width);
+            return g_glyph[0];
+        });
+        const double frame = glyphsPerSec(passes, [&](char ch) {
+            font_blit(font, ch, FG, BG, g_frame, FRAME_W);
+            return g_frame[0];
+        });
+
+        const size_t bitmapBytes = FONT_GLYPHS * bitmap.height * sizeof(uint16_t);
+        const size_t runBytes    = font.index[FONT_GLYPHS] + (FONT_GLYPHS + 1) * sizeof(uint16_t);
+        bitmapTotal += bitmapBytes;
+        runTotal    += runBytes;
+
+        const bool same = samePixels(font, bitmap);
+        ok = ok && same;
+        printf("%-6s %10.0f %9.0f (%.2f) %9.0f (%.2f) %9.0f (%.2f) %9zu %7zu %7s\n",
+               f.name, bits, rows, rows / bits, glyph, glyph / bits, frame, frame / bits,
+               bitmapBytes, runBytes, same ? "same" : "DIFFER");
+    }
+    printf("%-6s %10s %17s %17s %17s %9zu %7zu\n", "total", "", "", "", "", bitmapTotal, runTotal);
+    printf("# sink %u\n", g_sink);
+    return ok ? 0 : 1;
+}
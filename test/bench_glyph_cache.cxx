@@ -0,0 +1,140 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * bench_glyph_cache.cxx — glyphs/sec with and without the glyph cache.
+ *
+ * Draws a notification-screen text mix (app name, time, title, message,
+ * mesh texts, clock) through the real TFT::drawStr, over and over, and
+ * reports for each configuration:
+ *
+ *   cpu glyphs/s    host CPU time in the driver only
+ *   tx/glyph        SPI transactions on the mock device (mock_spi.h)
+ *   bus us/glyph    modelled bus time at 40 MHz + per-transaction overhead
+ *   glyphs/s        what the panel sees: glyphs / (CPU + bus)
+ *
+ * Configurations: drawing direct with the cache off and on, and the
+ * framebuffer (which never uses the cache) for reference.  All three must
+ * leave the same pixels on the panel.
+ *
+ *   ./build/bench_glyph_cache [passes] [slots]
+ *
+ * Not registered with CTest — glyphs/sec is machine-dependent.
+ */
+
+#include "mock_spi.h"
+#include "tft.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+namespace {
+
+static constexpr double TXN_OVERHEAD_US = 8.0;
+
+struct Line {
+    uint16_t       x, y;
+    const char*    text;
+    const FontDef* font;
+    uint16_t       fg, bg;
+};
+
+// What a few notification and mesh screens draw, in their colours.
+const Line SCREEN[] = {
+    { 0,   21, "Messages",               &Font_7x10,  TFT::BLACK, TFT::WHITE },
+    { 122, 21, "12:34",                  &Font_7x10,  TFT::BLACK, TFT::WHITE },
+    { 0,   44, "Dinner?",                &Font_11x18, TFT::BLACK, TFT::WHITE },
+    { 0,   62, "Table for four",         &Font_11x18, TFT::BLACK, TFT::WHITE },
+    { 0,   21, "MESH +2",                &Font_7x10,  TFT::BLACK, TFT::CYAN  },
+    { 0,   33, "At the trailhe",         &Font_11x18, TFT::BLACK, TFT::WHITE },
+    { 0,   52, "ad, heading up",         &Font_11x18, TFT::BLACK, TFT::WHITE },
+    { 0,   70, "SNR 6.5 dB",             &Font_7x10,  TFT::BLACK, TFT::WHITE },
+    { 0,   6,  "12:35",                  &Font_7x10,  TFT::WHITE, 0x3190     },
+};
+
+struct Result {
+    double   cpuS;
+    double   busS;
+    uint64_t glyphs;
+    uint64_t txns;
+    uint32_t hits, misses;
+    std::vector<uint16_t> gram;
+};
+
+Result run(bool framebuffer, size_t slots, int passes)
+{
+    TFT tft(1, 2, 3, 4, 5, 6, 7);
+    tft.init(framebuffer, slots);
+    spi_device_t* dev = mock_spiLastDevice();
+    dev->reset();
+
+    uint64_t glyphs = 0;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int p = 0; p < passes; p++)
+    {
+        for (const Line& l : SCREEN)
+        {
+            tft.drawStr(l.x, l.y, l.text, *l.font, l.fg, l.bg);
+            for (const char* c = l.text; *c; c++) glyphs++;
+        }
+        tft.flush();
+    }
+    const auto t1 = std::chrono::steady_clock::now();
+
+    return { std::chrono::duration<double>(t1 - t0).count(),
+             dev->busUs(TXN_OVERHEAD_US) / 1e6, glyphs, dev->txns,
+             tft.glyphCache().hits(), tft.glyphCache().misses(), dev->gram };
+}
+
+void report(const char* name, const Result& r)
+{
+    const uint32_t lookups = r.hits + r.misses;
+    printf("%-18s %12.0f %9.1f %13.1f %10.0f",
+           name, r.glyphs / r.cpuS,
+           static_cast<double>(r.txns) / r.glyphs,
+           r.busS * 1e6 / r.glyphs,
+           r.glyphs / (r.cpuS + r.busS));
+    if (lookups) printf("   hit %.1f%%", 100.0 * r.hits / lookups);
+    printf("\n");
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const int    passes = argc > 1 ? atoi(argv[1]) : 500;
+    const size_t slots  = argc > 2 ? static_cast<size_t>(atoi(argv[2])) : 32;
+
+    printf("# %d passes, %zu slots, bus 40 MHz + %.0f us/transaction\n",
+           passes, slots, TXN_OVERHEAD_US);
+    printf("%-18s %12s %9s %13s %10s\n",
+           "config", "cpu glyphs/s", "tx/glyph", "bus us/glyph", "glyphs/s");
+
+    const Result off = run(false, 0,     passes);
+    const Result on  = run(false, slots, passes);
+    const Result fb  = run(true,  slots, passes);
+
+    report("direct, no cache", off);
+    report("direct, cache", on);
+    report("framebuffer", fb);
+
+    const bool same = off.gram == on.gram && off.gram == fb.gram;
+    printf("# pixels %s\n", same ? "same" : "DIFFER");
+    return same ? 0 : 1;
+}
@@ -0,0 +1,116 @@
+/**
+ * bench_mesh_sim.cxx — delivery and channel statistics for simulated meshes.
+ *
+ * Build: part of the test CMake project (not run by CTest).
+ * Run:   ./build/bench_mesh_sim [nodes] [minutes] [seed]
+ *
+ * Scatters N nodes over a square sized for an average of ~6 neighbours,
+ * a quarter of them ROUTERs, and has every node broadcast a text at a
+ * random time about once every two minutes, plus a NodeInfo at start.
+ * Runs twice — LBT on and off — and prints per run:
+ *
+ *   frames       transmissions started
+ *   delivery     texts received / texts that could have been received
+ *                (every other node, whether or not it is in range)
+ *   collisions   receptions lost to overlap, per frame
+ *   airtime/node mean fraction of time each node spent transmitting
+ *   speed        virtual seconds simulated per wall-clock second
+ */
+
+#include "sim_mesh.h"
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+static constexpr uint32_t BROADCAST = 0xFFFFFFFF;
+
+static uint32_t xorshift(uint32_t& s)
+{
+    s ^= s << 13;
+    s ^= s >> 17;
+    s ^= s << 5;
+    return s;
+}
+
+static void run(unsigned nodes, unsigned minutes, uint32_t seed, bool lbt)
+{
+    SimMesh m;
+
+    // Disc area for ~6 neighbours within the 20 km-class radio range.
+    const float range = 25000.f;
+    const float side  = std::sqrt(static_cast<float>(nodes) * 3.14159f * range * range / 6.f);
+
+    uint32_t s = seed ? seed : 1;
+    for (unsigned i = 0; i < nodes; i++)
+    {
+        SimNodeConfig c;
+        c.nodeId = 0xA0000000u + i;
+        c.x      = static_cast<float>(xorshift(s) % 10000) / 10000.f * side;
+        c.y      = static_cast<float>(xorshift(s) % 10000) / 10000.f * side;
+        c.role   = (i % 4 == 0) ? MC_ROLE_ROUTER : 0;
+        c.lbt    = lbt;
+        m.add(c);
+    }
+
+    // Per-node send times: a NodeInfo in the first minute, then a text
+    // every ~2 minutes with jitter.
+    std::vector<uint32_t> next(nodes);
+    std::vector<bool>     announced(nodes, false);
+    for (unsigned i = 0; i < nodes; i++) next[i] = xorshift(s) % 60000;
+
+    const uint32_t endMs = minutes * 60000u;
+    uint32_t texts = 0;
+    const auto t0 = std::chrono::steady_clock::now();
+    while (m.nowMs() < endMs)
+    {
+        for (unsigned i = 0; i < nodes; i++)
+        {
+            if (next[i] > m.nowMs()) continue;
+            if (!announced[i])
+            {
+                m.node(i).sendNodeInfo(BROADCAST, false);
+                announced[i] = true;
+            }
+            else
+            {
+                char text[32];
+                snprintf(text, sizeof(text), "n%u #%u", i, texts);
+                m.node(i).sendText(BROADCAST, text);
+                texts++;
+            }
+            next[i] = m.nowMs() + 60000 + xorshift(s) % 120000;
+        }
+        m.run(10);
+    }
+    m.runUntilQuiet(60000);
+    const double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    size_t received = 0;
+    for (unsigned i = 0; i < nodes; i++) received += m.node(i).inbox().size();
+    const double possible = static_cast<double>(texts) * (nodes - 1);
+
+    const SimAir& air = m.air();
+    printf("  LBT %-3s  frames %6u  delivery %5.1f%%  collisions/frame %5.3f  "
+           "missed-busy %5u  airtime/node %4.1f%%  speed %7.0fx\n",
+           lbt ? "on" : "off", (unsigned)air.frames,
+           possible > 0 ? 100.0 * received / possible : 0.0,
+           air.frames ? static_cast<double>(air.collisions) / air.frames : 0.0,
+           (unsigned)air.missedBusy,
+           100.0 * static_cast<double>(air.busyUs) / (static_cast<double>(m.nowMs()) * 1000.0 * nodes),
+           wall > 0 ? m.nowMs() / 1000.0 / wall : 0.0);
+}
+
+int main(int argc, char** argv)
+{
+    const unsigned nodes   = argc > 1 ? static_cast<unsigned>(atoi(argv[1])) : 32;
+    const unsigned minutes = argc > 2 ? static_cast<unsigned>(atoi(argv[2])) : 30;
+    const uint32_t seed    = argc > 3 ? static_cast<uint32_t>(atoi(argv[3])) : 1;
+
+    printf("bench_mesh_sim: %u nodes, %u min, seed %u (LongFast)\n", nodes, minutes, (unsigned)seed);
+    run(nodes, minutes, seed, true);
+    run(nodes, minutes, seed, false);
+    return 0;
+}
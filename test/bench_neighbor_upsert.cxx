@@ -0,0 +1,177 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * bench_neighbor_upsert.cxx — bytes copied per neighbour-table upsert.
+ *
+ * Replays a synthetic mesh (default 100 nodes, 100000 packets) through
+ * mc_neighborApply and reports, per packet type, the bytes written into the
+ * table and the largest single guarded section.  The "aos" columns are
+ * what the previous single-struct entry copied for the same packets: the
+ * whole decoded struct per update, plus a full entry clear on insert, all
+ * inside one critical section.  Capacity and eviction are identical; only
+ * the layout differs.
+ *
+ *   ./build/bench_neighbor_upsert [nodes] [packets]
+ *
+ * Not registered with CTest — the ns/upsert column is machine-dependent;
+ * the byte counts are exact.
+ */
+
+#include "mesh_neighbors.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+
+namespace {
+
+// Pre-split entry layout, for the byte-count baseline.
+struct AosNeighbor {
+    uint32_t       nodeId;
+    uint32_t       lastSeen;
+    MeshPosition   pos;
+    MeshUser       user;
+    MeshNodeStatus nodeStatus;
+};
+
+enum Kind { K_POS, K_USER, K_STATUS, K_KEY, K_COUNT };
+const char* const KIND_NAME[K_COUNT] = { "position", "nodeinfo", "status", "key-verify" };
+
+struct Tally {
+    uint64_t packets = 0;
+    uint64_t soaBytes = 0, aosBytes = 0;
+    size_t   soaMaxSection = 0, aosMaxSection = 0;
+    uint64_t sections = 0;
+    void add(const McNeighborResult& r, size_t aos)
+    {
+        packets++;
+        soaBytes += r.bytesCopied;
+        aosBytes += aos;
+        sections += r.sections;
+        if (r.maxSection > soaMaxSection) soaMaxSection = r.maxSection;
+        if (aos > aosMaxSection)          aosMaxSection = aos;
+    }
+};
+
+struct Node {
+    MeshUser       user;
+    MeshNodeStatus status;
+    MeshPosition   pos;
+};
+
+} // namespace
+
+static McNeighborTable g_table;
+
+int main(int argc, char** argv)
+{
+    const int nodes   = (argc > 1) ? std::atoi(argv[1]) : 100;
+    const int packets = (argc > 2) ? std::atoi(argv[2]) : 100000;
+    if (nodes <= 0 || packets <= 0) return 1;
+
+    std::mt19937 rng(42);
+    Node* mesh = new Node[nodes]();
+    for (int i = 0; i < nodes; i++)
+    {
+        Node& n = mesh[i];
+        std::snprintf(n.user.id, sizeof(n.user.id), "!%08x", 0x433B0000u + i);
+        std::snprintf(n.user.longName, sizeof(n.user.longName), "Meshtastic %04x", i);
+        std::snprintf(n.user.shortName, sizeof(n.user.shortName), "%04x", (unsigned)(i & 0xFFFF));
+        n.user.hwModel = 48;
+        for (int b = 0; b < 32; b++) n.user.publicKey[b] = static_cast<uint8_t>(rng());
+        n.user.hasPublicKey = true;
+        n.pos.lat_i = 470000000 + static_cast<int32_t>(rng() % 1000000);
+        n.pos.lon_i = -1220000000 + static_cast<int32_t>(rng() % 1000000);
+        n.pos.sats  = 8;
+    }
+
+    Tally tally[K_COUNT];
+    Tally total;
+    uint32_t now = 0;
+
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int p = 0; p < packets; p++)
+    {
+        now += 1 + rng() % 50;
+        const int id = static_cast<int>(rng() % nodes);
+        Node& n = mesh[id];
+        const uint32_t nodeId = 0x433B0000u + id;
+
+        // Rough broadcast mix for a 2.7.x mesh with default intervals.
+        const uint32_t roll = rng() % 100;
+        const Kind kind = roll < 50 ? K_POS : roll < 75 ? K_USER : roll < 95 ? K_STATUS : K_KEY;
+
+        McNeighborUpdate u = {.rssi = static_cast<int16_t>(-60 - rng() % 60), .snr = 5.0f};
+        size_t aos = 0;
+        switch (kind)
+        {
+        case K_POS:
+            n.pos.lat_i += static_cast<int32_t>(rng() % 200) - 100;
+            n.pos.unixTime = now;
+            u.pos = &n.pos;
+            aos = sizeof(MeshPosition);
+            break;
+        case K_USER:
+            if (rng() % 50 == 0) n.user.longName[0] ^= 1;   // occasional rename
+            u.user = &n.user;
+            aos = sizeof(MeshUser);
+            break;
+        case K_STATUS:
+            n.status.uptimeSec += 900;
+            u.status = &n.status;
+            aos = sizeof(MeshNodeStatus);
+            break;
+        case K_KEY:
+            u.publicKey = n.user.publicKey;
+            aos = sizeof(MeshUser);   // the old path upserted a key-only MeshUser
+            break;
+        default:
+            break;
+        }
+
+        const McNeighborResult r = mc_neighborApply(g_table, nodeId, now, u);
+        if (r.created) aos += sizeof(AosNeighbor);   // old insert cleared the entry
+        tally[kind].add(r, aos);
+        total.add(r, aos);
+    }
+    const auto t1 = std::chrono::steady_clock::now();
+    const double nsPer = std::chrono::duration<double, std::nano>(t1 - t0).count() / packets;
+
+    std::printf("nodes=%d packets=%d capacity=%d evictions=%u  sizeof hot=%zu identity=%zu"
+                " pos=%zu status=%zu  aos entry=%zu\n",
+                nodes, packets, MC_NEIGHBOR_MAX, (unsigned)g_table.evictions,
+                sizeof(McNeighborHot), sizeof(McNeighborIdentity), sizeof(McNeighborPos),
+                sizeof(McNeighborStatus), sizeof(AosNeighbor));
+    std::printf("%-10s %8s %14s %14s %14s %14s %10s\n", "type", "packets",
+                "soa B/upsert", "aos B/upsert", "soa max sect", "aos max sect", "sections");
+    auto row = [](const char* name, const Tally& t) {
+        if (!t.packets) return;
+        std::printf("%-10s %8llu %14.1f %14.1f %14zu %14zu %10.2f\n", name,
+                    (unsigned long long)t.packets,
+                    (double)t.soaBytes / t.packets, (double)t.aosBytes / t.packets,
+                    t.soaMaxSection, t.aosMaxSection, (double)t.sections / t.packets);
+    };
+    for (int k = 0; k < K_COUNT; k++) row(KIND_NAME[k], tally[k]);
+    row("all", total);
+    std::printf("%.1f ns/upsert (host, unguarded)\n", nsPer);
+
+    delete[] mesh;
+    return 0;
+}
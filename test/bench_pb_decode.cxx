@@ -0,0 +1,568 @@
+/**
+ * bench_pb_decode.cxx — decode cost per packet, hand-rolled vs PbReader.
+ *
+ * Replays the packet set in test/pb_corpus/ (skipping the malformed
+ * "bad_*" seeds) through the full receive-side decode path: mc_parseData,
+ * then the inner decoder for the packet's portnum.  The "legacy" column
+ * runs verbatim copies of the per-message varint/tag walkers that
+ * mesh_codec.cxx used before PbReader; "pbreader" runs the current
+ * decoders.  Both must agree on every decoded field before timing starts.
+ *
+ *   ./build/bench_pb_decode test/pb_corpus [rounds]
+ *
+ * Not registered with CTest — timings are machine-dependent.
+ */
+
+#include "mesh_codec.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace {
+
+// ─────────────────────────────────────────────────────────────────────────
+// Pre-PbReader decoders (mesh_codec.cxx before the rewrite)
+// ─────────────────────────────────────────────────────────────────────────
+
+// ── mc_parseData ──────────────────────────────────────────────────────────
+
+static bool legacy_parseData(const uint8_t* data, size_t len,
+                  uint32_t&       portnum,
+                  const uint8_t*& payload, size_t& payloadLen,
+                  bool&           wantResponse)
+{
+    portnum      = 0;
+    payload      = nullptr;
+    payloadLen   = 0;
+    wantResponse = false;
+
+    if (data == nullptr || len == 0) return false;
+
+    size_t pos = 0;
+    while (pos < len)
+    {
+        uint32_t tag   = 0;
+        int      shift = 0;
+        while (pos < len)
+        {
+            uint8_t b = data[pos++];
+            tag |= static_cast<uint32_t>(b & 0x7F) << shift;
+            if (!(b & 0x80)) break;
+            shift += 7;
+            if (shift > 28) return false;
+        }
+
+        const uint32_t fieldNum = tag >> 3;
+        const uint8_t  wireType = tag & 0x07;
+
+        if (wireType == 0) // varint
+        {
+            uint64_t val    = 0;
+            int      vshift = 0;
+            while (pos < len)
+            {
+                uint8_t b = data[pos++];
+                val |= static_cast<uint64_t>(b & 0x7F) << vshift;
+                if (!(b & 0x80)) break;
+                vshift += 7;
+                if (vshift > 63) return false;
+            }
+            if (fieldNum == 1) portnum      = static_cast<uint32_t>(val);
+            if (fieldNum == 3) wantResponse = (val != 0);
+        }
+        else if (wireType == 2) // length-delimited
+        {
+            uint32_t msgLen = 0;
+            int      lshift = 0;
+            while (pos < len)
+            {
+                uint8_t b = data[pos++];
+                msgLen |= static_cast<uint32_t>(b & 0x7F) << lshift;
+                if (!(b & 0x80)) break;
+                lshift += 7;
+                if (lshift > 28) return false;
+            }
+            if (pos + msgLen > len) return false;
+            if (fieldNum == 2) { payload = data + pos; payloadLen = msgLen; }
+            pos += msgLen;
+        }
+        else if (wireType == 5) { if (pos + 4 > len) return false; pos += 4; }
+        else if (wireType == 1) { if (pos + 8 > len) return false; pos += 8; }
+        else return false;
+    }
+
+    return portnum != 0;
+}
+
+// ── mc_parsePosition ──────────────────────────────────────────────────────
+
+static bool legacy_parsePosition(const uint8_t* data, size_t len, MeshPosition& pos)
+{
+    if (data == nullptr || len == 0) return false;
+
+    size_t p       = 0;
+    bool gotLatLon = false;
+
+    auto readFixed32 = [&]() -> uint32_t {
+        uint32_t v = data[p] | (uint32_t)data[p+1]<<8
+                   | (uint32_t)data[p+2]<<16 | (uint32_t)data[p+3]<<24;
+        p += 4;
+        return v;
+    };
+
+    while (p < len)
+    {
+        uint32_t tag = 0; int shift = 0;
+        while (p < len) {
+            uint8_t b = data[p++];
+            tag |= (uint32_t)(b & 0x7F) << shift;
+            if (!(b & 0x80)) break;
+            shift += 7; if (shift > 28) return false;
+        }
+        const uint32_t field    = tag >> 3;
+        const uint8_t  wireType = tag & 0x07;
+
+        if (wireType == 0) // varint
+        {
+            uint64_t val = 0; int vs = 0;
+            while (p < len) {
+                uint8_t b = data[p++];
+                val |= (uint64_t)(b & 0x7F) << vs;
+                if (!(b & 0x80)) break;
+                vs += 7; if (vs > 63) return false;
+            }
+            switch (field) {
+                case 3:  pos.alt_m      = (int32_t)(int64_t)val; break;
+                case 10: pos.speed_cm_s = (uint32_t)val; break;  // ground_speed
+                case 11: pos.track_x100 = (uint32_t)val; break;  // ground_track
+                // field 9 = pos_flags (varint) — NOT time; skip silently
+                case 14: pos.sats       = (uint32_t)val; break;  // NOT field 7
+                default: break;
+            }
+        }
+        else if (wireType == 5) // fixed32 / sfixed32
+        {
+            if (p + 4 > len) return false;
+            uint32_t val = readFixed32();
+            switch (field) {
+                case 1: pos.lat_i    = static_cast<int32_t>(val); gotLatLon = true; break;
+                case 2: pos.lon_i    = static_cast<int32_t>(val); break;
+                case 4: pos.unixTime = val; break;  // GPS fix time — highest priority
+                // Field 7: timestamp (device wall-clock time).  Use as fallback when
+                // field 4 (GPS time) was not present — e.g. packets from non-GPS nodes
+                // that only carry the device clock.  If field 4 already set unixTime,
+                // don't overwrite it.
+                case 7: if (pos.unixTime == 0) pos.unixTime = val; break;
+                default: break;
+            }
+        }
+        else if (wireType == 2) // length-delimited — skip (e.g. field 7 = google_plus_code)
+        {
+            uint32_t msgLen = 0; int ls = 0;
+            while (p < len) {
+                uint8_t b = data[p++];
+                msgLen |= (uint32_t)(b & 0x7F) << ls;
+                if (!(b & 0x80)) break;
+                ls += 7; if (ls > 28) return false;
+            }
+            if (p + msgLen > len) return false;
+            p += msgLen;
+        }
+        else if (wireType == 1) { if (p + 8 > len) return false; p += 8; }
+        else return false;
+    }
+    return gotLatLon;
+}
+
+// ── mc_parseUser ──────────────────────────────────────────────────────────
+
+static bool legacy_parseUser(const uint8_t* data, size_t len, MeshUser& user)
+{
+    if (data == nullptr || len == 0) return false;
+
+    size_t p   = 0;
+    bool gotId = false;
+
+    auto readVarint = [&](uint64_t& out) -> bool {
+        out = 0; int s = 0;
+        while (p < len) {
+            uint8_t b = data[p++];
+            out |= (uint64_t)(b & 0x7F) << s;
+            if (!(b & 0x80)) return true;
+            s += 7; if (s > 63) return false;
+        }
+        return false;
+    };
+
+    while (p < len)
+    {
+        uint64_t tag64 = 0;
+        if (!readVarint(tag64)) break;
+        const uint32_t field    = (uint32_t)(tag64 >> 3);
+        const uint8_t  wireType = (uint8_t)(tag64 & 0x07);
+
+        if (wireType == 2) // string / bytes
+        {
+            uint64_t slen = 0;
+            if (!readVarint(slen)) return false;
+            if (p + slen > len) return false;
+            const char* src = reinterpret_cast<const char*>(data + p);
+            switch (field) {
+                case 1:
+                    snprintf(user.id, sizeof(user.id), "%.*s",
+                             (int)std::min(slen, (uint64_t)(sizeof(user.id) - 1)), src);
+                    gotId = true;
+                    break;
+                case 2:
+                    snprintf(user.longName, sizeof(user.longName), "%.*s",
+                             (int)std::min(slen, (uint64_t)(sizeof(user.longName) - 1)), src);
+                    break;
+                case 3:
+                    snprintf(user.shortName, sizeof(user.shortName), "%.*s",
+                             (int)std::min(slen, (uint64_t)(sizeof(user.shortName) - 1)), src);
+                    break;
+                case 4:
+                    if (slen == 6) {
+                        memcpy(user.macaddr, src, 6);
+                        user.hasMacaddr = true;
+                    }
+                    break;
+                case 8:
+                    if (slen == 32) { memcpy(user.publicKey, src, 32); user.hasPublicKey = true; }
+                    break;
+                default: break;
+            }
+            p += (size_t)slen;
+        }
+        else if (wireType == 0)
+        {
+            uint64_t val = 0;
+            if (!readVarint(val)) return false;
+            switch (field) {
+                case 5: user.hwModel        = (uint32_t)val; break;
+                case 6: user.isLicensed     = (val != 0);    break;
+                case 7: user.role           = (uint8_t)val;  break;
+                case 9: user.isUnmessageable= (val != 0);    break;
+                default: break;
+            }
+        }
+        else if (wireType == 5) { if (p + 4 > len) return false; p += 4; }
+        else if (wireType == 1) { if (p + 8 > len) return false; p += 8; }
+        else return false;
+    }
+    return gotId;
+}
+
+// ── mc_parseNodeStatus ────────────────────────────────────────────────────
+
+static bool legacy_parseNodeStatus(const uint8_t* data, size_t len, MeshNodeStatus& status)
+{
+    if (data == nullptr || len == 0) return false;
+
+    size_t p = 0;
+    bool gotUptime = false;
+
+    auto readVarint = [&](uint64_t& out) -> bool {
+        out = 0; int s = 0;
+        while (p < len) {
+            uint8_t b = data[p++];
+            out |= (uint64_t)(b & 0x7F) << s;
+            if (!(b & 0x80)) return true;
+            s += 7; if (s > 63) return false;
+        }
+        return false;
+    };
+
+    while (p < len)
+    {
+        uint64_t tag64 = 0;
+        if (!readVarint(tag64)) break;
+        const uint32_t field    = (uint32_t)(tag64 >> 3);
+        const uint8_t  wireType = (uint8_t)(tag64 & 0x07);
+
+        if (wireType == 0) // varint
+        {
+            uint64_t val = 0;
+            if (!readVarint(val)) return false;
+            switch (field) {
+                case 1: status.uptimeSec       = (uint32_t)val; gotUptime = true; break;
+                case 2: status.isMqttConnected = (val != 0);    break;
+                case 3: status.isRouter        = (val != 0);    break;
+                default: break;
+            }
+        }
+        else if (wireType == 2) // length-delimited — skip unknown
+        {
+            uint64_t slen = 0;
+            if (!readVarint(slen)) return false;
+            if (p + slen > len) return false;
+            p += (size_t)slen;
+        }
+        else if (wireType == 5) { if (p + 4 > len) return false; p += 4; }
+        else if (wireType == 1) { if (p + 8 > len) return false; p += 8; }
+        else return false;
+    }
+
+    // A NodeStatus is considered valid even when uptime==0 (just-booted node),
+    // as long as we successfully parsed the message.  We track gotUptime to
+    // distinguish "field 1 present and zero" from "empty / corrupt payload".
+    return gotUptime;
+}
+
+// ── mc_parsePkiReport ─────────────────────────────────────────────────────
+
+static bool legacy_parsePkiReport(const uint8_t* data, size_t len, MeshPkiReport& report)
+{
+    if (data == nullptr || len == 0) return false;
+
+    size_t p = 0;
+
+    auto readVarint = [&](uint64_t& out) -> bool {
+        out = 0; int s = 0;
+        while (p < len) {
+            uint8_t b = data[p++];
+            out |= (uint64_t)(b & 0x7F) << s;
+            if (!(b & 0x80)) return true;
+            s += 7; if (s > 63) return false;
+        }
+        return false;
+    };
+
+    while (p < len)
+    {
+        uint64_t tag64 = 0;
+        if (!readVarint(tag64)) break;
+        const uint32_t field    = (uint32_t)(tag64 >> 3);
+        const uint8_t  wireType = (uint8_t)(tag64 & 0x07);
+
+        if (wireType == 0)
+        {
+            uint64_t val = 0;
+            if (!readVarint(val)) return false;
+            if (field == 2) report.requestorNodeNum = (uint32_t)val;
+        }
+        else if (wireType == 2)
+        {
+            uint64_t slen = 0;
+            if (!readVarint(slen)) return false;
+            if (p + slen > len) return false;
+            if (field == 1 && slen == 32)
+            {
+                memcpy(report.publicKey, data + p, 32);
+                report.hasPublicKey = true;
+            }
+            p += (size_t)slen;
+        }
+        else if (wireType == 5) { if (p + 4 > len) return false; p += 4; }
+        else if (wireType == 1) { if (p + 8 > len) return false; p += 8; }
+        else return false;
+    }
+
+    report.valid = report.hasPublicKey;
+    return report.valid;
+}
+
+// Former inline TRACEROUTE parser from LoRa::_processPacket.
+static bool legacy_parseRouteDiscovery(const uint8_t* payload, size_t payloadLen,
+                                       MeshRouteDiscovery& rd)
+{
+    rd.routeLen = 0;
+    rd.snrLen   = 0;
+    const uint8_t* rp  = payload;
+    const uint8_t* end = payload + payloadLen;
+    while (rp < end)
+    {
+        uint8_t tagByte = *rp++;
+        uint8_t field   = tagByte >> 3;
+        uint8_t wt      = tagByte & 0x07;
+
+        if (field == 1 && wt == 5) // route: fixed32
+        {
+            if (rp + 4 > end) break;
+            uint32_t id = (uint32_t)rp[0]
+                        | (uint32_t)rp[1] <<  8
+                        | (uint32_t)rp[2] << 16
+                        | (uint32_t)rp[3] << 24;
+            if (rd.routeLen < MC_ROUTE_MAX) rd.route[rd.routeLen++] = id;
+            rp += 4;
+        }
+        else if (field == 2 && wt == 0) // snr_towards: zigzag sint32
+        {
+            uint32_t zz = 0; int sh = 0;
+            while (rp < end) {
+                uint8_t b = *rp++;
+                zz |= (uint32_t)(b & 0x7F) << sh;
+                if (!(b & 0x80)) break;
+                sh += 7;
+            }
+            if (rd.snrLen < MC_ROUTE_MAX)
+                rd.snrTowards[rd.snrLen++] = (int32_t)((zz >> 1) ^ (0u - (zz & 1)));
+        }
+        else if (wt == 5) { if (rp + 4 <= end) rp += 4; else break; }
+        else if (wt == 0) { while (rp < end && (*rp & 0x80)) rp++; if (rp < end) rp++; }
+        else if (wt == 1) { if (rp + 8 <= end) rp += 8; else break; }
+        else if (wt == 2)
+        {
+            uint32_t l = 0; int sh = 0;
+            while (rp < end) {
+                uint8_t b = *rp++;
+                l |= (uint32_t)(b & 0x7F) << sh;
+                if (!(b & 0x80)) break;
+                sh += 7;
+            }
+            if (rp + l <= end) rp += l; else break;
+        }
+        else break;
+    }
+    return true;
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// Receive-side decode of one Data proto.  Returns a checksum over every
+// decoded field so the two paths can be compared and nothing is elided.
+// ─────────────────────────────────────────────────────────────────────────
+
+struct Decoders {
+    bool (*data)(const uint8_t*, size_t, uint32_t&, const uint8_t*&, size_t&, bool&);
+    bool (*position)(const uint8_t*, size_t, MeshPosition&);
+    bool (*user)(const uint8_t*, size_t, MeshUser&);
+    bool (*status)(const uint8_t*, size_t, MeshNodeStatus&);
+    bool (*pki)(const uint8_t*, size_t, MeshPkiReport&);
+    bool (*route)(const uint8_t*, size_t, MeshRouteDiscovery&);
+};
+
+static const Decoders kLegacy = {
+    legacy_parseData, legacy_parsePosition, legacy_parseUser,
+    legacy_parseNodeStatus, legacy_parsePkiReport, legacy_parseRouteDiscovery,
+};
+
+static const Decoders kPbReader = {
+    mc_parseData, mc_parsePosition, mc_parseUser,
+    mc_parseNodeStatus, mc_parsePkiReport, mc_parseRouteDiscovery,
+};
+
+static uint64_t mix(uint64_t h, uint64_t v) { return (h ^ v) * 0x100000001B3ull; }
+
+static uint64_t decodePacket(const Decoders& d, const std::vector<uint8_t>& pkt)
+{
+    uint32_t portnum = 0; const uint8_t* payload = nullptr;
+    size_t payloadLen = 0; bool wantResp = false;
+    if (!d.data(pkt.data(), pkt.size(), portnum, payload, payloadLen, wantResp))
+        return 0;
+
+    uint64_t h = mix(0xCBF29CE484222325ull, portnum);
+    h = mix(h, payloadLen);
+    h = mix(h, wantResp);
+
+    switch (portnum)
+    {
+    case 3: {
+        MeshPosition p;
+        h = mix(h, d.position(payload, payloadLen, p));
+        h = mix(h, (uint32_t)p.lat_i); h = mix(h, (uint32_t)p.lon_i);
+        h = mix(h, (uint32_t)p.alt_m); h = mix(h, p.unixTime);
+        h = mix(h, p.sats); h = mix(h, p.speed_cm_s); h = mix(h, p.track_x100);
+        break;
+    }
+    case 4: {
+        MeshUser u;
+        h = mix(h, d.user(payload, payloadLen, u));
+        for (char c : u.longName) h = mix(h, (uint8_t)c);
+        for (char c : u.id)       h = mix(h, (uint8_t)c);
+        h = mix(h, u.hwModel); h = mix(h, u.role); h = mix(h, u.hasPublicKey);
+        h = mix(h, u.publicKey[31]); h = mix(h, u.hasMacaddr);
+        break;
+    }
+    case 36: {
+        MeshNodeStatus s;
+        h = mix(h, d.status(payload, payloadLen, s));
+        h = mix(h, s.uptimeSec); h = mix(h, s.isRouter);
+        break;
+    }
+    case 12: {
+        MeshPkiReport k;
+        h = mix(h, d.pki(payload, payloadLen, k));
+        h = mix(h, k.requestorNodeNum); h = mix(h, k.publicKey[0]);
+        break;
+    }
+    case 70: {
+        MeshRouteDiscovery rd;
+        d.route(payload, payloadLen, rd);
+        h = mix(h, rd.routeLen); h = mix(h, rd.snrLen);
+        for (size_t i = 0; i < rd.routeLen; i++) h = mix(h, rd.route[i]);
+        for (size_t i = 0; i < rd.snrLen; i++)   h = mix(h, (uint32_t)rd.snrTowards[i]);
+        break;
+    }
+    default:
+        break;
+    }
+    return h;
+}
+
+static double timeRun(const Decoders& d, const std::vector<std::vector<uint8_t>>& pkts,
+                      int rounds, uint64_t& sink)
+{
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++)
+        for (const auto& p : pkts) sink += decodePacket(d, p);
+    const auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(t1 - t0).count()
+         / (double(rounds) * double(pkts.size()));
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::fprintf(stderr, "usage: %s <corpus-dir> [rounds]\n", argv[0]);
+        return 2;
+    }
+    const int rounds = (argc > 2) ? std::atoi(argv[2]) : 20000;
+
+    std::vector<std::vector<uint8_t>> pkts;
+    std::vector<std::string>          names;
+    for (const auto& e : std::filesystem::directory_iterator(argv[1]))
+    {
+        const std::string name = e.path().filename().string();
+        if (e.path().extension() != ".bin" || name.rfind("bad_", 0) == 0) continue;
+        std::ifstream in(e.path(), std::ios::binary);
+        pkts.emplace_back(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        names.push_back(name);
+    }
+    if (pkts.empty()) { std::fprintf(stderr, "no packets in %s\n", argv[1]); return 1; }
+
+    // Cross-check before timing: the rewrite must not change any result.
+    // (Packed RouteDiscovery is the one intended difference — the legacy
+    // walker skipped packed fields.)
+    for (size_t i = 0; i < pkts.size(); i++)
+    {
+        if (names[i].find("traceroute_packed") != std::string::npos) continue;
+        if (decodePacket(kLegacy, pkts[i]) != decodePacket(kPbReader, pkts[i]))
+        {
+            std::fprintf(stderr, "MISMATCH on %s\n", names[i].c_str());
+            return 1;
+        }
+    }
+
+    uint64_t sink = 0;
+    timeRun(kLegacy, pkts, rounds / 10 + 1, sink);     // warm-up
+    timeRun(kPbReader, pkts, rounds / 10 + 1, sink);
+    const double nsLegacy = timeRun(kLegacy, pkts, rounds, sink);
+    const double nsReader = timeRun(kPbReader, pkts, rounds, sink);
+
+    std::printf("packets=%zu rounds=%d  legacy=%.1f ns/packet  pbreader=%.1f ns/packet"
+                "  (%.2fx)  [sink=%016" PRIx64 "]\n",
+                pkts.size(), rounds, nsLegacy, nsReader, nsLegacy / nsReader, sink);
+    return 0;
+}
@@ -0,0 +1,196 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * bench_tft_framebuffer.cxx — SPI traffic per screen, direct vs framebuffer.
+ *
+ * Renders the same screens through the real Display and TFT code twice:
+ * drawing straight to the panel, and composing into the framebuffer with
+ * one flush at the end (as the draw task does).  The SPI master driver is
+ * the mock device in mock_spi.h, so the two modes are also checked to
+ * leave identical pixels behind, and the direct mode's queued line buffers
+ * to be used by the driver's rules.
+ *
+ * Bus time: 40 MHz plus overhead_us per transaction (default 8).
+ *
+ *   ./build/bench_tft_framebuffer [overhead_us]
+ *
+ * Not registered with CTest — a benchmark, not a test.
+ */
+
+#include "display.h"
+#include "mock_spi.h"
+#include "notificationservice.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+static double TXN_OVERHEAD_US = 8.0;
+
+// ── Screens ───────────────────────────────────────────────────────────────
+
+namespace {
+
+// Pins only need to be valid numbers for TFT::init().
+Display* makeDisplay(bool framebuffer)
+{
+    Display* d = new Display(1, 2, 3, 4, 5, 6, 7);
+    d->init(framebuffer);
+    return d;
+}
+
+void bootScreen(Display& d)
+{
+    d.paintHeaderBackground();
+    d.showBLEState(BLE_CONNECTED);
+    d.showBatteryLevel(80, false);
+    d.showLoraState(true);
+    d.showTime("12:34");
+    d.standby(BLE_CONNECTED);
+}
+
+void notification(Display& d)
+{
+    notification_def n;
+    strcpy(n.title,    "Dinner?");
+    strcpy(n.message,  "Table for four at eight");
+    strcpy(n.bundleId, "com.apple.MobileSMS");
+    n.time = 1700000000;
+    d.showNotification(n, 0);
+}
+
+void longNotification(Display& d)
+{
+    notification_def n;
+    strcpy(n.title,    "Trip update");
+    strcpy(n.message,  "Your 7:40 train is running twelve minutes late; it now "
+                       "leaves from platform 4. Connections at the next stop are held.");
+    strcpy(n.bundleId, "com.apple.MobileSMS");
+    n.time = 1700000000;
+    d.showNotification(n, 0);
+}
+
+// One 1 px step, after the hold at the top.
+void scrollStep(Display& d)
+{
+    d.scrollStep(TextScrollTiming{}.holdMs + TextScrollTiming{}.stepMs);
+}
+
+void meshMessage(Display& d)
+{
+    MeshMessage m;
+    m.fromNode = 0x1234abcd;
+    strcpy(m.shortName, "KX9");
+    strcpy(m.text, "At the trailhead, heading up the ridge now. Back by 6.");
+    m.rssi  = -97;
+    m.snr   = 6.5f;
+    m.valid = true;
+    d.showLoraMessage(m, 2);
+}
+
+void clockTick(Display& d)
+{
+    d.showTime("12:35");
+}
+
+void batteryStep(Display& d)
+{
+    d.showBatteryLevel(60, false);
+}
+
+// What a minute can bring: the clock ticks, GPS gets a fix, the battery
+// drops a step, and BLE and LoRa report what they already showed.
+void headerUpdates(Display& d)
+{
+    d.showTime("12:35");
+    d.showGpsState(true);
+    d.showBatteryLevel(60, false);
+    d.showBLEState(BLE_CONNECTED);
+    d.showLoraState(true);
+}
+
+struct Scenario {
+    const char* name;
+    void      (*draw)(Display&);
+    void      (*before)(Display&) = nullptr;    ///< on screen already, not counted
+};
+
+const Scenario SCENARIOS[] = {
+    { "full screen (boot)",  bootScreen   },
+    { "notification",        notification },
+    { "long notification",   longNotification },
+    { "message scroll step", scrollStep, longNotification },
+    { "mesh message",        meshMessage  },
+    { "clock tick",          clockTick    },
+    { "battery icon",        batteryStep  },
+    { "header updates",      headerUpdates },
+};
+
+struct Result {
+    uint64_t txns, bytes;
+    double   us;
+    std::vector<uint16_t> gram;
+};
+
+Result run(const Scenario& s, bool framebuffer)
+{
+    Display* d = makeDisplay(framebuffer);
+    spi_device_t* dev = mock_spiLastDevice();
+
+    if (s.draw != bootScreen) bootScreen(*d);
+    if (s.before) s.before(*d);
+    d->flush();
+    dev->reset();
+
+    s.draw(*d);
+    d->flush();
+
+    Result r{ dev->txns, dev->bytes, dev->busUs(TXN_OVERHEAD_US), dev->gram };
+    delete d;
+    return r;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc > 1) TXN_OVERHEAD_US = atof(argv[1]);
+
+    printf("# 40 MHz SPI, %.1f us per transaction\n", TXN_OVERHEAD_US);
+    printf("%-20s %10s %10s %10s   %10s %10s %10s   %s\n",
+           "screen", "direct tx", "bytes", "ms", "frame tx", "bytes", "ms", "pixels");
+
+    bool allMatch = true;
+    for (const Scenario& s : SCENARIOS)
+    {
+        const Result direct = run(s, false);
+        const Result frame  = run(s, true);
+        const bool   match  = direct.gram == frame.gram;
+        allMatch = allMatch && match;
+
+        printf("%-20s %10llu %10llu %10.2f   %10llu %10llu %10.2f   %s\n", s.name,
+               static_cast<unsigned long long>(direct.txns),
+               static_cast<unsigned long long>(direct.bytes), direct.us / 1000,
+               static_cast<unsigned long long>(frame.txns),
+               static_cast<unsigned long long>(frame.bytes), frame.us / 1000,
+               match ? "same" : "DIFFER");
+    }
+    return allMatch ? 0 : 1;
+}
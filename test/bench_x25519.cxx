@@ -0,0 +1,83 @@
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * bench_x25519.cxx — host throughput benchmark for mc_x25519SharedSecret
+ * (variable base) and mc_x25519PublicKey (fixed base u = 9).
+ *
+ * Built once per field backend (bench_x25519_fe16 / bench_x25519_fe32, see
+ * CMakeLists.txt) so the two can be compared on the same machine:
+ *
+ *   ./build/bench_x25519_fe16 && ./build/bench_x25519_fe32
+ *
+ * Not registered with CTest — timings are machine-dependent.  Absolute
+ * numbers on the host say little about the ESP32-S3; the ratio is what
+ * matters.
+ */
+
+#include "mesh_crypto.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+int main(int argc, char** argv)
+{
+    const int iterations = (argc > 1) ? std::atoi(argv[1]) : 2000;
+
+    // RFC 7748 §5.2 iterated chain — every call feeds the next, so the
+    // compiler cannot hoist or elide any of the work.
+    uint8_t k[32] = {9};
+    uint8_t u[32] = {9};
+
+    mc_x25519ResetScalarMultCount();
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        uint8_t r[32];
+        mc_x25519SharedSecret(k, u, r);
+        memcpy(u, k, 32);
+        memcpy(k, r, 32);
+    }
+    const auto t1 = std::chrono::steady_clock::now();
+
+    const double sec = std::chrono::duration<double>(t1 - t0).count();
+    const uint32_t n = mc_x25519ScalarMultCount();
+    std::printf("backend=%-16s shared     scalar-mults=%u  %.3f s  %.0f scalar-mults/sec  %.1f us/op"
+                "  (k[0..3]=%02x%02x%02x%02x)\n",
+                mc_x25519FieldBackend(), (unsigned)n, sec,
+                n / sec, sec * 1e6 / n, k[0], k[1], k[2], k[3]);
+
+    // Public-key derivation, chained the same way (pub → next private key).
+    mc_x25519ResetScalarMultCount();
+    const auto t2 = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        uint8_t r[32];
+        mc_x25519PublicKey(k, r);
+        memcpy(k, r, 32);
+    }
+    const auto t3 = std::chrono::steady_clock::now();
+
+    const double psec = std::chrono::duration<double>(t3 - t2).count();
+    const uint32_t pn = mc_x25519ScalarMultCount();
+    std::printf("backend=%-16s public-key scalar-mults=%u  %.3f s  %.0f scalar-mults/sec  %.1f us/op"
+                "  (%.2fx shared)  (k[0..3]=%02x%02x%02x%02x)\n",
+                mc_x25519FieldBackend(), (unsigned)pn, psec,
+                pn / psec, psec * 1e6 / pn, sec / n / (psec / pn),
+                k[0], k[1], k[2], k[3]);
+    return 0;
+}
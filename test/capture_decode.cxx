@@ -0,0 +1,163 @@
+/**
+ * capture_decode.cxx — print a packet capture exported by the Diag service.
+ *
+ * Reads the LINKTYPE_LORATAP pcap stream that the capture characteristic
+ * notifies (mesh_capture.h), either from a file or from stdin, and prints
+ * one line per frame: receive time, RSSI / SNR, the Meshtastic OTA header,
+ * and — for channel frames — the portnum after decrypting with the default
+ * LongFast PSK.  Text messages are shown inline.  PKC direct messages are
+ * listed but not decrypted.
+ *
+ *   ./build/capture_decode dump.pcap
+ *   some-ble-tool | ./build/capture_decode -
+ *
+ * The same file opens in Wireshark with the LoRaTap dissector.
+ *
+ * Not registered with CTest — a tool, not a test.
+ */
+
+#include "mesh_codec.h"
+#include "mesh_crypto.h"
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+
+namespace {
+
+static const uint8_t DEFAULT_PSK[16] = {
+    0xd4, 0xf1, 0xbb, 0x3a, 0x20, 0x29, 0x07, 0x59,
+    0xf0, 0xbc, 0xff, 0xab, 0xcf, 0x4e, 0x69, 0x01,
+};
+
+static constexpr uint32_t PCAP_MAGIC       = 0xA1B2C3D4;
+static constexpr uint32_t LINKTYPE_LORATAP = 270;
+static constexpr size_t   MESH_HDR         = 16;
+
+static uint32_t le32(const uint8_t* p)
+{
+    return p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static uint32_t be32(const uint8_t* p)
+{
+    return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3];
+}
+
+static bool readAll(FILE* f, uint8_t* buf, size_t n)
+{
+    return fread(buf, 1, n, f) == n;
+}
+
+static void printFrame(uint32_t tsSec, uint32_t tsUsec, const uint8_t* tap, size_t tapLen,
+                       const uint8_t* pkt, size_t len)
+{
+    const int   rssi = tapLen >= 11 ? static_cast<int>(tap[10]) - 139 : 0;
+    const float snr  = tapLen >= 14 ? static_cast<int8_t>(tap[13]) / 4.f : 0.f;
+
+    printf("%6" PRIu32 ".%03" PRIu32 "  %4d dBm %6.2f dB  %3zu B",
+           tsSec, tsUsec / 1000, rssi, snr, len);
+
+    if (len < MESH_HDR)
+    {
+        printf("  (short)\n");
+        return;
+    }
+
+    const uint32_t to       = le32(pkt + 0);
+    const uint32_t from     = le32(pkt + 4);
+    const uint32_t id       = le32(pkt + 8);
+    const uint8_t  hopLimit = pkt[12] & 0x07;
+    const uint8_t  hopStart = (pkt[12] >> 5) & 0x07;
+    const uint8_t  chanHash = pkt[13];
+    const uint8_t  relay    = pkt[15];
+
+    printf("  %08" PRIx32 " → %08" PRIx32 "  id %08" PRIx32 "  hop %u/%u  ch %02x  relay %02x",
+           from, to, id, hopLimit, hopStart, chanHash, relay);
+
+    if (chanHash == 0)
+    {
+        printf("  PKC\n");
+        return;
+    }
+
+    uint8_t plain[255];
+    const size_t plainLen = len - MESH_HDR;
+    uint32_t       port = 0;
+    const uint8_t* payload = nullptr;
+    size_t         payloadLen = 0;
+    bool           wantResponse = false;
+    if (!mc_channelCrypt(DEFAULT_PSK, id, from, pkt + MESH_HDR, plainLen, plain) ||
+        !mc_parseData(plain, plainLen, port, payload, payloadLen, wantResponse))
+    {
+        printf("  (not default PSK)\n");
+        return;
+    }
+
+    printf("  port %" PRIu32, port);
+    if (port == PORT_TEXT)
+        printf("  \"%.*s\"", static_cast<int>(payloadLen), reinterpret_cast<const char*>(payload));
+    printf("\n");
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc != 2)
+    {
+        fprintf(stderr, "usage: %s <capture.pcap | ->\n", argv[0]);
+        return 2;
+    }
+
+    FILE* f = strcmp(argv[1], "-") == 0 ? stdin : fopen(argv[1], "rb");
+    if (!f)
+    {
+        perror(argv[1]);
+        return 1;
+    }
+
+    uint8_t hdr[24];
+    if (!readAll(f, hdr, sizeof(hdr)) || le32(hdr) != PCAP_MAGIC)
+    {
+        fprintf(stderr, "%s: not a little-endian pcap file\n", argv[1]);
+        return 1;
+    }
+    if (le32(hdr + 20) != LINKTYPE_LORATAP)
+    {
+        fprintf(stderr, "%s: link type %" PRIu32 ", expected LoRaTap (%" PRIu32 ")\n",
+                argv[1], le32(hdr + 20), LINKTYPE_LORATAP);
+        return 1;
+    }
+
+    unsigned frames = 0;
+    uint8_t  rec[16];
+    uint8_t  body[65536];
+    while (readAll(f, rec, sizeof(rec)))
+    {
+        const uint32_t incl = le32(rec + 8);
+        if (incl > sizeof(body) || !readAll(f, body, incl))
+        {
+            fprintf(stderr, "truncated record after %u frames\n", frames);
+            return 1;
+        }
+
+        // LoRaTap: version 0, padding, big-endian header length.
+        const size_t tapLen = incl >= 4 ? (static_cast<size_t>(body[2]) << 8 | body[3]) : 0;
+        if (incl < 4 || body[0] != 0 || tapLen < 4 || tapLen > incl)
+        {
+            fprintf(stderr, "bad LoRaTap header in frame %u\n", frames);
+            return 1;
+        }
+        if (frames == 0 && tapLen >= 10)
+            printf("# %.3f MHz  BW %u kHz  SF%u\n",
+                   be32(body + 4) / 1e6, body[8] * 125u, body[9]);
+
+        printFrame(le32(rec), le32(rec + 4), body, tapLen, body + tapLen, incl - tapLen);
+        frames++;
+    }
+
+    printf("# %u frames\n", frames);
+    if (f != stdin) fclose(f);
+    return 0;
+}
@@ -0,0 +1,252 @@
+/**
+ * font_compile.cxx — compile the bitmap fonts into run tables.
+ *
+ * Reads the bitmap tables in main/fonts.cxx and writes main/font_spans.cxx:
+ * each glyph as (background, ink) nibble pairs, row-major, stopping after
+ * the last ink pixel (format in main/fonts.h).  Every bitmap font is
+ * emitted at its fixed cell width; the 7×10 and 11×18 fonts are emitted a
+ * second time as proportional fonts, each glyph cropped to its ink plus
+ * one column of spacing.
+ *
+ *   cmake --build build --target font_spans     # regenerates main/font_spans.cxx
+ *   ./build/font_compile out.cxx                 # or write anywhere ("-" = stdout)
+ *
+ * A size summary, bitmap bytes against run bytes, goes to stderr.
+ *
+ * Not registered with CTest — a tool, not a test.  test_font_spans checks
+ * the committed output against the bitmaps.
+ */
+
+#include "fonts.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Glyph {
+    uint8_t              left;      // first bitmap column
+    uint8_t              width;     // columns taken, spacing included
+    std::vector<uint8_t> runs;
+};
+
+struct Compiled {
+    std::string        name;        // Font_<name>
+    uint8_t            width, height;
+    bool               proportional;
+    std::vector<Glyph> glyphs;
+    size_t             runBytes = 0;
+};
+
+bool ink(const FontBitmap& f, uint32_t g, uint32_t row, uint32_t col)
+{
+    return col < 16 && (f.data[g * f.height + row] << col) & 0x8000;
+}
+
+void emitPair(std::vector<uint8_t>& out, uint32_t bg, uint32_t fg)
+{
+    while (bg > 15) { out.push_back(0xF0); bg -= 15; }
+    while (fg > 15) { out.push_back(static_cast<uint8_t>(bg << 4 | 15)); bg = 0; fg -= 15; }
+    out.push_back(static_cast<uint8_t>(bg << 4 | fg));
+}
+
+Glyph encode(const FontBitmap& f, uint32_t g, bool proportional)
+{
+    Glyph out{ 0, f.width, {} };
+    if (proportional)
+    {
+        int first = -1, last = -1;
+        for (uint32_t col = 0; col < f.width; col++)
+            for (uint32_t row = 0; row < f.height; row++)
+                if (ink(f, g, row, col))
+                {
+                    if (first < 0) first = static_cast<int>(col);
+                    last = static_cast<int>(col);
+                }
+        if (first < 0)
+        {
+            out.width = static_cast<uint8_t>(f.width / 2);  // space
+            return out;
+        }
+        out.left  = static_cast<uint8_t>(first);
+        out.width = static_cast<uint8_t>(last - first + 2);
+    }
+
+    // Runs over the pixels actually drawn; the spacing column is always
+    // background, so it never holds ink.
+    uint32_t bg = 0, fg = 0;
+    for (uint32_t row = 0; row < f.height; row++)
+    {
+        for (uint32_t col = 0; col < out.width; col++)
+        {
+            if (ink(f, g, row, out.left + col))
+            {
+                fg++;
+            }
+            else
+            {
+                if (fg) { emitPair(out.runs, bg, fg); bg = 0; fg = 0; }
+                bg++;
+            }
+        }
+    }
+    if (fg) emitPair(out.runs, bg, fg);
+    return out;
+}
+
+Compiled compile(const char* name, const FontBitmap& f, bool proportional)
+{
+    Compiled c{ name, 0, f.height, proportional, {} };
+    for (uint32_t g = 0; g < FONT_GLYPHS; g++)
+    {
+        c.glyphs.push_back(encode(f, g, proportional));
+        c.runBytes += c.glyphs.back().runs.size();
+        if (c.glyphs.back().width > c.width) c.width = c.glyphs.back().width;
+    }
+    return c;
+}
+
+// Comment naming a glyph, as fonts.cxx does: a backslash would splice
+// the next line into a // comment.
+std::string glyphLabel(uint32_t g)
+{
+    const char ch = static_cast<char>(FONT_FIRST + g);
+    if (ch == ' ')  return "// sp";
+    if (ch == '\\') return "/* \\ */";
+    return std::string("// ") + ch;
+}
+
+void write(FILE* out, const Compiled& c)
+{
+    std::string rule;
+    for (size_t i = c.name.size(); i < 63; i++) rule += "─";
+    fprintf(out, "// ── Font_%s %s\n\n", c.name.c_str(), rule.c_str());
+
+    fprintf(out, "static const uint8_t Spans_%s[] = {\n", c.name.c_str());
+    for (uint32_t g = 0; g < FONT_GLYPHS; g++)
+    {
+        std::string line;
+        char hex[8];
+        for (uint8_t b : c.glyphs[g].runs)
+        {
+            snprintf(hex, sizeof(hex), "0x%02X,", b);
+            if (!line.empty()) line += ' ';
+            line += hex;
+        }
+        if (line.empty())
+        {
+            fprintf(out, "    %s (no ink)\n", glyphLabel(g).c_str());
+            continue;
+        }
+
+        // Long glyphs wrap at 12 bytes; the label goes on the first line.
+        const size_t CHUNK = 12 * 6;
+        size_t pos = 0;
+        do {
+            const std::string chunk = line.substr(pos, CHUNK - 1);
+            if (pos == 0)
+                fprintf(out, "    %-*s  %s\n", static_cast<int>(CHUNK - 1),
+                        chunk.c_str(), glyphLabel(g).c_str());
+            else
+                fprintf(out, "    %s\n", chunk.c_str());
+            pos += CHUNK;
+        } while (pos < line.size());
+    }
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "static const uint16_t Index_%s[FONT_GLYPHS + 1] = {", c.name.c_str());
+    size_t off = 0;
+    for (uint32_t g = 0; g <= FONT_GLYPHS; g++)
+    {
+        fprintf(out, "%s%4zu,", g % 12 == 0 ? "\n   " : "", off);
+        if (g < FONT_GLYPHS) off += c.glyphs[g].runs.size();
+    }
+    fprintf(out, "\n};\n\n");
+
+    if (c.proportional)
+    {
+        fprintf(out, "static const uint8_t Advance_%s[FONT_GLYPHS] = {", c.name.c_str());
+        for (uint32_t g = 0; g < FONT_GLYPHS; g++)
+            fprintf(out, "%s%2u,", g % 16 == 0 ? "\n   " : "", c.glyphs[g].width);
+        fprintf(out, "\n};\n\n");
+    }
+
+    fprintf(out, "const FontDef Font_%s = {%u, %u, Index_%s, Spans_%s, %s%s};\n\n",
+            c.name.c_str(), c.width, c.height, c.name.c_str(), c.name.c_str(),
+            c.proportional ? "Advance_" : "nullptr",
+            c.proportional ? c.name.c_str() : "");
+}
+
+const char* HEADER = R"(/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * font_spans.cxx — GENERATED by test/font_compile.cxx from fonts.cxx.
+ * Do not edit by hand.
+ *
+ * Run tables of the TFT fonts; format in fonts.h.
+ */
+
+#include "fonts.h"
+
+)";
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc != 2)
+    {
+        fprintf(stderr, "usage: %s <font_spans.cxx | ->\n", argv[0]);
+        return 2;
+    }
+
+    const Compiled fonts[] = {
+        compile("7x10",       FontBitmap_7x10,  false),
+        compile("11x18",      FontBitmap_11x18, false),
+        compile("16x26",      FontBitmap_16x26, false),
+        compile("7x10_Prop",  FontBitmap_7x10,  true),
+        compile("11x18_Prop", FontBitmap_11x18, true),
+    };
+
+    FILE* out = strcmp(argv[1], "-") == 0 ? stdout : fopen(argv[1], "w");
+    if (!out)
+    {
+        perror(argv[1]);
+        return 1;
+    }
+    fputs(HEADER, out);
+    for (const Compiled& c : fonts) write(out, c);
+    if (out != stdout) fclose(out);
+
+    size_t bitmapTotal = 0, spanTotal = 0;
+    for (const Compiled& c : fonts)
+    {
+        const size_t bitmap = FONT_GLYPHS * c.height * sizeof(uint16_t);
+        const size_t spans  = c.runBytes + (FONT_GLYPHS + 1) * sizeof(uint16_t) +
+                              (c.proportional ? FONT_GLYPHS : 0);
+        fprintf(stderr, "Font_%-11s bitmap %5zu B   runs %5zu B\n",
+                c.name.c_str(), bitmap, spans);
+        if (!c.proportional) bitmapTotal += bitmap;
+        spanTotal += spans;
+    }
+    fprintf(stderr, "total          bitmap %5zu B   runs %5zu B (fixed and proportional)\n",
+            bitmapTotal, spanTotal);
+    return 0;
+}
@@ -0,0 +1,161 @@
+#!/usr/bin/env python3
+"""
+Regenerate test/pb_corpus/ — seed inputs for fuzz_mesh_codec and the
+packet set replayed by bench_pb_decode.
+
+    python3 test/gen_pb_corpus.py test/pb_corpus
+
+Every file is a decrypted Meshtastic Data proto (the plaintext that
+mc_parseData() sees after AES-CTR), encoded exactly as nanopb 0.4 /
+Meshtastic 2.7.x firmware emits it: fields in ascending order, proto3
+defaults omitted, repeated scalars packed.  Field values mirror the OTA
+captures referenced in test_mesh_codec.cxx.  A handful of deliberately
+malformed inputs (prefix "bad_") pin the error paths.
+
+Only the Python standard library is used.
+"""
+
+import os
+import struct
+import sys
+
+
+def varint(v):
+    v &= (1 << 64) - 1
+    out = bytearray()
+    while v > 0x7F:
+        out.append((v & 0x7F) | 0x80)
+        v >>= 7
+    out.append(v)
+    return bytes(out)
+
+
+def zz(v):
+    return (v << 1) ^ (v >> 31)
+
+
+def tag(field, wt):
+    return varint((field << 3) | wt)
+
+
+def f_varint(field, v):
+    return tag(field, 0) + varint(v)
+
+
+def f_fixed32(field, v):
+    return tag(field, 5) + struct.pack("<I", v & 0xFFFFFFFF)
+
+
+def f_float(field, v):
+    return tag(field, 5) + struct.pack("<f", v)
+
+
+def f_bytes(field, b):
+    return tag(field, 2) + varint(len(b)) + b
+
+
+def data(portnum, payload, want_response=False, dest=0, request_id=0):
+    out = f_varint(1, portnum) + f_bytes(2, payload)
+    if want_response:
+        out += f_varint(3, 1)
+    if dest:
+        out += f_fixed32(4, dest)
+    if request_id:
+        out += f_fixed32(6, request_id)
+    return out + f_varint(9, 0)
+
+
+def position(lat, lon, alt=0, t=0, sats=0, speed=0, track=0):
+    out = f_fixed32(1, lat) + f_fixed32(2, lon)
+    if alt:
+        out += f_varint(3, alt)
+    if t:
+        out += f_fixed32(4, t)
+    out += f_varint(5, 2)
+    if t:
+        out += f_fixed32(7, t)
+    if speed:
+        out += f_varint(10, speed)
+    if track:
+        out += f_varint(11, track)
+    if sats:
+        out += f_varint(14, sats)
+    return out + tag(18, 0) + varint(32)
+
+
+def user(node, long_name, short_name, hw, role=0, key=None, mac=None):
+    out = f_bytes(1, ("!%08x" % node).encode())
+    out += f_bytes(2, long_name.encode()) + f_bytes(3, short_name.encode())
+    if mac:
+        out += f_bytes(4, mac)
+    out += f_varint(5, hw)
+    if role:
+        out += f_varint(7, role)
+    if key:
+        out += f_bytes(8, key)
+    return out + f_varint(9, 0)
+
+
+def telemetry(t, level, volts, chutil, airtx, uptime):
+    dm = (f_varint(1, level) + f_float(2, volts) + f_float(3, chutil)
+          + f_float(4, airtx) + f_varint(5, uptime))
+    return f_fixed32(1, t) + f_bytes(2, dm)
+
+
+def route_discovery(route, snr, packed=True):
+    if packed:
+        out = b""
+        if route:
+            out += f_bytes(1, b"".join(struct.pack("<I", r) for r in route))
+        if snr:
+            out += f_bytes(2, b"".join(varint(zz(s)) for s in snr))
+        return out
+    return (b"".join(f_fixed32(1, r) for r in route)
+            + b"".join(f_varint(2, zz(s)) for s in snr))
+
+
+KEY = bytes(range(0x40, 0x60))
+MAC = bytes([0x48, 0x27, 0xE2, 0x1A, 0x2B, 0x3C])
+
+CORPUS = {
+    "text_short": data(1, b"hi"),
+    "text_long": data(1, b"Meet at the trailhead at 0800, bring the spare radio + batteries"),
+    "text_utf8": data(1, "Café — \U0001F4E1 ok".encode()),
+    "alert": data(11, b"SOS near ridge"),
+    "position_gps": data(3, position(473977420, 85452360, alt=412, t=1760600000,
+                                     sats=9, speed=140, track=27150)),
+    "position_nofix_time": data(3, position(0, 0, t=1760600123)),
+    "position_southwest": data(3, position(-338688000 & 0xFFFFFFFF,
+                                           -1512093000 & 0xFFFFFFFF, alt=-3)),
+    "nodeinfo_tracker": data(4, user(0xDA5C1F04, "Heltec Tracker 1f04", "1f04",
+                                     48, role=5, key=KEY, mac=MAC),
+                             want_response=True),
+    "nodeinfo_client_nokey": data(4, user(0x433B8A21, "Base Camp", "BC", 43)),
+    "telemetry_device": data(67, telemetry(1760600200, 87, 4.02, 12.5, 1.75, 86400)),
+    "node_status": data(36, f_varint(1, 3600) + f_varint(3, 1)),
+    "pki_report": data(12, f_bytes(1, KEY) + f_varint(2, 0x433B8A21)),
+    "traceroute_empty": data(70, b"", dest=0xDA5C1F04),
+    "traceroute_packed": data(70, route_discovery([0x433B8A21, 0x12AB34CD], [24, -9])),
+    "traceroute_unpacked": data(70, route_discovery([0x433B8A21], [-40], packed=False)),
+    "routing_ack": data(5, f_varint(3, 0), request_id=0x5EED1234),
+    "map_report": data(73, f_bytes(1, b"Base Camp") + f_bytes(2, b"BC")
+                       + f_varint(3, 43) + f_varint(5, 1) + f_varint(6, 0)),
+    "bad_truncated_len": bytes([0x08, 0x01, 0x12, 0x10, 0x41]),
+    "bad_overlong_varint": bytes([0x08] + [0xFF] * 11),
+    "bad_group_wiretype": bytes([0x08, 0x01, 0x13, 0x14]),
+    "bad_truncated_fixed32": data(3, bytes([0x0D, 0x01, 0x00])),
+}
+
+
+def main():
+    outdir = sys.argv[1] if len(sys.argv) > 1 else os.path.join(
+        os.path.dirname(__file__), "pb_corpus")
+    os.makedirs(outdir, exist_ok=True)
+    for name, blob in sorted(CORPUS.items()):
+        with open(os.path.join(outdir, name + ".bin"), "wb") as f:
+            f.write(blob)
+    print("wrote %d files to %s" % (len(CORPUS), outdir))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,123 @@
+#!/usr/bin/env python3
+"""
+Generate main/x25519_base_table.h — the fixed-base precomputation table
+used by mc_x25519PublicKey() when the 10-limb field backend is selected.
+
+    python3 test/gen_x25519_base_table.py > main/x25519_base_table.h
+
+Table layout (SUPERCOP ref10 "ge_precomp" form):
+    BASE[i][j] = (j + 1) * 256^i * B     for i in 0..31, j in 0..7
+where B is the Ed25519 base point (birationally equivalent to the X25519
+base point u = 9).  Each entry stores (y + x, y − x, 2·d·x·y) as field
+elements in radix 2^25.5 (10 limbs: 26, 25, 26, 25, … bits).
+
+Only the Python standard library is used.
+"""
+
+p = 2**255 - 19
+d = (-121665 * pow(121666, p - 2, p)) % p
+
+def inv(a):
+    return pow(a, p - 2, p)
+
+def recover_x(y):
+    # x^2 = (y^2 - 1) / (d y^2 + 1)
+    xx = (y * y - 1) * inv(d * y * y + 1) % p
+    x = pow(xx, (p + 3) // 8, p)
+    if (x * x - xx) % p != 0:
+        x = x * pow(2, (p - 1) // 4, p) % p
+    assert (x * x - xx) % p == 0
+    if x & 1:
+        x = p - x
+    return x
+
+By = 4 * inv(5) % p
+Bx = recover_x(By)
+B = (Bx, By)
+
+# Sanity: B maps to Montgomery u = (1 + y) / (1 - y) = 9
+assert (1 + By) * inv(1 - By) % p == 9
+
+def add(P, Q):
+    x1, y1 = P
+    x2, y2 = Q
+    t = d * x1 * x2 * y1 * y2 % p
+    x3 = (x1 * y2 + x2 * y1) * inv(1 + t) % p
+    y3 = (y1 * y2 + x1 * x2) * inv(1 - t) % p
+    return (x3, y3)
+
+def limbs(v):
+    out = []
+    shift = 0
+    for i in range(10):
+        bits = 26 if i % 2 == 0 else 25
+        out.append((v >> shift) & ((1 << bits) - 1))
+        shift += bits
+    assert shift == 255
+    return out
+
+def fe_str(v):
+    return "{" + ",".join(str(l) for l in limbs(v % p)) + "}"
+
+HEADER = """\
+/**
+ * Copyright (c) 2025-2026 Sjofn LLC
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * x25519_base_table.h — GENERATED by test/gen_x25519_base_table.py.
+ * Do not edit by hand.
+ *
+ * BASE_TABLE[i][j] = (j + 1) · 256^i · B on Ed25519, in ref10 precomputed
+ * form {y + x, y − x, 2·d·x·y}, radix-2^25.5 limbs.  32 × 8 entries,
+ * 30 KiB of .rodata (flash).
+ *
+ * Private to mesh_crypto.cxx.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+struct X25519BasePrecomp {
+    int32_t yplusx[10];
+    int32_t yminusx[10];
+    int32_t xy2d[10];
+};
+
+static const X25519BasePrecomp X25519_BASE_TABLE[32][8] = {
+"""
+
+def main():
+    lines = [HEADER]
+    row_base = B
+    for i in range(32):
+        lines.append("  { // 256^%d · B\n" % i)
+        P = row_base
+        for j in range(8):
+            x, y = P
+            lines.append("    { %s,\n      %s,\n      %s },\n"
+                         % (fe_str(y + x), fe_str(y - x), fe_str(2 * d * x * y)))
+            P = add(P, row_base)
+        lines.append("  },\n")
+        # next row base = 256 · row_base
+        for _ in range(8):
+            row_base = add(row_base, row_base)
+    lines.append("};\n")
+    print("".join(lines), end="")
+
+if __name__ == "__main__":
+    main()
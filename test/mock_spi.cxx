@@ -0,0 +1,118 @@
+/**
+ * mock_spi.cxx — mock SPI master device for the host TFT benches
+ * (see mock_spi.h).
+ */
+
+#include "mock_spi.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+static constexpr double SPI_HZ = 40e6;
+
+static spi_device_t* g_lastDevice = nullptr;
+
+spi_device_t* mock_spiLastDevice() { return g_lastDevice; }
+
+// ── Panel model ───────────────────────────────────────────────────────────
+
+double spi_device_t::busUs(double overheadUs) const
+{
+    return txns * overheadUs + bytes * 8 / SPI_HZ * 1e6;
+}
+
+void spi_device_t::pixelByte(uint8_t b)
+{
+    if (hiByte) { partial = static_cast<uint16_t>(b << 8); hiByte = false; return; }
+    hiByte = true;
+    if (wx >= 0 && wx < ST7735_WIDTH && wy >= 0 && wy < ST7735_HEIGHT)
+        gram[wy * ST7735_WIDTH + wx] = partial | b;
+    if (++wx > x1) { wx = x0; if (++wy > y1) wy = y0; }
+}
+
+void spi_device_t::data(const uint8_t* p, size_t n)
+{
+    if (cmd == 0x2C) {                          // RAMWR
+        for (size_t i = 0; i < n; i++) pixelByte(p[i]);
+        return;
+    }
+    arg.insert(arg.end(), p, p + n);
+    if (arg.size() == 4 && cmd == 0x2A) {       // CASET
+        x0 = arg[1] - ST7735_XSTART;
+        x1 = arg[3] - ST7735_XSTART;
+    } else if (arg.size() == 4 && cmd == 0x2B) { // RASET
+        y0 = arg[1] - ST7735_YSTART;
+        y1 = arg[3] - ST7735_YSTART;
+    }
+}
+
+void spi_device_t::command(uint8_t c)
+{
+    cmd = c;
+    arg.clear();
+    if (c == 0x2C) { wx = x0; wy = y0; hiByte = true; }
+}
+
+// ── spi_master calls ──────────────────────────────────────────────────────
+
+esp_err_t spi_bus_initialize(spi_host_device_t, const spi_bus_config_t*, int) { return ESP_OK; }
+
+esp_err_t spi_bus_add_device(spi_host_device_t, const spi_device_interface_config_t* cfg,
+                             spi_device_handle_t* handle)
+{
+    *handle = g_lastDevice = new spi_device_t;
+    (*handle)->pre_cb    = cfg->pre_cb;
+    (*handle)->queueSize = cfg->queue_size;
+    return ESP_OK;
+}
+
+static void fail(const char* what)
+{
+    fprintf(stderr, "mock SPI: %s\n", what);
+    abort();
+}
+
+static const uint8_t* txBytes(const spi_transaction_t* t)
+{
+    return (t->flags & SPI_TRANS_USE_TXDATA)
+         ? t->tx_data : static_cast<const uint8_t*>(t->tx_buffer);
+}
+
+static void apply(spi_device_handle_t dev, const spi_transaction_t* t, const uint8_t* p)
+{
+    const size_t n = t->length / 8;
+    dev->txns++;
+    dev->bytes += n;
+    if (reinterpret_cast<intptr_t>(t->user) == 0)
+        dev->command(p[0]);
+    else
+        dev->data(p, n);
+}
+
+esp_err_t spi_device_polling_transmit(spi_device_handle_t dev, spi_transaction_t* t)
+{
+    if (!dev->queued.empty()) fail("polled transaction with queued ones pending");
+    apply(dev, t, txBytes(t));
+    return ESP_OK;
+}
+
+esp_err_t spi_device_queue_trans(spi_device_handle_t dev, spi_transaction_t* t, TickType_t)
+{
+    if (static_cast<int>(dev->queued.size()) >= dev->queueSize) fail("queue overflow");
+    const uint8_t* p = txBytes(t);
+    dev->queued.push_back({ t, std::vector<uint8_t>(p, p + t->length / 8) });
+    return ESP_OK;
+}
+
+esp_err_t spi_device_get_trans_result(spi_device_handle_t dev, spi_transaction_t** t, TickType_t)
+{
+    if (dev->queued.empty()) fail("reap with nothing queued");
+    spi_device_t::Queued q = std::move(dev->queued.front());
+    dev->queued.pop_front();
+    if (memcmp(txBytes(q.t), q.sent.data(), q.sent.size()) != 0)
+        fail("line buffer rewritten while in flight");
+    apply(dev, q.t, q.sent.data());
+    *t = q.t;
+    return ESP_OK;
+}
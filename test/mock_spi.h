@@ -0,0 +1,62 @@
+/**
+ * mock_spi.h — mock SPI master device with a model of the ST7735's RAM,
+ * for the host TFT benches.
+ *
+ * Implements the spi_master calls TFT makes (test/stubs/driver/spi_master.h)
+ * on a spi_device_t that counts transactions and bytes and decodes CASET,
+ * RASET and RAMWR into a 160 × 80 pixel array, so screens drawn different
+ * ways can be compared pixel for pixel.  Queued transactions are applied
+ * when reaped, as DMA would read them.  The mock aborts if a queued buffer
+ * is rewritten before it is reaped, a polled transaction starts with
+ * queued ones pending, or the queue overflows.
+ *
+ * Bus time is modelled as 40 MHz on the wire plus a fixed cost per
+ * transaction (driver setup and CS/DC turnaround; an estimate — measure on
+ * the board to refine it).
+ */
+
+#pragma once
+
+#include "tft.h"
+
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+struct spi_device_t {
+    transaction_cb_t pre_cb     = nullptr;
+    int              queueSize  = 1;
+
+    // Queued transactions with a copy of their data as queued.
+    struct Queued {
+        spi_transaction_t*   t;
+        std::vector<uint8_t> sent;
+    };
+    std::deque<Queued> queued;
+
+    uint64_t txns  = 0;
+    uint64_t bytes = 0;
+
+    // Panel model: last command, its argument bytes, the address window
+    // (panel coordinates, offsets removed) and the RAMWR write pointer.
+    uint8_t               cmd = 0;
+    std::vector<uint8_t>  arg;
+    int                   x0 = 0, x1 = 0, y0 = 0, y1 = 0;
+    int                   wx = 0, wy = 0;
+    bool                  hiByte = true;
+    uint16_t              partial = 0;
+    std::vector<uint16_t> gram = std::vector<uint16_t>(ST7735_WIDTH * ST7735_HEIGHT, 0);
+
+    /// Modelled bus time so far, microseconds.
+    double busUs(double overheadUs) const;
+    void   reset() { txns = 0; bytes = 0; }
+
+    void command(uint8_t c);
+    void data(const uint8_t* p, size_t n);
+
+private:
+    void pixelByte(uint8_t b);
+};
+
+/// The device added most recently — the TFT initialised last.
+spi_device_t* mock_spiLastDevice();
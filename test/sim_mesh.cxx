@@ -0,0 +1,329 @@
+/**
+ * sim_mesh.cxx — multi-node Meshtastic bench (see sim_mesh.h).
+ */
+
+#include "sim_mesh.h"
+#include "mesh_codec.h"
+#include "sx1262_defs.h"
+#include <cstdio>
+#include <cstring>
+
+static inline void _put32(uint8_t* p, uint32_t v)
+{
+    p[0] = static_cast<uint8_t>(v);       p[1] = static_cast<uint8_t>(v >> 8);
+    p[2] = static_cast<uint8_t>(v >> 16); p[3] = static_cast<uint8_t>(v >> 24);
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// SimNode — setup
+// ─────────────────────────────────────────────────────────────────────────
+
+static MeshRadioConfig _radioConfig(const SimRadioParams& p, const SimNodeConfig& cfg)
+{
+    MeshRadioConfig c;
+    c.freqHz      = 906875000;      // US LongFast default slot; the sim has one channel
+    c.sf          = p.sf;
+    c.bwHz        = p.bwHz;
+    c.cr          = p.cr;
+    c.preambleLen = p.preamble;
+    c.ldro        = p.ldro;
+    c.dutyPct     = cfg.dutyPct;
+    c.role        = cfg.role;
+    c.lbt         = cfg.lbt;
+    return c;
+}
+
+static MeshAppConfig _appConfig(const SimNodeConfig& cfg)
+{
+    MeshAppConfig c;
+    c.hopLimit = cfg.hopLimit;
+    return c;
+}
+
+// MeshRadio only stores the bus reference, so _chip may be handed over
+// before it is constructed.
+SimNode::SimNode(SimAir& air, const SimNodeConfig& cfg)
+:   MeshRadio(_chip, _radioConfig(air.params(), cfg))
+,   MeshApp(_appConfig(cfg))
+,   _cfg(cfg)
+,   _air(air)
+,   _seed(cfg.nodeId * 2654435761u ^ 0x5EEDu)
+{
+    if (_seed == 0) _seed = 1;
+    air.attach(_chip, cfg.x, cfg.y);
+
+    // Deterministic identity: private key = SHA-256(node id).
+    uint8_t idBytes[4];
+    _put32(idBytes, cfg.nodeId);
+    mc_sha256(idBytes, sizeof(idBytes), _priv);
+    mc_x25519PublicKey(_priv, _pub);
+}
+
+uint32_t SimNode::_rnd()
+{
+    // xorshift32 — esp_random() stand-in, reproducible per node.
+    _seed ^= _seed << 13;
+    _seed ^= _seed >> 17;
+    _seed ^= _seed << 5;
+    return _seed;
+}
+
+void SimNode::boot(uint32_t nowMs)
+{
+    _chip.setPowered(true);
+    _online = true;
+    _radioReset();
+    _radioStart(nowMs);
+    _wakeMs = nowMs + _radioWaitMs(nowMs);
+}
+
+void SimNode::setOnline(bool on, uint32_t nowMs)
+{
+    if (on == _online) return;
+    if (on)
+    {
+        boot(nowMs);
+        return;
+    }
+    // Power loss: RAM state goes with it, as it would on the target.
+    _chip.setPowered(false);
+    _online = false;
+    _appReset();
+    mc_dedupInit(_dedup, _radioCfg.dedupWindowMs);
+    _relay = McRelayQueue();
+    _txq   = McTxQueue();
+    _lbt   = McLbt();
+    _pending.clear();
+}
+
+// The part of _initSx1262() the simulated chip models: standby, maximum
+// payload length, receive IRQ mapping.
+void SimNode::_radioReset()
+{
+    alignas(4) uint8_t stby[4] = { CMD_SET_STANDBY, 0x00 };
+    alignas(4) uint8_t pkt[8]  = { CMD_SET_PKT_PARAMS, 0x00, 0x10, 0x00, 0xFF, 0x01, 0x00 };
+    SxXfer x[2];
+    x[0] = { stby, nullptr, 2 };
+    x[1] = { pkt,  nullptr, 7 };
+    _chip.transfer(x, 2);
+    sx_setRxIrq(_chip);
+}
+
+void SimNode::_onRadioEvent(Event e, const EventInfo& info)
+{
+    switch (e)
+    {
+    case Event::RxPacket:     _stats.rxPackets++;     break;
+    case Event::CrcError:     _stats.crcErrors++;     break;
+    case Event::HeaderError:  _stats.headerErrors++;  break;
+    case Event::TxDone:       _stats.txPackets++;     break;
+    case Event::DutyDropped:  _stats.txDutyDropped++; break;
+    case Event::RelayDropped: _stats.relayDropped++;  break;
+    case Event::Relayed:      _stats.relayed++;       break;
+    case Event::TxFailed:
+        if ((info.irq & IRQ_TIMEOUT) || info.irq == 0) _stats.txTimeouts++;
+        else                                           _stats.txErrors++;
+        break;
+    case Event::Duplicate:
+        _stats.duplicates++;
+        if (info.cancelled) _stats.relayCancelled++;
+        break;
+    default:
+        break;
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// SimNode — run loop (lora.cxx run())
+// ─────────────────────────────────────────────────────────────────────────
+
+bool SimNode::wantsService(uint32_t nowMs) const
+{
+    return _online
+        && (_chip.dio1() || static_cast<int32_t>(nowMs - _wakeMs) >= 0);
+}
+
+bool SimNode::quiet() const
+{
+    return !_online
+        || (_txPhase == TxPhase::Idle && _txq.depth == 0
+            && mc_relayNextDue(_relay, 0) == UINT32_MAX);
+}
+
+void SimNode::service(uint32_t nowMs)
+{
+    const bool rxBusy = _radioService(nowMs);
+    _sendDueRelays(nowMs);
+    _pumpTx(rxBusy, nowMs);
+    _wakeMs = nowMs + _radioWaitMs(nowMs);
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// SimNode — app layer (MeshApp hooks)
+// ─────────────────────────────────────────────────────────────────────────
+
+void SimNode::_onRxFrame(uint8_t* buf, uint8_t len, int16_t rssi, float snr, uint32_t nowMs)
+{
+    if (_admitRx(buf, len, snr, id(), nowMs) == RxAdmit::Accept)
+        _appReceive(buf, len, rssi, snr, nowMs);
+}
+
+uint32_t SimNode::_appPacketId()
+{
+    const uint32_t pktId = _rnd();
+    return pktId != 0 ? pktId : 1;
+}
+
+bool SimNode::_appSend(const uint8_t* frame, uint8_t len, McTxPriority prio)
+{
+    const uint32_t nowMs = _nowMs();
+    if (!mc_txqPush(_txq, frame, len, prio, nowMs)) return false;
+    _wakeMs = nowMs;    // a queued frame ends the loop's wait
+    return true;
+}
+
+bool SimNode::_appSendNodeInfo(uint32_t to, bool wantResponse, uint32_t requestId)
+{
+    const uint32_t self = id();
+    char longName[33];
+    char shortName[5];
+    snprintf(longName,  sizeof(longName),  "Sim %08x", (unsigned)self);
+    snprintf(shortName, sizeof(shortName), "%04x", (unsigned)(self & 0xFFFF));
+    const uint8_t mac[6] = { 0x02, 0x00,
+                             static_cast<uint8_t>(self >> 24), static_cast<uint8_t>(self >> 16),
+                             static_cast<uint8_t>(self >> 8),  static_cast<uint8_t>(self) };
+
+    uint8_t frame[MESH_HDR + MESH_MAX_DATA];
+    const uint8_t len = _appBuildFrame(frame, PORT_NODEINFO,
+                                       [&](PbWriter& w) {
+                                           mc_writeUser(w, self, longName, shortName, mac,
+                                                        /*hwModel=*/0, _cfg.role, _pub);
+                                       },
+                                       wantResponse, to, requestId);
+    return len > 0 && _appSend(frame, len, mc_txPriorityFor(PORT_NODEINFO, to != MESH_BROADCAST));
+}
+
+void SimNode::_onAppText(const Packet& p, const uint8_t* text, size_t len, bool alert)
+{
+    (void)alert;
+    SimText t;
+    t.from = p.from;
+    t.to   = p.to;
+    t.id   = p.id;
+    t.atMs = p.atMs;
+    t.hops = static_cast<uint8_t>(p.hopStart - p.hopLimit);
+    t.pkc  = p.pkc;
+    memcpy(t.text, text, len < sizeof(t.text) - 1 ? len : sizeof(t.text) - 1);
+    _inbox.push_back(t);
+}
+
+void SimNode::_onAppEvent(AppEvent e, const AppEventInfo& info)
+{
+    switch (e)
+    {
+    case AppEvent::Decrypted: _stats.decryptOk++; break;
+    case AppEvent::PkcHeld:   _stats.pkcNoKey++;  break;
+    case AppEvent::KeyRequest:
+        if (!info.flag) _stats.keyRequests++;
+        break;
+    case AppEvent::NodeInfo:
+        if (info.user->hasPublicKey) _flushPending(info.pkt->from);
+        break;
+    default:
+        break;
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// SimNode — originating packets
+// ─────────────────────────────────────────────────────────────────────────
+
+bool SimNode::_sendText(uint32_t to, const char* text, size_t len, bool pkc)
+{
+    uint8_t frame[MESH_HDR + MESH_MAX_DATA];
+    const uint8_t n = _appBuildFrame(frame, PORT_TEXT,
+                                     [&](PbWriter& w) {
+                                         w.raw(reinterpret_cast<const uint8_t*>(text), len);
+                                     },
+                                     /*wantResponse=*/false, to, /*requestId=*/0, pkc);
+    return n > 0 && _appSend(frame, n, mc_txPriorityFor(PORT_TEXT, to != MESH_BROADCAST));
+}
+
+bool SimNode::sendText(uint32_t to, const char* text)
+{
+    const size_t len = strnlen(text, sizeof(PendingDm::text) - 1);
+
+    if (to == MESH_BROADCAST)
+        return _sendText(to, text, len, /*pkc=*/false);
+    if (hasKeyFor(to))
+        return _sendText(to, text, len, /*pkc=*/true);
+
+    // No key yet: ask for the peer's NodeInfo and send once it answers.
+    PendingDm dm = {};
+    dm.to = to;
+    memcpy(dm.text, text, len);
+    _pending.push_back(dm);
+    _stats.keyRequests++;
+    return _appSendNodeInfo(to, /*wantResponse=*/true, /*requestId=*/0);
+}
+
+bool SimNode::sendNodeInfo(uint32_t to, bool wantResponse)
+{
+    return _appSendNodeInfo(to, wantResponse, /*requestId=*/0);
+}
+
+void SimNode::_flushPending(uint32_t peer)
+{
+    for (size_t i = 0; i < _pending.size();)
+    {
+        if (_pending[i].to != peer)
+        {
+            i++;
+            continue;
+        }
+        const PendingDm& dm = _pending[i];
+        _sendText(peer, dm.text, strlen(dm.text), /*pkc=*/true);
+        _pending.erase(_pending.begin() + static_cast<std::ptrdiff_t>(i));
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// SimMesh
+// ─────────────────────────────────────────────────────────────────────────
+
+SimMesh::SimMesh(const SimRadioParams& p)
+:   _air(p)
+{
+}
+
+SimNode& SimMesh::add(const SimNodeConfig& cfg)
+{
+    _nodes.push_back(std::make_unique<SimNode>(_air, cfg));
+    SimNode& n = *_nodes.back();
+    n.boot(_now);
+    return n;
+}
+
+void SimMesh::run(uint32_t ms)
+{
+    for (uint32_t i = 0; i < ms; i++)
+    {
+        _now++;
+        _air.advanceTo(static_cast<uint64_t>(_now) * 1000u);
+        for (auto& n : _nodes)
+            if (n->wantsService(_now)) n->service(_now);
+    }
+}
+
+uint32_t SimMesh::runUntilQuiet(uint32_t maxMs)
+{
+    const uint32_t start = _now;
+    while (_now - start < maxMs)
+    {
+        run(1);
+        bool quiet = !_air.onAir();
+        for (auto& n : _nodes) quiet = quiet && n->quiet();
+        if (quiet) break;
+    }
+    return _now - start;
+}
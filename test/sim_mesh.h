@@ -0,0 +1,183 @@
+/**
+ * sim_mesh.h — multi-node Meshtastic bench on simulated SX1262 radios.
+ *
+ * Each SimNode is one node's LoRa task reduced to the firmware's own
+ * platform-free pieces:
+ *
+ *   radio       MeshRadio (mesh_radio.h) — the LoRa task's wakeup timing,
+ *               IRQ dispatch, TX / LBT state machine and receive admission
+ *               — running the sx1262_batch sequences against a SimSx1262
+ *   app         MeshApp (mesh_app.h) — the LoRa task's packet handler:
+ *               decryption, the neighbour table, NodeInfo and key replies,
+ *               held PKC DMs, and the frames the node originates
+ *   identity    X25519 key pair per node; NodeInfo carries the public key.
+ *               The one piece that is the sim's own is the sending side of
+ *               a DM, which a phone does on the target: to a node with no
+ *               known key it first requests its NodeInfo and waits
+ *
+ * SimMesh owns the medium and the nodes and steps them on one virtual
+ * millisecond clock.  A node's loop runs only when the firmware's would
+ * wake — DIO1 raised, or the wait from _radioWaitMs() run out — so runs
+ * are deterministic for a given seed and cost little while idle.
+ *
+ * Ticks are milliseconds throughout, as on the target (CONFIG_FREERTOS_HZ
+ * = 1000).
+ */
+
+#pragma once
+
+#include "sim_sx1262.h"
+#include "mesh_app.h"
+#include "mesh_radio.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+struct SimNodeConfig {
+    uint32_t nodeId  = 0;
+    uint8_t  role    = 0;       ///< DeviceRole; MC_ROLE_* relay, 0 = CLIENT
+    float    x       = 0.f;     ///< metres
+    float    y       = 0.f;
+    uint8_t  dutyPct = 100;     ///< CONFIG_LORA_DUTY_CYCLE_PCT
+    bool     lbt     = true;    ///< CAD before every frame
+    uint8_t  hopLimit = 3;
+};
+
+/// A text message delivered to this node.
+struct SimText {
+    uint32_t from  = 0;
+    uint32_t to    = 0;
+    uint32_t id    = 0;
+    uint32_t atMs  = 0;
+    uint8_t  hops  = 0;         ///< hop_start − hop_limit
+    bool     pkc   = false;
+    char     text[64] = {};
+};
+
+struct SimNodeStats {
+    uint32_t rxPackets      = 0;
+    uint32_t crcErrors      = 0;
+    uint32_t headerErrors   = 0;
+    uint32_t duplicates     = 0;
+    uint32_t decryptOk      = 0;
+    uint32_t pkcNoKey       = 0;    ///< PKC DMs to us we could not decrypt yet
+    uint32_t relayed        = 0;
+    uint32_t relayCancelled = 0;
+    uint32_t relayDropped   = 0;
+    uint32_t txPackets      = 0;
+    uint32_t txErrors       = 0;    ///< ended without TX_DONE, not a timeout
+    uint32_t txTimeouts     = 0;    ///< chip TIMEOUT or TX_DEADLINE_MS
+    uint32_t txDutyDropped  = 0;
+    uint32_t keyRequests    = 0;    ///< NodeInfo want_response sent for a key
+};
+
+class SimNode : private MeshRadio, private MeshApp
+{
+public:
+    SimNode(SimAir& air, const SimNodeConfig& cfg);
+
+    uint32_t   id() const   { return _cfg.nodeId; }
+    SimSx1262& chip()       { return _chip; }
+    bool       online() const { return _online; }
+
+    /// Power the radio up and enter RX, as run() does before its loop.
+    void boot(uint32_t nowMs);
+
+    /// Node churn: off powers the radio down and stops the loop.
+    void setOnline(bool on, uint32_t nowMs);
+
+    /// Broadcast on the channel, or PKC DM when @p to is a node.  A DM to a
+    /// node whose key is unknown waits for its NodeInfo.  Both take the
+    /// time from the medium.
+    bool sendText(uint32_t to, const char* text);
+    bool sendNodeInfo(uint32_t to, bool wantResponse);
+
+    using MeshApp::hasKeyFor;
+
+    /// Whether the firmware's loop would be awake at @p nowMs.
+    bool wantsService(uint32_t nowMs) const;
+    /// One pass of the run loop: _radioService, _sendDueRelays, _pumpTx.
+    void service(uint32_t nowMs);
+    /// Nothing queued, pending, backing off or on the air.
+    bool quiet() const;
+
+    const std::vector<SimText>& inbox() const { return _inbox; }
+    const SimNodeStats&    stats() const     { return _stats; }
+    const McNeighborTable& neighbors() const { return _neighbors; }
+    const McTxQueue&       txq() const       { return _txq; }
+    const McLbt&           lbt() const       { return _lbt; }
+    const McAirtime&       airtime() const   { return _airtime; }
+    const McPkcKeyCache&   keyCache() const  { return _pkcKeys; }
+
+private:
+    struct PendingDm {
+        uint32_t to;
+        char     text[64];
+    };
+
+    // MeshRadio hooks
+    uint32_t _radioRandom() override { return _rnd(); }
+    uint8_t* _rxSlot() override      { return _rxBuf; }
+    void     _onRxFrame(uint8_t* buf, uint8_t len, int16_t rssi, float snr,
+                        uint32_t nowMs) override;
+    void     _radioReset() override;
+    void     _onRadioEvent(Event e, const EventInfo& info) override;
+
+    // MeshApp hooks
+    uint32_t       _appSelf() const override       { return _cfg.nodeId; }
+    const uint8_t* _appPrivateKey() const override { return _priv; }
+    const uint8_t* _appPublicKey() const override  { return _pub; }
+    uint32_t       _appPacketId() override;
+    bool           _appSend(const uint8_t* frame, uint8_t len, McTxPriority prio) override;
+    bool           _appSendNodeInfo(uint32_t to, bool wantResponse,
+                                    uint32_t requestId) override;
+    void           _onAppText(const Packet& p, const uint8_t* text, size_t len,
+                              bool alert) override;
+    void           _onAppEvent(AppEvent e, const AppEventInfo& info) override;
+
+    uint32_t _rnd();
+    uint32_t _nowMs() const { return static_cast<uint32_t>(_air.nowUs() / 1000u); }
+    bool     _sendText(uint32_t to, const char* text, size_t len, bool pkc);
+    /// Send the DMs that were waiting for @p peer's key.
+    void     _flushPending(uint32_t peer);
+
+    SimNodeConfig _cfg;
+    SimAir&       _air;
+    SimSx1262     _chip;
+    bool          _online = false;
+    uint32_t      _seed;
+    uint32_t      _wakeMs = 0;      ///< end of the loop's current wait
+
+    uint8_t  _priv[32] = {};
+    uint8_t  _pub[32]  = {};
+    uint8_t  _rxBuf[255] = {};
+
+    std::vector<PendingDm> _pending;
+    std::vector<SimText>   _inbox;
+    SimNodeStats           _stats;
+};
+
+class SimMesh
+{
+public:
+    explicit SimMesh(const SimRadioParams& p = {});
+
+    /// Add and boot a node at the current time.
+    SimNode& add(const SimNodeConfig& cfg);
+
+    SimNode& node(size_t i) { return *_nodes[i]; }
+    size_t   size() const   { return _nodes.size(); }
+    SimAir&  air()          { return _air; }
+    uint32_t nowMs() const  { return _now; }
+
+    /// Advance the clock by @p ms, servicing every node that wakes.
+    void run(uint32_t ms);
+
+    /// Run until every node is quiet, at most @p maxMs.  Returns ms elapsed.
+    uint32_t runUntilQuiet(uint32_t maxMs);
+
+private:
+    SimAir   _air;
+    uint32_t _now = 0;
+    std::vector<std::unique_ptr<SimNode>> _nodes;
+};
@@ -0,0 +1,334 @@
+/**
+ * sim_sx1262.cxx — simulated SX1262 and air medium (see sim_sx1262.h).
+ */
+
+#include "sim_sx1262.h"
+#include "mesh_airtime.h"
+#include "sx1262_defs.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+static constexpr uint64_t TX_KEEP_US = 20000000;   // > longest LongSlow frame
+
+// ─────────────────────────────────────────────────────────────────────────
+// SimAir
+// ─────────────────────────────────────────────────────────────────────────
+
+SimAir::SimAir(const SimRadioParams& p)
+:   _p(p)
+,   _noiseDbm(-174.f + 10.f * std::log10(static_cast<float>(p.bwHz)) + p.noiseFigDb)
+{
+}
+
+size_t SimAir::attach(SimSx1262& chip, float x, float y)
+{
+    chip._air = this;
+    chip._idx = _sites.size();
+    _sites.push_back({ &chip, x, y });
+    return chip._idx;
+}
+
+void SimAir::move(size_t idx, float x, float y)
+{
+    _sites[idx].x = x;
+    _sites[idx].y = y;
+}
+
+uint32_t SimAir::airtimeUs(uint8_t len) const
+{
+    return mc_airtimeUs(_p.sf, _p.bwHz, _p.cr, _p.preamble, _p.ldro, len);
+}
+
+float SimAir::rssiDbm(size_t from, size_t to) const
+{
+    const float dx = _sites[from].x - _sites[to].x;
+    const float dy = _sites[from].y - _sites[to].y;
+    const float d  = std::max(1.f, std::sqrt(dx * dx + dy * dy));
+    return _p.txDbm - (_p.refLossDb + 10.f * _p.pathLossExp * std::log10(d));
+}
+
+float SimAir::snrDb(size_t from, size_t to) const
+{
+    return rssiDbm(from, to) - _noiseDbm;
+}
+
+// Demodulation floor: −7.5 dB at SF7, 2.5 dB lower per SF step.
+float SimAir::_floorDb() const
+{
+    return -7.5f - 2.5f * static_cast<float>(_p.sf - 7);
+}
+
+bool SimAir::canHear(size_t from, size_t to) const
+{
+    return from != to && snrDb(from, to) >= _floorDb();
+}
+
+bool SimAir::onAir() const
+{
+    for (const Tx& tx : _txs)
+        if (!tx.done) return true;
+    return false;
+}
+
+bool SimAir::_detectable(size_t at, uint64_t from, uint64_t to) const
+{
+    for (const Tx& tx : _txs)
+        if (tx.start < to && tx.end > from && canHear(tx.src, at))
+            return true;
+    return false;
+}
+
+void SimAir::_startTx(size_t src, const uint8_t* data, uint8_t len)
+{
+    Tx tx = {};
+    tx.id    = _nextId++;
+    tx.src   = src;
+    tx.start = _now;
+    tx.end   = _now + airtimeUs(len);
+    tx.len   = len;
+    memcpy(tx.data, data, len);
+    _txs.push_back(tx);
+
+    frames++;
+    busyUs += tx.end - tx.start;
+
+    for (Site& s : _sites)
+    {
+        SimSx1262& r = *s.chip;
+        if (r._mode != SimSx1262::Mode::Rx || !canHear(src, r._idx)) continue;
+        if (r._locked)
+        {
+            missedBusy++;
+            continue;
+        }
+        r._locked = true;
+        r._lockId = tx.id;
+        r._raise(IRQ_PREAMBLE_DET | IRQ_HEADER_VALID);
+    }
+}
+
+void SimAir::_endTx(Tx& tx)
+{
+    tx.done = true;
+
+    SimSx1262& src = *_sites[tx.src].chip;
+    if (src._mode == SimSx1262::Mode::Tx) src._onTxDone();
+
+    for (Site& s : _sites)
+    {
+        SimSx1262& r = *s.chip;
+        if (!r._locked || r._lockId != tx.id) continue;
+        r._locked = false;
+
+        const float sig = rssiDbm(tx.src, r._idx);
+        bool clean = true;
+        for (const Tx& o : _txs)
+        {
+            if (o.id == tx.id || o.src == r._idx) continue;
+            if (o.start < tx.end && o.end > tx.start &&
+                sig - rssiDbm(o.src, r._idx) < _p.captureDb)
+            {
+                clean = false;
+                break;
+            }
+        }
+        if (clean) deliveries++;
+        else       collisions++;
+        r._onRx(tx.data, tx.len, sig, snrDb(tx.src, r._idx), clean);
+    }
+}
+
+uint64_t SimAir::_nextEvent() const
+{
+    uint64_t next = UINT64_MAX;
+    for (const Tx& tx : _txs)
+        if (!tx.done) next = std::min(next, tx.end);
+    for (const Site& s : _sites)
+    {
+        const SimSx1262& c = *s.chip;
+        if (c._mode == SimSx1262::Mode::Cad) next = std::min(next, c._cadEnd);
+        if (c._mode == SimSx1262::Mode::Tx && c._txFault && c._txTimeoutUs != 0)
+            next = std::min(next, c._txTimeoutEnd);
+    }
+    return next;
+}
+
+void SimAir::advanceTo(uint64_t us)
+{
+    for (uint64_t next = _nextEvent(); next <= us; next = _nextEvent())
+    {
+        _now = next;
+        for (Tx& tx : _txs)
+            if (!tx.done && tx.end <= _now) _endTx(tx);
+        for (Site& s : _sites)
+        {
+            SimSx1262& c = *s.chip;
+            if (c._mode == SimSx1262::Mode::Cad && c._cadEnd <= _now)
+                c._onCadDone(_detectable(c._idx, c._cadStart, c._cadEnd));
+            if (c._mode == SimSx1262::Mode::Tx && c._txFault && c._txTimeoutUs != 0 &&
+                c._txTimeoutEnd <= _now)
+                c._onTxTimeout();
+        }
+    }
+    _now = us;
+
+    _txs.erase(std::remove_if(_txs.begin(), _txs.end(), [&](const Tx& tx) {
+                   return tx.done && tx.end + TX_KEEP_US < _now;
+               }),
+               _txs.end());
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// SimSx1262
+// ─────────────────────────────────────────────────────────────────────────
+
+void SimSx1262::setPowered(bool on)
+{
+    _locked   = false;
+    _irq      = 0;
+    _irqMask  = 0;
+    _dio1Mask = 0;
+    _mode     = on ? Mode::Standby : Mode::Off;
+
+    memset(_regs, 0, sizeof(_regs));
+    _regs[REG_IQ_CONFIG] = 0x0D;    // inverted-IQ bit set out of reset (errata 15.3)
+}
+
+void SimSx1262::transfer(const SxXfer* xfers, size_t n)
+{
+    roundTrips++;
+    for (size_t i = 0; i < n; i++) _command(xfers[i]);
+}
+
+void SimSx1262::_onTxDone()
+{
+    _mode = Mode::Standby;
+    _raise(IRQ_TX_DONE);
+}
+
+void SimSx1262::_onTxTimeout()
+{
+    _mode = Mode::Standby;
+    _raise(IRQ_TIMEOUT);
+}
+
+void SimSx1262::_onRx(const uint8_t* data, uint8_t len, float rssi, float snr, bool crcOk)
+{
+    // Continuous RX: the chip stays in RX and overwrites from RxBaseAddr 0.
+    memcpy(_buffer, data, len);
+    _rxLen   = len;
+    _rxPtr   = 0;
+    _pktRssi = static_cast<uint8_t>(std::clamp(-2.f * rssi, 0.f, 255.f));
+    _pktSnr  = static_cast<int8_t>(std::clamp(4.f * snr, -128.f, 127.f));
+    _raise(crcOk ? IRQ_RX_DONE : (IRQ_RX_DONE | IRQ_CRC_ERROR));
+}
+
+void SimSx1262::_onCadDone(bool detected)
+{
+    _mode = Mode::Standby;
+    _raise(IRQ_CAD_DONE | (detected ? IRQ_CAD_DETECTED : 0));
+}
+
+void SimSx1262::_command(const SxXfer& x)
+{
+    commands++;
+    if (x.len == 0) return;
+
+    uint8_t reply[3 + 255] = {};
+    const uint8_t status = static_cast<uint8_t>(static_cast<uint8_t>(_mode) << 4);
+    if (x.len > 1) reply[1] = status;
+
+    if (_mode != Mode::Off)
+    {
+        const uint8_t* t = x.tx;
+        switch (t[0])
+        {
+        case CMD_SET_STANDBY:
+            _mode   = Mode::Standby;
+            _locked = false;
+            break;
+        case CMD_SET_RX:
+            _mode = Mode::Rx;
+            break;
+        case CMD_SET_TX:
+            // Timeout in 15.625 µs steps; 0 = none.  Only a faulted chip
+            // ever gets that far.
+            _mode   = Mode::Tx;
+            _locked = false;
+            _txTimeoutUs  = x.len >= 4
+                          ? ((static_cast<uint64_t>(t[1]) << 16 | t[2] << 8 | t[3]) * 15625) / 1000
+                          : 0;
+            _txTimeoutEnd = _air->nowUs() + _txTimeoutUs;
+            if (!_txFault) _air->_startTx(_idx, _buffer, _txLen);
+            break;
+        case CMD_SET_CAD:
+        {
+            const SimRadioParams& p = _air->params();
+            const uint64_t symUs = (static_cast<uint64_t>(1) << p.sf) * 1000000u / p.bwHz;
+            _mode     = Mode::Cad;
+            _locked   = false;
+            _cadStart = _air->nowUs();
+            _cadEnd   = _cadStart + 2 * symUs;
+            break;
+        }
+        case CMD_SET_DIO_IRQ:
+            if (x.len >= 5)
+            {
+                _irqMask  = static_cast<uint16_t>((t[1] << 8) | t[2]);
+                _dio1Mask = static_cast<uint16_t>((t[3] << 8) | t[4]);
+            }
+            break;
+        case CMD_SET_PKT_PARAMS:
+            if (x.len >= 5) _txLen = t[4];
+            break;
+        case CMD_WRITE_BUFFER:
+            for (uint16_t i = 2; i < x.len; i++)
+                _buffer[static_cast<uint8_t>(t[1] + i - 2)] = t[i];
+            break;
+        case CMD_WRITE_REGISTER:
+            for (uint16_t i = 3; i < x.len; i++)
+            {
+                const uint32_t addr = ((t[1] << 8) | t[2]) + i - 3u;
+                if (addr < sizeof(_regs)) _regs[addr] = t[i];
+            }
+            break;
+        case CMD_READ_REGISTER:
+            // [cmd, addrH, addrL, NOP] then one value per clocked NOP.
+            for (uint16_t i = 4; i < x.len; i++)
+            {
+                const uint32_t addr = ((t[1] << 8) | t[2]) + i - 4u;
+                reply[i] = addr < sizeof(_regs) ? _regs[addr] : 0;
+            }
+            break;
+        case CMD_READ_BUFFER:
+            for (uint16_t i = 3; i < x.len; i++)
+                reply[i] = _buffer[static_cast<uint8_t>(t[1] + i - 3)];
+            break;
+        case CMD_GET_IRQ_STATUS:
+            reply[2] = static_cast<uint8_t>(_irq >> 8);
+            reply[3] = static_cast<uint8_t>(_irq);
+            break;
+        case CMD_CLEAR_IRQ:
+            if (x.len >= 3) _irq &= static_cast<uint16_t>(~((t[1] << 8) | t[2]));
+            break;
+        case CMD_GET_RX_BUF_STATUS:
+            reply[2] = _rxLen;
+            reply[3] = _rxPtr;
+            break;
+        case CMD_GET_PKT_STATUS:
+            reply[2] = _pktRssi;
+            reply[3] = static_cast<uint8_t>(_pktSnr);
+            reply[4] = _pktRssi;
+            break;
+        case CMD_GET_RSSI_INST:
+            reply[2] = static_cast<uint8_t>(-2.f * _air->_noiseDbm);
+            break;
+        case CMD_GET_STATUS:
+        default:
+            break;
+        }
+    }
+
+    if (x.rx) memcpy(x.rx, reply, x.len);
+}
@@ -0,0 +1,178 @@
+/**
+ * sim_sx1262.h — simulated SX1262 and the shared air medium, for host tests.
+ *
+ * SimSx1262 implements SxBus (sx1262_batch.h), so it sits exactly where the
+ * firmware's SPI device does: it decodes the command bytes the driver
+ * sends — SetStandby, SetRx, SetTx, SetCad, SetDioIrqParams,
+ * SetPacketParams, Write/ReadBuffer, Write/ReadRegister, GetIrqStatus,
+ * ClearIrq, GetRxBufferStatus, GetPacketStatus, GetStatus — and answers
+ * with the datasheet reply layouts (sx1262_defs.h).  Other configuration
+ * commands are accepted and ignored.
+ *
+ * SimAir connects the chips.  It runs on a virtual microsecond clock that
+ * only moves when advanceTo() is called, so a run is fully reproducible:
+ *
+ *   path loss   log-distance, PL(d) = refLoss + 10·n·log10(d / 1 m)
+ *   noise       −174 dBm/Hz + 10·log10(BW) + noise figure
+ *   sensitivity SNR at or above the SF's demodulation floor (−7.5 … −20 dB)
+ *   airtime     mc_airtimeUs() for the configured modem settings
+ *   collisions  a receiver locks onto the first detectable preamble; the
+ *               frame survives only if it is captureDb above every other
+ *               transmission that overlapped it there, else CRC error
+ *   CAD         2 symbols; detects any decodable transmission on the air
+ *
+ * A chip that starts transmitting drops whatever it was receiving.
+ * Powering a chip off (node churn) makes it deaf and mute until powered on.
+ * A chip with a TX fault enters TX on SetTx but never radiates, raising
+ * TIMEOUT only once the SetTx timeout runs out.
+ */
+
+#pragma once
+
+#include "sx1262_batch.h"
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+struct SimRadioParams {
+    uint8_t  sf          = 11;        ///< LongFast
+    uint32_t bwHz        = 250000;
+    uint8_t  cr          = 1;         ///< 4/5
+    uint16_t preamble    = 16;
+    bool     ldro        = false;
+    float    txDbm       = 22.f;
+    float    refLossDb   = 31.7f;     ///< free-space loss at 1 m, 915 MHz
+    float    pathLossExp = 2.7f;
+    float    noiseFigDb  = 6.f;
+    float    captureDb   = 6.f;       ///< co-SF capture threshold
+};
+
+class SimSx1262;
+
+class SimAir
+{
+public:
+    explicit SimAir(const SimRadioParams& p = {});
+
+    const SimRadioParams& params() const { return _p; }
+
+    /// Place @p chip at (x, y) metres.  Returns its index on the medium.
+    size_t attach(SimSx1262& chip, float x, float y);
+    void   move(size_t idx, float x, float y);
+
+    uint64_t nowUs() const { return _now; }
+
+    /// Run the medium forward, completing transmissions and CAD scans.
+    void advanceTo(uint64_t us);
+
+    /// Time on air of a @p len-byte frame with the configured modem settings.
+    uint32_t airtimeUs(uint8_t len) const;
+
+    /// Received power and SNR of @p from's signal at @p to.
+    float rssiDbm(size_t from, size_t to) const;
+    float snrDb(size_t from, size_t to) const;
+    bool  canHear(size_t from, size_t to) const;
+
+    /// Any transmission still in progress.
+    bool onAir() const;
+
+    // Counters
+    uint32_t frames      = 0;   ///< transmissions started
+    uint32_t deliveries  = 0;   ///< frames received intact, summed over receivers
+    uint32_t collisions  = 0;   ///< receptions lost to an overlapping frame
+    uint32_t missedBusy  = 0;   ///< decodable frames a receiver missed: locked on another
+    uint64_t busyUs      = 0;   ///< total transmit time, all nodes
+
+private:
+    friend class SimSx1262;
+
+    struct Tx {
+        uint32_t id;
+        size_t   src;
+        uint64_t start, end;
+        uint8_t  len;
+        uint8_t  data[255];
+        bool     done;
+    };
+    struct Site {
+        SimSx1262* chip;
+        float      x, y;
+    };
+
+    void     _startTx(size_t src, const uint8_t* data, uint8_t len);
+    void     _endTx(Tx& tx);
+    bool     _detectable(size_t at, uint64_t from, uint64_t to) const;
+    uint64_t _nextEvent() const;
+    float    _floorDb() const;
+
+    SimRadioParams    _p;
+    std::vector<Site> _sites;
+    std::vector<Tx>   _txs;
+    uint32_t          _nextId  = 1;
+    uint64_t          _now     = 0;
+    float             _noiseDbm;
+};
+
+class SimSx1262 : public SxBus
+{
+public:
+    enum class Mode : uint8_t { Standby = 2, Rx = 5, Tx = 6, Cad = 7, Off = 0 };
+
+    SimSx1262() = default;
+
+    void transfer(const SxXfer* xfers, size_t n) override;
+
+    /// DIO1 level: any IRQ routed to DIO1 is pending.
+    bool dio1() const { return (_irq & _dio1Mask) != 0; }
+    Mode mode() const { return _mode; }
+
+    /// Node churn: off drops any reception and ignores the bus.  Power-up
+    /// restores the registers' reset values.
+    void setPowered(bool on);
+    bool powered() const { return _mode != Mode::Off; }
+
+    /// PA fault: SetTx puts nothing on the air.  Survives a power cycle.
+    void setTxFault(bool on) { _txFault = on; }
+
+    uint8_t reg(uint16_t addr) const { return addr < sizeof(_regs) ? _regs[addr] : 0; }
+
+    // SPI accounting
+    uint32_t roundTrips = 0;    ///< transfer() calls
+    uint32_t commands   = 0;    ///< NSS frames
+
+private:
+    friend class SimAir;
+
+    void _command(const SxXfer& x);
+    void _raise(uint16_t irq) { _irq |= irq & _irqMask; }
+    void _onTxDone();
+    void _onTxTimeout();
+    void _onRx(const uint8_t* data, uint8_t len, float rssi, float snr, bool crcOk);
+    void _onCadDone(bool detected);
+
+    SimAir*  _air     = nullptr;
+    size_t   _idx     = 0;
+    Mode     _mode    = Mode::Standby;
+    uint16_t _irq     = 0;
+    uint16_t _irqMask = 0;
+    uint16_t _dio1Mask = 0;
+    uint8_t  _txLen   = 0xFF;       ///< SetPacketParams payload length
+    uint8_t  _buffer[256] = {};
+    uint8_t  _regs[0x1000] = {};    ///< 0x0000–0x0FFF: every register the driver touches
+
+    bool     _txFault      = false;
+    uint64_t _txTimeoutUs  = 0;     ///< SetTx timeout; 0 = none
+    uint64_t _txTimeoutEnd = 0;
+
+    // Reception in progress
+    bool     _locked   = false;
+    uint32_t _lockId   = 0;         ///< SimAir::Tx::id being received
+    uint64_t _cadStart = 0;
+    uint64_t _cadEnd   = 0;
+
+    // Last packet
+    uint8_t  _rxLen  = 0;
+    uint8_t  _rxPtr  = 0;
+    uint8_t  _pktRssi = 0;          ///< −2 × RSSI
+    int8_t   _pktSnr  = 0;          ///< 4 × SNR
+};
@@ -0,0 +1,23 @@
+#pragma once
+// Minimal GPIO host stub — outputs are accepted and ignored.
+#include <stdint.h>
+#include "esp_log.h"   // esp_err_t
+
+typedef int gpio_num_t;
+#define GPIO_NUM_NC (-1)
+
+typedef enum { GPIO_MODE_OUTPUT = 2 } gpio_mode_t;
+typedef enum { GPIO_PULLUP_DISABLE = 0 } gpio_pullup_t;
+typedef enum { GPIO_PULLDOWN_DISABLE = 0 } gpio_pulldown_t;
+typedef enum { GPIO_INTR_DISABLE = 0 } gpio_int_type_t;
+
+typedef struct {
+    uint64_t        pin_bit_mask;
+    gpio_mode_t     mode;
+    gpio_pullup_t   pull_up_en;
+    gpio_pulldown_t pull_down_en;
+    gpio_int_type_t intr_type;
+} gpio_config_t;
+
+static inline esp_err_t gpio_config(const gpio_config_t* c) { (void)c; return ESP_OK; }
+static inline esp_err_t gpio_set_level(gpio_num_t n, uint32_t l) { (void)n; (void)l; return ESP_OK; }
@@ -0,0 +1,9 @@
+#pragma once
+// Heap capabilities host stub — every allocation is plain malloc().
+#include <stdlib.h>
+
+#define MALLOC_CAP_DMA  (1u << 3)
+#define MALLOC_CAP_8BIT (1u << 2)
+
+static inline void* heap_caps_malloc(size_t n, uint32_t caps) { (void)caps; return malloc(n); }
+static inline void  heap_caps_free(void* p) { free(p); }
@@ -0,0 +1,211 @@
+/**
+ * test_diag_report.cxx — Unity tests for the BLE diagnostic report JSON.
+ *
+ * Run with: cmake -B build && cmake --build build && ctest --test-dir build -V
+ *
+ * Test groups
+ * ───────────
+ *   1. Format                 — sections and keys, with and without LoRa
+ *   2. Size                   — widest report fits DIAG_REPORT_MAX, clamps, cuts
+ */
+
+#include "unity.h"
+#include "diag_report.h"
+#include <cstdint>
+#include <cstring>
+
+// ── Unity required entry points ───────────────────────────────────────────
+void setUp(void)    {}
+void tearDown(void) {}
+
+/// Every field as wide as its type and source allow.
+static DiagReport widest()
+{
+    DiagReport r;
+    r.hasLora      = true;
+    r.nodeId       = "!ffffffff";
+    r.shortName    = "WWWW";
+    r.upSec        = UINT32_MAX;
+    r.heap         = UINT32_MAX;
+    r.heapMin      = UINT32_MAX;
+    r.bleConnected = true;
+    r.battery      = 100;
+    r.gpsFix       = true;
+    r.gpsSats      = UINT32_MAX;
+    r.gpsHdop      = 1e30f;
+    r.gpsOk        = UINT32_MAX;
+    r.gpsFail      = UINT32_MAX;
+
+    DiagLoraReport& l = r.lora;
+    l.state          = "init_failed";
+    l.preambles      = UINT32_MAX;
+    l.headersValid   = UINT32_MAX;
+    l.rxPackets      = UINT32_MAX;
+    l.crcErrors      = UINT32_MAX;
+    l.headerErrors   = UINT32_MAX;
+    l.decryptOk      = UINT32_MAX;
+    l.duplicates     = UINT32_MAX;
+    l.textMessages   = UINT32_MAX;
+    l.inboxOverflows = UINT32_MAX;
+    l.txPackets      = UINT32_MAX;
+    l.txErrors       = UINT32_MAX;
+    l.txTimeouts     = UINT32_MAX;
+    l.cadBusy        = UINT32_MAX;
+    l.txBackoffs     = UINT32_MAX;
+    l.channelUtil    = 1e30f;
+    l.airUtilTx      = 1e30f;
+    l.neighbors      = UINT32_MAX;
+    l.lastRssi       = INT16_MIN;
+    l.lastSnr        = -1e30f;
+
+    r.hdr.updates   = UINT32_MAX;
+    r.hdr.unchanged = UINT32_MAX;
+    r.hdr.bursts    = UINT32_MAX;
+    r.hdr.pixels    = UINT32_MAX;
+    r.dispState     = PanelPower::Sleep;
+    for (uint32_t& ua : r.dispUa) ua = UINT32_MAX;
+    r.disp.avgUa    = UINT32_MAX;
+    r.notifications = UINT32_MAX;
+    r.bonds         = UINT32_MAX;
+    return r;
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 1. Format
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_without_lora_has_no_lora_section(void)
+{
+    DiagReport r;
+    r.upSec   = 3600;
+    r.battery = 85;
+    char buf[DIAG_REPORT_MAX];
+    const size_t n = diag_formatReport(buf, sizeof(buf), r);
+    TEST_ASSERT_EQUAL_size_t(strlen(buf), n);
+    TEST_ASSERT_EQUAL_MEMORY("{\"up\":3600,", buf, 11);
+    TEST_ASSERT_NULL(strstr(buf, "\"lora\""));
+    TEST_ASSERT_NULL(strstr(buf, "\"node_id\""));
+    TEST_ASSERT_EQUAL_INT('}', buf[n - 1]);
+}
+
+void test_lora_section_keys_in_order(void)
+{
+    DiagReport r;
+    r.hasLora          = true;
+    r.nodeId           = "!deadbeef";
+    r.shortName        = "YIFF";
+    r.lora.state       = "listening";
+    r.lora.duplicates  = 7;
+    r.lora.neighbors   = 5;
+    r.lora.lastRssi    = -87;
+    r.lora.lastSnr     = 7.5f;
+    char buf[DIAG_REPORT_MAX];
+    diag_formatReport(buf, sizeof(buf), r);
+
+    TEST_ASSERT_EQUAL_MEMORY("{\"node_id\":\"!deadbeef\",\"short_name\":\"YIFF\",\"up\":",
+                             buf, 48);
+    const char* keys[] = {
+        "\"lora\":{\"state\":\"listening\"", "\"preamble\":", "\"hdr_ok\":", "\"rx\":",
+        "\"crc_err\":", "\"hdr_err\":", "\"decrypt\":", "\"dup\":7,", "\"text\":",
+        "\"inbox_lost\":", "\"tx\":", "\"tx_err\":", "\"tx_timeout\":", "\"cad_busy\":",
+        "\"backoff\":", "\"ch_util\":", "\"air_tx\":", "\"neighbors\":5,",
+        "\"rssi\":-87,\"snr\":7.5}", "\"hdr\":{", "\"disp\":{", "\"notif\":", "\"bonds\":",
+    };
+    const char* at = buf;
+    for (const char* key : keys)
+    {
+        const char* found = strstr(at, key);
+        TEST_ASSERT_TRUE_MESSAGE(found != nullptr, key);
+        at = found + strlen(key);
+    }
+}
+
+void test_display_currents_in_milliamps(void)
+{
+    DiagReport r;
+    r.dispState   = PanelPower::Dim;
+    r.dispUa[0]   = 18000;
+    r.dispUa[1]   = 6000;
+    r.dispUa[2]   = 10;
+    r.disp.avgUa  = 4700;
+    char buf[DIAG_REPORT_MAX];
+    diag_formatReport(buf, sizeof(buf), r);
+    TEST_ASSERT_NOT_NULL(strstr(buf, "\"disp\":{\"st\":1,\"ma\":[18.0,6.0,0.01],\"avg\":4.7}"));
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 2. Size
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_widest_report_fits(void)
+{
+    char buf[DIAG_REPORT_MAX];
+    const size_t n = diag_formatReport(buf, sizeof(buf), widest());
+    TEST_ASSERT_TRUE(n < sizeof(buf) - 1);      // not cut
+    TEST_ASSERT_EQUAL_size_t(strlen(buf), n);
+    TEST_ASSERT_EQUAL_INT('}', buf[n - 1]);
+    TEST_ASSERT_NOT_NULL(strstr(buf, "\"bonds\":4294967295}"));
+}
+
+void test_floats_clamped_to_source_range(void)
+{
+    DiagReport r = widest();
+    char buf[DIAG_REPORT_MAX];
+    diag_formatReport(buf, sizeof(buf), r);
+    TEST_ASSERT_NOT_NULL(strstr(buf, "\"hdop\":99.9,"));
+    TEST_ASSERT_NOT_NULL(strstr(buf, "\"ch_util\":100.0,\"air_tx\":100.0,"));
+    TEST_ASSERT_NOT_NULL(strstr(buf, "\"rssi\":-32768,\"snr\":-32.0}"));
+    TEST_ASSERT_NOT_NULL(strstr(buf, "\"ma\":[999.9,999.9,999.90],\"avg\":999.9}"));
+
+    r.gpsHdop          = -1e30f;
+    r.lora.channelUtil = -1e30f;
+    r.lora.airUtilTx   = -1e30f;
+    r.lora.lastSnr     = 1e30f;
+    diag_formatReport(buf, sizeof(buf), r);
+    TEST_ASSERT_NOT_NULL(strstr(buf, "\"hdop\":0.0,"));
+    TEST_ASSERT_NOT_NULL(strstr(buf, "\"ch_util\":0.0,\"air_tx\":0.0,"));
+    TEST_ASSERT_NOT_NULL(strstr(buf, "\"snr\":32.0}"));
+}
+
+void test_long_names_cut_to_field_width(void)
+{
+    DiagReport r;
+    r.hasLora    = true;
+    r.nodeId     = "!0123456789abcdef";
+    r.shortName  = "LONGNAME";
+    r.lora.state = "listening-and-more";
+    char buf[DIAG_REPORT_MAX];
+    diag_formatReport(buf, sizeof(buf), r);
+    TEST_ASSERT_NOT_NULL(strstr(buf, "\"node_id\":\"!01234567\",\"short_name\":\"LONG\","));
+    TEST_ASSERT_NOT_NULL(strstr(buf, "\"state\":\"listening-a\","));
+}
+
+void test_small_buffer_cut_and_terminated(void)
+{
+    char buf[64];
+    memset(buf, 'x', sizeof(buf));
+    const size_t n = diag_formatReport(buf, sizeof(buf), widest());
+    TEST_ASSERT_EQUAL_size_t(sizeof(buf) - 1, n);
+    TEST_ASSERT_EQUAL_INT('\0', buf[sizeof(buf) - 1]);
+    TEST_ASSERT_EQUAL_size_t(n, strlen(buf));
+
+    TEST_ASSERT_EQUAL_size_t(0, diag_formatReport(buf, 0, widest()));
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    // 1. Format
+    RUN_TEST(test_without_lora_has_no_lora_section);
+    RUN_TEST(test_lora_section_keys_in_order);
+    RUN_TEST(test_display_currents_in_milliamps);
+
+    // 2. Size
+    RUN_TEST(test_widest_report_fits);
+    RUN_TEST(test_floats_clamped_to_source_range);
+    RUN_TEST(test_long_names_cut_to_field_width);
+    RUN_TEST(test_small_buffer_cut_and_terminated);
+
+    return UNITY_END();
+}
@@ -0,0 +1,214 @@
+/**
+ * test_display_power.cxx — Unity tests for the display power state machine.
+ *
+ * Run with: cmake -B build && cmake --build build && ctest --test-dir build -V
+ *
+ * Test groups
+ * ───────────
+ *   1. Timeouts               — dim then sleep, straight to sleep, never, wake, wrap
+ *   2. Waiting                — waitMs() against the next step()
+ *   3. Estimates              — backlight levels, current per state, stats
+ */
+
+#include "unity.h"
+#include "display_power.h"
+#include <cstdint>
+
+// ── Unity required entry points ───────────────────────────────────────────
+void setUp(void)    {}
+void tearDown(void) {}
+
+static DisplayPowerConfig config(uint32_t dimMs, uint32_t sleepMs, uint8_t dimPercent = 20)
+{
+    DisplayPowerConfig c;
+    c.dimMs      = dimMs;
+    c.sleepMs    = sleepMs;
+    c.dimPercent = dimPercent;
+    return c;
+}
+
+static void assertState(PanelPower expected, const DisplayPower& p)
+{
+    TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(expected), static_cast<uint8_t>(p.state()));
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 1. Timeouts
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_dims_then_sleeps(void)
+{
+    DisplayPower p(config(30000, 120000));
+    p.wake(1000);
+    TEST_ASSERT_FALSE(p.step(30999));
+    assertState(PanelPower::Full, p);
+    TEST_ASSERT_TRUE(p.step(31000));
+    assertState(PanelPower::Dim, p);
+    TEST_ASSERT_FALSE(p.step(60000));
+    TEST_ASSERT_TRUE(p.step(121000));
+    assertState(PanelPower::Sleep, p);
+    TEST_ASSERT_FALSE(p.step(500000));
+}
+
+void test_late_step_goes_straight_to_sleep(void)
+{
+    // A draw task that slept through the dim deadline skips it.
+    DisplayPower p(config(30000, 120000));
+    p.wake(0);
+    TEST_ASSERT_TRUE(p.step(200000));
+    assertState(PanelPower::Sleep, p);
+
+    // As does a sleep timeout no longer than the dim one.
+    DisplayPower q(config(30000, 30000));
+    q.wake(0);
+    TEST_ASSERT_TRUE(q.step(30000));
+    assertState(PanelPower::Sleep, q);
+}
+
+void test_zero_timeouts_never_fire(void)
+{
+    DisplayPower never(config(0, 0));
+    never.wake(0);
+    TEST_ASSERT_FALSE(never.step(UINT32_MAX / 2));
+    assertState(PanelPower::Full, never);
+
+    DisplayPower dimOnly(config(5000, 0));
+    dimOnly.wake(0);
+    TEST_ASSERT_TRUE(dimOnly.step(5000));
+    TEST_ASSERT_FALSE(dimOnly.step(UINT32_MAX / 2));
+    assertState(PanelPower::Dim, dimOnly);
+
+    DisplayPower sleepOnly(config(0, 5000));
+    sleepOnly.wake(0);
+    TEST_ASSERT_TRUE(sleepOnly.step(5000));
+    assertState(PanelPower::Sleep, sleepOnly);
+}
+
+void test_wake_restarts_and_reports_state_left(void)
+{
+    DisplayPower p(config(30000, 120000));
+    TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(PanelPower::Full),
+                            static_cast<uint8_t>(p.wake(0)));
+    p.step(40000);
+    TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(PanelPower::Dim),
+                            static_cast<uint8_t>(p.wake(40000)));
+    assertState(PanelPower::Full, p);
+
+    // Idle time counts from the last wake, not the first.
+    TEST_ASSERT_FALSE(p.step(69999));
+    TEST_ASSERT_TRUE(p.step(70000));
+    p.step(200000);
+    TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(PanelPower::Sleep),
+                            static_cast<uint8_t>(p.wake(200000)));
+}
+
+void test_nothing_before_first_wake(void)
+{
+    DisplayPower p(config(1000, 2000));
+    TEST_ASSERT_FALSE(p.step(100000));
+    assertState(PanelPower::Full, p);
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, p.waitMs(100000));
+}
+
+void test_timeouts_across_tick_wrap(void)
+{
+    DisplayPower p(config(30000, 120000));
+    const uint32_t t0 = UINT32_MAX - 10000;
+    p.wake(t0);
+    TEST_ASSERT_FALSE(p.step(t0 + 29999));
+    TEST_ASSERT_TRUE(p.step(t0 + 30000));          // past zero
+    assertState(PanelPower::Dim, p);
+    TEST_ASSERT_EQUAL_UINT32(90000, p.waitMs(t0 + 30000));
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 2. Waiting
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_wait_is_next_deadline(void)
+{
+    DisplayPower p(config(30000, 120000));
+    p.wake(1000);
+    TEST_ASSERT_EQUAL_UINT32(30000, p.waitMs(1000));
+    TEST_ASSERT_EQUAL_UINT32(10000, p.waitMs(21000));
+    TEST_ASSERT_EQUAL_UINT32(0, p.waitMs(40000));  // overdue: step() now
+    p.step(40000);
+    TEST_ASSERT_EQUAL_UINT32(81000, p.waitMs(40000));
+    p.step(121000);
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, p.waitMs(121000));
+}
+
+void test_wait_without_timeouts(void)
+{
+    DisplayPower never(config(0, 0));
+    never.wake(0);
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, never.waitMs(0));
+
+    DisplayPower sleepFirst(config(30000, 10000));
+    sleepFirst.wake(0);
+    TEST_ASSERT_EQUAL_UINT32(10000, sleepFirst.waitMs(0));
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 3. Estimates
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_backlight_and_current_per_state(void)
+{
+    DisplayPower p(config(30000, 120000, 20));
+    TEST_ASSERT_EQUAL_UINT8(100, p.backlightPercent(PanelPower::Full));
+    TEST_ASSERT_EQUAL_UINT8(20,  p.backlightPercent(PanelPower::Dim));
+    TEST_ASSERT_EQUAL_UINT8(0,   p.backlightPercent(PanelPower::Sleep));
+    TEST_ASSERT_EQUAL_UINT32(DISP_PANEL_ON_UA + DISP_BACKLIGHT_UA, p.currentUa(PanelPower::Full));
+    TEST_ASSERT_EQUAL_UINT32(DISP_PANEL_ON_UA + DISP_BACKLIGHT_UA / 5, p.currentUa(PanelPower::Dim));
+    TEST_ASSERT_EQUAL_UINT32(DISP_PANEL_SLEEP_UA, p.currentUa(PanelPower::Sleep));
+
+    DisplayPower over(config(1, 2, 150));           // clamped
+    TEST_ASSERT_EQUAL_UINT8(100, over.backlightPercent(PanelPower::Dim));
+}
+
+void test_stats_weigh_time_in_state(void)
+{
+    DisplayPower p(config(10000, 20000, 20));
+    TEST_ASSERT_EQUAL_UINT32(p.currentUa(PanelPower::Full), p.stats(0).avgUa);
+
+    p.wake(0);
+    p.step(10000);                  // 10 s full
+    p.step(20000);                  // 10 s dim
+    p.wake(40000);                  // 20 s asleep
+    const DisplayPowerStats s = p.stats(40000);
+    TEST_ASSERT_EQUAL_UINT32(10, s.seconds[static_cast<uint8_t>(PanelPower::Full)]);
+    TEST_ASSERT_EQUAL_UINT32(10, s.seconds[static_cast<uint8_t>(PanelPower::Dim)]);
+    TEST_ASSERT_EQUAL_UINT32(20, s.seconds[static_cast<uint8_t>(PanelPower::Sleep)]);
+    TEST_ASSERT_EQUAL_UINT32(1, s.wakes);
+    const uint32_t expected = (p.currentUa(PanelPower::Full) * 10
+                             + p.currentUa(PanelPower::Dim) * 10
+                             + p.currentUa(PanelPower::Sleep) * 20) / 40;
+    TEST_ASSERT_EQUAL_UINT32(expected, s.avgUa);
+
+    // The state in progress counts up to the time asked about.
+    TEST_ASSERT_EQUAL_UINT32(15, p.stats(45000).seconds[static_cast<uint8_t>(PanelPower::Full)]);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    // 1. Timeouts
+    RUN_TEST(test_dims_then_sleeps);
+    RUN_TEST(test_late_step_goes_straight_to_sleep);
+    RUN_TEST(test_zero_timeouts_never_fire);
+    RUN_TEST(test_wake_restarts_and_reports_state_left);
+    RUN_TEST(test_nothing_before_first_wake);
+    RUN_TEST(test_timeouts_across_tick_wrap);
+
+    // 2. Waiting
+    RUN_TEST(test_wait_is_next_deadline);
+    RUN_TEST(test_wait_without_timeouts);
+
+    // 3. Estimates
+    RUN_TEST(test_backlight_and_current_per_state);
+    RUN_TEST(test_stats_weigh_time_in_state);
+
+    return UNITY_END();
+}
@@ -0,0 +1,271 @@
+/**
+ * test_font_spans.cxx — Unity tests for the run-length fonts.
+ *
+ * Run with: cmake -B build && cmake --build build && ctest --test-dir build -V
+ *
+ * Decodes every glyph of the committed run tables (font_spans.cxx) and
+ * compares it with the bitmap source (fonts.cxx), so a stale
+ * font_spans.cxx fails here — regenerate with the font_spans target.
+ *
+ * Test groups
+ * ───────────
+ *   1. Fixed fonts            — every glyph equals its bitmap, pixel for pixel
+ *   2. Proportional fonts     — cropped to ink plus one spacing column
+ *   3. Layout                 — advance, string width, fill alignment, row skip
+ *   4. Size                   — run tables smaller than the bitmaps
+ */
+
+#include "unity.h"
+#include "fonts.h"
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+// ── Unity required entry points ───────────────────────────────────────────
+void setUp(void)    {}
+void tearDown(void) {}
+
+static constexpr uint16_t INK = 0xF800;
+static constexpr uint16_t BG  = 0x07E0;
+
+static bool bitmapInk(const FontBitmap& b, char ch, uint32_t row, uint32_t col)
+{
+    return col < 16 && (b.data[(ch - FONT_FIRST) * b.height + row] << col) & 0x8000;
+}
+
+/// Decode @p ch of @p font and compare with columns [left, left + width)
+/// of its bitmap; the columns past the bitmap must be background.
+static void checkGlyph(const FontDef& font, const FontBitmap& bitmap, char ch, uint32_t left)
+{
+    GlyphRows rows(font, ch);
+    uint16_t  px[32];
+    for (uint32_t row = 0; row < font.height; row++)
+    {
+        rows.row(INK, BG, px);
+        for (uint32_t col = 0; col < rows.width(); col++)
+        {
+            const bool want = left + col < bitmap.width && bitmapInk(bitmap, ch, row, left + col);
+            if (px[col] != (want ? INK : BG))
+            {
+                char msg[64];
+                snprintf(msg, sizeof(msg), "'%c' row %u col %u", ch,
+                         static_cast<unsigned>(row), static_cast<unsigned>(col));
+                TEST_FAIL_MESSAGE(msg);
+            }
+        }
+    }
+}
+
+static int firstInkColumn(const FontBitmap& b, char ch)
+{
+    for (uint32_t col = 0; col < b.width; col++)
+        for (uint32_t row = 0; row < b.height; row++)
+            if (bitmapInk(b, ch, row, col)) return static_cast<int>(col);
+    return -1;
+}
+
+static int lastInkColumn(const FontBitmap& b, char ch)
+{
+    for (int col = b.width - 1; col >= 0; col--)
+        for (uint32_t row = 0; row < b.height; row++)
+            if (bitmapInk(b, ch, row, static_cast<uint32_t>(col))) return col;
+    return -1;
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 1. Fixed fonts
+// ─────────────────────────────────────────────────────────────────────────
+
+static void checkFixed(const FontDef& font, const FontBitmap& bitmap)
+{
+    TEST_ASSERT_EQUAL_UINT8(bitmap.width,  font.width);
+    TEST_ASSERT_EQUAL_UINT8(bitmap.height, font.height);
+    TEST_ASSERT_NULL(font.advance);
+    for (char ch = FONT_FIRST; ch < 127; ch++)
+        checkGlyph(font, bitmap, ch, 0);
+}
+
+void test_fixed_7x10_matches_bitmap(void)  { checkFixed(Font_7x10,  FontBitmap_7x10);  }
+void test_fixed_11x18_matches_bitmap(void) { checkFixed(Font_11x18, FontBitmap_11x18); }
+void test_fixed_16x26_matches_bitmap(void) { checkFixed(Font_16x26, FontBitmap_16x26); }
+
+// ─────────────────────────────────────────────────────────────────────────
+// 2. Proportional fonts
+// ─────────────────────────────────────────────────────────────────────────
+
+static void checkProportional(const FontDef& font, const FontBitmap& bitmap)
+{
+    TEST_ASSERT_NOT_NULL(font.advance);
+    TEST_ASSERT_EQUAL_UINT8(bitmap.height, font.height);
+    for (char ch = FONT_FIRST; ch < 127; ch++)
+    {
+        const int first = firstInkColumn(bitmap, ch);
+        if (first < 0)
+        {
+            TEST_ASSERT_EQUAL_UINT8(bitmap.width / 2, font_advance(font, ch));
+            checkGlyph(font, bitmap, ch, bitmap.width);   // all background
+            continue;
+        }
+        const int last = lastInkColumn(bitmap, ch);
+        TEST_ASSERT_EQUAL_UINT8(last - first + 2, font_advance(font, ch));
+        TEST_ASSERT_TRUE(font_advance(font, ch) <= font.width);
+        checkGlyph(font, bitmap, ch, static_cast<uint32_t>(first));
+    }
+}
+
+void test_prop_7x10_cropped_to_ink(void)  { checkProportional(Font_7x10_Prop,  FontBitmap_7x10);  }
+void test_prop_11x18_cropped_to_ink(void) { checkProportional(Font_11x18_Prop, FontBitmap_11x18); }
+
+void test_prop_narrow_glyphs_narrower(void)
+{
+    TEST_ASSERT_TRUE(font_advance(Font_11x18_Prop, 'i') < font_advance(Font_11x18_Prop, 'm'));
+    TEST_ASSERT_TRUE(font_advance(Font_11x18_Prop, 'i') < Font_11x18.width);
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 3. Layout
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_unprintable_takes_a_cell(void)
+{
+    TEST_ASSERT_EQUAL_UINT8(Font_11x18_Prop.width, font_advance(Font_11x18_Prop, '\t'));
+    TEST_ASSERT_EQUAL_UINT8(Font_11x18_Prop.width,
+                            font_advance(Font_11x18_Prop, static_cast<char>(0xC3)));
+    TEST_ASSERT_EQUAL_UINT8(7,  font_advance(Font_7x10, '\n'));
+}
+
+void test_str_width_sums_advances(void)
+{
+    TEST_ASSERT_EQUAL_UINT32(5 * 7, font_strWidth(Font_7x10, "12:34"));
+    const uint32_t prop = font_strWidth(Font_11x18_Prop, "Table for four");
+    uint32_t sum = 0;
+    for (const char* c = "Table for four"; *c; c++) sum += font_advance(Font_11x18_Prop, *c);
+    TEST_ASSERT_EQUAL_UINT32(sum, prop);
+    TEST_ASSERT_TRUE(prop < font_strWidth(Font_11x18, "Table for four"));
+}
+
+void test_fill_any_alignment(void)
+{
+    uint16_t buf[16];
+    for (uint32_t start = 0; start < 3; start++)
+    {
+        for (uint32_t n = 0; n < 12; n++)
+        {
+            memset(buf, 0, sizeof(buf));
+            font_fill(buf + start, 0xABCD, n);
+            for (uint32_t i = 0; i < 16; i++)
+                TEST_ASSERT_EQUAL_HEX16(i >= start && i < start + n ? 0xABCD : 0, buf[i]);
+        }
+    }
+}
+
+void test_expand_any_alignment(void)
+{
+    uint16_t buf[40];
+    for (uint32_t start = 0; start < 3; start++)
+    {
+        for (uint32_t n = 0; n <= 32; n++)
+        {
+            const uint32_t ink = 0xB38F0E65;
+            memset(buf, 0, sizeof(buf));
+            font_expand(buf + start, ink, n, INK, BG);
+            for (uint32_t i = 0; i < 40; i++)
+            {
+                const bool inside = i >= start && i < start + n;
+                const uint16_t want = !inside ? 0 : (ink >> (i - start)) & 1 ? INK : BG;
+                TEST_ASSERT_EQUAL_HEX16(want, buf[i]);
+            }
+        }
+    }
+}
+
+void test_blit_matches_rows(void)
+{
+    const FontDef* fonts[] = { &Font_7x10, &Font_11x18_Prop, &Font_16x26 };
+    for (const FontDef* f : fonts)
+    {
+        for (char ch = FONT_FIRST; ch < 127; ch++)
+        {
+            // Glyph-wide rows (one line) and inside a wider frame at an odd column.
+            uint16_t glyph[16 * 26], frame[40 * 26];
+            GlyphRows rows(*f, ch);
+            const uint32_t w = rows.width();
+            font_blit(*f, ch, INK, BG, glyph, w);
+            font_blit(*f, ch, INK, BG, frame + 1, 40);
+            for (uint32_t r = 0; r < f->height; r++)
+            {
+                uint16_t want[16];
+                rows.row(INK, BG, want);
+                TEST_ASSERT_EQUAL_MEMORY(want, glyph + r * w, w * sizeof(uint16_t));
+                TEST_ASSERT_EQUAL_MEMORY(want, frame + 1 + r * 40, w * sizeof(uint16_t));
+            }
+        }
+    }
+}
+
+void test_skip_matches_rows_passed_over(void)
+{
+    const FontDef* fonts[] = { &Font_7x10, &Font_11x18_Prop, &Font_16x26 };
+    for (const FontDef* f : fonts)
+    {
+        for (char ch = FONT_FIRST; ch < 127; ch++)
+        {
+            for (uint32_t n = 0; n < f->height; n++)
+            {
+                uint16_t want[16], got[16];
+                GlyphRows a(*f, ch), b(*f, ch);
+                for (uint32_t r = 0; r < n; r++) a.row(INK, BG, want);
+                b.skip(n);
+                for (uint32_t r = n; r < f->height; r++)
+                {
+                    a.row(INK, BG, want);
+                    b.row(INK, BG, got);
+                    TEST_ASSERT_EQUAL_MEMORY(want, got, a.width() * sizeof(uint16_t));
+                }
+            }
+        }
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 4. Size
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_runs_smaller_than_bitmaps(void)
+{
+    const FontDef* fonts[] = { &Font_7x10, &Font_11x18, &Font_16x26 };
+    for (const FontDef* f : fonts)
+    {
+        const size_t bitmap = FONT_GLYPHS * f->height * sizeof(uint16_t);
+        const size_t runs   = f->index[FONT_GLYPHS] + (FONT_GLYPHS + 1) * sizeof(uint16_t);
+        TEST_ASSERT_TRUE(runs < bitmap * 3 / 4);
+    }
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    // 1. Fixed fonts
+    RUN_TEST(test_fixed_7x10_matches_bitmap);
+    RUN_TEST(test_fixed_11x18_matches_bitmap);
+    RUN_TEST(test_fixed_16x26_matches_bitmap);
+
+    // 2. Proportional fonts
+    RUN_TEST(test_prop_7x10_cropped_to_ink);
+    RUN_TEST(test_prop_11x18_cropped_to_ink);
+    RUN_TEST(test_prop_narrow_glyphs_narrower);
+
+    // 3. Layout
+    RUN_TEST(test_unprintable_takes_a_cell);
+    RUN_TEST(test_str_width_sums_advances);
+    RUN_TEST(test_fill_any_alignment);
+    RUN_TEST(test_expand_any_alignment);
+    RUN_TEST(test_blit_matches_rows);
+    RUN_TEST(test_skip_matches_rows_passed_over);
+
+    // 4. Size
+    RUN_TEST(test_runs_smaller_than_bitmaps);
+
+    return UNITY_END();
+}
@@ -0,0 +1,274 @@
+/**
+ * test_framebuffer.cxx — Unity tests for the TFT framebuffer's dirty rectangles.
+ *
+ * Run with: cmake -B build && cmake --build build && ctest --test-dir build -V
+ *
+ * Built with FB_DIRTY_MAX=4 so the rectangle cap is cheap to reach.  The
+ * frame is the panel's 160 × 80; a recording TftBus stands in for the SPI.
+ *
+ * Test groups
+ * ───────────
+ *   1. Marking                — clipping, coverage, nothing dirty after attach
+ *   2. Merging                — near rectangles merged when cheaper, far ones kept
+ *   3. Cap                    — a full list merges the rectangle that grows least
+ *   4. Flush                  — narrow rects packed, wide ones sent as full rows,
+ *                               one window and one burst per rectangle
+ */
+
+#include "unity.h"
+#include "framebuffer.h"
+#include <cstdint>
+#include <vector>
+
+// ── Unity required entry points ───────────────────────────────────────────
+void setUp(void)    {}
+void tearDown(void) {}
+
+static constexpr uint8_t W = 160;
+static constexpr uint8_t H = 80;
+static constexpr size_t  STAGE = 512;
+
+/// Records each window and the pixels sent into it.
+struct RecordingBus : TftBus {
+    struct Burst {
+        FbRect                rect;
+        std::vector<uint16_t> px;
+    };
+    std::vector<Burst> bursts;
+    size_t             windows = 0;
+
+    void window(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1) override
+    {
+        windows++;
+        Burst b;
+        b.rect.x0 = x0; b.rect.y0 = y0; b.rect.x1 = x1; b.rect.y1 = y1;
+        bursts.push_back(b);
+    }
+    void pixels(const uint16_t* px, size_t n) override
+    {
+        bursts.back().px.assign(px, px + n);
+    }
+};
+
+static void paint(FrameBuffer& fb, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t v)
+{
+    for (uint16_t r = 0; r < h; r++)
+        for (uint16_t c = 0; c < w; c++)
+            *fb.row(x + c, y + r) = v;
+    fb.markDirty(x, y, w, h);
+}
+
+static void expectRect(const FbRect& r, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1)
+{
+    TEST_ASSERT_EQUAL_UINT8(x0, r.x0);
+    TEST_ASSERT_EQUAL_UINT8(y0, r.y0);
+    TEST_ASSERT_EQUAL_UINT8(x1, r.x1);
+    TEST_ASSERT_EQUAL_UINT8(y1, r.y1);
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 1. Marking
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_attach_clears_frame(void)
+{
+    uint16_t frame[W * H], stage[STAGE];
+    frame[123] = 0xFFFF;
+    FrameBuffer fb;
+    TEST_ASSERT_FALSE(fb.active());
+    fb.attach(frame, W, H, stage, STAGE);
+    TEST_ASSERT_TRUE(fb.active());
+    TEST_ASSERT_EQUAL_UINT16(0, frame[123]);
+    TEST_ASSERT_EQUAL_size_t(0, fb.dirtyCount());
+}
+
+void test_mark_clips_to_frame(void)
+{
+    uint16_t frame[W * H], stage[STAGE];
+    FrameBuffer fb;
+    fb.attach(frame, W, H, stage, STAGE);
+    fb.markDirty(150, 70, 20, 20);
+    TEST_ASSERT_EQUAL_size_t(1, fb.dirtyCount());
+    expectRect(fb.dirty(0), 150, 70, 159, 79);
+
+    fb.markDirty(W, 0, 4, 4);           // wholly outside
+    fb.markDirty(0, 0, 0, 4);           // empty
+    TEST_ASSERT_EQUAL_size_t(1, fb.dirtyCount());
+}
+
+void test_covered_rect_adds_nothing(void)
+{
+    uint16_t frame[W * H], stage[STAGE];
+    FrameBuffer fb;
+    fb.attach(frame, W, H, stage, STAGE);
+    fb.markDirty(0, 20, 160, 60);
+    fb.markDirty(10, 30, 11, 18);
+    TEST_ASSERT_EQUAL_size_t(1, fb.dirtyCount());
+    expectRect(fb.dirty(0), 0, 20, 159, 79);
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 2. Merging
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_adjacent_glyphs_merge(void)
+{
+    uint16_t frame[W * H], stage[STAGE];
+    FrameBuffer fb;
+    fb.attach(frame, W, H, stage, STAGE);
+    for (uint16_t i = 0; i < 5; i++)
+        fb.markDirty(i * 7, 6, 7, 10);  // "12:34" in Font_7x10
+    TEST_ASSERT_EQUAL_size_t(1, fb.dirtyCount());
+    expectRect(fb.dirty(0), 0, 6, 34, 15);
+}
+
+void test_distant_icons_stay_apart(void)
+{
+    uint16_t frame[W * H], stage[STAGE];
+    FrameBuffer fb;
+    fb.attach(frame, W, H, stage, STAGE);
+    fb.markDirty(W - 84, 1, 16, 16);    // call
+    fb.markDirty(W - 16, 1, 16, 16);    // battery
+    fb.markDirty(0, 60, 16, 16);
+    TEST_ASSERT_EQUAL_size_t(3, fb.dirtyCount());
+
+    // One column apart: one window is cheaper than two.
+    fb.markDirty(W - 33, 1, 16, 16);    // BLE
+    TEST_ASSERT_EQUAL_size_t(3, fb.dirtyCount());
+}
+
+void test_merge_cascades(void)
+{
+    uint16_t frame[W * H], stage[STAGE];
+    FrameBuffer fb;
+    fb.attach(frame, W, H, stage, STAGE);
+    fb.markDirty(0, 0, 10, 10);
+    fb.markDirty(40, 0, 10, 10);
+    TEST_ASSERT_EQUAL_size_t(2, fb.dirtyCount());
+
+    // Bridges the gap: all three become one.
+    fb.markDirty(10, 0, 30, 10);
+    TEST_ASSERT_EQUAL_size_t(1, fb.dirtyCount());
+    expectRect(fb.dirty(0), 0, 0, 49, 9);
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 3. Cap
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_full_list_merges_least_growth(void)
+{
+    uint16_t frame[W * H], stage[STAGE];
+    FrameBuffer fb;
+    fb.attach(frame, W, H, stage, STAGE);
+    fb.markDirty(0,   0,  4, 4);
+    fb.markDirty(60,  0,  4, 4);
+    fb.markDirty(120, 0,  4, 4);
+    fb.markDirty(0,   60, 4, 4);
+    TEST_ASSERT_EQUAL_size_t(FB_DIRTY_MAX, fb.dirtyCount());
+
+    fb.markDirty(120, 40, 4, 4);        // nearest the third
+    TEST_ASSERT_EQUAL_size_t(FB_DIRTY_MAX, fb.dirtyCount());
+    bool found = false;
+    for (size_t i = 0; i < fb.dirtyCount(); i++)
+    {
+        const FbRect& r = fb.dirty(i);
+        if (r.x0 == 120) { expectRect(r, 120, 0, 123, 43); found = true; }
+    }
+    TEST_ASSERT_TRUE(found);
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 4. Flush
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_flush_packs_narrow_rect(void)
+{
+    uint16_t frame[W * H], stage[STAGE];
+    FrameBuffer fb;
+    fb.attach(frame, W, H, stage, STAGE);
+    paint(fb, 10, 5, 3, 2, 0xABCD);
+    *fb.row(11, 6) = 0x1234;
+
+    RecordingBus bus;
+    TEST_ASSERT_EQUAL_size_t(1, fb.flush(bus));
+    TEST_ASSERT_EQUAL_size_t(1, bus.windows);
+    expectRect(bus.bursts[0].rect, 10, 5, 12, 6);
+    const std::vector<uint16_t> want = { 0xABCD, 0xABCD, 0xABCD, 0xABCD, 0x1234, 0xABCD };
+    TEST_ASSERT_TRUE(bus.bursts[0].px == want);
+    TEST_ASSERT_EQUAL_size_t(0, fb.dirtyCount());
+}
+
+void test_flush_sends_full_width_in_place(void)
+{
+    uint16_t frame[W * H], stage[STAGE];
+    FrameBuffer fb;
+    fb.attach(frame, W, H, stage, STAGE);
+    paint(fb, 0, 20, W, 60, 0xFFFF);
+
+    RecordingBus bus;
+    fb.flush(bus);
+    expectRect(bus.bursts[0].rect, 0, 20, W - 1, 79);
+    TEST_ASSERT_EQUAL_size_t(W * 60, bus.bursts[0].px.size());
+}
+
+void test_flush_widens_rect_too_big_for_stage(void)
+{
+    uint16_t frame[W * H], stage[STAGE];
+    FrameBuffer fb;
+    fb.attach(frame, W, H, stage, STAGE);
+    paint(fb, 16, 10, 128, 64, 0x001F);     // 8192 px > STAGE
+
+    RecordingBus bus;
+    fb.flush(bus);
+    expectRect(bus.bursts[0].rect, 0, 10, W - 1, 73);
+    TEST_ASSERT_EQUAL_size_t(W * 64, bus.bursts[0].px.size());
+    TEST_ASSERT_EQUAL_UINT16(0,      bus.bursts[0].px[0]);      // outside, unchanged
+    TEST_ASSERT_EQUAL_UINT16(0x001F, bus.bursts[0].px[16]);
+}
+
+void test_flush_one_burst_per_rect(void)
+{
+    uint16_t frame[W * H], stage[STAGE];
+    FrameBuffer fb;
+    fb.attach(frame, W, H, stage, STAGE);
+    paint(fb, W - 33, 1, 16, 16, 1);
+    paint(fb, 0, 6, 35, 10, 2);
+    paint(fb, 0, 62, 11, 18, 3);
+
+    RecordingBus bus;
+    TEST_ASSERT_EQUAL_size_t(3, fb.flush(bus));
+    TEST_ASSERT_EQUAL_size_t(3, bus.windows);
+    for (const RecordingBus::Burst& b : bus.bursts)
+        TEST_ASSERT_EQUAL_size_t(b.rect.area(), b.px.size());
+
+    RecordingBus again;
+    TEST_ASSERT_EQUAL_size_t(0, fb.flush(again));
+    TEST_ASSERT_EQUAL_size_t(0, again.windows);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    // 1. Marking
+    RUN_TEST(test_attach_clears_frame);
+    RUN_TEST(test_mark_clips_to_frame);
+    RUN_TEST(test_covered_rect_adds_nothing);
+
+    // 2. Merging
+    RUN_TEST(test_adjacent_glyphs_merge);
+    RUN_TEST(test_distant_icons_stay_apart);
+    RUN_TEST(test_merge_cascades);
+
+    // 3. Cap
+    RUN_TEST(test_full_list_merges_least_growth);
+
+    // 4. Flush
+    RUN_TEST(test_flush_packs_narrow_rect);
+    RUN_TEST(test_flush_sends_full_width_in_place);
+    RUN_TEST(test_flush_widens_rect_too_big_for_stage);
+    RUN_TEST(test_flush_one_burst_per_rect);
+
+    return UNITY_END();
+}
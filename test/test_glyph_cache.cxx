@@ -0,0 +1,170 @@
+/**
+ * test_glyph_cache.cxx — Unity tests for the pre-expanded glyph cache.
+ *
+ * Run with: cmake -B build && cmake --build build && ctest --test-dir build -V
+ *
+ * Uses the firmware's own fonts (font_spans.cxx).
+ *
+ * Test groups
+ * ───────────
+ *   1. Lookup                 — inactive cache, hits, every key field counts
+ *   2. Eviction               — least recently used goes first, empty slots before
+ *   3. Pixels                 — cached bitmap equals row-by-row expansion
+ */
+
+#include "unity.h"
+#include "glyph_cache.h"
+#include <cstdint>
+#include <cstring>
+
+// ── Unity required entry points ───────────────────────────────────────────
+void setUp(void)    {}
+void tearDown(void) {}
+
+static constexpr size_t SLOTS = 4;
+
+static constexpr uint16_t FG = 0x0000;
+static constexpr uint16_t BG = 0xFFFF;
+
+// ─────────────────────────────────────────────────────────────────────────
+// 1. Lookup
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_inactive_returns_null(void)
+{
+    uint16_t   px[SLOTS * GLYPH_MAX_PIXELS];
+    GlyphCache c;
+    c.attach(px, 0);
+    TEST_ASSERT_FALSE(c.active());
+    TEST_ASSERT_NULL(c.get(Font_7x10, 'A', FG, BG));
+}
+
+void test_second_lookup_hits(void)
+{
+    uint16_t   px[SLOTS * GLYPH_MAX_PIXELS];
+    GlyphCache c;
+    c.attach(px, SLOTS);
+    const uint16_t* a = c.get(Font_7x10, 'A', FG, BG);
+    const uint16_t* b = c.get(Font_7x10, 'A', FG, BG);
+    TEST_ASSERT_NOT_NULL(a);
+    TEST_ASSERT_EQUAL_PTR(a, b);
+    TEST_ASSERT_EQUAL_UINT32(1, c.hits());
+    TEST_ASSERT_EQUAL_UINT32(1, c.misses());
+}
+
+void test_key_includes_font_and_colours(void)
+{
+    uint16_t   px[SLOTS * GLYPH_MAX_PIXELS];
+    GlyphCache c;
+    c.attach(px, SLOTS);
+    c.get(Font_7x10,  'A', FG, BG);
+    c.get(Font_11x18, 'A', FG, BG);
+    c.get(Font_7x10,  'A', BG, FG);
+    c.get(Font_7x10,  'A', FG, 0x1234);
+    TEST_ASSERT_EQUAL_UINT32(0, c.hits());
+    TEST_ASSERT_EQUAL_UINT32(4, c.misses());
+}
+
+void test_oversize_glyph_uncached(void)
+{
+    uint16_t   px[SLOTS * GLYPH_MAX_PIXELS];
+    GlyphCache c;
+    c.attach(px, SLOTS);
+    TEST_ASSERT_NULL(c.get(Font_16x26, 'A', FG, BG));
+    TEST_ASSERT_EQUAL_UINT32(0, c.misses());
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 2. Eviction
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_least_recently_used_evicted(void)
+{
+    uint16_t   px[SLOTS * GLYPH_MAX_PIXELS];
+    GlyphCache c;
+    c.attach(px, SLOTS);
+    c.get(Font_7x10, 'A', FG, BG);
+    c.get(Font_7x10, 'B', FG, BG);
+    c.get(Font_7x10, 'C', FG, BG);
+    c.get(Font_7x10, 'D', FG, BG);
+    c.get(Font_7x10, 'A', FG, BG);      // A is now the newest; B the oldest
+    c.get(Font_7x10, 'E', FG, BG);      // evicts B
+
+    const uint32_t misses = c.misses();
+    c.get(Font_7x10, 'A', FG, BG);
+    c.get(Font_7x10, 'C', FG, BG);
+    c.get(Font_7x10, 'D', FG, BG);
+    c.get(Font_7x10, 'E', FG, BG);
+    TEST_ASSERT_EQUAL_UINT32(misses, c.misses());
+    c.get(Font_7x10, 'B', FG, BG);
+    TEST_ASSERT_EQUAL_UINT32(misses + 1, c.misses());
+}
+
+void test_empty_slots_filled_first(void)
+{
+    uint16_t   px[SLOTS * GLYPH_MAX_PIXELS];
+    GlyphCache c;
+    c.attach(px, SLOTS);
+    const uint16_t* slot[SLOTS];
+    for (size_t i = 0; i < SLOTS; i++)
+        slot[i] = c.get(Font_7x10, static_cast<char>('a' + i), FG, BG);
+    for (size_t i = 0; i < SLOTS; i++)
+        for (size_t j = i + 1; j < SLOTS; j++)
+            TEST_ASSERT_TRUE(slot[i] != slot[j]);
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 3. Pixels
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_bitmap_matches_expansion(void)
+{
+    uint16_t   px[SLOTS * GLYPH_MAX_PIXELS];
+    GlyphCache c;
+    c.attach(px, SLOTS);
+    const FontDef* fonts[] = { &Font_7x10, &Font_11x18, &Font_11x18_Prop };
+    for (const FontDef* f : fonts)
+    {
+        for (char ch = 32; ch < 127; ch++)
+        {
+            const uint16_t* got = c.get(*f, ch, 0x1F00, 0xE007);
+            uint16_t  want[GLYPH_MAX_PIXELS];
+            GlyphRows rows(*f, ch);
+            for (uint32_t row = 0; row < f->height; row++)
+                rows.row(0x1F00, 0xE007, want + row * rows.width());
+            TEST_ASSERT_EQUAL_MEMORY(want, got, rows.width() * f->height * sizeof(uint16_t));
+        }
+    }
+}
+
+void test_reused_slot_fully_rewritten(void)
+{
+    uint16_t   px[SLOTS * GLYPH_MAX_PIXELS];
+    GlyphCache c;
+    c.attach(px, 1);
+    c.get(Font_11x18, '#', FG, BG);
+    const uint16_t* got = c.get(Font_11x18, ' ', FG, BG);
+    for (size_t i = 0; i < 11 * 18; i++)
+        TEST_ASSERT_EQUAL_HEX16(BG, got[i]);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    // 1. Lookup
+    RUN_TEST(test_inactive_returns_null);
+    RUN_TEST(test_second_lookup_hits);
+    RUN_TEST(test_key_includes_font_and_colours);
+    RUN_TEST(test_oversize_glyph_uncached);
+
+    // 2. Eviction
+    RUN_TEST(test_least_recently_used_evicted);
+    RUN_TEST(test_empty_slots_filled_first);
+
+    // 3. Pixels
+    RUN_TEST(test_bitmap_matches_expansion);
+    RUN_TEST(test_reused_slot_fully_rewritten);
+
+    return UNITY_END();
+}
@@ -0,0 +1,282 @@
+/**
+ * test_header_bar.cxx — Unity tests for the header bar diffing compositor.
+ *
+ * Run with: cmake -B build && cmake --build build && ctest --test-dir build -V
+ *
+ * Composition is checked against the firmware icons (bitmaps.h) and
+ * Font_7x10 expanded independently — an XBM bit test, font_blit() — at
+ * the cell positions the Display used to draw each one at.
+ *
+ * Test groups
+ * ───────────
+ *   1. Diffing                — first draw, repeats, one cell, one digit, merging, invalidate
+ *   2. Composition            — icons, clock, background, partial rectangles, wire order
+ *   3. Stats                  — updates, repeats, bursts, pixels, per-cell redraws
+ */
+
+#include "unity.h"
+#include "bitmaps.h"
+#include "header_bar.h"
+#include <cstdint>
+#include <cstring>
+
+// ── Unity required entry points ───────────────────────────────────────────
+void setUp(void)    {}
+void tearDown(void) {}
+
+static constexpr uint8_t  W     = 160;
+static constexpr uint16_t BG    = 0x3190;
+static constexpr uint16_t WHITE = 0xFFFF;
+static constexpr uint16_t GREEN = 0x07E0;
+
+static uint16_t be(uint16_t c) { return __builtin_bswap16(c); }
+
+/// A bar with everything drawn once.
+static HeaderBar settled()
+{
+    HeaderBar bar(W, BG, WHITE);
+    bar.setTime("12:34");
+    bar.setIcon(HDR_BLE, Bitmaps::BluetoothRound, WHITE);
+    bar.setIcon(HDR_BATTERY, Bitmaps::Battery_100, WHITE);
+    bar.drawn();
+    return bar;
+}
+
+static HeaderRect g_rects[HDR_RECTS_MAX];
+
+/// The one rectangle dirty() must give.
+static const HeaderRect& only(const HeaderBar& bar)
+{
+    TEST_ASSERT_EQUAL_UINT8(1, bar.dirty(g_rects));
+    return g_rects[0];
+}
+
+static void assertRect(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, const HeaderRect& r)
+{
+    TEST_ASSERT_EQUAL_UINT8(x0, r.x0);
+    TEST_ASSERT_EQUAL_UINT8(y0, r.y0);
+    TEST_ASSERT_EQUAL_UINT8(x1, r.x1);
+    TEST_ASSERT_EQUAL_UINT8(y1, r.y1);
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 1. Diffing
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_first_draw_covers_every_cell(void)
+{
+    HeaderBar bar(W, BG, WHITE);
+    TEST_ASSERT_EQUAL_UINT8(2, bar.dirty(g_rects));
+    assertRect(W - 84, 1, W - 1, 16, g_rects[0]);       // icons
+    assertRect(0, 6, 34, 15, g_rects[1]);               // clock
+    bar.drawn();
+    TEST_ASSERT_EQUAL_UINT8(0, bar.dirty(g_rects));
+}
+
+void test_repeats_are_not_dirty(void)
+{
+    HeaderBar bar = settled();
+    bar.setTime("12:34");
+    bar.setIcon(HDR_BLE, Bitmaps::BluetoothRound, WHITE);
+    bar.setIcon(HDR_GPS, nullptr, WHITE);
+    bar.setIcon(HDR_CALL, nullptr, GREEN);     // blank in any colour is blank
+    TEST_ASSERT_EQUAL_UINT8(0, bar.dirty(g_rects));
+}
+
+void test_one_icon_is_its_cell(void)
+{
+    HeaderBar bar = settled();
+    bar.setIcon(HDR_GPS, Bitmaps::GPS, WHITE);
+    assertRect(W - 50, 1, W - 35, 16, only(bar));
+
+    // Changed and changed back before a flush: nothing to draw.
+    bar.setIcon(HDR_GPS, nullptr, WHITE);
+    TEST_ASSERT_EQUAL_UINT8(0, bar.dirty(g_rects));
+
+    // Same icon, new colour.
+    bar.setIcon(HDR_BATTERY, Bitmaps::Battery_100, GREEN);
+    assertRect(W - 16, 1, W - 1, 16, only(bar));
+}
+
+void test_minute_tick_is_one_digit(void)
+{
+    HeaderBar bar = settled();
+    bar.setTime("12:35");
+    assertRect(28, 6, 34, 15, only(bar));
+
+    bar.setTime("12:40");
+    assertRect(21, 6, 34, 15, only(bar));
+
+    bar.setTime("9:05");                        // short: padded with spaces
+    assertRect(0, 6, 34, 15, only(bar));
+}
+
+void test_icons_merge_clock_apart(void)
+{
+    HeaderBar bar = settled();
+    bar.setIcon(HDR_CALL, Bitmaps::PhoneCall, GREEN);
+    bar.setIcon(HDR_BLE, Bitmaps::Bluetooth, WHITE);
+    assertRect(W - 84, 1, W - 18, 16, only(bar));
+
+    // The clock digit is 41 columns from the call icon: a window of its own.
+    bar.setTime("12:35");
+    TEST_ASSERT_EQUAL_UINT8(2, bar.dirty(g_rects));
+    assertRect(W - 84, 1, W - 18, 16, g_rects[0]);
+    assertRect(28, 6, 34, 15, g_rects[1]);
+}
+
+void test_clock_joins_when_cheaper(void)
+{
+    // On a 120-pixel bar the call icon starts at column 36, right after
+    // the clock: one window costs fewer pixels than a second one.
+    HeaderBar bar(120, BG, WHITE);
+    bar.setTime("12:34");
+    bar.drawn();
+    bar.setTime("12:35");
+    bar.setIcon(HDR_CALL, Bitmaps::PhoneCall, GREEN);
+    assertRect(28, 1, 51, 16, only(bar));
+}
+
+void test_invalidate_redraws_all(void)
+{
+    HeaderBar bar = settled();
+    bar.invalidate();
+    TEST_ASSERT_EQUAL_UINT8(2, bar.dirty(g_rects));
+    assertRect(W - 84, 1, W - 1, 16, g_rects[0]);
+    assertRect(0, 6, 34, 15, g_rects[1]);
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 2. Composition
+// ─────────────────────────────────────────────────────────────────────────
+
+static uint16_t g_bar[16][W];
+
+static void compose(const HeaderBar& bar, uint8_t x0 = 0, uint8_t w = W)
+{
+    for (uint8_t y = 1; y <= 16; y++)
+        bar.drawRow(y, x0, w, g_bar[y - 1]);
+}
+
+static void checkIcon(uint8_t x, const uint8_t* xbm, uint16_t color)
+{
+    for (uint32_t row = 0; row < 16; row++)
+        for (uint32_t col = 0; col < 16; col++)
+        {
+            const bool ink = xbm[row * 2 + col / 8] >> (col % 8) & 1;
+            TEST_ASSERT_EQUAL_HEX16(be(ink ? color : BG), g_bar[row][x + col]);
+        }
+}
+
+void test_icons_match_xbm(void)
+{
+    HeaderBar bar = settled();
+    bar.setIcon(HDR_CALL, Bitmaps::PhoneCall, GREEN);
+    bar.setIcon(HDR_LORA, Bitmaps::LoRaMesh, WHITE);
+    compose(bar);
+    checkIcon(W - 84, Bitmaps::PhoneCall, GREEN);
+    checkIcon(W - 67, Bitmaps::LoRaMesh, WHITE);
+    checkIcon(W - 33, Bitmaps::BluetoothRound, WHITE);
+    checkIcon(W - 16, Bitmaps::Battery_100, WHITE);
+    for (uint32_t row = 0; row < 16; row++)
+        for (uint32_t x = W - 50; x < W - 34; x++)     // GPS: blank
+            TEST_ASSERT_EQUAL_HEX16(be(BG), g_bar[row][x]);
+}
+
+void test_clock_matches_font(void)
+{
+    HeaderBar bar = settled();
+    compose(bar);
+    uint16_t glyph[7 * 10];
+    const char* t = "12:34";
+    for (uint32_t i = 0; i < 5; i++)
+    {
+        font_blit(Font_7x10, t[i], be(WHITE), be(BG), glyph, 7);
+        for (uint32_t row = 0; row < 10; row++)
+            TEST_ASSERT_EQUAL_MEMORY(glyph + row * 7, &g_bar[5 + row][i * 7], 7 * sizeof(uint16_t));
+    }
+    // Above and below the clock, and up to the call cell: background.
+    for (uint32_t x = 0; x < W - 84; x++)
+    {
+        TEST_ASSERT_EQUAL_HEX16(be(BG), g_bar[0][x]);
+        TEST_ASSERT_EQUAL_HEX16(be(BG), g_bar[15][x]);
+        if (x >= 35) TEST_ASSERT_EQUAL_HEX16(be(BG), g_bar[8][x]);
+    }
+}
+
+void test_partial_rectangle_matches_whole(void)
+{
+    HeaderBar bar = settled();
+    bar.setIcon(HDR_GPS, Bitmaps::GPS, WHITE);
+    static uint16_t whole[16][W];
+    compose(bar);
+    memcpy(whole, g_bar, sizeof(whole));
+
+    const uint8_t spans[][2] = { {0, 35}, {30, 60}, {W - 50, 16}, {W - 41, 41}, {5, 1} };
+    for (const auto& s : spans)
+    {
+        uint16_t row[W];
+        for (uint8_t y = 1; y <= 16; y++)
+        {
+            bar.drawRow(y, s[0], s[1], row);
+            TEST_ASSERT_EQUAL_MEMORY(&whole[y - 1][s[0]], row, s[1] * sizeof(uint16_t));
+        }
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 3. Stats
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_stats_count_updates_and_redraws(void)
+{
+    HeaderBar bar = settled();
+    const HeaderStats before = bar.stats();
+    TEST_ASSERT_EQUAL_UINT32(3, before.updates);
+    TEST_ASSERT_EQUAL_UINT32(0, before.unchanged);
+    TEST_ASSERT_EQUAL_UINT32(2, before.bursts);
+    TEST_ASSERT_EQUAL_UINT32(84 * 16 + 35 * 10, before.pixels);
+    for (uint8_t c = 0; c < HDR_CELLS; c++)
+        TEST_ASSERT_EQUAL_UINT32(1, before.cells[c]);
+
+    // A minute of header traffic: battery and BLE repeated, one clock tick.
+    for (int i = 0; i < 4; i++) {
+        bar.setIcon(HDR_BATTERY, Bitmaps::Battery_100, WHITE);
+        bar.setIcon(HDR_BLE, Bitmaps::BluetoothRound, WHITE);
+    }
+    bar.setTime("12:35");
+    bar.drawn();
+
+    const HeaderStats& after = bar.stats();
+    TEST_ASSERT_EQUAL_UINT32(3 + 9, after.updates);
+    TEST_ASSERT_EQUAL_UINT32(8, after.unchanged);
+    TEST_ASSERT_EQUAL_UINT32(3, after.bursts);
+    TEST_ASSERT_EQUAL_UINT32(84 * 16 + 35 * 10 + 7 * 10, after.pixels);
+    TEST_ASSERT_EQUAL_UINT32(2, after.cells[HDR_TIME]);
+    TEST_ASSERT_EQUAL_UINT32(1, after.cells[HDR_BATTERY]);
+    TEST_ASSERT_EQUAL_UINT32(1, after.cells[HDR_BLE]);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    // 1. Diffing
+    RUN_TEST(test_first_draw_covers_every_cell);
+    RUN_TEST(test_repeats_are_not_dirty);
+    RUN_TEST(test_one_icon_is_its_cell);
+    RUN_TEST(test_minute_tick_is_one_digit);
+    RUN_TEST(test_icons_merge_clock_apart);
+    RUN_TEST(test_clock_joins_when_cheaper);
+    RUN_TEST(test_invalidate_redraws_all);
+
+    // 2. Composition
+    RUN_TEST(test_icons_match_xbm);
+    RUN_TEST(test_clock_matches_font);
+    RUN_TEST(test_partial_rectangle_matches_whole);
+
+    // 3. Stats
+    RUN_TEST(test_stats_count_updates_and_redraws);
+
+    return UNITY_END();
+}
@@ -0,0 +1,210 @@
+/**
+ * test_mesh_airtime.cxx — Unity tests for time-on-air and the airtime ledger.
+ *
+ * Run with: cmake -B build && cmake --build build && ctest --test-dir build -V
+ *
+ * Test groups
+ * ───────────
+ *   1. Time on air            — Semtech formula for the Meshtastic presets
+ *   2. Ledger                 — per-minute buckets, rolling hour, utilisation
+ *   3. Duty-cycle budget      — hard limit, periodic headroom, release time
+ */
+
+#include "unity.h"
+#include "mesh_airtime.h"
+#include <cstdint>
+
+// ── Unity required entry points ───────────────────────────────────────────
+void setUp(void)    {}
+void tearDown(void) {}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 1. Time on air
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_toa_long_fast(void)
+{
+    // SF11/BW250/CR4-5, 16-symbol preamble, 50 bytes:
+    //   payload = 8 + ceil(400/44)·5 = 58 symbols, + 20.25 preamble
+    //   78.25 × 8.192 ms = 641.024 ms
+    TEST_ASSERT_EQUAL_UINT32(641024u, mc_airtimeUs(11, 250000, 1, 16, false, 50));
+}
+
+void test_toa_short_fast(void)
+{
+    // SF7/BW250, 10 bytes: 8 + ceil(96/28)·5 = 28, + 20.25 → 48.25 × 512 µs
+    TEST_ASSERT_EQUAL_UINT32(24704u, mc_airtimeUs(7, 250000, 1, 16, false, 10));
+}
+
+void test_toa_long_slow_uses_ldro(void)
+{
+    // SF12/BW125/CR4-8, LDRO: 8 + ceil(156/40)·8 = 40, + 20.25 → 60.25 × 32.768 ms
+    TEST_ASSERT_EQUAL_UINT32(1974272u, mc_airtimeUs(12, 125000, 4, 16, true, 20));
+    TEST_ASSERT_TRUE(mc_airtimeUs(12, 125000, 4, 16, true, 200) >
+                     mc_airtimeUs(12, 125000, 4, 16, false, 200));
+}
+
+void test_toa_empty_payload_is_header_only(void)
+{
+    // Negative numerator clamps to the 8 mandatory symbols.
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)(28.25 * 32768), mc_airtimeUs(12, 125000, 1, 16, false, 0));
+}
+
+void test_toa_grows_with_length(void)
+{
+    uint32_t prev = 0;
+    for (unsigned len = 0; len <= 255; len += 15)
+    {
+        const uint32_t us = mc_airtimeUs(11, 250000, 1, 16, false, (uint8_t)len);
+        TEST_ASSERT_TRUE(us >= prev);
+        prev = us;
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 2. Ledger
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_tx_share_of_hour(void)
+{
+    McAirtime a;
+    mc_airtimeInit(a, 0);
+    mc_airtimeNoteTx(a, 1000, 18000);
+    mc_airtimeNoteTx(a, 125000, 18000);             // a later minute
+    TEST_ASSERT_EQUAL_UINT16(10, mc_airtimeTxPermille(a, 130000));   // 36 s = 1.0 %
+    TEST_ASSERT_EQUAL_UINT32(36000u, a.txTotalMs);
+}
+
+void test_tx_leaves_window_after_an_hour(void)
+{
+    McAirtime a;
+    mc_airtimeInit(a, 0);
+    mc_airtimeNoteTx(a, 30000, 36000);              // minute 0
+    TEST_ASSERT_EQUAL_UINT16(10, mc_airtimeTxPermille(a, MC_AIRTIME_HOUR_MS - 1));
+    TEST_ASSERT_EQUAL_UINT16(0,  mc_airtimeTxPermille(a, MC_AIRTIME_HOUR_MS));
+    TEST_ASSERT_EQUAL_UINT32(36000u, a.txTotalMs);  // total survives
+}
+
+void test_long_gap_clears_everything(void)
+{
+    McAirtime a;
+    mc_airtimeInit(a, 0);
+    mc_airtimeNoteTx(a, 0, 5000);
+    mc_airtimeNoteRx(a, 0, 5000);
+    TEST_ASSERT_TRUE(mc_airtimeAdvance(a, 10u * MC_AIRTIME_HOUR_MS + 123));
+    TEST_ASSERT_EQUAL_UINT16(0, mc_airtimeTxPermille(a, 10u * MC_AIRTIME_HOUR_MS + 123));
+    TEST_ASSERT_EQUAL_UINT16(0, mc_airtimeChannelPermille(a, 10u * MC_AIRTIME_HOUR_MS + 123));
+}
+
+void test_channel_utilisation_counts_rx_and_tx(void)
+{
+    McAirtime a;
+    mc_airtimeInit(a, 0);
+    mc_airtimeNoteRx(a, 500, 2400);
+    mc_airtimeNoteTx(a, 800, 3600);
+    // 6 s busy over 60 s + 1 s of the current minute
+    TEST_ASSERT_EQUAL_UINT16(98, mc_airtimeChannelPermille(a, 1000));
+    // Two minutes later both buckets have aged out of the short window,
+    // though the TX is still in the hour.
+    TEST_ASSERT_EQUAL_UINT16(0, mc_airtimeChannelPermille(a, 2 * MC_AIRTIME_BUCKET_MS + 1000));
+    TEST_ASSERT_EQUAL_UINT16(1, mc_airtimeTxPermille(a, 2 * MC_AIRTIME_BUCKET_MS + 1000));
+}
+
+void test_advance_reports_completed_minutes(void)
+{
+    McAirtime a;
+    mc_airtimeInit(a, 0);
+    TEST_ASSERT_FALSE(mc_airtimeAdvance(a, MC_AIRTIME_BUCKET_MS - 1));
+    TEST_ASSERT_TRUE(mc_airtimeAdvance(a, MC_AIRTIME_BUCKET_MS));
+    TEST_ASSERT_FALSE(mc_airtimeAdvance(a, MC_AIRTIME_BUCKET_MS + 5));
+}
+
+void test_ledger_across_clock_wrap(void)
+{
+    const uint32_t t0 = 0xFFFFFFFFu - 30000u;
+    McAirtime a;
+    mc_airtimeInit(a, t0);
+    mc_airtimeNoteTx(a, t0 + 1000, 36000);
+    const uint32_t later = t0 + 2u * MC_AIRTIME_BUCKET_MS;   // wrapped
+    TEST_ASSERT_TRUE(later < t0);
+    TEST_ASSERT_EQUAL_UINT16(10, mc_airtimeTxPermille(a, later));
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 3. Duty-cycle budget
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_budget_hard_limit(void)
+{
+    // 10 % of an hour = 360 s
+    McAirtime a;
+    mc_airtimeInit(a, 0);
+    mc_airtimeNoteTx(a, 0, 290000);
+    TEST_ASSERT_TRUE (mc_airtimeAllows(a, 1000, 70000, 10, false));
+    TEST_ASSERT_FALSE(mc_airtimeAllows(a, 1000, 70001, 10, false));
+}
+
+void test_budget_periodic_headroom(void)
+{
+    // Periodic traffic stops at 80 % of 10 % = 288 s
+    McAirtime a;
+    mc_airtimeInit(a, 0);
+    mc_airtimeNoteTx(a, 0, 288000);
+    TEST_ASSERT_TRUE (mc_airtimeAllows(a, 1000, 0, 10, true));
+    mc_airtimeNoteTx(a, 1000, 1);
+    TEST_ASSERT_FALSE(mc_airtimeAllows(a, 1000, 0, 10, true));
+    TEST_ASSERT_TRUE (mc_airtimeAllows(a, 1000, 1000, 10, false));   // replies still fit
+}
+
+void test_budget_unlimited_region(void)
+{
+    McAirtime a;
+    mc_airtimeInit(a, 0);
+    mc_airtimeNoteTx(a, 0, MC_AIRTIME_HOUR_MS);
+    TEST_ASSERT_TRUE(mc_airtimeAllows(a, 1000, 5000, 100, false));
+    TEST_ASSERT_TRUE(mc_airtimeAllows(a, 1000, 5000, 100, true));
+}
+
+void test_budget_frees_as_minutes_expire(void)
+{
+    // 1 % = 36 s.  All of it spent in minute 0: refused until minute 0
+    // leaves the hour, which mc_airtimeNextReleaseMs counts down to.
+    McAirtime a;
+    mc_airtimeInit(a, 0);
+    mc_airtimeNoteTx(a, 10000, 36000);
+    const uint32_t t = MC_AIRTIME_HOUR_MS - 20000;
+    TEST_ASSERT_FALSE(mc_airtimeAllows(a, t, 500, 1, false));
+    TEST_ASSERT_EQUAL_UINT32(20000u, mc_airtimeNextReleaseMs(a, t));
+    TEST_ASSERT_TRUE(mc_airtimeAllows(a, t + 20000, 500, 1, false));
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// Main
+// ─────────────────────────────────────────────────────────────────────────
+int main(void)
+{
+    UNITY_BEGIN();
+
+    // 1. Time on air
+    RUN_TEST(test_toa_long_fast);
+    RUN_TEST(test_toa_short_fast);
+    RUN_TEST(test_toa_long_slow_uses_ldro);
+    RUN_TEST(test_toa_empty_payload_is_header_only);
+    RUN_TEST(test_toa_grows_with_length);
+
+    // 2. Ledger
+    RUN_TEST(test_tx_share_of_hour);
+    RUN_TEST(test_tx_leaves_window_after_an_hour);
+    RUN_TEST(test_long_gap_clears_everything);
+    RUN_TEST(test_channel_utilisation_counts_rx_and_tx);
+    RUN_TEST(test_advance_reports_completed_minutes);
+    RUN_TEST(test_ledger_across_clock_wrap);
+
+    // 3. Duty-cycle budget
+    RUN_TEST(test_budget_hard_limit);
+    RUN_TEST(test_budget_periodic_headroom);
+    RUN_TEST(test_budget_unlimited_region);
+    RUN_TEST(test_budget_frees_as_minutes_expire);
+
+    return UNITY_END();
+}
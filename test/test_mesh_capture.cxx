@@ -0,0 +1,379 @@
+/**
+ * test_mesh_capture.cxx — Unity tests for the packet capture ring and pcap export.
+ *
+ * Run with: cmake -B build && cmake --build build && ctest --test-dir build -V
+ *
+ * Built with MC_CAPTURE_DEPTH=8 so wrap-around is cheap to reach.
+ *
+ * Test groups
+ * ───────────
+ *   1. Ring               — in-place write, order, wrap, busy and overwritten slots
+ *   2. LoRaTap            — header layout, RSSI / SNR encoding and clamping
+ *   3. pcap stream        — file and record headers, chunking, frames lost mid-export
+ *   4. Hot path           — no allocation, no copy beyond the caller's write
+ *   5. Concurrency        — writer and reader threads: no torn frames
+ */
+
+#include "unity.h"
+#include "mesh_capture.h"
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <thread>
+#include <vector>
+
+// ── Unity required entry points ───────────────────────────────────────────
+void setUp(void)    {}
+void tearDown(void) {}
+
+// Count heap allocations so the hot path can be shown not to make any.
+static std::atomic<unsigned> g_allocs{0};
+void* operator new(size_t n)
+{
+    g_allocs++;
+    if (void* p = malloc(n ? n : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+
+/// Commit frame @p n: @p len bytes of a pattern derived from n.
+static void put(McCapture& c, uint32_t n, uint8_t len = 40,
+                int16_t rssi = -90, float snr = 6.5f, uint32_t tick = 0)
+{
+    uint8_t* d = mc_captureBegin(c);
+    for (unsigned i = 0; i < len; i++) d[i] = static_cast<uint8_t>(n * 31 + i);
+    mc_captureCommit(c, len, rssi, snr, tick ? tick : 1000 + n * 10);
+}
+
+static bool patternOk(const McCaptureFrame& f)
+{
+    for (unsigned i = 0; i < f.len; i++)
+        if (f.data[i] != static_cast<uint8_t>(f.n * 31 + i)) return false;
+    return true;
+}
+
+static const McLoraTapChannel CH = { 906875000, 250000, 11, 0x2B };
+
+static uint32_t le32(const uint8_t* p)
+{
+    return p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+/// Whole export in chunks of @p chunk bytes.
+static std::vector<uint8_t> exportAll(McPcapStream& s, const McCapture& c, size_t chunk)
+{
+    std::vector<uint8_t> out;
+    uint8_t buf[512];
+    while (size_t n = mc_pcapRead(s, c, buf, chunk)) out.insert(out.end(), buf, buf + n);
+    return out;
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 1. Ring
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_ring_round_trip(void)
+{
+    McCapture c;
+    put(c, 0, 52, -87, 7.5f, 12345);
+
+    McCaptureFrame f;
+    TEST_ASSERT_EQUAL_UINT32(1, mc_captureHead(c));
+    TEST_ASSERT_TRUE(mc_captureRead(c, 0, f));
+    TEST_ASSERT_EQUAL_UINT32(0, f.n);
+    TEST_ASSERT_EQUAL_UINT8(52, f.len);
+    TEST_ASSERT_EQUAL_INT16(-87, f.rssi);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 7.5f, f.snr);
+    TEST_ASSERT_EQUAL_UINT32(12345, f.tickMs);
+    TEST_ASSERT_TRUE(patternOk(f));
+}
+
+void test_ring_begin_returns_slot_storage(void)
+{
+    // The caller's ReadBuffer writes straight into the ring.
+    McCapture c;
+    uint8_t* d = mc_captureBegin(c);
+    TEST_ASSERT_TRUE(d == c.slots[0].data);
+    mc_captureCommit(c, 1, 0, 0.f, 0);
+    TEST_ASSERT_TRUE(mc_captureBegin(c) == c.slots[1].data);
+}
+
+void test_ring_not_yet_committed(void)
+{
+    McCapture c;
+    McCaptureFrame f;
+    TEST_ASSERT_FALSE(mc_captureRead(c, 0, f));
+    mc_captureBegin(c);                     // being written
+    TEST_ASSERT_FALSE(mc_captureRead(c, 0, f));
+}
+
+void test_ring_wrap_overwrites_oldest(void)
+{
+    McCapture c;
+    for (uint32_t n = 0; n < MC_CAPTURE_DEPTH + 3; n++) put(c, n);
+
+    TEST_ASSERT_EQUAL_UINT32(MC_CAPTURE_DEPTH + 3, mc_captureHead(c));
+    TEST_ASSERT_EQUAL_UINT32(3, mc_captureOldest(c));
+
+    McCaptureFrame f;
+    TEST_ASSERT_FALSE(mc_captureRead(c, 2, f));
+    for (uint32_t n = 3; n < MC_CAPTURE_DEPTH + 3; n++)
+    {
+        TEST_ASSERT_TRUE(mc_captureRead(c, n, f));
+        TEST_ASSERT_EQUAL_UINT32(n, f.n);
+        TEST_ASSERT_TRUE(patternOk(f));
+    }
+}
+
+void test_ring_slot_being_rewritten_is_unreadable(void)
+{
+    // Frame 0's slot is reclaimed for frame DEPTH: frame 0 is gone as soon
+    // as the writer begins, before anything is committed.
+    McCapture c;
+    for (uint32_t n = 0; n < MC_CAPTURE_DEPTH; n++) put(c, n);
+    McCaptureFrame f;
+    TEST_ASSERT_TRUE(mc_captureRead(c, 0, f));
+    mc_captureBegin(c);
+    TEST_ASSERT_FALSE(mc_captureRead(c, 0, f));
+    TEST_ASSERT_FALSE(mc_captureRead(c, MC_CAPTURE_DEPTH, f));
+}
+
+void test_ring_snr_quantised_and_clamped(void)
+{
+    McCapture c;
+    put(c, 0, 10, -120, -12.3f);
+    put(c, 1, 10, -120, 99.f);
+    put(c, 2, 10, -120, -99.f);
+
+    McCaptureFrame f;
+    mc_captureRead(c, 0, f);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, -12.25f, f.snr);
+    mc_captureRead(c, 1, f);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 31.75f, f.snr);
+    mc_captureRead(c, 2, f);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, -32.f, f.snr);
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 2. LoRaTap
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_loratap_header_layout(void)
+{
+    uint8_t h[MC_LORATAP_HDR];
+    TEST_ASSERT_EQUAL_UINT(15, mc_loraTapHeader(h, CH, -87, 7.5f));
+
+    const uint8_t want[15] = {
+        0x00, 0x00, 0x00, 0x0F,             // version, pad, length 15 (BE)
+        0x36, 0x0D, 0xD0, 0x78,             // 906 875 000 Hz (BE)
+        0x02, 0x0B,                         // 250 kHz = 2 × 125 kHz, SF11
+        52, 0x00, 0x00,                     // −87 + 139; max, current unset
+        30,                                 // 7.5 dB × 4
+        0x2B,
+    };
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(want, h, 15);
+}
+
+void test_loratap_rssi_and_snr_limits(void)
+{
+    uint8_t h[MC_LORATAP_HDR];
+    mc_loraTapHeader(h, CH, -150, -20.f);
+    TEST_ASSERT_EQUAL_UINT8(0, h[10]);
+    TEST_ASSERT_EQUAL_INT8(-80, static_cast<int8_t>(h[13]));
+    mc_loraTapHeader(h, CH, 130, 40.f);
+    TEST_ASSERT_EQUAL_UINT8(255, h[10]);
+    TEST_ASSERT_EQUAL_INT8(127, static_cast<int8_t>(h[13]));
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 3. pcap stream
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_pcap_empty_ring_is_file_header_only(void)
+{
+    McCapture c;
+    McPcapStream s;
+    mc_pcapBegin(s, c, CH);
+    const std::vector<uint8_t> out = exportAll(s, c, 512);
+
+    TEST_ASSERT_EQUAL_UINT(MC_PCAP_FILE_HDR, out.size());
+    TEST_ASSERT_EQUAL_HEX32(0xA1B2C3D4, le32(&out[0]));
+    TEST_ASSERT_EQUAL_UINT8(2, out[4]);
+    TEST_ASSERT_EQUAL_UINT8(4, out[6]);
+    TEST_ASSERT_EQUAL_UINT32(MC_LORATAP_HDR + 255, le32(&out[16]));
+    TEST_ASSERT_EQUAL_UINT32(270, le32(&out[20]));
+}
+
+void test_pcap_records(void)
+{
+    McCapture c;
+    put(c, 0, 40, -90, 6.5f, 1234);
+    put(c, 1, 200, -100, -3.f, 61005);
+
+    McPcapStream s;
+    mc_pcapBegin(s, c, CH);
+    const std::vector<uint8_t> out = exportAll(s, c, 512);
+    TEST_ASSERT_EQUAL_UINT(24 + (16 + 15 + 40) + (16 + 15 + 200), out.size());
+    TEST_ASSERT_EQUAL_UINT32(2, s.sent);
+    TEST_ASSERT_EQUAL_UINT32(0, s.lost);
+
+    const uint8_t* r = &out[24];
+    TEST_ASSERT_EQUAL_UINT32(1,      le32(r));          // ts_sec
+    TEST_ASSERT_EQUAL_UINT32(234000, le32(r + 4));      // ts_usec
+    TEST_ASSERT_EQUAL_UINT32(55,     le32(r + 8));      // incl_len
+    TEST_ASSERT_EQUAL_UINT32(55,     le32(r + 12));     // orig_len
+    TEST_ASSERT_EQUAL_UINT8(49, r[16 + 10]);            // −90 + 139
+    TEST_ASSERT_EQUAL_UINT8(26, r[16 + 13]);            // 6.5 × 4
+    for (unsigned i = 0; i < 40; i++)
+        TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(i), r[31 + i]);
+
+    r += 16 + 15 + 40;
+    TEST_ASSERT_EQUAL_UINT32(61,   le32(r));
+    TEST_ASSERT_EQUAL_UINT32(5000, le32(r + 4));
+    TEST_ASSERT_EQUAL_UINT32(215,  le32(r + 8));
+    TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(31 + 199), r[31 + 199]);
+}
+
+void test_pcap_chunk_size_does_not_matter(void)
+{
+    McCapture c;
+    for (uint32_t n = 0; n < MC_CAPTURE_DEPTH; n++)
+        put(c, n, static_cast<uint8_t>(20 + n * 29));
+
+    McPcapStream s;
+    mc_pcapBegin(s, c, CH);
+    const std::vector<uint8_t> ref = exportAll(s, c, 512);
+    for (size_t chunk : { 1u, 20u, 23u, 244u })
+    {
+        mc_pcapBegin(s, c, CH);
+        TEST_ASSERT_TRUE(exportAll(s, c, chunk) == ref);
+    }
+}
+
+void test_pcap_snapshot_excludes_later_frames(void)
+{
+    McCapture c;
+    put(c, 0);
+    McPcapStream s;
+    mc_pcapBegin(s, c, CH);
+    put(c, 1);
+    exportAll(s, c, 100);
+    TEST_ASSERT_EQUAL_UINT32(1, s.sent);
+}
+
+void test_pcap_frames_overwritten_mid_export_are_counted(void)
+{
+    McCapture c;
+    for (uint32_t n = 0; n < MC_CAPTURE_DEPTH; n++) put(c, n);
+
+    McPcapStream s;
+    mc_pcapBegin(s, c, CH);
+    uint8_t buf[64];
+    mc_pcapRead(s, c, buf, sizeof(buf));    // header + part of frame 0
+    // Frames 0‥2 are overwritten; 0 was already staged, 1 and 2 are lost.
+    for (uint32_t n = 0; n < 3; n++) put(c, MC_CAPTURE_DEPTH + n);
+    exportAll(s, c, 64);
+
+    TEST_ASSERT_EQUAL_UINT32(MC_CAPTURE_DEPTH - 2, s.sent);
+    TEST_ASSERT_EQUAL_UINT32(2, s.lost);
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 4. Hot path
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_capture_and_export_never_allocate(void)
+{
+    McCapture c;
+    McPcapStream s;
+    uint8_t buf[244];
+
+    const unsigned before = g_allocs.load();
+    for (uint32_t n = 0; n < 3 * MC_CAPTURE_DEPTH; n++) put(c, n, 255);
+    mc_pcapBegin(s, c, CH);
+    while (mc_pcapRead(s, c, buf, sizeof(buf))) {}
+    TEST_ASSERT_EQUAL_UINT(before, g_allocs.load());
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 5. Concurrency
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_concurrent_reader_sees_no_torn_frames(void)
+{
+    McCapture c;
+    static constexpr uint32_t FRAMES = 200000;
+    std::atomic<bool> done{false};
+
+    std::thread writer([&] {
+        for (uint32_t n = 0; n < FRAMES; n++)
+        {
+            const uint8_t len = static_cast<uint8_t>(16 + n % 240);
+            uint8_t* d = mc_captureBegin(c);
+            for (unsigned i = 0; i < len; i++) d[i] = static_cast<uint8_t>(n * 31 + i);
+            mc_captureCommit(c, len, static_cast<int16_t>(-(int)(n % 120)), 0.f, n);
+        }
+        done.store(true);
+    });
+
+    uint32_t ok = 0, bad = 0, missed = 0;
+    McCaptureFrame f;
+    while (!done.load())
+    {
+        const uint32_t head = mc_captureHead(c);
+        for (uint32_t n = mc_captureOldest(c); n < head; n++)
+        {
+            if (!mc_captureRead(c, n, f)) { missed++; continue; }
+            const bool good = f.tickMs == n && f.len == 16 + n % 240
+                           && f.rssi == -(int)(n % 120) && patternOk(f);
+            good ? ok++ : bad++;
+        }
+    }
+    writer.join();
+
+    char msg[96];
+    snprintf(msg, sizeof(msg), "reads: %u consistent, %u torn, %u lost to the writer",
+             (unsigned)ok, (unsigned)bad, (unsigned)missed);
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_EQUAL_UINT32(0, bad);
+    TEST_ASSERT_TRUE(ok > 0);
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// Main
+// ─────────────────────────────────────────────────────────────────────────
+int main(void)
+{
+    UNITY_BEGIN();
+
+    // 1. Ring
+    RUN_TEST(test_ring_round_trip);
+    RUN_TEST(test_ring_begin_returns_slot_storage);
+    RUN_TEST(test_ring_not_yet_committed);
+    RUN_TEST(test_ring_wrap_overwrites_oldest);
+    RUN_TEST(test_ring_slot_being_rewritten_is_unreadable);
+    RUN_TEST(test_ring_snr_quantised_and_clamped);
+
+    // 2. LoRaTap
+    RUN_TEST(test_loratap_header_layout);
+    RUN_TEST(test_loratap_rssi_and_snr_limits);
+
+    // 3. pcap stream
+    RUN_TEST(test_pcap_empty_ring_is_file_header_only);
+    RUN_TEST(test_pcap_records);
+    RUN_TEST(test_pcap_chunk_size_does_not_matter);
+    RUN_TEST(test_pcap_snapshot_excludes_later_frames);
+    RUN_TEST(test_pcap_frames_overwritten_mid_export_are_counted);
+
+    // 4. Hot path
+    RUN_TEST(test_capture_and_export_never_allocate);
+
+    // 5. Concurrency
+    RUN_TEST(test_concurrent_reader_sees_no_torn_frames);
+
+    return UNITY_END();
+}
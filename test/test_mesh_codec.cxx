@@ -25,10 +25,16 @@
  *  15. mc_parseNodeStatus     — NODE_STATUS_APP portnum 36 (node status string)
  *  16. mc_parsePkiReport / mc_encodePkiReport — KEY_VERIFICATION_APP portnum 12
  *  17. ALERT_APP portnum 11   — portnum value + MeshMessage.isAlert flag
+ *  18. mc_encodeMapReport     — hasPosition=false identity-only report
+ *  19. PbReader               — zero-copy wire-format cursor
+ *  20. mc_parseRouteDiscovery — TRACEROUTE_APP payload, packed + unpacked
+ *  21. PbWriter / bounded encoders — sizing pass, cap overflow, nested submessages
  */
 
 #include "unity.h"
 #include "mesh_codec.h"
+#include "pb_reader.h"
+#include "pb_writer.h"
 #include <cstring>
 #include <cstdint>
 #include <climits>
@@ -1857,6 +1863,28 @@ void test_telemetry_channel_util_and_air_util_emitted(void)
     TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.0f, au);
 }
 
+void test_telemetry_channel_util_and_air_util_values(void)
+{
+    // Airtime ledger figures land in fields 3 and 4 as IEEE floats.
+    uint8_t buf[64] = {};
+    size_t n = mc_encodeTelemetry(buf, sizeof(buf), 100, 3600, 50, 3.7f, 12.5f, 0.75f);
+    TEST_ASSERT_GREATER_THAN(0u, n);
+
+    const int idx3 = findTag(buf + 7, n - 7, 0x1D);
+    const int idx4 = findTag(buf + 7, n - 7, 0x25);
+    TEST_ASSERT_NOT_EQUAL(-1, idx3);
+    TEST_ASSERT_NOT_EQUAL(-1, idx4);
+
+    float ch; memcpy(&ch, buf + 7 + idx3 + 1, 4);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 12.5f, ch);
+    float au; memcpy(&au, buf + 7 + idx4 + 1, 4);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.75f, au);
+
+    // Same length as the all-zero encoding: both fields are fixed32.
+    uint8_t ref[64] = {};
+    TEST_ASSERT_EQUAL_size_t(mc_encodeTelemetry(ref, sizeof(ref), 100, 3600, 50, 3.7f), n);
+}
+
 void test_encodeUser_id_format(void)
 {
     // Verify the id string format is "!xxxxxxxx" (lowercase hex, 9 chars)
@@ -2247,6 +2275,396 @@ void test_encodeMapReport_no_position_keeps_identity_fields(void)
         "field 7 (has_default_channel) must be present even without position");
 }
 
+// ─────────────────────────────────────────────────────────────────────────
+// 19. PbReader — zero-copy wire-format cursor
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_pbreader_yields_fields_in_order(void)
+{
+    // varint 1=150, LEN 2="hi", fixed32 3=0xDEADBEEF, fixed64 4=1
+    const uint8_t data[] = {
+        0x08, 0x96, 0x01,
+        0x12, 0x02, 'h', 'i',
+        0x1D, 0xEF, 0xBE, 0xAD, 0xDE,
+        0x21, 0x01, 0, 0, 0, 0, 0, 0, 0,
+    };
+    PbReader r(data, sizeof(data));
+    PbField  f;
+
+    TEST_ASSERT_TRUE(r.next(f));
+    TEST_ASSERT_TRUE(f.is(1, PB_WT_VARINT));
+    TEST_ASSERT_EQUAL_UINT32(150u, f.u32());
+
+    TEST_ASSERT_TRUE(r.next(f));
+    TEST_ASSERT_TRUE(f.is(2, PB_WT_LEN));
+    TEST_ASSERT_EQUAL_size_t(2u, f.len);
+    TEST_ASSERT_EQUAL_PTR(data + 5, f.data);    // span into the source, no copy
+
+    TEST_ASSERT_TRUE(r.next(f));
+    TEST_ASSERT_TRUE(f.is(3, PB_WT_FIXED32));
+    TEST_ASSERT_EQUAL_HEX32(0xDEADBEEFu, f.u32());
+
+    TEST_ASSERT_TRUE(r.next(f));
+    TEST_ASSERT_TRUE(f.is(4, PB_WT_FIXED64));
+    TEST_ASSERT_EQUAL_UINT32(1u, f.u32());
+
+    TEST_ASSERT_FALSE(r.next(f));
+    TEST_ASSERT_FALSE(r.failed());
+    TEST_ASSERT_TRUE(r.atEnd());
+}
+
+void test_pbreader_multibyte_tag(void)
+{
+    // Field 18 varint (tag 0x90 0x01) = 32 — precision_bits in Position
+    const uint8_t data[] = { 0x90, 0x01, 0x20 };
+    PbReader r(data, sizeof(data));
+    PbField  f;
+    TEST_ASSERT_TRUE(r.next(f));
+    TEST_ASSERT_TRUE(f.is(18, PB_WT_VARINT));
+    TEST_ASSERT_EQUAL_UINT32(32u, f.u32());
+}
+
+void test_pbreader_negative_int32_ten_byte_varint(void)
+{
+    uint8_t buf[16] = { 0x18 };
+    size_t n = 1 + mc_pbVarint(buf + 1, static_cast<uint64_t>(static_cast<int64_t>(-10)));
+    TEST_ASSERT_EQUAL_size_t(11u, n);
+    PbReader r(buf, n);
+    PbField  f;
+    TEST_ASSERT_TRUE(r.next(f));
+    TEST_ASSERT_EQUAL_INT32(-10, f.i32());
+}
+
+void test_pbreader_rejects_overlong_varint(void)
+{
+    const uint8_t data[] = { 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+                             0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01 };
+    PbReader r(data, sizeof(data));
+    PbField  f;
+    TEST_ASSERT_FALSE(r.next(f));
+    TEST_ASSERT_TRUE(r.failed());
+}
+
+void test_pbreader_rejects_len_past_end(void)
+{
+    const uint8_t data[] = { 0x12, 0x05, 'a', 'b' };
+    PbReader r(data, sizeof(data));
+    PbField  f;
+    TEST_ASSERT_FALSE(r.next(f));
+    TEST_ASSERT_TRUE(r.failed());
+}
+
+void test_pbreader_rejects_group_wire_types(void)
+{
+    const uint8_t start[] = { 0x0B };   // field 1, wire type 3
+    const uint8_t end[]   = { 0x0C };   // field 1, wire type 4
+    PbField f;
+    PbReader r1(start, sizeof(start));
+    TEST_ASSERT_FALSE(r1.next(f));
+    TEST_ASSERT_TRUE(r1.failed());
+    PbReader r2(end, sizeof(end));
+    TEST_ASSERT_FALSE(r2.next(f));
+    TEST_ASSERT_TRUE(r2.failed());
+}
+
+void test_pbreader_empty_and_null_input(void)
+{
+    PbField  f;
+    PbReader r1(nullptr, 0);
+    TEST_ASSERT_FALSE(r1.next(f));
+    TEST_ASSERT_FALSE(r1.failed());
+    const uint8_t one[] = { 0x08 };
+    PbReader r2(one, 0);
+    TEST_ASSERT_FALSE(r2.next(f));
+    TEST_ASSERT_FALSE(r2.failed());
+}
+
+void test_pbreader_packed_elements(void)
+{
+    const uint8_t packed[] = { 0x01, 0x96, 0x01, 0x7F };
+    PbReader r(packed, sizeof(packed));
+    uint64_t v = 0;
+    TEST_ASSERT_TRUE(r.readVarint(v));  TEST_ASSERT_EQUAL_UINT32(1u, (uint32_t)v);
+    TEST_ASSERT_TRUE(r.readVarint(v));  TEST_ASSERT_EQUAL_UINT32(150u, (uint32_t)v);
+    TEST_ASSERT_TRUE(r.readVarint(v));  TEST_ASSERT_EQUAL_UINT32(127u, (uint32_t)v);
+    TEST_ASSERT_FALSE(r.readVarint(v));
+    TEST_ASSERT_FALSE(r.failed());
+
+    const uint8_t fixed[] = { 1, 0, 0, 0, 2, 0 };   // one full element + 2 stray bytes
+    PbReader rf(fixed, sizeof(fixed));
+    uint32_t x = 0;
+    TEST_ASSERT_TRUE(rf.readFixed32(x));  TEST_ASSERT_EQUAL_UINT32(1u, x);
+    TEST_ASSERT_FALSE(rf.readFixed32(x));
+    TEST_ASSERT_TRUE(rf.failed());
+}
+
+void test_parse_user_truncated_tag_returns_false(void)
+{
+    // id field followed by a dangling continuation byte: malformed.
+    const uint8_t data[] = { 0x0A, 0x02, '!', 'a', 0x80 };
+    MeshUser user = {};
+    TEST_ASSERT_FALSE(mc_parseUser(data, sizeof(data), user));
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 20. mc_parseRouteDiscovery — TRACEROUTE_APP payload
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_parseRouteDiscovery_unpacked(void)
+{
+    // route=[0x433B8A21], snr_towards=[-40] (zigzag 79), unpacked tags 0x0D / 0x10
+    const uint8_t data[] = { 0x0D, 0x21, 0x8A, 0x3B, 0x43, 0x10, 0x4F };
+    MeshRouteDiscovery rd;
+    TEST_ASSERT_TRUE(mc_parseRouteDiscovery(data, sizeof(data), rd));
+    TEST_ASSERT_EQUAL_size_t(1u, rd.routeLen);
+    TEST_ASSERT_EQUAL_HEX32(0x433B8A21u, rd.route[0]);
+    TEST_ASSERT_EQUAL_size_t(1u, rd.snrLen);
+    TEST_ASSERT_EQUAL_INT32(-40, rd.snrTowards[0]);
+}
+
+void test_parseRouteDiscovery_packed(void)
+{
+    // Packed encoding as emitted by nanopb: 0x0A len [fixed32…], 0x12 len [varint…]
+    const uint8_t data[] = {
+        0x0A, 0x08, 0x21, 0x8A, 0x3B, 0x43, 0xCD, 0x34, 0xAB, 0x12,
+        0x12, 0x02, 0x30, 0x11,          // 24, -9
+    };
+    MeshRouteDiscovery rd;
+    TEST_ASSERT_TRUE(mc_parseRouteDiscovery(data, sizeof(data), rd));
+    TEST_ASSERT_EQUAL_size_t(2u, rd.routeLen);
+    TEST_ASSERT_EQUAL_HEX32(0x433B8A21u, rd.route[0]);
+    TEST_ASSERT_EQUAL_HEX32(0x12AB34CDu, rd.route[1]);
+    TEST_ASSERT_EQUAL_size_t(2u, rd.snrLen);
+    TEST_ASSERT_EQUAL_INT32(24, rd.snrTowards[0]);
+    TEST_ASSERT_EQUAL_INT32(-9, rd.snrTowards[1]);
+}
+
+void test_parseRouteDiscovery_empty_is_valid(void)
+{
+    MeshRouteDiscovery rd;
+    TEST_ASSERT_TRUE(mc_parseRouteDiscovery(nullptr, 0, rd));
+    TEST_ASSERT_EQUAL_size_t(0u, rd.routeLen);
+    TEST_ASSERT_EQUAL_size_t(0u, rd.snrLen);
+}
+
+void test_parseRouteDiscovery_caps_at_route_max(void)
+{
+    uint8_t buf[5 * (MC_ROUTE_MAX + 3)] = {};
+    size_t  n = 0;
+    for (uint32_t i = 0; i < MC_ROUTE_MAX + 3; i++)
+    {
+        buf[n++] = 0x0D;
+        buf[n++] = static_cast<uint8_t>(i + 1);
+        buf[n++] = 0; buf[n++] = 0; buf[n++] = 0;
+    }
+    MeshRouteDiscovery rd;
+    TEST_ASSERT_TRUE(mc_parseRouteDiscovery(buf, n, rd));
+    TEST_ASSERT_EQUAL_size_t(MC_ROUTE_MAX, rd.routeLen);
+    TEST_ASSERT_EQUAL_HEX32(MC_ROUTE_MAX, rd.route[MC_ROUTE_MAX - 1]);
+}
+
+void test_parseRouteDiscovery_truncated_keeps_prefix(void)
+{
+    const uint8_t data[] = { 0x0D, 0x01, 0x00, 0x00, 0x00, 0x0D, 0x02, 0x00 };
+    MeshRouteDiscovery rd;
+    TEST_ASSERT_FALSE(mc_parseRouteDiscovery(data, sizeof(data), rd));
+    TEST_ASSERT_EQUAL_size_t(1u, rd.routeLen);
+    TEST_ASSERT_EQUAL_HEX32(1u, rd.route[0]);
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 21. PbWriter / bounded encoders
+// ─────────────────────────────────────────────────────────────────────────
+
+static const uint8_t kMac[6] = { 0x48, 0xCA, 0x43, 0x01, 0x02, 0x03 };
+
+void test_pbwriter_sizing_pass_touches_nothing(void)
+{
+    PbWriter w(nullptr, 0);
+    w.varint(1, 300);
+    w.fixed32(2, 0xDEADBEEF);
+    w.string(3, "abc");
+    TEST_ASSERT_TRUE(w.sizing());
+    TEST_ASSERT_FALSE(w.overflowed());
+    TEST_ASSERT_EQUAL_size_t(3u + 5u + 5u, w.finish());
+}
+
+void test_pbwriter_field_encodings(void)
+{
+    uint8_t buf[32] = {};
+    PbWriter w(buf, sizeof(buf));
+    w.int32(3, -1);          // 10-byte varint
+    w.sint32(2, -40);        // zigzag 79
+    w.boolean(9, false);
+    const uint8_t expect[] = {
+        0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01,
+        0x10, 0x4F,
+        0x48, 0x00,
+    };
+    TEST_ASSERT_EQUAL_size_t(sizeof(expect), w.finish());
+    TEST_ASSERT_EQUAL_MEMORY(expect, buf, sizeof(expect));
+}
+
+void test_pbwriter_multibyte_tag(void)
+{
+    uint8_t buf[4] = {};
+    PbWriter w(buf, sizeof(buf));
+    w.varint(18, 32);        // precision_bits: tag 0x90 0x01
+    TEST_ASSERT_EQUAL_size_t(3u, w.finish());
+    TEST_ASSERT_EQUAL_HEX8(0x90, buf[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x01, buf[1]);
+    TEST_ASSERT_EQUAL_HEX8(0x20, buf[2]);
+}
+
+void test_pbwriter_overflow_latches(void)
+{
+    uint8_t buf[8];
+    memset(buf, 0xAA, sizeof(buf));
+    PbWriter w(buf, 4);
+    w.fixed32(1, 0x01020304);        // 5 bytes into cap 4 — rejected whole
+    w.varint(2, 1);                  // would fit, but overflow is latched
+    TEST_ASSERT_TRUE(w.overflowed());
+    TEST_ASSERT_EQUAL_size_t(0u, w.finish());
+    for (size_t i = 4; i < sizeof(buf); i++)
+        TEST_ASSERT_EQUAL_HEX8(0xAA, buf[i]);
+}
+
+void test_pbwriter_nested_message_length(void)
+{
+    uint8_t buf[32] = {};
+    PbWriter w(buf, sizeof(buf));
+    w.message(2, [](PbWriter& m) {
+        m.varint(1, 50);
+        m.message(3, [](PbWriter& mm) { mm.varint(1, 1); });
+    });
+    const uint8_t expect[] = { 0x12, 0x06, 0x08, 0x32, 0x1A, 0x02, 0x08, 0x01 };
+    TEST_ASSERT_EQUAL_size_t(sizeof(expect), w.finish());
+    TEST_ASSERT_EQUAL_MEMORY(expect, buf, sizeof(expect));
+}
+
+void test_encoders_null_buf_returns_exact_size(void)
+{
+    uint8_t buf[256];
+
+    TEST_ASSERT_EQUAL_size_t(
+        mc_encodePosition(buf, sizeof(buf), 377749290, -1224194160, 52, 9,
+                          1700000000u, 1234, 27000),
+        mc_encodePosition(nullptr, 0, 377749290, -1224194160, 52, 9,
+                          1700000000u, 1234, 27000));
+
+    TEST_ASSERT_EQUAL_size_t(
+        mc_encodeUser(buf, sizeof(buf), 0xDEADBEEF, "Heltec Tracker", "HT",
+                      kMac, 48, 5, kTestPubKey),
+        mc_encodeUser(nullptr, 0, 0xDEADBEEF, "Heltec Tracker", "HT",
+                      kMac, 48, 5, kTestPubKey));
+
+    TEST_ASSERT_EQUAL_size_t(
+        mc_encodeTelemetry(buf, sizeof(buf), 1700000000u, 86400, 87, 4.05f),
+        mc_encodeTelemetry(nullptr, 0, 1700000000u, 86400, 87, 4.05f));
+
+    TEST_ASSERT_EQUAL_size_t(
+        mc_encodeMapReport(buf, sizeof(buf), "Heltec Tracker", "HT",
+                           377749290, -1224194160, 52, 7, 48, 1, 0, "2.7.15.0"),
+        mc_encodeMapReport(nullptr, 0, "Heltec Tracker", "HT",
+                           377749290, -1224194160, 52, 7, 48, 1, 0, "2.7.15.0"));
+
+    TEST_ASSERT_EQUAL_size_t(
+        mc_encodePkiReport(buf, sizeof(buf), kTestPubKey, 0x12345678u),
+        mc_encodePkiReport(nullptr, 0, kTestPubKey, 0x12345678u));
+}
+
+void test_encoders_fail_one_byte_short_without_overrun(void)
+{
+    uint8_t buf[256];
+    const size_t sizes[] = {
+        mc_encodePosition(nullptr, 0, 1, 2, 3, 4, 5, 6, 7),
+        mc_encodeUser(nullptr, 0, 1, "Long", "LN", kMac, 48, 5, kTestPubKey),
+        mc_encodeTelemetry(nullptr, 0, 1, 2, 3, 3.7f),
+        mc_encodeMapReport(nullptr, 0, "Long", "LN", 1, 2, 3, 4, 48, 1, 0, "2.7.15.0"),
+        mc_encodePkiReport(nullptr, 0, kTestPubKey, 9),
+    };
+    for (size_t k = 0; k < sizeof(sizes) / sizeof(sizes[0]); k++)
+    {
+        const size_t cap = sizes[k] - 1;
+        memset(buf, 0xAA, sizeof(buf));
+        size_t n = 0;
+        switch (k)
+        {
+        case 0: n = mc_encodePosition(buf, cap, 1, 2, 3, 4, 5, 6, 7); break;
+        case 1: n = mc_encodeUser(buf, cap, 1, "Long", "LN", kMac, 48, 5, kTestPubKey); break;
+        case 2: n = mc_encodeTelemetry(buf, cap, 1, 2, 3, 3.7f); break;
+        case 3: n = mc_encodeMapReport(buf, cap, "Long", "LN", 1, 2, 3, 4, 48, 1, 0, "2.7.15.0"); break;
+        case 4: n = mc_encodePkiReport(buf, cap, kTestPubKey, 9); break;
+        }
+        TEST_ASSERT_EQUAL_size_t(0u, n);
+        for (size_t i = cap; i < sizeof(buf); i++)
+            TEST_ASSERT_EQUAL_HEX8(0xAA, buf[i]);
+    }
+}
+
+void test_encodeData_exact_cap_succeeds(void)
+{
+    const uint8_t payload[] = { 0x01, 0x02, 0x03 };
+    const size_t need = mc_encodeData(nullptr, 0, 67, payload, sizeof(payload), true, 0x11, 0x22);
+    uint8_t buf[64];
+    TEST_ASSERT_EQUAL_size_t(need, mc_encodeData(buf, need, 67, payload, sizeof(payload),
+                                                 true, 0x11, 0x22));
+    TEST_ASSERT_EQUAL_size_t(0u, mc_encodeData(buf, need - 1, 67, payload, sizeof(payload),
+                                               true, 0x11, 0x22));
+}
+
+void test_writeData_nested_position_matches_two_step(void)
+{
+    // Data{Position} written in one pass must equal encode-then-wrap.
+    uint8_t posBuf[64], twoStep[128], onePass[128];
+    const size_t posLen = mc_encodePosition(posBuf, sizeof(posBuf),
+                                            377749290, -1224194160, 52, 9, 1700000000u);
+    const size_t twoLen = mc_encodeData(twoStep, sizeof(twoStep), 3, posBuf, posLen);
+
+    PbWriter w(onePass, sizeof(onePass));
+    mc_writeData(w, 3, [](PbWriter& p) {
+        mc_writePosition(p, 377749290, -1224194160, 52, 9, 1700000000u);
+    });
+    TEST_ASSERT_EQUAL_size_t(twoLen, w.finish());
+    TEST_ASSERT_EQUAL_MEMORY(twoStep, onePass, twoLen);
+}
+
+void test_writeData_nested_overflow_writes_nothing_past_cap(void)
+{
+    uint8_t buf[64];
+    memset(buf, 0xAA, sizeof(buf));
+    PbWriter w(buf, 20);                 // Data{Telemetry} needs 34 bytes
+    mc_writeData(w, 67, [](PbWriter& p) {
+        mc_writeTelemetry(p, 1700000000u, 86400, 87, 4.05f);
+    });
+    TEST_ASSERT_EQUAL_size_t(0u, w.finish());
+    for (size_t i = 20; i < sizeof(buf); i++)
+        TEST_ASSERT_EQUAL_HEX8(0xAA, buf[i]);
+}
+
+void test_writeRouteDiscovery_roundtrip(void)
+{
+    MeshRouteDiscovery in;
+    in.route[0] = 0x433B8A21u; in.route[1] = 0x12AB34CDu; in.routeLen = 2;
+    in.snrTowards[0] = -40;    in.snrTowards[1] = 24;     in.snrLen   = 2;
+
+    uint8_t buf[32] = {};
+    PbWriter w(buf, sizeof(buf));
+    mc_writeRouteDiscovery(w, in);
+    const size_t n = w.finish();
+    TEST_ASSERT_EQUAL_size_t(2u * 5u + 2u * 2u, n);
+    TEST_ASSERT_EQUAL_HEX8(0x0D, buf[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x10, buf[10]);
+    TEST_ASSERT_EQUAL_HEX8(0x4F, buf[11]);      // zigzag(-40)
+
+    MeshRouteDiscovery out;
+    TEST_ASSERT_TRUE(mc_parseRouteDiscovery(buf, n, out));
+    TEST_ASSERT_EQUAL_size_t(2u, out.routeLen);
+    TEST_ASSERT_EQUAL_HEX32(0x12AB34CDu, out.route[1]);
+    TEST_ASSERT_EQUAL_INT32(-40, out.snrTowards[0]);
+    TEST_ASSERT_EQUAL_INT32(24, out.snrTowards[1]);
+}
+
 // ─────────────────────────────────────────────────────────────────────────
 // Main
 // ─────────────────────────────────────────────────────────────────────────
@@ -2357,6 +2775,7 @@ int main(void)
     RUN_TEST(test_telemetry_large_uptime);
     // 2.7.x: DeviceMetrics fields 3 and 4 (channel_utilization, air_util_tx)
     RUN_TEST(test_telemetry_channel_util_and_air_util_emitted);
+    RUN_TEST(test_telemetry_channel_util_and_air_util_values);
 
     // 11. mc_encodeMapReport — field presence, firmware_version (2.7.x field 4)
     RUN_TEST(test_encodeMapReport_all_fields_present);
@@ -2426,5 +2845,36 @@ int main(void)
     RUN_TEST(test_encodeMapReport_no_position_omits_latlon);
     RUN_TEST(test_encodeMapReport_no_position_keeps_identity_fields);
 
+    // 19. PbReader — zero-copy wire-format cursor
+    RUN_TEST(test_pbreader_yields_fields_in_order);
+    RUN_TEST(test_pbreader_multibyte_tag);
+    RUN_TEST(test_pbreader_negative_int32_ten_byte_varint);
+    RUN_TEST(test_pbreader_rejects_overlong_varint);
+    RUN_TEST(test_pbreader_rejects_len_past_end);
+    RUN_TEST(test_pbreader_rejects_group_wire_types);
+    RUN_TEST(test_pbreader_empty_and_null_input);
+    RUN_TEST(test_pbreader_packed_elements);
+    RUN_TEST(test_parse_user_truncated_tag_returns_false);
+
+    // 20. mc_parseRouteDiscovery — TRACEROUTE_APP payload
+    RUN_TEST(test_parseRouteDiscovery_unpacked);
+    RUN_TEST(test_parseRouteDiscovery_packed);
+    RUN_TEST(test_parseRouteDiscovery_empty_is_valid);
+    RUN_TEST(test_parseRouteDiscovery_caps_at_route_max);
+    RUN_TEST(test_parseRouteDiscovery_truncated_keeps_prefix);
+
+    // 21. PbWriter / bounded encoders
+    RUN_TEST(test_pbwriter_sizing_pass_touches_nothing);
+    RUN_TEST(test_pbwriter_field_encodings);
+    RUN_TEST(test_pbwriter_multibyte_tag);
+    RUN_TEST(test_pbwriter_overflow_latches);
+    RUN_TEST(test_pbwriter_nested_message_length);
+    RUN_TEST(test_encoders_null_buf_returns_exact_size);
+    RUN_TEST(test_encoders_fail_one_byte_short_without_overrun);
+    RUN_TEST(test_encodeData_exact_cap_succeeds);
+    RUN_TEST(test_writeData_nested_position_matches_two_step);
+    RUN_TEST(test_writeData_nested_overflow_writes_nothing_past_cap);
+    RUN_TEST(test_writeRouteDiscovery_roundtrip);
+
     return UNITY_END();
 }
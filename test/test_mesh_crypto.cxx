@@ -35,12 +35,14 @@
  *  7. mc_pkcEncrypt/Decrypt   — PKC DM encrypt/decrypt round-trips (AES-256-CCM)
  *  8. Full Meshtastic OTA frame — encode→encrypt→decrypt→parse
  *  9. Channel-hash computation — verify DEFAULT_CHAN_HASH = 0x08
+ * 10. mc_pkcKeyCache*        — PKC session-key cache hit/miss equivalence
  */
 
 #include "unity.h"
 #include "mesh_crypto.h"
 #include "mesh_codec.h"
 
+#include <cstdio>
 #include <cstring>
 #include <cstdint>
 
@@ -97,6 +99,167 @@ void test_x25519_rfc5_2_iterated_1(void)
         "RFC 7748 §5.2 iterated (1 round) must match");
 }
 
+void test_x25519_rfc5_2_vector2(void)
+{
+    // RFC 7748 §5.2 test vector 2 — input u has bit 255 set, which must
+    // be masked off before use.
+    const uint8_t scalar[32] = {
+        0x4b,0x66,0xe9,0xd4, 0xd1,0xb4,0x67,0x3c,
+        0x5a,0xd2,0x26,0x91, 0x95,0x7d,0x6a,0xf5,
+        0xc1,0x1b,0x64,0x21, 0xe0,0xea,0x01,0xd4,
+        0x2c,0xa4,0x16,0x9e, 0x79,0x18,0xba,0x0d
+    };
+    const uint8_t u_in[32] = {
+        0xe5,0x21,0x0f,0x12, 0x78,0x68,0x11,0xd3,
+        0xf4,0xb7,0x95,0x9d, 0x05,0x38,0xae,0x2c,
+        0x31,0xdb,0xe7,0x10, 0x6f,0xc0,0x3c,0x3e,
+        0xfc,0x4c,0xd5,0x49, 0xc7,0x15,0xa4,0x93
+    };
+    const uint8_t expected[32] = {
+        0x95,0xcb,0xde,0x94, 0x76,0xe8,0x90,0x7d,
+        0x7a,0xad,0xe4,0x5c, 0xb4,0xb8,0x73,0xf8,
+        0x8b,0x59,0x5a,0x68, 0x79,0x9f,0xa1,0x52,
+        0xe6,0xf8,0xf7,0x64, 0x7a,0xac,0x79,0x57
+    };
+    uint8_t out[32] = {};
+    mc_x25519SharedSecret(scalar, u_in, out);
+    TEST_ASSERT_EQUAL_MEMORY_MESSAGE(expected, out, 32,
+        "RFC 7748 §5.2 vector 2 must match");
+}
+
+void test_x25519_rfc5_2_iterated_1000(void)
+{
+    // RFC 7748 §5.2 iterated test, 1000 rounds: k, u ← X25519(k, u), k.
+    uint8_t k[32] = {9};
+    uint8_t u[32] = {9};
+    for (int i = 0; i < 1000; i++) {
+        uint8_t r[32];
+        mc_x25519SharedSecret(k, u, r);
+        memcpy(u, k, 32);
+        memcpy(k, r, 32);
+    }
+    const uint8_t expected[32] = {
+        0x68,0x4c,0xf5,0x9b, 0xa8,0x33,0x09,0x55,
+        0x28,0x00,0xef,0x56, 0x6f,0x2f,0x4d,0x3c,
+        0x1c,0x38,0x87,0xc4, 0x93,0x60,0xe3,0x87,
+        0x5f,0x2e,0xb9,0x4d, 0x99,0x53,0x2c,0x51
+    };
+    TEST_ASSERT_EQUAL_MEMORY_MESSAGE(expected, k, 32,
+        "RFC 7748 §5.2 iterated (1000 rounds) must match");
+}
+
+// RFC 7748 §6.1 Diffie-Hellman vectors (values cross-checked with
+// test/verify_rfc7748.py).
+static const uint8_t RFC6_1_ALICE_PRIV[32] = {
+    0x77,0x07,0x6d,0x0a, 0x73,0x18,0xa5,0x7d,
+    0x3c,0x16,0xc1,0x72, 0x51,0xb2,0x66,0x45,
+    0xdf,0x4c,0x2f,0x87, 0xeb,0xc0,0x99,0x2a,
+    0xb1,0x77,0xfb,0xa5, 0x1d,0xb9,0x2c,0x2a
+};
+static const uint8_t RFC6_1_ALICE_PUB[32] = {
+    0x85,0x20,0xf0,0x09, 0x89,0x30,0xa7,0x54,
+    0x74,0x8b,0x7d,0xdc, 0xb4,0x3e,0xf7,0x5a,
+    0x0d,0xbf,0x3a,0x0d, 0x26,0x38,0x1a,0xf4,
+    0xeb,0xa4,0xa9,0x8e, 0xaa,0x9b,0x4e,0x6a
+};
+static const uint8_t RFC6_1_BOB_PRIV[32] = {
+    0x5d,0xab,0x08,0x7e, 0x62,0x4a,0x8a,0x4b,
+    0x79,0xe1,0x7f,0x8b, 0x83,0x80,0x0e,0xe6,
+    0x6f,0x3b,0xb1,0x29, 0x26,0x18,0xb6,0xfd,
+    0x1c,0x2f,0x8b,0x27, 0xff,0x88,0xe0,0xeb
+};
+static const uint8_t RFC6_1_BOB_PUB[32] = {
+    0xde,0x9e,0xdb,0x7d, 0x7b,0x7d,0xc1,0xb4,
+    0xd3,0x5b,0x61,0xc2, 0xec,0xe4,0x35,0x37,
+    0x3f,0x83,0x43,0xc8, 0x5b,0x78,0x67,0x4d,
+    0xad,0xfc,0x7e,0x14, 0x6f,0x88,0x2b,0x4f
+};
+static const uint8_t RFC6_1_SHARED[32] = {
+    0x4a,0x5d,0x9d,0x5b, 0xa4,0xce,0x2d,0xe1,
+    0x72,0x8e,0x3b,0xf4, 0x80,0x35,0x0f,0x25,
+    0xe0,0x7e,0x21,0xc9, 0x47,0xd1,0x9e,0x33,
+    0x76,0xf0,0x9b,0x3c, 0x1e,0x16,0x17,0x42
+};
+
+void test_x25519_rfc6_1_public_keys(void)
+{
+    uint8_t pubA[32] = {}, pubB[32] = {};
+    TEST_ASSERT_TRUE(mc_x25519PublicKey(RFC6_1_ALICE_PRIV, pubA));
+    TEST_ASSERT_TRUE(mc_x25519PublicKey(RFC6_1_BOB_PRIV, pubB));
+    TEST_ASSERT_EQUAL_MEMORY_MESSAGE(RFC6_1_ALICE_PUB, pubA, 32,
+        "RFC 7748 §6.1 Alice public key must match");
+    TEST_ASSERT_EQUAL_MEMORY_MESSAGE(RFC6_1_BOB_PUB, pubB, 32,
+        "RFC 7748 §6.1 Bob public key must match");
+}
+
+void test_x25519_rfc6_1_shared_secret(void)
+{
+    uint8_t ab[32] = {}, ba[32] = {};
+    TEST_ASSERT_TRUE(mc_x25519SharedSecret(RFC6_1_ALICE_PRIV, RFC6_1_BOB_PUB, ab));
+    TEST_ASSERT_TRUE(mc_x25519SharedSecret(RFC6_1_BOB_PRIV, RFC6_1_ALICE_PUB, ba));
+    TEST_ASSERT_EQUAL_MEMORY(RFC6_1_SHARED, ab, 32);
+    TEST_ASSERT_EQUAL_MEMORY(RFC6_1_SHARED, ba, 32);
+}
+
+void test_x25519_matches_mbedtls_random_inputs(void)
+{
+    // Differential check against mbedtls ECP Curve25519 over pseudo-random
+    // scalars and u-coordinates (xorshift32, fixed seed → reproducible).
+    uint32_t x = 0x2545F491;
+    auto next = [&x]() { x ^= x << 13; x ^= x >> 17; x ^= x << 5; return x; };
+
+    for (int round = 0; round < 32; round++) {
+        uint8_t k[32], u[32];
+        for (int i = 0; i < 32; i++) {
+            k[i] = static_cast<uint8_t>(next());
+            u[i] = static_cast<uint8_t>(next());
+        }
+        u[31] &= 0x7f;   // canonical u (< 2^255) — mbedtls does not mask
+
+        uint8_t ours[32] = {}, ref[32] = {};
+        mc_x25519SharedSecret(k, u, ours);
+        TEST_ASSERT_EQUAL_INT(0, mc_x25519SharedSecret_alt(k, u, ref));
+        TEST_ASSERT_EQUAL_MEMORY(ref, ours, 32);
+    }
+}
+
+void test_x25519_public_key_matches_ladder_random_scalars(void)
+{
+    // mc_x25519PublicKey may take a fixed-base (table) path; it must agree
+    // bit-for-bit with the generic ladder run on u = 9.
+    static const uint8_t basepoint[32] = {9};
+    uint32_t x = 0x9E3779B9;
+    auto next = [&x]() { x ^= x << 13; x ^= x >> 17; x ^= x << 5; return x; };
+
+    for (int round = 0; round < 64; round++) {
+        uint8_t k[32];
+        for (int i = 0; i < 32; i++) k[i] = static_cast<uint8_t>(next());
+
+        uint8_t fixed[32] = {}, ladder[32] = {};
+        TEST_ASSERT_TRUE(mc_x25519PublicKey(k, fixed));
+        TEST_ASSERT_TRUE(mc_x25519SharedSecret(k, basepoint, ladder));
+        TEST_ASSERT_EQUAL_MEMORY(ladder, fixed, 32);
+    }
+}
+
+void test_x25519_public_key_matches_ladder_edge_scalars(void)
+{
+    // Clamping extremes: all-zero → 2^254, all-ones → 2^255 − 8, and a
+    // scalar whose every radix-16 digit is 8 (maximal signed carry chain).
+    static const uint8_t basepoint[32] = {9};
+    uint8_t scalars[3][32];
+    memset(scalars[0], 0x00, 32);
+    memset(scalars[1], 0xff, 32);
+    memset(scalars[2], 0x88, 32);
+
+    for (auto& k : scalars) {
+        uint8_t fixed[32] = {}, ladder[32] = {};
+        mc_x25519PublicKey(k, fixed);
+        mc_x25519SharedSecret(k, basepoint, ladder);
+        TEST_ASSERT_EQUAL_MEMORY(ladder, fixed, 32);
+    }
+}
+
 // ── Meshtastic DEFAULT_PSK ────────────────────────────────────────────────
 // The factory LongFast channel AES-128 key used by every unmodified
 // Meshtastic device.  Hardcoded here so tests are self-contained.
@@ -803,6 +966,213 @@ void test_channel_hash_combined(void)
     TEST_ASSERT_EQUAL_HEX8(0x08, nameXor ^ pskXor);
 }
 
+// ─────────────────────────────────────────────────────────────────────────
+// 10. PKC session-key cache (mc_pkcKeyCache*)
+//
+// A cache hit must hand back exactly the key a fresh ECDH + SHA-256 would
+// derive, so ciphertext / plaintext is byte-identical on both paths.  The
+// scalar-mult counter proves the hit path skips X25519 entirely.
+// ─────────────────────────────────────────────────────────────────────────
+
+static void _referencePkcKey(const uint8_t priv[32], const uint8_t pub[32],
+                             uint8_t key[32])
+{
+    uint8_t shared[32] = {};
+    TEST_ASSERT_TRUE(mc_x25519SharedSecret(priv, pub, shared));
+    TEST_ASSERT_TRUE(mc_sha256(shared, 32, key));
+}
+
+void test_pkc_key_cache_miss_then_hit_returns_reference_key(void)
+{
+    McPkcKeyCache cache;
+    uint8_t ref[32] = {}, k1[32] = {}, k2[32] = {};
+    _referencePkcKey(TEST_PRIV_B, TEST_PUB_A, ref);
+
+    TEST_ASSERT_TRUE(mc_pkcKeyCacheGet(cache, TEST_PRIV_B, 0xAAAA0001, TEST_PUB_A, k1));
+    TEST_ASSERT_EQUAL_UINT32(1u, cache.misses);
+    TEST_ASSERT_EQUAL_UINT32(0u, cache.hits);
+    TEST_ASSERT_EQUAL_MEMORY(ref, k1, 32);
+
+    TEST_ASSERT_TRUE(mc_pkcKeyCacheGet(cache, TEST_PRIV_B, 0xAAAA0001, TEST_PUB_A, k2));
+    TEST_ASSERT_EQUAL_UINT32(1u, cache.misses);
+    TEST_ASSERT_EQUAL_UINT32(1u, cache.hits);
+    TEST_ASSERT_EQUAL_MEMORY(ref, k2, 32);
+}
+
+void test_pkc_key_cache_hit_and_miss_decrypt_identically(void)
+{
+    const uint8_t pt[] = "cached session key";
+    const size_t  len  = sizeof(pt) - 1;
+    uint8_t ct[64 + MC_PKC_OVERHEAD] = {};
+    TEST_ASSERT_TRUE(mc_pkcEncrypt(TEST_PRIV_A, TEST_PUB_B, 0x1000, 0xAAAA0001,
+                                    0xBBBB0002, pt, len, ct));
+
+    McPkcKeyCache cache;
+    uint8_t key[32] = {}, outMiss[64] = {}, outHit[64] = {}, outRef[64] = {};
+
+    TEST_ASSERT_TRUE(mc_pkcKeyCacheGet(cache, TEST_PRIV_B, 0xAAAA0001, TEST_PUB_A, key));
+    TEST_ASSERT_TRUE(mc_pkcDecryptWithKey(key, 0x1000, 0xAAAA0001,
+                                           ct, len + MC_PKC_OVERHEAD, outMiss));
+
+    TEST_ASSERT_TRUE(mc_pkcKeyCacheGet(cache, TEST_PRIV_B, 0xAAAA0001, TEST_PUB_A, key));
+    TEST_ASSERT_EQUAL_UINT32(1u, cache.hits);
+    TEST_ASSERT_TRUE(mc_pkcDecryptWithKey(key, 0x1000, 0xAAAA0001,
+                                           ct, len + MC_PKC_OVERHEAD, outHit));
+
+    TEST_ASSERT_TRUE(mc_pkcDecrypt(TEST_PRIV_B, TEST_PUB_A, 0x1000, 0xAAAA0001,
+                                    ct, len + MC_PKC_OVERHEAD, outRef));
+
+    TEST_ASSERT_EQUAL_MEMORY(pt, outMiss, len);
+    TEST_ASSERT_EQUAL_MEMORY(outRef, outMiss, len);
+    TEST_ASSERT_EQUAL_MEMORY(outRef, outHit, len);
+}
+
+void test_pkc_key_cache_encrypt_matches_uncached(void)
+{
+    const uint8_t pt[24] = {0x08,0x01,0x12,0x14,'s','a','m','e',' ','w','i','r','e',
+                            ' ','b','y','t','e','s',' ','o','u','t','!'};
+    uint8_t ref[24 + MC_PKC_OVERHEAD] = {}, got[24 + MC_PKC_OVERHEAD] = {};
+    TEST_ASSERT_TRUE(mc_pkcEncrypt(TEST_PRIV_A, TEST_PUB_B, 0x2222, 0xAAAA0001,
+                                    0xBBBB0002, pt, sizeof(pt), ref));
+
+    McPkcKeyCache cache;
+    uint8_t key[32] = {};
+    for (int pass = 0; pass < 2; pass++) {   // pass 0 = miss, pass 1 = hit
+        TEST_ASSERT_TRUE(mc_pkcKeyCacheGet(cache, TEST_PRIV_A, 0xBBBB0002, TEST_PUB_B, key));
+        TEST_ASSERT_TRUE(mc_pkcEncryptWithKey(key, 0x2222, 0xAAAA0001,
+                                               pt, sizeof(pt), got));
+        TEST_ASSERT_EQUAL_MEMORY(ref, got, sizeof(ref));
+    }
+}
+
+void test_pkc_key_cache_key_rotation_is_a_miss(void)
+{
+    // Our private key stays the same; only the peer's public key changes.
+    McPkcKeyCache cache;
+    uint8_t k1[32] = {}, k2[32] = {}, k3[32] = {}, ref[32] = {};
+
+    TEST_ASSERT_TRUE(mc_pkcKeyCacheGet(cache, TEST_PRIV_A, 0x0C0FFEE0, TEST_PUB_B, k1));
+    // Same node id, different public key — must not reuse the old entry.
+    TEST_ASSERT_TRUE(mc_pkcKeyCacheGet(cache, TEST_PRIV_A, 0x0C0FFEE0, TEST_PUB_A, k2));
+    TEST_ASSERT_EQUAL_UINT32(2u, cache.misses);
+    TEST_ASSERT_EQUAL_UINT32(0u, cache.hits);
+
+    _referencePkcKey(TEST_PRIV_A, TEST_PUB_A, ref);
+    TEST_ASSERT_EQUAL_MEMORY(ref, k2, 32);
+
+    // The stale slot was replaced, not duplicated.
+    size_t occupied = 0;
+    for (size_t i = 0; i < MC_PKC_KEY_CACHE_MAX; i++)
+        if (cache.entries[i].occupied) occupied++;
+    TEST_ASSERT_EQUAL_size_t(1u, occupied);
+
+    // The new key is now the cached one.
+    TEST_ASSERT_TRUE(mc_pkcKeyCacheGet(cache, TEST_PRIV_A, 0x0C0FFEE0, TEST_PUB_A, k3));
+    TEST_ASSERT_EQUAL_UINT32(1u, cache.hits);
+    TEST_ASSERT_EQUAL_MEMORY(k2, k3, 32);
+}
+
+void test_pkc_key_cache_invalidate_zeroizes_entry(void)
+{
+    McPkcKeyCache cache;
+    uint8_t key[32] = {};
+    TEST_ASSERT_TRUE(mc_pkcKeyCacheGet(cache, TEST_PRIV_A, 0x12345678, TEST_PUB_B, key));
+
+    mc_pkcKeyCacheInvalidate(cache, 0x12345678);
+
+    static const uint8_t zero[32] = {};
+    for (size_t i = 0; i < MC_PKC_KEY_CACHE_MAX; i++) {
+        TEST_ASSERT_FALSE(cache.entries[i].occupied);
+        TEST_ASSERT_EQUAL_MEMORY(zero, cache.entries[i].key, 32);
+    }
+
+    // Next lookup re-derives.
+    TEST_ASSERT_TRUE(mc_pkcKeyCacheGet(cache, TEST_PRIV_A, 0x12345678, TEST_PUB_B, key));
+    TEST_ASSERT_EQUAL_UINT32(2u, cache.misses);
+}
+
+void test_pkc_key_cache_evicts_least_recently_used(void)
+{
+    McPkcKeyCache cache;
+    uint8_t key[32] = {};
+
+    // Fill the cache; the key material is irrelevant here, only the node ids.
+    for (uint32_t n = 1; n <= MC_PKC_KEY_CACHE_MAX; n++)
+        TEST_ASSERT_TRUE(mc_pkcKeyCacheGet(cache, TEST_PRIV_A, n, TEST_PUB_B, key));
+    // Touch node 1 so node 2 becomes the LRU entry.
+    TEST_ASSERT_TRUE(mc_pkcKeyCacheGet(cache, TEST_PRIV_A, 1, TEST_PUB_B, key));
+    TEST_ASSERT_EQUAL_UINT32(1u, cache.hits);
+
+    TEST_ASSERT_TRUE(mc_pkcKeyCacheGet(cache, TEST_PRIV_A, 0x99, TEST_PUB_B, key));
+
+    bool have1 = false, have2 = false, have99 = false;
+    for (size_t i = 0; i < MC_PKC_KEY_CACHE_MAX; i++) {
+        if (!cache.entries[i].occupied) continue;
+        have1  |= cache.entries[i].nodeId == 1;
+        have2  |= cache.entries[i].nodeId == 2;
+        have99 |= cache.entries[i].nodeId == 0x99;
+    }
+    TEST_ASSERT_TRUE(have1);
+    TEST_ASSERT_FALSE(have2);
+    TEST_ASSERT_TRUE(have99);
+}
+
+// Benchmark: X25519 scalar multiplications needed to decrypt 1000 DMs
+// spread round-robin over 4 peers.  Uncached = one per DM; cached = one
+// per peer.
+void test_pkc_key_cache_scalar_mults_per_1000_dms(void)
+{
+    static constexpr int    DMS   = 1000;
+    static constexpr size_t PEERS = 4;
+
+    uint8_t peerPriv[PEERS][32], peerPub[PEERS][32];
+    for (size_t p = 0; p < PEERS; p++) {
+        memcpy(peerPriv[p], TEST_PRIV_A, 32);
+        peerPriv[p][0] ^= static_cast<uint8_t>(p + 1);
+        TEST_ASSERT_TRUE(mc_x25519PublicKey(peerPriv[p], peerPub[p]));
+    }
+
+    // Pre-encrypt one DM per peer (Alice's peers → Bob).
+    const uint8_t pt[] = "benchmark DM";
+    const size_t  len  = sizeof(pt) - 1;
+    uint8_t ct[PEERS][32 + MC_PKC_OVERHEAD];
+    for (size_t p = 0; p < PEERS; p++)
+        TEST_ASSERT_TRUE(mc_pkcEncrypt(peerPriv[p], TEST_PUB_B, 0x7000 + (uint32_t)p,
+                                        0xA0000000 + (uint32_t)p, 0xBBBB0002,
+                                        pt, len, ct[p]));
+
+    uint8_t out[32] = {};
+
+    mc_x25519ResetScalarMultCount();
+    for (int i = 0; i < DMS; i++) {
+        const size_t p = (size_t)i % PEERS;
+        TEST_ASSERT_TRUE(mc_pkcDecrypt(TEST_PRIV_B, peerPub[p], 0x7000 + (uint32_t)p,
+                                        0xA0000000 + (uint32_t)p,
+                                        ct[p], len + MC_PKC_OVERHEAD, out));
+    }
+    const uint32_t uncached = mc_x25519ScalarMultCount();
+
+    McPkcKeyCache cache;
+    uint8_t key[32] = {};
+    mc_x25519ResetScalarMultCount();
+    for (int i = 0; i < DMS; i++) {
+        const size_t p = (size_t)i % PEERS;
+        TEST_ASSERT_TRUE(mc_pkcKeyCacheGet(cache, TEST_PRIV_B, 0xA0000000 + (uint32_t)p,
+                                            peerPub[p], key));
+        TEST_ASSERT_TRUE(mc_pkcDecryptWithKey(key, 0x7000 + (uint32_t)p,
+                                               0xA0000000 + (uint32_t)p,
+                                               ct[p], len + MC_PKC_OVERHEAD, out));
+        TEST_ASSERT_EQUAL_MEMORY(pt, out, len);
+    }
+    const uint32_t cached = mc_x25519ScalarMultCount();
+
+    printf("  scalar-mults per %d DMs (%zu peers): uncached=%u cached=%u\n",
+           DMS, PEERS, (unsigned)uncached, (unsigned)cached);
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)DMS, uncached);
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)PEERS, cached);
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)(DMS - PEERS), cache.hits);
+}
+
 // ─────────────────────────────────────────────────────────────────────────
 // Main
 // ─────────────────────────────────────────────────────────────────────────
@@ -811,9 +1181,16 @@ int main(void)
 {
     UNITY_BEGIN();
 
-    // 0. RFC 7748 §5.2 conformance — proves X25519 implementation is correct
+    // 0. RFC 7748 §5.2 / §6.1 conformance — proves X25519 implementation is correct
     RUN_TEST(test_x25519_rfc5_2_vector1);
     RUN_TEST(test_x25519_rfc5_2_iterated_1);
+    RUN_TEST(test_x25519_rfc5_2_vector2);
+    RUN_TEST(test_x25519_rfc5_2_iterated_1000);
+    RUN_TEST(test_x25519_rfc6_1_public_keys);
+    RUN_TEST(test_x25519_rfc6_1_shared_secret);
+    RUN_TEST(test_x25519_matches_mbedtls_random_inputs);
+    RUN_TEST(test_x25519_public_key_matches_ladder_random_scalars);
+    RUN_TEST(test_x25519_public_key_matches_ladder_edge_scalars);
 
     // 1. mc_buildNonce
     RUN_TEST(test_nonce_layout_packetid_le);
@@ -870,5 +1247,14 @@ int main(void)
     RUN_TEST(test_channel_hash_default_psk_xor);
     RUN_TEST(test_channel_hash_combined);
 
+    // 10. PKC session-key cache
+    RUN_TEST(test_pkc_key_cache_miss_then_hit_returns_reference_key);
+    RUN_TEST(test_pkc_key_cache_hit_and_miss_decrypt_identically);
+    RUN_TEST(test_pkc_key_cache_encrypt_matches_uncached);
+    RUN_TEST(test_pkc_key_cache_key_rotation_is_a_miss);
+    RUN_TEST(test_pkc_key_cache_invalidate_zeroizes_entry);
+    RUN_TEST(test_pkc_key_cache_evicts_least_recently_used);
+    RUN_TEST(test_pkc_key_cache_scalar_mults_per_1000_dms);
+
     return UNITY_END();
 }
@@ -0,0 +1,285 @@
+/**
+ * test_mesh_dedup.cxx — Unity tests for the time-windowed packet dedup filter.
+ *
+ * Run with: cmake -B build && cmake --build build && ctest --test-dir build -V
+ *
+ * Test groups
+ * ───────────
+ *   1. Basics                 — new vs duplicate, key includes sender, id 0
+ *   2. Window / rotation      — expiry, early rotation, idle reset, tick wrap
+ *   3. Flood replay           — 10k-packet synthetic flood, measured FP/FN
+ *                               rates against ground truth and the old ring
+ */
+
+#include "unity.h"
+#include "mesh_dedup.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+// ── Unity required entry points ───────────────────────────────────────────
+void setUp(void)    {}
+void tearDown(void) {}
+
+static constexpr uint32_t WINDOW = 600000;   // 10 min of 1 ms ticks
+
+static bool inExact(const McDedup& d, uint32_t from, uint32_t id)
+{
+    for (const McDedupSlot& s : d.exact)
+        if (s.id == id && s.from == from) return true;
+    return false;
+}
+
+// Record unrelated keys at tick until (from, id) drops out of the exact set,
+// staying below the generation capacity so no rotation is triggered.
+static void evictFromExact(McDedup& d, uint32_t from, uint32_t id, uint32_t tick)
+{
+    uint32_t n = 0;
+    while (inExact(d, from, id))
+    {
+        TEST_ASSERT_TRUE(d.curCount + 1 < MC_DEDUP_GEN_CAPACITY);
+        mc_dedupRecord(d, 0x2000 + n, 100 + n, tick);
+        n++;
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 1. Basics
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_first_sighting_is_new_then_exact(void)
+{
+    McDedup d;
+    mc_dedupInit(d, WINDOW);
+    TEST_ASSERT_TRUE(mc_dedupCheck(d, 0x433B8A21u, 0x1234u, 10) == McDedupResult::New);
+    TEST_ASSERT_TRUE(mc_dedupCheck(d, 0x433B8A21u, 0x1234u, 20) == McDedupResult::Exact);
+    TEST_ASSERT_EQUAL_UINT32(1u, d.exactHits);
+}
+
+void test_same_id_from_other_sender_is_new(void)
+{
+    McDedup d;
+    mc_dedupInit(d, WINDOW);
+    mc_dedupCheck(d, 0xAAAA0001u, 77, 1);
+    TEST_ASSERT_TRUE(mc_dedupCheck(d, 0xAAAA0002u, 77, 2) == McDedupResult::New);
+}
+
+void test_packet_id_zero_never_duplicate(void)
+{
+    McDedup d;
+    mc_dedupInit(d, WINDOW);
+    TEST_ASSERT_TRUE(mc_dedupCheck(d, 1, 0, 1) == McDedupResult::New);
+    TEST_ASSERT_TRUE(mc_dedupCheck(d, 1, 0, 2) == McDedupResult::New);
+}
+
+void test_record_marks_without_lookup(void)
+{
+    McDedup d;
+    mc_dedupInit(d, WINDOW);
+    mc_dedupRecord(d, 0xBEEF, 42, 5);
+    TEST_ASSERT_TRUE(mc_dedupCheck(d, 0xBEEF, 42, 6) == McDedupResult::Exact);
+}
+
+void test_bloom_catches_key_pushed_out_of_exact_set(void)
+{
+    McDedup d;
+    mc_dedupInit(d, WINDOW);
+    mc_dedupCheck(d, 0x1000, 1, 1);
+    evictFromExact(d, 0x1000, 1, 2);
+    TEST_ASSERT_TRUE(mc_dedupCheck(d, 0x1000, 1, 3) == McDedupResult::Probable);
+    // ...and is pulled back into the exact set for the next echo.
+    TEST_ASSERT_TRUE(mc_dedupCheck(d, 0x1000, 1, 4) == McDedupResult::Exact);
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 2. Window / rotation
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_exact_hit_past_window_is_new(void)
+{
+    McDedup d;
+    mc_dedupInit(d, 1000);
+    mc_dedupCheck(d, 7, 7, 0);
+    mc_dedupCheck(d, 8, 8, 999);          // keep a generation young
+    TEST_ASSERT_TRUE(mc_dedupCheck(d, 7, 7, 1000) == McDedupResult::New);
+}
+
+void test_key_retained_for_at_least_one_window(void)
+{
+    McDedup d;
+    mc_dedupInit(d, 1000);
+    mc_dedupCheck(d, 1, 100, 0);           // starts the first generation
+    mc_dedupCheck(d, 9, 9, 900);           // inserted just before rotation
+    mc_dedupCheck(d, 1, 1, 1000);          // rotates: key now in the old generation
+    TEST_ASSERT_EQUAL_UINT32(1u, d.rotations);
+    evictFromExact(d, 9, 9, 1000);
+    TEST_ASSERT_TRUE(mc_dedupCheck(d, 9, 9, 1899) == McDedupResult::Probable);
+}
+
+void test_idle_two_windows_forgets_everything(void)
+{
+    McDedup d;
+    mc_dedupInit(d, 1000);
+    mc_dedupCheck(d, 3, 3, 0);
+    evictFromExact(d, 3, 3, 1);
+    TEST_ASSERT_TRUE(mc_dedupCheck(d, 3, 3, 2001) == McDedupResult::New);
+}
+
+void test_generation_capacity_forces_rotation(void)
+{
+    McDedup d;
+    mc_dedupInit(d, WINDOW);
+    for (uint32_t i = 0; i < MC_DEDUP_GEN_CAPACITY + 1; i++)
+        mc_dedupRecord(d, 0x5000, 1 + i, 1);
+    TEST_ASSERT_EQUAL_UINT32(1u, d.rotations);
+}
+
+void test_tick_wrap(void)
+{
+    McDedup d;
+    mc_dedupInit(d, 1000);
+    mc_dedupCheck(d, 4, 4, 0xFFFFFF00u);
+    TEST_ASSERT_TRUE(mc_dedupCheck(d, 4, 4, 0x00000010u) == McDedupResult::Exact);
+    TEST_ASSERT_EQUAL_UINT32(0u, d.rotations);
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 3. Flood replay
+// ─────────────────────────────────────────────────────────────────────────
+
+// Synthetic busy mesh: 60 senders originate packets; each copy of a packet
+// reaches us 1–5 times (direct + neighbour rebroadcasts) with delays of up
+// to 90 s.  10 000 receptions total, ~1 reception per 400 ms.
+struct Rx { uint32_t tick, from, id; };
+
+static std::vector<Rx> makeFlood(uint32_t seed, size_t receptions)
+{
+    std::mt19937 rng(seed);
+    std::vector<Rx> rx;
+    uint32_t t = 1000;
+    uint32_t nextId[60] = {};
+    for (auto& n : nextId) n = rng();
+    while (rx.size() < receptions)
+    {
+        t += 200 + rng() % 1000;
+        const uint32_t node = rng() % 60;
+        const uint32_t from = 0x433B0000u + node;
+        uint32_t id = ++nextId[node];
+        if (id == 0) id = ++nextId[node];
+        const int copies = 1 + rng() % 5;
+        for (int c = 0; c < copies && rx.size() < receptions; c++)
+            rx.push_back({t + (c ? static_cast<uint32_t>(rng() % 90000) : 0u), from, id});
+    }
+    std::sort(rx.begin(), rx.end(), [](const Rx& a, const Rx& b) { return a.tick < b.tick; });
+    return rx;
+}
+
+struct FloodRates { size_t unique = 0, dups = 0, fp = 0, fn = 0; uint32_t rotations = 0; };
+
+static FloodRates replay(const std::vector<Rx>& rx)
+{
+    McDedup d;
+    mc_dedupInit(d, WINDOW);
+    std::map<std::pair<uint32_t, uint32_t>, uint32_t> lastSeen;   // ground truth
+    FloodRates r;
+    for (const Rx& p : rx)
+    {
+        const auto key = std::make_pair(p.from, p.id);
+        auto it = lastSeen.find(key);
+        // Truth: duplicate iff the previous sighting is within the window.
+        const bool isDup = it != lastSeen.end() && p.tick - it->second < WINDOW;
+        const bool saysDup = mc_dedupCheck(d, p.from, p.id, p.tick) != McDedupResult::New;
+        lastSeen[key] = p.tick;
+        if (isDup) { r.dups++;   if (!saysDup) r.fn++; }
+        else       { r.unique++; if (saysDup)  r.fp++; }
+    }
+    r.rotations = d.rotations;
+    return r;
+}
+
+void test_flood_replay_10k_fp_fn(void)
+{
+    const std::vector<Rx> rx = makeFlood(0xD0D0, 10000);
+    const FloodRates r = replay(rx);
+
+    // Reference: the previous 16-entry id ring.
+    uint32_t ring[16] = {};
+    size_t cur = 0, ringFn = 0;
+    std::map<std::pair<uint32_t, uint32_t>, bool> seen;
+    for (const Rx& p : rx)
+    {
+        bool hit = false;
+        for (uint32_t id : ring) hit |= (id == p.id);
+        const auto key = std::make_pair(p.from, p.id);
+        if (seen[key] && !hit) ringFn++;
+        if (!hit) { ring[cur] = p.id; cur = (cur + 1) % 16; }
+        seen[key] = true;
+    }
+
+    char msg[200];
+    snprintf(msg, sizeof(msg),
+             "10k flood: unique=%zu dup=%zu  FP=%zu (%.3f%%)  FN=%zu (%.3f%%)  "
+             "old 16-ring FN=%zu (%.1f%%)",
+             r.unique, r.dups, r.fp, 100.0 * r.fp / r.unique,
+             r.fn, 100.0 * r.fn / r.dups, ringFn, 100.0 * ringFn / r.dups);
+    TEST_MESSAGE(msg);
+
+    TEST_ASSERT_EQUAL_size_t(10000u, r.unique + r.dups);
+    TEST_ASSERT_TRUE(r.dups > 4000);
+    TEST_ASSERT_EQUAL_size_t(0u, r.fn);
+    TEST_ASSERT_TRUE(r.fp * 200 < r.unique);          // < 0.5 %
+    TEST_ASSERT_TRUE(ringFn > r.dups / 4);            // the ring really was the problem
+}
+
+void test_flood_replay_saturated_generation(void)
+{
+    // Nearly every packet unique and arriving fast: generations fill and
+    // rotate on capacity.  False positives must stay bounded.
+    std::vector<Rx> rx;
+    for (uint32_t i = 0; i < 10000; i++)
+        rx.push_back({1000 + i * 50, 0x10000000u + (i % 97), 1 + i});
+    for (uint32_t i = 0; i < 10000; i += 10)                        // 10 % echoes
+        rx.push_back({1000 + i * 50 + 20, 0x10000000u + (i % 97), 1 + i});
+    std::sort(rx.begin(), rx.end(), [](const Rx& a, const Rx& b) { return a.tick < b.tick; });
+    const FloodRates r = replay(rx);
+
+    char msg[120];
+    snprintf(msg, sizeof(msg), "saturated: unique=%zu dup=%zu FP=%zu FN=%zu rotations=%u",
+             r.unique, r.dups, r.fp, r.fn, (unsigned)r.rotations);
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_EQUAL_size_t(0u, r.fn);
+    TEST_ASSERT_TRUE(r.fp * 100 < r.unique);          // < 1 %
+    TEST_ASSERT_TRUE(r.rotations >= 10000u / MC_DEDUP_GEN_CAPACITY - 1);
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// Main
+// ─────────────────────────────────────────────────────────────────────────
+int main(void)
+{
+    UNITY_BEGIN();
+
+    // 1. Basics
+    RUN_TEST(test_first_sighting_is_new_then_exact);
+    RUN_TEST(test_same_id_from_other_sender_is_new);
+    RUN_TEST(test_packet_id_zero_never_duplicate);
+    RUN_TEST(test_record_marks_without_lookup);
+    RUN_TEST(test_bloom_catches_key_pushed_out_of_exact_set);
+
+    // 2. Window / rotation
+    RUN_TEST(test_exact_hit_past_window_is_new);
+    RUN_TEST(test_key_retained_for_at_least_one_window);
+    RUN_TEST(test_idle_two_windows_forgets_everything);
+    RUN_TEST(test_generation_capacity_forces_rotation);
+    RUN_TEST(test_tick_wrap);
+
+    // 3. Flood replay
+    RUN_TEST(test_flood_replay_10k_fp_fn);
+    RUN_TEST(test_flood_replay_saturated_generation);
+
+    return UNITY_END();
+}
@@ -0,0 +1,325 @@
+/**
+ * test_mesh_inbox.cxx — Unity tests for the LoRa → display message inbox.
+ *
+ * Run with: cmake -B build && cmake --build build && ctest --test-dir build -V
+ *
+ * Built with MC_INBOX_DEPTH=4 so overflow is cheap to reach.
+ *
+ * Test groups
+ * ───────────
+ *   1. Push / get             — sequence numbers, wrap overwrites the oldest
+ *   2. Unread                 — oldest first, read mark, deliberate skips
+ *   3. Overflow               — only unread messages count, seen before the consumer looks
+ *   4. Paging                 — walking back through read messages
+ *   5. Races                  — producer and consumer threads: order, no torn
+ *                               messages, every message shown or counted lost
+ */
+
+#include "unity.h"
+#include "mesh_inbox.h"
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+
+// ── Unity required entry points ───────────────────────────────────────────
+void setUp(void)    {}
+void tearDown(void) {}
+
+/// Message @p n: fromNode and text both carry n, so a torn copy shows.
+static MeshMessage make(uint32_t n)
+{
+    MeshMessage m;
+    m.fromNode = n;
+    m.rssi     = static_cast<int16_t>(-(int)(n % 120));
+    m.valid    = true;
+    snprintf(m.text, sizeof(m.text), "message %08x %08x %08x", n, ~n, n * 2654435761u);
+    return m;
+}
+
+static bool intact(const MeshMessage& m)
+{
+    const MeshMessage want = make(m.fromNode);
+    return m.valid && m.rssi == want.rssi && strcmp(m.text, want.text) == 0;
+}
+
+static void push(McInbox& b, uint32_t from, uint32_t count)
+{
+    for (uint32_t n = from; n < from + count; n++) mc_inboxPush(b, make(n));
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 1. Push / get
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_push_get_round_trip(void)
+{
+    McInbox b;
+    MeshMessage m = make(0);
+    m.isAlert = true;
+    strcpy(m.shortName, "ABCD");
+    m.snr = 6.25f;
+    mc_inboxPush(b, m);
+
+    MeshMessage out;
+    TEST_ASSERT_EQUAL_UINT32(1, mc_inboxHead(b));
+    TEST_ASSERT_TRUE(mc_inboxGet(b, 0, out));
+    TEST_ASSERT_TRUE(intact(out));
+    TEST_ASSERT_TRUE(out.isAlert);
+    TEST_ASSERT_EQUAL_STRING("ABCD", out.shortName);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 6.25f, out.snr);
+}
+
+void test_get_not_yet_pushed(void)
+{
+    McInbox b;
+    MeshMessage out;
+    TEST_ASSERT_FALSE(mc_inboxGet(b, 0, out));
+    push(b, 0, 1);
+    TEST_ASSERT_FALSE(mc_inboxGet(b, 1, out));
+}
+
+void test_wrap_overwrites_oldest(void)
+{
+    McInbox b;
+    push(b, 0, MC_INBOX_DEPTH + 2);
+
+    TEST_ASSERT_EQUAL_UINT32(2, mc_inboxOldest(b));
+    MeshMessage out;
+    TEST_ASSERT_FALSE(mc_inboxGet(b, 0, out));
+    TEST_ASSERT_FALSE(mc_inboxGet(b, 1, out));
+    for (uint32_t n = 2; n < MC_INBOX_DEPTH + 2; n++)
+    {
+        TEST_ASSERT_TRUE(mc_inboxGet(b, n, out));
+        TEST_ASSERT_EQUAL_UINT32(n, out.fromNode);
+        TEST_ASSERT_TRUE(intact(out));
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 2. Unread
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_take_unread_oldest_first(void)
+{
+    McInbox b;
+    push(b, 0, 3);
+    TEST_ASSERT_EQUAL_UINT32(3, mc_inboxUnread(b));
+
+    MeshMessage out;
+    uint32_t    seq = 99;
+    for (uint32_t n = 0; n < 3; n++)
+    {
+        TEST_ASSERT_TRUE(mc_inboxTakeUnread(b, out, seq));
+        TEST_ASSERT_EQUAL_UINT32(n, seq);
+        TEST_ASSERT_EQUAL_UINT32(n, out.fromNode);
+        TEST_ASSERT_EQUAL_UINT32(2 - n, mc_inboxUnread(b));
+    }
+    TEST_ASSERT_FALSE(mc_inboxTakeUnread(b, out, seq));
+    TEST_ASSERT_EQUAL_UINT32(0, mc_inboxOverflows(b));
+}
+
+void test_take_picks_up_later_pushes(void)
+{
+    // The draw task's loop: messages pushed while one is on screen are
+    // taken on the next pass without a new notification.
+    McInbox b;
+    push(b, 0, 1);
+    MeshMessage out;
+    uint32_t    seq;
+    TEST_ASSERT_TRUE(mc_inboxTakeUnread(b, out, seq));
+    push(b, 1, 2);
+    TEST_ASSERT_TRUE(mc_inboxTakeUnread(b, out, seq));
+    TEST_ASSERT_EQUAL_UINT32(1, seq);
+    TEST_ASSERT_TRUE(mc_inboxTakeUnread(b, out, seq));
+    TEST_ASSERT_EQUAL_UINT32(2, seq);
+    TEST_ASSERT_FALSE(mc_inboxTakeUnread(b, out, seq));
+}
+
+void test_mark_read_to_skips_without_overflow(void)
+{
+    McInbox b;
+    push(b, 0, 3);
+    mc_inboxMarkReadTo(b, 2);
+    TEST_ASSERT_EQUAL_UINT32(1, mc_inboxUnread(b));
+    TEST_ASSERT_EQUAL_UINT32(2, mc_inboxFirstUnread(b));
+    TEST_ASSERT_EQUAL_UINT32(0, mc_inboxOverflows(b));
+
+    // Never past the head, never backwards.
+    mc_inboxMarkReadTo(b, 50);
+    TEST_ASSERT_EQUAL_UINT32(3, b.readMark.load());
+    mc_inboxMarkReadTo(b, 1);
+    TEST_ASSERT_EQUAL_UINT32(3, b.readMark.load());
+
+    push(b, 3, 1);
+    TEST_ASSERT_EQUAL_UINT32(1, mc_inboxUnread(b));
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 3. Overflow
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_burst_keeps_newest_and_counts_lost(void)
+{
+    McInbox b;
+    push(b, 0, MC_INBOX_DEPTH + 3);
+
+    // Visible to the diagnostic report before the display looks.
+    TEST_ASSERT_EQUAL_UINT32(3, mc_inboxOverflows(b));
+    TEST_ASSERT_EQUAL_UINT32(MC_INBOX_DEPTH, mc_inboxUnread(b));
+    TEST_ASSERT_EQUAL_UINT32(3, mc_inboxFirstUnread(b));
+
+    MeshMessage out;
+    uint32_t    seq;
+    for (uint32_t n = 3; n < MC_INBOX_DEPTH + 3; n++)
+    {
+        TEST_ASSERT_TRUE(mc_inboxTakeUnread(b, out, seq));
+        TEST_ASSERT_EQUAL_UINT32(n, seq);
+    }
+    TEST_ASSERT_FALSE(mc_inboxTakeUnread(b, out, seq));
+    TEST_ASSERT_EQUAL_UINT32(3, b.lost.load());
+    TEST_ASSERT_EQUAL_UINT32(3, mc_inboxOverflows(b));
+}
+
+void test_read_messages_overwritten_are_not_lost(void)
+{
+    McInbox b;
+    push(b, 0, MC_INBOX_DEPTH);
+    MeshMessage out;
+    uint32_t    seq;
+    while (mc_inboxTakeUnread(b, out, seq)) {}
+
+    push(b, MC_INBOX_DEPTH, MC_INBOX_DEPTH);
+    TEST_ASSERT_EQUAL_UINT32(0, mc_inboxOverflows(b));
+    TEST_ASSERT_EQUAL_UINT32(MC_INBOX_DEPTH, mc_inboxUnread(b));
+}
+
+void test_mark_read_counts_already_overwritten(void)
+{
+    // Skipping to the head does not hide messages that were already gone.
+    McInbox b;
+    push(b, 0, MC_INBOX_DEPTH + 2);
+    mc_inboxMarkReadTo(b, mc_inboxHead(b));
+    TEST_ASSERT_EQUAL_UINT32(2, mc_inboxOverflows(b));
+    TEST_ASSERT_EQUAL_UINT32(0, mc_inboxUnread(b));
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 4. Paging
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_page_back_through_read_messages(void)
+{
+    McInbox b;
+    push(b, 0, MC_INBOX_DEPTH + 1);
+    MeshMessage out;
+    uint32_t    seq;
+    while (mc_inboxTakeUnread(b, out, seq)) {}
+
+    // Newest to oldest, as a "previous" button would walk.
+    uint32_t pages = 0;
+    for (uint32_t n = mc_inboxHead(b); n-- > mc_inboxOldest(b);)
+    {
+        TEST_ASSERT_TRUE(mc_inboxGet(b, n, out));
+        TEST_ASSERT_EQUAL_UINT32(n, out.fromNode);
+        pages++;
+    }
+    TEST_ASSERT_EQUAL_UINT32(MC_INBOX_DEPTH, pages);
+    TEST_ASSERT_EQUAL_UINT32(0, mc_inboxUnread(b));
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 5. Races
+// ─────────────────────────────────────────────────────────────────────────
+
+/// Producer pushes @p total messages while the consumer takes them.  A
+/// paced producer waits while the inbox is full of unread messages, so
+/// nothing should be lost; a free-running one overwrites freely.
+static uint32_t race(uint32_t total, bool paced)
+{
+    McInbox b;
+    std::atomic<bool> done{false};
+
+    std::thread producer([&] {
+        for (uint32_t n = 0; n < total; n++)
+        {
+            while (paced && mc_inboxUnread(b) >= MC_INBOX_DEPTH)
+                std::this_thread::yield();
+            mc_inboxPush(b, make(n));
+        }
+        done.store(true);
+    });
+
+    uint32_t taken = 0, torn = 0, disorder = 0;
+    uint32_t last  = 0;
+    bool     any   = false;
+    MeshMessage out;
+    uint32_t    seq;
+    for (;;)
+    {
+        const bool finished = done.load();
+        while (mc_inboxTakeUnread(b, out, seq))
+        {
+            if (!intact(out) || out.fromNode != seq) torn++;
+            if (any && seq <= last) disorder++;
+            last = seq;
+            any  = true;
+            taken++;
+        }
+        if (finished) break;
+    }
+    producer.join();
+
+    char msg[80];
+    snprintf(msg, sizeof(msg), "taken %u, lost %u of %u",
+             (unsigned)taken, (unsigned)mc_inboxOverflows(b), (unsigned)total);
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_EQUAL_UINT32(0, torn);
+    TEST_ASSERT_EQUAL_UINT32(0, disorder);
+    TEST_ASSERT_EQUAL_UINT32(total, taken + mc_inboxOverflows(b));
+    TEST_ASSERT_EQUAL_UINT32(total - 1, last);
+    return mc_inboxOverflows(b);
+}
+
+void test_race_paced_producer_loses_nothing(void)
+{
+    TEST_ASSERT_EQUAL_UINT32(0, race(2000, true));
+}
+
+void test_race_free_running_producer_accounts_for_losses(void)
+{
+    race(100000, false);
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// Main
+// ─────────────────────────────────────────────────────────────────────────
+int main(void)
+{
+    UNITY_BEGIN();
+
+    // 1. Push / get
+    RUN_TEST(test_push_get_round_trip);
+    RUN_TEST(test_get_not_yet_pushed);
+    RUN_TEST(test_wrap_overwrites_oldest);
+
+    // 2. Unread
+    RUN_TEST(test_take_unread_oldest_first);
+    RUN_TEST(test_take_picks_up_later_pushes);
+    RUN_TEST(test_mark_read_to_skips_without_overflow);
+
+    // 3. Overflow
+    RUN_TEST(test_burst_keeps_newest_and_counts_lost);
+    RUN_TEST(test_read_messages_overwritten_are_not_lost);
+    RUN_TEST(test_mark_read_counts_already_overwritten);
+
+    // 4. Paging
+    RUN_TEST(test_page_back_through_read_messages);
+
+    // 5. Races
+    RUN_TEST(test_race_paced_producer_loses_nothing);
+    RUN_TEST(test_race_free_running_producer_accounts_for_losses);
+
+    return UNITY_END();
+}
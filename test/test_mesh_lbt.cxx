@@ -0,0 +1,182 @@
+/**
+ * test_mesh_lbt.cxx — Unity tests for the listen-before-talk backoff policy.
+ *
+ * Run with: cmake -B build && cmake --build build && ctest --test-dir build -V
+ *
+ * Test groups
+ * ───────────
+ *   1. Decisions              — clear → send, busy → back off, forced send
+ *   2. Contention window      — exponential growth, cap, utilisation base
+ *   3. Utilisation            — EWMA from CAD results and external samples
+ */
+
+#include "unity.h"
+#include "mesh_lbt.h"
+#include <cstdint>
+
+// ── Unity required entry points ───────────────────────────────────────────
+void setUp(void)    {}
+void tearDown(void) {}
+
+static constexpr uint32_t SLOT_MS = 77;    // LongFast contention slot
+
+// ─────────────────────────────────────────────────────────────────────────
+// 1. Decisions
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_clear_channel_transmits_at_once(void)
+{
+    McLbt l;
+    const McLbtDecision d = mc_lbtOnCad(l, false, SLOT_MS, 12345);
+    TEST_ASSERT_TRUE(d.transmit);
+    TEST_ASSERT_EQUAL_UINT32(0u, d.backoffMs);
+    TEST_ASSERT_EQUAL_UINT32(1u, l.clear);
+    TEST_ASSERT_EQUAL_UINT32(0u, l.backoffs);
+}
+
+void test_busy_channel_backs_off_whole_slots(void)
+{
+    McLbt l;
+    for (uint32_t rnd = 0; rnd < 64; rnd++)
+    {
+        l.attempt = 0;
+        const McLbtDecision d = mc_lbtOnCad(l, true, SLOT_MS, rnd);
+        TEST_ASSERT_FALSE(d.transmit);
+        TEST_ASSERT_EQUAL_UINT32(0u, d.backoffMs % SLOT_MS);
+        TEST_ASSERT_TRUE(d.backoffMs >= SLOT_MS);   // never zero
+    }
+    TEST_ASSERT_EQUAL_UINT32(64u, l.busy);
+    TEST_ASSERT_EQUAL_UINT32(64u, l.backoffs);
+}
+
+void test_backoff_total_accumulates(void)
+{
+    McLbt l;
+    uint32_t sum = 0;
+    sum += mc_lbtOnCad(l, true, SLOT_MS, 3).backoffMs;
+    sum += mc_lbtOnCad(l, true, SLOT_MS, 7).backoffMs;
+    TEST_ASSERT_EQUAL_UINT32(sum, l.backoffMs);
+}
+
+void test_clear_after_busy_resets_attempts(void)
+{
+    McLbt l;
+    mc_lbtOnCad(l, true, SLOT_MS, 0);
+    mc_lbtOnCad(l, true, SLOT_MS, 0);
+    TEST_ASSERT_EQUAL_UINT8(2, l.attempt);
+    TEST_ASSERT_TRUE(mc_lbtOnCad(l, false, SLOT_MS, 0).transmit);
+    TEST_ASSERT_EQUAL_UINT8(0, l.attempt);
+}
+
+void test_persistent_busy_forces_send(void)
+{
+    McLbt l;
+    for (uint8_t i = 1; i < MC_LBT_MAX_ATTEMPTS; i++)
+        TEST_ASSERT_FALSE(mc_lbtOnCad(l, true, SLOT_MS, i).transmit);
+
+    const McLbtDecision d = mc_lbtOnCad(l, true, SLOT_MS, 0);
+    TEST_ASSERT_TRUE(d.transmit);
+    TEST_ASSERT_EQUAL_UINT32(1u, l.forced);
+    TEST_ASSERT_EQUAL_UINT32(MC_LBT_MAX_ATTEMPTS, l.busy);
+    TEST_ASSERT_EQUAL_UINT32(MC_LBT_MAX_ATTEMPTS - 1u, l.backoffs);
+    TEST_ASSERT_EQUAL_UINT8(0, l.attempt);          // next frame starts fresh
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 2. Contention window
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_window_doubles_per_busy_scan(void)
+{
+    McLbt l;
+    TEST_ASSERT_EQUAL_UINT8(MC_LBT_CW_MIN, mc_lbtWindow(l));
+
+    // Pin utilisation at zero so only the attempt count moves the window.
+    for (uint8_t a = 1; a <= 3; a++)
+    {
+        mc_lbtOnCad(l, true, SLOT_MS, 0);
+        l.util = 0;
+        TEST_ASSERT_EQUAL_UINT8(MC_LBT_CW_MIN + a - 1, mc_lbtWindow(l));
+    }
+}
+
+void test_backoff_bounded_by_window(void)
+{
+    // rnd = all ones picks the top of the window: 2^cw slots.
+    McLbt l;
+    const McLbtDecision d = mc_lbtOnCad(l, true, SLOT_MS, 0xFFFFFFFFu);
+    const uint32_t cw = mc_lbtWindow(l);
+    TEST_ASSERT_EQUAL_UINT32((1u << cw) * SLOT_MS, d.backoffMs);
+}
+
+void test_window_capped(void)
+{
+    McLbt l;
+    l.util    = 255;
+    l.attempt = MC_LBT_MAX_ATTEMPTS - 1;
+    TEST_ASSERT_EQUAL_UINT8(MC_LBT_CW_MAX, mc_lbtWindow(l));
+}
+
+void test_busy_channel_starts_wider(void)
+{
+    McLbt idle;
+    McLbt loaded;
+    mc_lbtNoteUtilisation(loaded, 100);
+    for (int i = 0; i < 30; i++) mc_lbtNoteUtilisation(loaded, 100);
+    TEST_ASSERT_TRUE(mc_lbtWindow(loaded) > mc_lbtWindow(idle));
+    TEST_ASSERT_TRUE(mc_lbtWindow(loaded) <= MC_LBT_CW_MIN + 3);
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 3. Utilisation
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_utilisation_tracks_cad_results(void)
+{
+    McLbt l;
+    TEST_ASSERT_EQUAL_UINT8(0, mc_lbtUtilisation(l));
+
+    for (int i = 0; i < 40; i++) { mc_lbtOnCad(l, true, SLOT_MS, 0); l.attempt = 0; }
+    TEST_ASSERT_TRUE(mc_lbtUtilisation(l) >= 90);
+
+    for (int i = 0; i < 40; i++) mc_lbtOnCad(l, false, SLOT_MS, 0);
+    TEST_ASSERT_TRUE(mc_lbtUtilisation(l) <= 10);
+}
+
+void test_external_samples_converge(void)
+{
+    McLbt l;
+    for (int i = 0; i < 60; i++) mc_lbtNoteUtilisation(l, 50);
+    const uint8_t u = mc_lbtUtilisation(l);
+    TEST_ASSERT_TRUE(u >= 45 && u <= 50);
+
+    mc_lbtNoteUtilisation(l, 250);                  // clamped to 100 %
+    TEST_ASSERT_TRUE(mc_lbtUtilisation(l) <= 57);
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// Main
+// ─────────────────────────────────────────────────────────────────────────
+int main(void)
+{
+    UNITY_BEGIN();
+
+    // 1. Decisions
+    RUN_TEST(test_clear_channel_transmits_at_once);
+    RUN_TEST(test_busy_channel_backs_off_whole_slots);
+    RUN_TEST(test_backoff_total_accumulates);
+    RUN_TEST(test_clear_after_busy_resets_attempts);
+    RUN_TEST(test_persistent_busy_forces_send);
+
+    // 2. Contention window
+    RUN_TEST(test_window_doubles_per_busy_scan);
+    RUN_TEST(test_backoff_bounded_by_window);
+    RUN_TEST(test_window_capped);
+    RUN_TEST(test_busy_channel_starts_wider);
+
+    // 3. Utilisation
+    RUN_TEST(test_utilisation_tracks_cad_results);
+    RUN_TEST(test_external_samples_converge);
+
+    return UNITY_END();
+}
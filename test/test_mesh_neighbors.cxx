@@ -0,0 +1,545 @@
+/**
+ * test_mesh_neighbors.cxx — Unity tests for the hash-indexed neighbour table.
+ *
+ * Run with: cmake -B build && cmake --build build && ctest --test-dir build -V
+ *
+ * Built twice: test_mesh_neighbors at the default MC_NEIGHBOR_MAX (64) and
+ * test_mesh_neighbors_256 at MC_NEIGHBOR_MAX=256.
+ *
+ * Test groups
+ * ───────────
+ *   1. Lookup / insert        — find, upsert, created flag, lastSeen stamping
+ *   2. LRU eviction           — oldest lastSeen evicted, refresh, tick wrap
+ *   3. Remove / iteration     — backward-shift deletion, dense mc_neighborAt
+ *   4. Churn                  — randomized upsert/remove over 4 × capacity
+ *                               nodes against a reference model
+ *   5. mc_neighborApply       — hot/cold blocks, change detection, key
+ *                               updates, guard sections, reader round-trips
+ */
+
+#include "unity.h"
+#include "mesh_neighbors.h"
+#include <cstring>
+#include <cstdint>
+#include <map>
+#include <random>
+
+// ── Unity required entry points ───────────────────────────────────────────
+void setUp(void)    {}
+void tearDown(void) {}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 1. Lookup / insert
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_find_in_empty_table_returns_null(void)
+{
+    McNeighborTable t;
+    TEST_ASSERT_EQUAL_INT(-1, mc_neighborFind(t, 0x433B8A21u));
+    TEST_ASSERT_EQUAL_size_t(0u, t.count);
+}
+
+void test_upsert_creates_then_updates(void)
+{
+    McNeighborTable t;
+    bool created = false;
+    const size_t a = mc_neighborUpsert(t, 0x433B8A21u, 100, &created);
+    TEST_ASSERT_TRUE(created);
+    TEST_ASSERT_EQUAL_HEX32(0x433B8A21u, t.hot[a].nodeId);
+    TEST_ASSERT_EQUAL_UINT32(100u, t.hot[a].lastSeen);
+    t.hot[a].flags = MC_NB_USER;
+
+    const size_t b = mc_neighborUpsert(t, 0x433B8A21u, 250, &created);
+    TEST_ASSERT_FALSE(created);
+    TEST_ASSERT_EQUAL_size_t(a, b);
+    TEST_ASSERT_EQUAL_UINT32(250u, t.hot[b].lastSeen);
+    TEST_ASSERT_EQUAL_HEX8(MC_NB_USER, t.hot[b].flags);   // payload kept
+    TEST_ASSERT_EQUAL_INT((int)a, mc_neighborFind(t, 0x433B8A21u));
+    TEST_ASSERT_EQUAL_size_t(1u, t.count);
+}
+
+void test_new_slot_has_no_flags(void)
+{
+    McNeighborTable t;
+    const size_t a = mc_neighborUpsert(t, 1, 1);
+    t.hot[a].flags = MC_NB_KEY | MC_NB_POS;
+    t.hot[a].rssi  = -90;
+    mc_neighborRemove(t, 1);
+    const size_t b = mc_neighborUpsert(t, 2, 2);
+    TEST_ASSERT_EQUAL_HEX8(0, t.hot[b].flags);
+    TEST_ASSERT_EQUAL_INT16(0, t.hot[b].rssi);
+}
+
+void test_fill_to_capacity_no_eviction(void)
+{
+    McNeighborTable t;
+    for (uint32_t i = 0; i < MC_NEIGHBOR_MAX; i++)
+        mc_neighborUpsert(t, 0x10000000u + i, i);
+    TEST_ASSERT_EQUAL_size_t(MC_NEIGHBOR_MAX, t.count);
+    TEST_ASSERT_EQUAL_UINT32(0u, t.evictions);
+    for (uint32_t i = 0; i < MC_NEIGHBOR_MAX; i++)
+    {
+        const int slot = mc_neighborFind(t, 0x10000000u + i);
+        TEST_ASSERT_TRUE(slot >= 0);
+        TEST_ASSERT_EQUAL_UINT32(i, t.hot[slot].lastSeen);
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 2. LRU eviction
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_full_table_evicts_oldest_last_seen(void)
+{
+    McNeighborTable t;
+    // Insert in scrambled time order so storage order ≠ age order.
+    for (uint32_t i = 0; i < MC_NEIGHBOR_MAX; i++)
+        mc_neighborUpsert(t, 1000 + i, 10 + ((i * 7) % MC_NEIGHBOR_MAX));
+    const uint32_t oldest = 1000;             // i = 0 → lastSeen 10
+
+    uint32_t evicted = 0;
+    bool created = false;
+    mc_neighborUpsert(t, 0xCAFE0001u, 5000, &created, &evicted);
+    TEST_ASSERT_TRUE(created);
+    TEST_ASSERT_EQUAL_HEX32(oldest, evicted);
+    TEST_ASSERT_EQUAL_INT(-1, mc_neighborFind(t, oldest));
+    TEST_ASSERT_TRUE(mc_neighborFind(t, 0xCAFE0001u) >= 0);
+    TEST_ASSERT_EQUAL_size_t(MC_NEIGHBOR_MAX, t.count);
+    TEST_ASSERT_EQUAL_UINT32(1u, t.evictions);
+}
+
+void test_refresh_protects_from_eviction(void)
+{
+    McNeighborTable t;
+    for (uint32_t i = 0; i < MC_NEIGHBOR_MAX; i++)
+        mc_neighborUpsert(t, 1 + i, 100 + i);
+    mc_neighborUpsert(t, 1, 900);             // oldest heard from again
+
+    uint32_t evicted = 0;
+    mc_neighborUpsert(t, 0xBEEF, 901, nullptr, &evicted);
+    TEST_ASSERT_EQUAL_UINT32(2u, evicted);    // next oldest goes instead
+    TEST_ASSERT_TRUE(mc_neighborFind(t, 1) >= 0);
+}
+
+void test_eviction_age_survives_tick_wrap(void)
+{
+    McNeighborTable t;
+    // Ticks straddle the 32-bit wrap: 0xFFFFFF00 is older than 0x00000010.
+    const uint32_t base = 0xFFFFFF00u;
+    for (uint32_t i = 0; i < MC_NEIGHBOR_MAX; i++)
+        mc_neighborUpsert(t, 1 + i, base + i * 8);  // last ones wrap past 0
+    uint32_t evicted = 0;
+    mc_neighborUpsert(t, 0xBEEF, base + MC_NEIGHBOR_MAX * 8, nullptr, &evicted);
+    TEST_ASSERT_EQUAL_UINT32(1u, evicted);
+}
+
+void test_upsert_without_eviction_leaves_evicted_id_untouched(void)
+{
+    McNeighborTable t;
+    uint32_t evicted = 0x12345678u;
+    mc_neighborUpsert(t, 7, 1, nullptr, &evicted);
+    TEST_ASSERT_EQUAL_HEX32(0x12345678u, evicted);
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 3. Remove / iteration
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_remove_missing_returns_false(void)
+{
+    McNeighborTable t;
+    mc_neighborUpsert(t, 1, 1);
+    TEST_ASSERT_FALSE(mc_neighborRemove(t, 2));
+    TEST_ASSERT_EQUAL_size_t(1u, t.count);
+}
+
+void test_remove_keeps_colliding_keys_reachable(void)
+{
+    // Sequential ids fill long probe runs; removing from the middle of the
+    // run must not strand later keys (backward-shift deletion).
+    McNeighborTable t;
+    for (uint32_t i = 0; i < MC_NEIGHBOR_MAX; i++)
+        mc_neighborUpsert(t, i, i);
+    for (uint32_t i = 0; i < MC_NEIGHBOR_MAX; i += 2)
+        TEST_ASSERT_TRUE(mc_neighborRemove(t, i));
+    TEST_ASSERT_EQUAL_size_t(MC_NEIGHBOR_MAX / 2, t.count);
+    for (uint32_t i = 0; i < MC_NEIGHBOR_MAX; i++)
+    {
+        const int slot = mc_neighborFind(t, i);
+        if (i % 2) { TEST_ASSERT_TRUE(slot >= 0); TEST_ASSERT_EQUAL_UINT32(i, t.hot[slot].lastSeen); }
+        else       { TEST_ASSERT_EQUAL_INT(-1, slot); }
+    }
+}
+
+void test_slots_stay_dense_after_remove(void)
+{
+    McNeighborTable t;
+    for (uint32_t i = 0; i < 10; i++) mc_neighborUpsert(t, 500 + i, i);
+    mc_neighborRemove(t, 503);
+    uint32_t seen = 0;
+    for (size_t i = 0; i < t.count; i++)
+    {
+        const uint32_t id = t.hot[i].nodeId;
+        TEST_ASSERT_TRUE(id >= 500 && id < 510 && id != 503);
+        TEST_ASSERT_EQUAL_INT((int)i, mc_neighborFind(t, id));
+        seen |= 1u << (id - 500);
+    }
+    TEST_ASSERT_EQUAL_HEX32(0x3F7u, seen);
+}
+
+void test_clear_resets(void)
+{
+    McNeighborTable t;
+    for (uint32_t i = 0; i < MC_NEIGHBOR_MAX + 3; i++) mc_neighborUpsert(t, i + 1, i);
+    TEST_ASSERT_EQUAL_UINT32(3u, t.evictions);
+    mc_neighborClear(t);
+    TEST_ASSERT_EQUAL_size_t(0u, t.count);
+    TEST_ASSERT_EQUAL_UINT32(0u, t.evictions);
+    TEST_ASSERT_EQUAL_INT(-1, mc_neighborFind(t, MC_NEIGHBOR_MAX + 3));
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 4. Churn — randomized operations against a reference model
+// ─────────────────────────────────────────────────────────────────────────
+
+// Model: node id → lastSeen.  LRU victim = greatest (now - lastSeen).
+static uint32_t modelVictim(const std::map<uint32_t, uint32_t>& m, uint32_t now)
+{
+    uint32_t victim = 0, oldestAge = 0;
+    bool first = true;
+    for (const auto& [id, seen] : m)
+    {
+        const uint32_t age = now - seen;
+        if (first || age > oldestAge) { victim = id; oldestAge = age; first = false; }
+    }
+    return victim;
+}
+
+static void runChurn(uint32_t seed, uint32_t idBase, uint32_t idStride, uint32_t startTick)
+{
+    McNeighborTable t;
+    std::map<uint32_t, uint32_t> model;
+    std::mt19937 rng(seed);
+
+    static constexpr size_t NODES = 4 * MC_NEIGHBOR_MAX;   // 256 at default capacity
+    static constexpr int    OPS   = 40000;
+    uint32_t now = startTick;
+
+    for (int op = 0; op < OPS; op++)
+    {
+        now += 1 + (rng() % 3);              // strictly increasing → no LRU ties
+        const uint32_t id = idBase + static_cast<uint32_t>(rng() % NODES) * idStride;
+
+        if (rng() % 8 == 0)
+        {
+            const bool had = model.erase(id) == 1;
+            TEST_ASSERT_EQUAL(had, mc_neighborRemove(t, id));
+        }
+        else
+        {
+            const bool     inModel = model.count(id) == 1;
+            const bool     full    = model.size() == MC_NEIGHBOR_MAX;
+            const uint32_t victim  = (!inModel && full) ? modelVictim(model, now) : 0;
+
+            bool     created = false;
+            uint32_t evicted = 0;
+            const size_t slot = mc_neighborUpsert(t, id, now, &created, &evicted);
+            TEST_ASSERT_TRUE(slot < t.count);
+            TEST_ASSERT_EQUAL(!inModel, created);
+            if (!inModel && full)
+            {
+                TEST_ASSERT_EQUAL_HEX32(victim, evicted);
+                model.erase(victim);
+            }
+            model[id] = now;
+        }
+
+        TEST_ASSERT_EQUAL_size_t(model.size(), t.count);
+        if (op % 997 == 0)
+        {
+            // Full cross-check: every model key findable with the right
+            // stamp, and every stored entry present in the model.
+            for (const auto& [mid, seen] : model)
+            {
+                const int slot = mc_neighborFind(t, mid);
+                TEST_ASSERT_TRUE(slot >= 0);
+                TEST_ASSERT_EQUAL_UINT32(seen, t.hot[slot].lastSeen);
+            }
+            for (size_t i = 0; i < t.count; i++)
+                TEST_ASSERT_EQUAL(1, (int)model.count(t.hot[i].nodeId));
+        }
+    }
+    TEST_ASSERT_TRUE(t.evictions > 0);
+}
+
+void test_churn_random_ids(void)
+{
+    runChurn(1, 0x433B0000u, 0x9E3779B1u, 0);
+}
+
+void test_churn_sequential_ids(void)
+{
+    // Consecutive node ids — the worst case for a naive modulo hash.
+    runChurn(2, 0x10000000u, 1, 1000);
+}
+
+void test_churn_across_tick_wrap(void)
+{
+    runChurn(3, 0xA0000000u, 0x100u, 0xFFFF0000u);
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 5. mc_neighborApply — hot/cold blocks and guarded sections
+// ─────────────────────────────────────────────────────────────────────────
+
+struct GuardLog { int depth = 0; int maxDepth = 0; int enters = 0; int exits = 0; };
+
+static McNeighborGuard countingGuard(GuardLog& log)
+{
+    return {
+        [](void* c) { auto* l = static_cast<GuardLog*>(c); l->enters++;
+                      if (++l->depth > l->maxDepth) l->maxDepth = l->depth; },
+        [](void* c) { auto* l = static_cast<GuardLog*>(c); l->exits++; l->depth--; },
+        &log,
+    };
+}
+
+static MeshUser makeUser(const char* shortName, uint8_t keyByte)
+{
+    MeshUser u = {};
+    strcpy(u.id, "!433b8a21");
+    strcpy(u.longName, "Tracker One");
+    strcpy(u.shortName, shortName);
+    u.hwModel = 48;
+    u.role    = 5;
+    if (keyByte)
+    {
+        memset(u.publicKey, keyByte, 32);
+        u.hasPublicKey = true;
+    }
+    return u;
+}
+
+void test_apply_hot_only_is_one_small_section(void)
+{
+    McNeighborTable t;
+    GuardLog log;
+    const McNeighborResult r = mc_neighborApply(t, 7, 10, {.rssi = -80, .snr = 6.5f},
+                                                countingGuard(log));
+    TEST_ASSERT_TRUE(r.created);
+    TEST_ASSERT_EQUAL_UINT8(1, r.sections);
+    TEST_ASSERT_EQUAL_size_t(sizeof(McNeighborHot), r.bytesCopied);
+    TEST_ASSERT_EQUAL_INT(1, log.enters);
+    TEST_ASSERT_EQUAL_INT(1, log.exits);
+    TEST_ASSERT_EQUAL_INT16(-80, t.hot[r.slot].rssi);
+    TEST_ASSERT_EQUAL_HEX8(0, t.hot[r.slot].flags);
+}
+
+void test_apply_position_round_trips(void)
+{
+    McNeighborTable t;
+    MeshPosition p = {};
+    p.lat_i = 473977000; p.lon_i = -1223000000; p.alt_m = 42; p.sats = 9;
+    p.speed_cm_s = 150; p.track_x100 = 18000; p.unixTime = 1700000000;
+    const McNeighborResult r = mc_neighborApply(t, 0xA1, 55,
+                                                {.rssi = -101, .snr = -3.25f, .pos = &p});
+    TEST_ASSERT_EQUAL_UINT8(2, r.sections);
+    TEST_ASSERT_EQUAL_size_t(sizeof(McNeighborPos), r.maxSection);
+
+    MeshPosition out = {};
+    TEST_ASSERT_TRUE(mc_neighborPosition(t, r.slot, out));
+    TEST_ASSERT_EQUAL_HEX32(0xA1u, out.fromNode);
+    TEST_ASSERT_EQUAL_INT32(p.lat_i, out.lat_i);
+    TEST_ASSERT_EQUAL_INT32(p.lon_i, out.lon_i);
+    TEST_ASSERT_EQUAL_INT32(42, out.alt_m);
+    TEST_ASSERT_EQUAL_UINT32(9u, out.sats);
+    TEST_ASSERT_EQUAL_UINT32(150u, out.speed_cm_s);
+    TEST_ASSERT_EQUAL_UINT32(18000u, out.track_x100);
+    TEST_ASSERT_EQUAL_UINT32(1700000000u, out.unixTime);
+    TEST_ASSERT_EQUAL_UINT32(55u, out.lastSeen);
+    TEST_ASSERT_EQUAL_INT16(-101, out.rssi);
+    TEST_ASSERT_TRUE(out.valid);
+
+    MeshUser u = {};
+    TEST_ASSERT_FALSE(mc_neighborUser(t, r.slot, u));       // no NodeInfo yet
+    MeshNodeStatus s = {};
+    TEST_ASSERT_FALSE(mc_neighborStatus(t, r.slot, s));
+}
+
+void test_apply_unchanged_user_copies_hot_only(void)
+{
+    McNeighborTable t;
+    const MeshUser u = makeUser("T1", 0x5A);
+    const McNeighborResult first = mc_neighborApply(t, 0xB2, 1, {.user = &u});
+    TEST_ASSERT_EQUAL_size_t(sizeof(McNeighborHot) + sizeof(McNeighborIdentity) + 32,
+                             first.bytesCopied);
+    TEST_ASSERT_FALSE(first.keyChanged);
+
+    const McNeighborResult again = mc_neighborApply(t, 0xB2, 2, {.user = &u});
+    TEST_ASSERT_EQUAL_UINT8(1, again.sections);
+    TEST_ASSERT_EQUAL_size_t(sizeof(McNeighborHot), again.bytesCopied);
+
+    MeshUser out = {};
+    TEST_ASSERT_TRUE(mc_neighborUser(t, again.slot, out));
+    TEST_ASSERT_EQUAL_STRING("!433b8a21", out.id);
+    TEST_ASSERT_EQUAL_STRING("Tracker One", out.longName);
+    TEST_ASSERT_EQUAL_STRING("T1", out.shortName);
+    TEST_ASSERT_EQUAL_UINT32(48u, out.hwModel);
+    TEST_ASSERT_EQUAL_UINT8(5, out.role);
+    TEST_ASSERT_TRUE(out.hasPublicKey);
+    TEST_ASSERT_EQUAL_MEMORY(u.publicKey, out.publicKey, 32);
+}
+
+void test_apply_changed_name_rewrites_identity_only(void)
+{
+    McNeighborTable t;
+    const MeshUser a = makeUser("T1", 0x5A);
+    const MeshUser b = makeUser("T2", 0x5A);
+    mc_neighborApply(t, 0xB2, 1, {.user = &a});
+    const McNeighborResult r = mc_neighborApply(t, 0xB2, 2, {.user = &b});
+    TEST_ASSERT_EQUAL_size_t(sizeof(McNeighborHot) + sizeof(McNeighborIdentity),
+                             r.bytesCopied);
+    TEST_ASSERT_FALSE(r.keyChanged);
+    TEST_ASSERT_EQUAL_STRING("T2", t.user[r.slot].shortName);
+}
+
+void test_apply_key_rotation_and_drop_report_key_changed(void)
+{
+    McNeighborTable t;
+    const MeshUser a = makeUser("T1", 0x11);
+    const MeshUser b = makeUser("T1", 0x22);
+    const MeshUser licensed = makeUser("T1", 0);
+    mc_neighborApply(t, 0xC3, 1, {.user = &a});
+
+    McNeighborResult r = mc_neighborApply(t, 0xC3, 2, {.user = &b});
+    TEST_ASSERT_TRUE(r.keyChanged);
+    TEST_ASSERT_EQUAL_HEX8(0x22, t.key[r.slot][0]);
+
+    r = mc_neighborApply(t, 0xC3, 3, {.user = &licensed});
+    TEST_ASSERT_TRUE(r.keyChanged);
+    TEST_ASSERT_FALSE(t.hot[r.slot].flags & MC_NB_KEY);
+
+    r = mc_neighborApply(t, 0xC3, 4, {.user = &licensed});
+    TEST_ASSERT_FALSE(r.keyChanged);                         // nothing to drop
+}
+
+void test_apply_key_only_keeps_identity(void)
+{
+    McNeighborTable t;
+    const MeshUser u = makeUser("T1", 0);
+    mc_neighborApply(t, 0xD4, 1, {.user = &u});
+
+    uint8_t key[32];
+    memset(key, 0x77, sizeof(key));
+    const McNeighborResult r = mc_neighborApply(t, 0xD4, 2, {.publicKey = key});
+    TEST_ASSERT_FALSE(r.keyChanged);                         // first key, not a rotation
+    TEST_ASSERT_EQUAL_size_t(sizeof(McNeighborHot) + 32, r.bytesCopied);
+
+    MeshUser out = {};
+    TEST_ASSERT_TRUE(mc_neighborUser(t, r.slot, out));
+    TEST_ASSERT_EQUAL_STRING("Tracker One", out.longName);
+    TEST_ASSERT_TRUE(out.hasPublicKey);
+    TEST_ASSERT_EQUAL_MEMORY(key, out.publicKey, 32);
+}
+
+void test_apply_status_round_trips(void)
+{
+    McNeighborTable t;
+    MeshNodeStatus s = {};
+    s.uptimeSec = 3600; s.isRouter = true;
+    const McNeighborResult r = mc_neighborApply(t, 0xE5, 9,
+                                                {.rssi = -70, .snr = 9.0f, .status = &s});
+    TEST_ASSERT_EQUAL_size_t(sizeof(McNeighborHot) + sizeof(McNeighborStatus), r.bytesCopied);
+    MeshNodeStatus out = {};
+    TEST_ASSERT_TRUE(mc_neighborStatus(t, r.slot, out));
+    TEST_ASSERT_EQUAL_HEX32(0xE5u, out.fromNode);
+    TEST_ASSERT_EQUAL_UINT32(3600u, out.uptimeSec);
+    TEST_ASSERT_TRUE(out.isRouter);
+    TEST_ASSERT_FALSE(out.isMqttConnected);
+    TEST_ASSERT_EQUAL_INT16(-70, out.rssi);
+
+    const McNeighborResult same = mc_neighborApply(t, 0xE5, 10, {.status = &s});
+    TEST_ASSERT_EQUAL_UINT8(1, same.sections);
+}
+
+void test_apply_recycled_slot_hides_previous_cold_data(void)
+{
+    McNeighborTable t;
+    const MeshUser u = makeUser("OLD", 0x33);
+    mc_neighborApply(t, 1, 0, {.user = &u});                 // oldest
+    for (uint32_t i = 1; i < MC_NEIGHBOR_MAX; i++)
+        mc_neighborApply(t, 1 + i, i, {});
+
+    MeshPosition p = {};
+    p.lat_i = 1;
+    const McNeighborResult r = mc_neighborApply(t, 0xF00D, 1000, {.pos = &p});
+    TEST_ASSERT_EQUAL_HEX32(1u, r.evictedId);
+
+    MeshUser out = {};
+    TEST_ASSERT_FALSE(mc_neighborUser(t, r.slot, out));      // "OLD" must not leak
+    TEST_ASSERT_TRUE(r.slot < t.count);
+    TEST_ASSERT_EQUAL_HEX8(MC_NB_POS, t.hot[r.slot].flags);
+}
+
+void test_apply_sections_never_nest(void)
+{
+    McNeighborTable t;
+    GuardLog log;
+    const McNeighborGuard g = countingGuard(log);
+    const MeshUser u = makeUser("T1", 0x44);
+    MeshPosition p = {};
+    MeshNodeStatus s = {};
+    s.uptimeSec = 1;
+    const McNeighborResult r = mc_neighborApply(t, 0x99, 1,
+        {.pos = &p, .user = &u, .status = &s}, g);
+    TEST_ASSERT_EQUAL_UINT8(5, r.sections);                  // hot, pos, user, key, status
+    TEST_ASSERT_EQUAL_INT(5, log.enters);
+    TEST_ASSERT_EQUAL_INT(5, log.exits);
+    TEST_ASSERT_EQUAL_INT(1, log.maxDepth);
+    TEST_ASSERT_EQUAL_INT(0, log.depth);
+    TEST_ASSERT_EQUAL_size_t(sizeof(McNeighborIdentity), r.maxSection);
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// Main
+// ─────────────────────────────────────────────────────────────────────────
+int main(void)
+{
+    UNITY_BEGIN();
+
+    // 1. Lookup / insert
+    RUN_TEST(test_find_in_empty_table_returns_null);
+    RUN_TEST(test_upsert_creates_then_updates);
+    RUN_TEST(test_new_slot_has_no_flags);
+    RUN_TEST(test_fill_to_capacity_no_eviction);
+
+    // 2. LRU eviction
+    RUN_TEST(test_full_table_evicts_oldest_last_seen);
+    RUN_TEST(test_refresh_protects_from_eviction);
+    RUN_TEST(test_eviction_age_survives_tick_wrap);
+    RUN_TEST(test_upsert_without_eviction_leaves_evicted_id_untouched);
+
+    // 3. Remove / iteration
+    RUN_TEST(test_remove_missing_returns_false);
+    RUN_TEST(test_remove_keeps_colliding_keys_reachable);
+    RUN_TEST(test_slots_stay_dense_after_remove);
+    RUN_TEST(test_clear_resets);
+
+    // 4. Churn
+    RUN_TEST(test_churn_random_ids);
+    RUN_TEST(test_churn_sequential_ids);
+    RUN_TEST(test_churn_across_tick_wrap);
+
+    // 5. mc_neighborApply
+    RUN_TEST(test_apply_hot_only_is_one_small_section);
+    RUN_TEST(test_apply_position_round_trips);
+    RUN_TEST(test_apply_unchanged_user_copies_hot_only);
+    RUN_TEST(test_apply_changed_name_rewrites_identity_only);
+    RUN_TEST(test_apply_key_rotation_and_drop_report_key_changed);
+    RUN_TEST(test_apply_key_only_keeps_identity);
+    RUN_TEST(test_apply_status_round_trips);
+    RUN_TEST(test_apply_recycled_slot_hides_previous_cold_data);
+    RUN_TEST(test_apply_sections_never_nest);
+
+    return UNITY_END();
+}
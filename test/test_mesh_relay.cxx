@@ -0,0 +1,340 @@
+/**
+ * test_mesh_relay.cxx — Unity tests for the managed-flood rebroadcast queue.
+ *
+ * Run with: cmake -B build && cmake --build build && ctest --test-dir build -V
+ *
+ * Test groups
+ * ───────────
+ *   1. Policy                 — relaying roles, slot time, SNR-weighted delay
+ *   2. Queue                  — header rewrite, cancel, due order, overflow
+ *   3. Multi-node simulation  — line and clique topologies of SimNodes
+ *                               (sim_mesh.h), which run LoRa's own radio
+ *                               core and packet handler; built with mbedtls
+ *                               only (MESH_RELAY_SIM)
+ */
+
+#include "unity.h"
+#include "mesh_dedup.h"
+#include "mesh_relay.h"
+#if MESH_RELAY_SIM
+#include "sim_mesh.h"
+#endif
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// ── Unity required entry points ───────────────────────────────────────────
+void setUp(void)    {}
+void tearDown(void) {}
+
+static constexpr uint32_t SELF     = 0x433B8A21u;
+static constexpr uint32_t BCAST    = 0xFFFFFFFFu;
+static constexpr uint32_t SLOT_MS  = 77;             // LongFast
+
+// OTA frame with hop_start = hop_limit = hops and a fake ciphertext body.
+static std::vector<uint8_t> makeFrame(uint32_t to, uint32_t from, uint32_t id,
+                                      uint8_t hops, size_t bodyLen = 40)
+{
+    std::vector<uint8_t> f(16 + bodyLen);
+    for (int i = 0; i < 4; i++)
+    {
+        f[i]     = static_cast<uint8_t>(to   >> (8 * i));
+        f[4 + i] = static_cast<uint8_t>(from >> (8 * i));
+        f[8 + i] = static_cast<uint8_t>(id   >> (8 * i));
+    }
+    f[12] = static_cast<uint8_t>((hops << 5) | hops);
+    f[13] = 0x08;
+    for (size_t i = 0; i < bodyLen; i++) f[16 + i] = static_cast<uint8_t>(0xA5 ^ (i * 37));
+    return f;
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 1. Policy
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_only_relaying_roles_forward(void)
+{
+    const auto f = makeFrame(BCAST, 0x1111, 1, 3);
+    for (uint8_t role = 0; role <= 10; role++)
+    {
+        const bool expect = role == MC_ROLE_ROUTER || role == MC_ROLE_ROUTER_CLIENT
+                         || role == MC_ROLE_REPEATER;
+        TEST_ASSERT_EQUAL(expect, mc_relayShouldForward(f.data(), f.size(), SELF, role));
+    }
+}
+
+void test_no_forward_without_hops_or_when_ours(void)
+{
+    const auto spent  = makeFrame(BCAST, 0x1111, 1, 0);
+    const auto toUs   = makeFrame(SELF, 0x1111, 1, 3);
+    const auto fromUs = makeFrame(BCAST, SELF, 1, 3);
+    const auto dmOther= makeFrame(0x2222, 0x1111, 1, 3);
+    TEST_ASSERT_FALSE(mc_relayShouldForward(spent.data(), spent.size(), SELF, MC_ROLE_ROUTER));
+    TEST_ASSERT_FALSE(mc_relayShouldForward(toUs.data(), toUs.size(), SELF, MC_ROLE_ROUTER));
+    TEST_ASSERT_FALSE(mc_relayShouldForward(fromUs.data(), fromUs.size(), SELF, MC_ROLE_ROUTER));
+    TEST_ASSERT_TRUE(mc_relayShouldForward(dmOther.data(), dmOther.size(), SELF, MC_ROLE_ROUTER));
+    TEST_ASSERT_FALSE(mc_relayShouldForward(spent.data(), 16, SELF, MC_ROLE_ROUTER));
+}
+
+void test_slot_time_matches_meshtastic_presets(void)
+{
+    TEST_ASSERT_EQUAL_UINT32(77u,  mc_relaySlotTimeMs(11, 250000));   // LongFast
+    TEST_ASSERT_EQUAL_UINT32(286u, mc_relaySlotTimeMs(12, 125000));   // LongSlow
+    TEST_ASSERT_EQUAL_UINT32(42u,  mc_relaySlotTimeMs(10, 250000));   // MediumSlow
+    TEST_ASSERT_EQUAL_UINT32(12u,  mc_relaySlotTimeMs(7,  250000));   // ShortFast
+}
+
+void test_delay_windows_by_role_and_snr(void)
+{
+    uint32_t routerMaxWeak = 0, routerMaxStrong = 0, clientMin = UINT32_MAX;
+    for (uint32_t r = 0; r < 4096; r++)
+    {
+        const uint32_t weak   = mc_relayDelayMs(-20.f, MC_ROLE_ROUTER, SLOT_MS, r);
+        const uint32_t strong = mc_relayDelayMs(10.f, MC_ROLE_REPEATER, SLOT_MS, r);
+        const uint32_t client = mc_relayDelayMs(-20.f, MC_ROLE_ROUTER_CLIENT, SLOT_MS, r);
+        TEST_ASSERT_EQUAL_UINT32(0u, weak % SLOT_MS);
+        if (weak > routerMaxWeak)     routerMaxWeak = weak;
+        if (strong > routerMaxStrong) routerMaxStrong = strong;
+        if (client < clientMin)       clientMin = client;
+    }
+    // Weak signal → CW 3 → 6 slots; strong → CW 8 → 16 slots.
+    TEST_ASSERT_EQUAL_UINT32(5u * SLOT_MS,  routerMaxWeak);
+    TEST_ASSERT_EQUAL_UINT32(15u * SLOT_MS, routerMaxStrong);
+    // ROUTER_CLIENT never beats a dedicated router.
+    TEST_ASSERT_EQUAL_UINT32(2u * MC_RELAY_CW_MAX * SLOT_MS, clientMin);
+    TEST_ASSERT_TRUE(clientMin > routerMaxStrong);
+    // Out-of-range SNR is clamped, not extrapolated.
+    TEST_ASSERT_EQUAL_UINT32(mc_relayDelayMs(-20.f, MC_ROLE_ROUTER, SLOT_MS, 5),
+                             mc_relayDelayMs(-40.f, MC_ROLE_ROUTER, SLOT_MS, 5));
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 2. Queue
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_schedule_rewrites_header_only(void)
+{
+    McRelayQueue q;
+    const auto f = makeFrame(BCAST, 0x1111, 0xCAFE, 3);
+    TEST_ASSERT_TRUE(mc_relaySchedule(q, f.data(), f.size(), SELF, 100));
+
+    uint8_t out[255];
+    TEST_ASSERT_EQUAL_UINT8(0, mc_relayPop(q, 99, out));
+    TEST_ASSERT_EQUAL_UINT8(f.size(), mc_relayPop(q, 100, out));
+
+    TEST_ASSERT_EQUAL_MEMORY(f.data(), out, 12);                    // to, from, id
+    TEST_ASSERT_EQUAL_HEX8(0x62, out[12]);                          // hop_start 3, hop_limit 2
+    TEST_ASSERT_EQUAL_HEX8(f[13], out[13]);                         // channel hash
+    TEST_ASSERT_EQUAL_HEX8(SELF & 0xFF, out[15]);                   // relay_node
+    TEST_ASSERT_EQUAL_MEMORY(f.data() + 16, out + 16, f.size() - 16); // ciphertext untouched
+    TEST_ASSERT_EQUAL_UINT32(1u, q.scheduled);
+    TEST_ASSERT_EQUAL_UINT32(1u, q.sent);
+}
+
+void test_cancel_drops_pending_copy(void)
+{
+    McRelayQueue q;
+    const auto a = makeFrame(BCAST, 0x1111, 1, 3);
+    const auto b = makeFrame(BCAST, 0x1111, 2, 3);
+    mc_relaySchedule(q, a.data(), a.size(), SELF, 50);
+    mc_relaySchedule(q, b.data(), b.size(), SELF, 60);
+
+    TEST_ASSERT_TRUE(mc_relayCancel(q, 0x1111, 1));
+    TEST_ASSERT_FALSE(mc_relayCancel(q, 0x1111, 1));
+    TEST_ASSERT_FALSE(mc_relayCancel(q, 0x2222, 2));
+
+    uint8_t out[255];
+    TEST_ASSERT_EQUAL_UINT8(b.size(), mc_relayPop(q, 1000, out));
+    TEST_ASSERT_EQUAL_HEX8(2, out[8]);
+    TEST_ASSERT_EQUAL_UINT8(0, mc_relayPop(q, 1000, out));
+    TEST_ASSERT_EQUAL_UINT32(1u, q.cancelled);
+}
+
+void test_pop_earliest_due_first_across_wrap(void)
+{
+    McRelayQueue q;
+    const auto a = makeFrame(BCAST, 0x1111, 1, 3);
+    const auto b = makeFrame(BCAST, 0x1111, 2, 3);
+    mc_relaySchedule(q, a.data(), a.size(), SELF, 0x00000010u);     // after the wrap
+    mc_relaySchedule(q, b.data(), b.size(), SELF, 0xFFFFFFF0u);     // before it
+
+    TEST_ASSERT_EQUAL_UINT32(0x10u, mc_relayNextDue(q, 0xFFFFFFE0u));
+    uint8_t out[255];
+    TEST_ASSERT_EQUAL_UINT8(b.size(), mc_relayPop(q, 0x20u, out));
+    TEST_ASSERT_EQUAL_HEX8(2, out[8]);
+    TEST_ASSERT_EQUAL_UINT32(0u, mc_relayNextDue(q, 0x20u));
+    TEST_ASSERT_EQUAL_UINT8(a.size(), mc_relayPop(q, 0x20u, out));
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, mc_relayNextDue(q, 0x20u));
+}
+
+void test_full_queue_drops_and_counts(void)
+{
+    McRelayQueue q;
+    for (uint32_t i = 0; i < MC_RELAY_PENDING; i++)
+    {
+        const auto f = makeFrame(BCAST, 0x1111, 1 + i, 3);
+        TEST_ASSERT_TRUE(mc_relaySchedule(q, f.data(), f.size(), SELF, 10));
+    }
+    const auto extra = makeFrame(BCAST, 0x1111, 999, 3);
+    TEST_ASSERT_FALSE(mc_relaySchedule(q, extra.data(), extra.size(), SELF, 10));
+    TEST_ASSERT_EQUAL_UINT32(1u, q.dropped);
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 3. Multi-node simulation
+// ─────────────────────────────────────────────────────────────────────────
+#if MESH_RELAY_SIM
+
+// SimNodes (sim_mesh.h) run the LoRa task's own radio core and packet
+// handler on simulated radios: dedup, relay scheduling and cancel are the
+// firmware's, as are CAD, airtime and collisions.  20 km apart nodes hear
+// their neighbours only; 1 km apart every node hears every other.
+static constexpr float    KM        = 1000.f;
+static constexpr uint32_t SETTLE_MS = 60000;
+
+static SimNodeConfig simNode(uint32_t id, float x, float y, uint8_t role, uint8_t hops)
+{
+    SimNodeConfig c;
+    c.nodeId   = id;
+    c.x        = x;
+    c.y        = y;
+    c.role     = role;
+    c.hopLimit = hops;
+    return c;
+}
+
+// N0 — N1 — N2 — N3 — N4 — N5 : five hops, @p role in between.
+static void makeLine(SimMesh& m, uint8_t role, uint8_t hops)
+{
+    for (uint32_t i = 0; i < 6; i++)
+        m.add(simNode(0x10000000u + i, i * 20 * KM, 0, role, hops));
+}
+
+static const SimText* findText(const SimNode& n, const char* text)
+{
+    for (const SimText& t : n.inbox())
+        if (strcmp(t.text, text) == 0) return &t;
+    return nullptr;
+}
+
+void test_line_5_hops_crosses_once_per_node(void)
+{
+    SimMesh m;
+    makeLine(m, MC_ROLE_ROUTER, 4);
+    m.node(0).sendText(BCAST, "down the line");
+    const uint32_t ms = m.runUntilQuiet(SETTLE_MS);
+
+    char msg[96];
+    snprintf(msg, sizeof(msg), "line: settled at %u ms", (unsigned)ms);
+    TEST_MESSAGE(msg);
+
+    TEST_ASSERT_EQUAL_UINT(0u, m.node(0).inbox().size());      // own echo only
+    for (size_t i = 1; i < 6; i++)
+    {
+        TEST_ASSERT_EQUAL_UINT(1u, m.node(i).inbox().size());
+        const SimText* t = findText(m.node(i), "down the line");
+        TEST_ASSERT_NOT_NULL(t);
+        TEST_ASSERT_EQUAL_UINT8(i - 1, t->hops);
+    }
+    for (size_t i = 0; i < 5; i++)
+        TEST_ASSERT_EQUAL_UINT32(1u, m.node(i).stats().txPackets);
+    TEST_ASSERT_EQUAL_UINT32(0u, m.node(5).stats().txPackets); // arrived with hop_limit 0
+    for (size_t i = 0; i < 6; i++)
+        TEST_ASSERT_EQUAL_UINT32(0u, m.node(i).stats().relayCancelled); // nobody else covers a line
+}
+
+void test_line_hop_limit_exhausted_before_end(void)
+{
+    SimMesh m;
+    makeLine(m, MC_ROLE_REPEATER, 3);
+    m.node(0).sendText(BCAST, "three hops");
+    m.runUntilQuiet(SETTLE_MS);
+
+    for (size_t i = 1; i < 5; i++) TEST_ASSERT_NOT_NULL(findText(m.node(i), "three hops"));
+    TEST_ASSERT_NULL(findText(m.node(5), "three hops"));
+    TEST_ASSERT_EQUAL_UINT32(0u, m.node(4).stats().txPackets);
+}
+
+void test_line_broken_by_non_relaying_node(void)
+{
+    SimMesh m;
+    for (uint32_t i = 0; i < 6; i++)
+        m.add(simNode(0x10000000u + i, i * 20 * KM, 0,
+                      i == 2 ? 5 /* TRACKER */ : MC_ROLE_ROUTER_CLIENT, 7));
+    m.node(0).sendText(BCAST, "stops at 2");
+    m.runUntilQuiet(SETTLE_MS);
+
+    TEST_ASSERT_NOT_NULL(findText(m.node(2), "stops at 2"));
+    TEST_ASSERT_EQUAL_UINT32(0u, m.node(2).stats().txPackets);
+    TEST_ASSERT_NULL(findText(m.node(3), "stops at 2"));
+}
+
+void test_clique_cancels_redundant_rebroadcasts(void)
+{
+    // Origin plus five routers that all hear each other: the first router
+    // to finish its contention delay covers the routers still waiting.
+    // One whose delay ran out while that relay was in CAD or on the air
+    // has already handed its copy to the TX queue, where it is no longer
+    // cancelled.  Node ids vary per run, and with them each node's random
+    // stream.
+    uint32_t relays = 0, cancels = 0;
+    for (uint32_t seed = 0; seed < 50; seed++)
+    {
+        SimMesh m;
+        for (uint32_t i = 0; i < 6; i++)
+            m.add(simNode(0x7000u + seed * 16 + i, (i % 3) * KM, (i / 3) * KM,
+                          MC_ROLE_ROUTER, 3));
+        m.node(0).sendText(BCAST, "clique");
+        m.runUntilQuiet(SETTLE_MS);
+
+        uint32_t r = 0, c = 0;
+        for (size_t i = 1; i < 6; i++)
+        {
+            TEST_ASSERT_EQUAL_UINT(1u, m.node(i).inbox().size());
+            r += m.node(i).stats().relayed;
+            c += m.node(i).stats().relayCancelled;
+        }
+        TEST_ASSERT_EQUAL_UINT32(5u, r + c);
+        relays += r;
+        cancels += c;
+    }
+
+    char msg[96];
+    snprintf(msg, sizeof(msg), "clique x50: relays=%u cancelled=%u (naive flood: 250 relays)",
+             (unsigned)relays, (unsigned)cancels);
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_TRUE(relays < 200);            // < 4 per packet vs 5 without cancel
+}
+
+#endif // MESH_RELAY_SIM
+
+// ─────────────────────────────────────────────────────────────────────────
+// Main
+// ─────────────────────────────────────────────────────────────────────────
+int main(void)
+{
+    UNITY_BEGIN();
+
+    // 1. Policy
+    RUN_TEST(test_only_relaying_roles_forward);
+    RUN_TEST(test_no_forward_without_hops_or_when_ours);
+    RUN_TEST(test_slot_time_matches_meshtastic_presets);
+    RUN_TEST(test_delay_windows_by_role_and_snr);
+
+    // 2. Queue
+    RUN_TEST(test_schedule_rewrites_header_only);
+    RUN_TEST(test_cancel_drops_pending_copy);
+    RUN_TEST(test_pop_earliest_due_first_across_wrap);
+    RUN_TEST(test_full_queue_drops_and_counts);
+
+#if MESH_RELAY_SIM
+    // 3. Multi-node simulation
+    RUN_TEST(test_line_5_hops_crosses_once_per_node);
+    RUN_TEST(test_line_hop_limit_exhausted_before_end);
+    RUN_TEST(test_line_broken_by_non_relaying_node);
+    RUN_TEST(test_clique_cancels_redundant_rebroadcasts);
+#endif
+
+    return UNITY_END();
+}
@@ -0,0 +1,570 @@
+/**
+ * test_mesh_sim.cxx — Unity tests for multi-node behaviour on simulated radios.
+ *
+ * Run with: cmake -B build && cmake --build build && ctest --test-dir build -V
+ *
+ * Nodes are SimNodes (sim_mesh.h): the LoRa task's radio core (MeshRadio)
+ * and packet handler (MeshApp), driving
+ * SimSx1262 chips through the driver's SX1262 command sequences on one
+ * shared SimAir medium.  Everything runs on a virtual clock, so every scenario is
+ * reproducible.
+ *
+ * Geometry: LongFast, 22 dBm, path-loss exponent 2.7 — nodes 20 km apart
+ * hear each other, 40 km apart do not.  The sim library is built with
+ * MC_NEIGHBOR_MAX=8 so table churn is reachable with a dozen nodes.
+ *
+ * Test groups
+ * ───────────
+ *   1. Link          — range, delivery, SPI round trips per packet,
+ *                      IQ errata fix, TX fault recovery
+ *   2. Multi-hop     — ROUTER line reaches the far end; hop limit bounds it
+ *   3. Collisions    — hidden node, capture effect
+ *   4. LBT           — CAD defers a second sender off a busy channel
+ *   5. Dedup/relay   — a clique delivers once and cancels redundant relays
+ *   6. PKC           — key exchange before a DM; bystanders cannot read it
+ *   7. Churn         — neighbour eviction and reboot force key re-requests
+ *   8. Determinism   — same scenario, same result
+ */
+
+#include "unity.h"
+#include "sim_mesh.h"
+#include "sx1262_defs.h"
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+// ── Unity required entry points ───────────────────────────────────────────
+void setUp(void)    {}
+void tearDown(void) {}
+
+static constexpr uint32_t BROADCAST = 0xFFFFFFFF;
+static constexpr float    KM        = 1000.f;
+static constexpr uint32_t SETTLE_MS = 60000;
+
+static SimNodeConfig node(uint32_t id, float x, float y, uint8_t role = 0, bool lbt = true)
+{
+    SimNodeConfig c;
+    c.nodeId = id;
+    c.x      = x;
+    c.y      = y;
+    c.role   = role;
+    c.lbt    = lbt;
+    return c;
+}
+
+static size_t countText(const SimNode& n, const char* text)
+{
+    size_t k = 0;
+    for (const SimText& t : n.inbox())
+        if (strcmp(t.text, text) == 0) k++;
+    return k;
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 1. Link
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_link_range(void)
+{
+    SimMesh m;
+    m.add(node(0x1001, 0, 0));
+    m.add(node(0x1002, 20 * KM, 0));
+    m.add(node(0x1003, 40 * KM, 0));
+    TEST_ASSERT_TRUE(m.air().canHear(0, 1));
+    TEST_ASSERT_TRUE(m.air().canHear(1, 2));
+    TEST_ASSERT_FALSE(m.air().canHear(0, 2));
+}
+
+void test_link_broadcast_delivered(void)
+{
+    SimMesh m;
+    SimNode& a = m.add(node(0x1001, 0, 0));
+    SimNode& b = m.add(node(0x1002, 20 * KM, 0));
+
+    TEST_ASSERT_TRUE(a.sendText(BROADCAST, "hello"));
+    m.runUntilQuiet(SETTLE_MS);
+
+    TEST_ASSERT_EQUAL_UINT(1, b.inbox().size());
+    const SimText& t = b.inbox()[0];
+    TEST_ASSERT_EQUAL_STRING("hello", t.text);
+    TEST_ASSERT_EQUAL_HEX32(0x1001, t.from);
+    TEST_ASSERT_EQUAL_UINT8(0, t.hops);
+    TEST_ASSERT_FALSE(t.pkc);
+    TEST_ASSERT_EQUAL_UINT32(1, a.stats().txPackets);
+    TEST_ASSERT_EQUAL_UINT32(0, b.stats().crcErrors);
+    TEST_ASSERT_EQUAL_UINT32(1, m.air().deliveries);
+}
+
+void test_link_out_of_range(void)
+{
+    SimMesh m;
+    SimNode& a = m.add(node(0x1001, 0, 0));
+    SimNode& c = m.add(node(0x1003, 40 * KM, 0));
+
+    a.sendText(BROADCAST, "anyone?");
+    m.runUntilQuiet(SETTLE_MS);
+    TEST_ASSERT_EQUAL_UINT(0, c.inbox().size());
+    TEST_ASSERT_EQUAL_UINT32(0, c.stats().rxPackets);
+}
+
+void test_link_receive_round_trips(void)
+{
+    // RX wake-up: one status batch plus one ReadBuffer (user-013), then
+    // RX re-entry: ReadRegister(IQ) | WriteRegister(IQ), SetRx.
+    SimMesh m;
+    SimNode& a = m.add(node(0x1001, 0, 0, 0, /*lbt=*/false));
+    SimNode& b = m.add(node(0x1002, 1 * KM, 0));
+    m.run(10);
+
+    a.sendText(BROADCAST, "spi");
+    const uint32_t before = b.chip().roundTrips;
+    m.runUntilQuiet(SETTLE_MS);
+    TEST_ASSERT_EQUAL_UINT(1, b.inbox().size());
+    TEST_ASSERT_EQUAL_UINT32(4, b.chip().roundTrips - before);
+}
+
+void test_link_rx_clears_inverted_iq(void)
+{
+    // The chip comes out of reset with the inverted-IQ bit set (errata
+    // 15.3); every RX entry clears it.
+    SimMesh m;
+    SimNode& a = m.add(node(0x1001, 0, 0));
+    TEST_ASSERT_TRUE(a.chip().mode() == SimSx1262::Mode::Rx);
+    TEST_ASSERT_EQUAL_HEX8(0x09, a.chip().reg(REG_IQ_CONFIG));
+}
+
+void test_link_tx_fault_recovers(void)
+{
+    // A PA that never keys up: the chip's own SetTx timeout ends the
+    // attempt, the radio is reset and the next frame goes out normally.
+    SimMesh m;
+    SimNode& a = m.add(node(0x1001, 0, 0, 0, /*lbt=*/false));
+    SimNode& b = m.add(node(0x1002, 1 * KM, 0));
+    m.run(10);
+
+    a.chip().setTxFault(true);
+    a.sendText(BROADCAST, "lost");
+    m.run(MeshRadio::TX_DEADLINE_MS + 1000);
+    TEST_ASSERT_EQUAL_UINT32(1, a.stats().txTimeouts);
+    TEST_ASSERT_EQUAL_UINT32(0, a.stats().txPackets);
+    TEST_ASSERT_EQUAL_UINT32(0, m.air().frames);
+
+    a.chip().setTxFault(false);
+    a.sendText(BROADCAST, "found");
+    m.runUntilQuiet(SETTLE_MS);
+    TEST_ASSERT_EQUAL_UINT32(1, a.stats().txPackets);
+    TEST_ASSERT_EQUAL_UINT(1, countText(b, "found"));
+    TEST_ASSERT_EQUAL_UINT(0, countText(b, "lost"));
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 2. Multi-hop
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_line_of_routers_reaches_far_end(void)
+{
+    // 0 ── 1 ── 2 ── 3 ── 4 ── 5, 20 km apart, hop limit 3.
+    SimMesh m;
+    for (uint32_t i = 0; i < 6; i++)
+        m.add(node(0x2000 + i, i * 20 * KM, 0, MC_ROLE_ROUTER));
+
+    m.node(0).sendText(BROADCAST, "down the line");
+    m.runUntilQuiet(SETTLE_MS);
+
+    for (size_t i = 1; i <= 4; i++)
+    {
+        TEST_ASSERT_EQUAL_UINT(1, m.node(i).inbox().size());
+        TEST_ASSERT_EQUAL_UINT8(i - 1, m.node(i).inbox()[0].hops);
+    }
+    // Arrived at node 4 with hop_limit 0: the flood stops there.
+    TEST_ASSERT_EQUAL_UINT(0, m.node(5).inbox().size());
+    TEST_ASSERT_EQUAL_UINT32(0, m.node(4).stats().relayed);
+}
+
+void test_line_of_clients_does_not_relay(void)
+{
+    SimMesh m;
+    for (uint32_t i = 0; i < 3; i++)
+        m.add(node(0x2100 + i, i * 20 * KM, 0));
+
+    m.node(0).sendText(BROADCAST, "clients");
+    m.runUntilQuiet(SETTLE_MS);
+    TEST_ASSERT_EQUAL_UINT(1, m.node(1).inbox().size());
+    TEST_ASSERT_EQUAL_UINT(0, m.node(2).inbox().size());
+    TEST_ASSERT_EQUAL_UINT32(0, m.node(1).stats().relayed);
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 3. Collisions
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_hidden_node_collision(void)
+{
+    // A and C cannot hear each other, so CAD cannot help; B hears both at
+    // the same power and loses the frame it locked onto.
+    SimMesh m;
+    SimNode& a = m.add(node(0x3001, 0, 0));
+    SimNode& b = m.add(node(0x3002, 20 * KM, 0));
+    SimNode& c = m.add(node(0x3003, 40 * KM, 0));
+
+    a.sendText(BROADCAST, "from a");
+    c.sendText(BROADCAST, "from c");
+    m.runUntilQuiet(SETTLE_MS);
+
+    TEST_ASSERT_EQUAL_UINT32(1, a.stats().txPackets);
+    TEST_ASSERT_EQUAL_UINT32(1, c.stats().txPackets);
+    TEST_ASSERT_EQUAL_UINT(0, b.inbox().size());
+    TEST_ASSERT_EQUAL_UINT32(1, b.stats().crcErrors);
+    TEST_ASSERT_EQUAL_UINT32(1, m.air().collisions);
+    TEST_ASSERT_EQUAL_UINT32(1, m.air().missedBusy);
+}
+
+void test_capture_effect(void)
+{
+    // Same collision, but A is 1 km from B and C is 20 km away: A's frame
+    // is far above the capture threshold and survives.
+    SimMesh m;
+    SimNode& a = m.add(node(0x3101, 19 * KM, 0, 0, /*lbt=*/false));
+    SimNode& b = m.add(node(0x3102, 20 * KM, 0));
+    SimNode& c = m.add(node(0x3103, 40 * KM, 0, 0, /*lbt=*/false));
+    m.run(10);
+
+    a.sendText(BROADCAST, "near");
+    c.sendText(BROADCAST, "far");
+    m.runUntilQuiet(SETTLE_MS);
+
+    TEST_ASSERT_EQUAL_UINT(1, b.inbox().size());
+    TEST_ASSERT_EQUAL_STRING("near", b.inbox()[0].text);
+    TEST_ASSERT_EQUAL_UINT32(0, b.stats().crcErrors);
+    TEST_ASSERT_EQUAL_UINT32(0, m.air().collisions);
+}
+
+void test_equal_power_overlap_collides(void)
+{
+    SimMesh m;
+    SimNode& a = m.add(node(0x3201, 0, 0, 0, /*lbt=*/false));
+    SimNode& b = m.add(node(0x3202, 10 * KM, 0));
+    SimNode& c = m.add(node(0x3203, 20 * KM, 0, 0, /*lbt=*/false));
+    m.run(10);
+
+    a.sendText(BROADCAST, "left");
+    c.sendText(BROADCAST, "right");
+    m.runUntilQuiet(SETTLE_MS);
+
+    TEST_ASSERT_EQUAL_UINT(0, b.inbox().size());
+    TEST_ASSERT_EQUAL_UINT32(1, b.stats().crcErrors);
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 4. LBT
+// ─────────────────────────────────────────────────────────────────────────
+
+/// A starts a frame; B queues one a little later.  C is equidistant.
+static void lbtScenario(SimMesh& m, bool lbt)
+{
+    m.add(node(0x4001, 0,      0, 0, lbt));
+    m.add(node(0x4002, 1 * KM, 0, 0, lbt));
+    m.add(node(0x4003, 0.5f * KM, 5 * KM));
+    m.run(10);
+
+    m.node(0).sendText(BROADCAST, "first");
+    m.run(50);
+    m.node(1).sendText(BROADCAST, "second");
+    m.runUntilQuiet(SETTLE_MS);
+}
+
+void test_lbt_defers_while_busy(void)
+{
+    SimMesh m;
+    lbtScenario(m, true);
+
+    const SimNode& b = m.node(1);
+    const SimNode& c = m.node(2);
+    TEST_ASSERT_TRUE(b.lbt().busy >= 1);
+    TEST_ASSERT_TRUE(b.lbt().backoffs >= 1);
+    TEST_ASSERT_EQUAL_UINT(2, c.inbox().size());
+    TEST_ASSERT_EQUAL_UINT32(0, m.air().collisions);
+}
+
+void test_no_lbt_collides(void)
+{
+    SimMesh m;
+    lbtScenario(m, false);
+    TEST_ASSERT_EQUAL_UINT(0, m.node(2).inbox().size());
+    TEST_ASSERT_EQUAL_UINT32(1, m.node(2).stats().crcErrors);
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 5. Dedup / relay cancel
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_clique_delivers_once(void)
+{
+    // Six ROUTERs within 2 km: everyone hears the original, so every relay
+    // is redundant.  Relays still waiting in the relay queue when a
+    // neighbour's goes out are cancelled; ones already handed to the TX
+    // queue are not.  Dedup keeps every inbox at one copy either way.
+    SimMesh m;
+    for (uint32_t i = 0; i < 6; i++)
+        m.add(node(0x5000 + i, (i % 3) * KM, (i / 3) * KM, MC_ROLE_ROUTER));
+
+    m.node(0).sendText(BROADCAST, "clique");
+    m.runUntilQuiet(SETTLE_MS);
+
+    uint32_t relayed = 0, cancelled = 0;
+    for (size_t i = 1; i < 6; i++)
+    {
+        TEST_ASSERT_EQUAL_UINT(1, countText(m.node(i), "clique"));
+        relayed   += m.node(i).stats().relayed;
+        cancelled += m.node(i).stats().relayCancelled;
+    }
+    TEST_ASSERT_EQUAL_UINT32(5, relayed + cancelled);
+    TEST_ASSERT_TRUE(cancelled >= 1);
+    TEST_ASSERT_EQUAL_UINT32(1 + relayed, m.air().frames);
+    // The first echo of our own frame is an own echo, the rest duplicates.
+    TEST_ASSERT_EQUAL_UINT32(relayed - 1, m.node(0).stats().duplicates);
+}
+
+void test_triangle_each_text_once(void)
+{
+    // Every node of a ROUTER triangle broadcasts; each text lands exactly
+    // once everywhere else despite the relays.
+    SimMesh m;
+    m.add(node(0x5101, 0,       0,       MC_ROLE_ROUTER));
+    m.add(node(0x5102, 10 * KM, 0,       MC_ROLE_ROUTER));
+    m.add(node(0x5103, 5 * KM,  8 * KM,  MC_ROLE_ROUTER));
+
+    const char* texts[3] = { "t0", "t1", "t2" };
+    for (size_t i = 0; i < 3; i++)
+    {
+        m.node(i).sendText(BROADCAST, texts[i]);
+        m.run(3000);
+    }
+    m.runUntilQuiet(SETTLE_MS);
+
+    for (size_t i = 0; i < 3; i++)
+        for (size_t j = 0; j < 3; j++)
+            TEST_ASSERT_EQUAL_UINT(i == j ? 0 : 1, countText(m.node(i), texts[j]));
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 6. PKC
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_pkc_dm_after_key_exchange(void)
+{
+    SimMesh m;
+    SimNode& a = m.add(node(0x6001, 0,      0));
+    SimNode& b = m.add(node(0x6002, 2 * KM, 0));
+    SimNode& c = m.add(node(0x6003, 1 * KM, 1 * KM));
+
+    TEST_ASSERT_FALSE(a.hasKeyFor(b.id()));
+    TEST_ASSERT_TRUE(a.sendText(b.id(), "for b only"));
+    m.runUntilQuiet(SETTLE_MS);
+
+    TEST_ASSERT_EQUAL_UINT32(1, a.stats().keyRequests);
+    TEST_ASSERT_TRUE(a.hasKeyFor(b.id()));
+    TEST_ASSERT_TRUE(b.hasKeyFor(a.id()));
+
+    TEST_ASSERT_EQUAL_UINT(1, b.inbox().size());
+    TEST_ASSERT_EQUAL_STRING("for b only", b.inbox()[0].text);
+    TEST_ASSERT_TRUE(b.inbox()[0].pkc);
+    TEST_ASSERT_EQUAL_HEX32(b.id(), b.inbox()[0].to);
+
+    // C heard every frame, NodeInfos included, but not the DM's contents.
+    TEST_ASSERT_EQUAL_UINT(0, c.inbox().size());
+    TEST_ASSERT_TRUE(c.stats().rxPackets >= 3);
+}
+
+void test_pkc_second_dm_needs_no_request(void)
+{
+    SimMesh m;
+    SimNode& a = m.add(node(0x6101, 0,      0));
+    SimNode& b = m.add(node(0x6102, 2 * KM, 0));
+
+    a.sendText(b.id(), "one");
+    m.runUntilQuiet(SETTLE_MS);
+    a.sendText(b.id(), "two");
+    m.runUntilQuiet(SETTLE_MS);
+
+    TEST_ASSERT_EQUAL_UINT32(1, a.stats().keyRequests);
+    TEST_ASSERT_EQUAL_UINT(2, b.inbox().size());
+    TEST_ASSERT_EQUAL_UINT32(1, a.keyCache().misses);   // ECDH once
+    TEST_ASSERT_TRUE(a.keyCache().hits >= 1);
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 7. Churn
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_churn_eviction_forces_key_request(void)
+{
+    // Twelve clients within 1 km; node 0's table holds 8.  Everyone
+    // announces in turn, so the first announcers are evicted by the end.
+    static_assert(MC_NEIGHBOR_MAX == 8, "sim library built with MC_NEIGHBOR_MAX=8");
+    SimMesh m;
+    for (uint32_t i = 0; i < 12; i++)
+        m.add(node(0x7000 + i, (i % 4) * 300.f, (i / 4) * 300.f));
+
+    for (size_t i = 1; i < 12; i++)
+    {
+        m.node(i).sendNodeInfo(BROADCAST, false);
+        m.runUntilQuiet(SETTLE_MS);
+    }
+
+    SimNode& hub = m.node(0);
+    TEST_ASSERT_EQUAL_UINT(MC_NEIGHBOR_MAX, hub.neighbors().count);
+    TEST_ASSERT_EQUAL_UINT32(11 - MC_NEIGHBOR_MAX, hub.neighbors().evictions);
+    TEST_ASSERT_FALSE(hub.hasKeyFor(m.node(1).id()));
+    TEST_ASSERT_TRUE(hub.hasKeyFor(m.node(11).id()));
+
+    // A DM to an evicted node re-requests its key and still arrives.
+    hub.sendText(m.node(1).id(), "still there?");
+    m.runUntilQuiet(SETTLE_MS);
+    TEST_ASSERT_EQUAL_UINT32(1, hub.stats().keyRequests);
+    TEST_ASSERT_EQUAL_UINT(1, countText(m.node(1), "still there?"));
+}
+
+void test_churn_reboot_loses_key(void)
+{
+    SimMesh m;
+    SimNode& a = m.add(node(0x7101, 0,      0));
+    SimNode& b = m.add(node(0x7102, 1 * KM, 0));
+
+    a.sendText(b.id(), "before");
+    m.runUntilQuiet(SETTLE_MS);
+    TEST_ASSERT_EQUAL_UINT(1, countText(b, "before"));
+
+    // B power-cycles and forgets A; A still has B's key and sends directly.
+    // B holds the DM, asks for A's key, and reads it once A answers.
+    b.setOnline(false, m.nowMs());
+    m.run(1000);
+    TEST_ASSERT_FALSE(b.hasKeyFor(a.id()));
+    b.setOnline(true, m.nowMs());
+
+    a.sendText(b.id(), "lost");
+    m.runUntilQuiet(SETTLE_MS);
+    TEST_ASSERT_EQUAL_UINT(1, countText(b, "lost"));
+    TEST_ASSERT_EQUAL_UINT32(1, b.stats().pkcNoKey);
+    TEST_ASSERT_EQUAL_UINT32(1, b.stats().keyRequests);
+    TEST_ASSERT_TRUE(b.hasKeyFor(a.id()));      // learned from A's reply
+
+    a.sendText(b.id(), "after");
+    m.runUntilQuiet(SETTLE_MS);
+    TEST_ASSERT_EQUAL_UINT(1, countText(b, "after"));
+}
+
+void test_churn_offline_node_is_deaf(void)
+{
+    SimMesh m;
+    SimNode& a = m.add(node(0x7201, 0,      0));
+    SimNode& b = m.add(node(0x7202, 1 * KM, 0));
+
+    b.setOnline(false, m.nowMs());
+    a.sendText(BROADCAST, "nobody home");
+    m.runUntilQuiet(SETTLE_MS);
+    TEST_ASSERT_EQUAL_UINT(0, b.inbox().size());
+    TEST_ASSERT_EQUAL_UINT32(0, m.air().deliveries);
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 8. Determinism
+// ─────────────────────────────────────────────────────────────────────────
+
+struct BusyResult {
+    uint32_t frames, deliveries, collisions, endMs;
+    uint32_t txPackets[9];
+};
+
+static BusyResult busyGrid()
+{
+    // 3 × 3 ROUTER grid, everyone broadcasting within half a second:
+    // contention, backoff, relays and collisions all exercised.
+    SimMesh m;
+    for (uint32_t i = 0; i < 9; i++)
+        m.add(node(0x8000 + i, (i % 3) * 8 * KM, (i / 3) * 8 * KM, MC_ROLE_ROUTER));
+    m.run(10);
+    for (size_t i = 0; i < 9; i++)
+    {
+        char text[16];
+        snprintf(text, sizeof(text), "grid %u", (unsigned)i);
+        m.node(i).sendText(BROADCAST, text);
+        m.run(40);      // well inside one frame's airtime
+    }
+    m.runUntilQuiet(10 * SETTLE_MS);
+
+    BusyResult r = {};
+    r.frames     = m.air().frames;
+    r.deliveries = m.air().deliveries;
+    r.collisions = m.air().collisions;
+    r.endMs      = m.nowMs();
+    for (size_t i = 0; i < 9; i++) r.txPackets[i] = m.node(i).stats().txPackets;
+    return r;
+}
+
+void test_same_scenario_same_result(void)
+{
+    const BusyResult a = busyGrid();
+    const BusyResult b = busyGrid();
+
+    char msg[96];
+    snprintf(msg, sizeof(msg), "grid: %u frames, %u deliveries, %u collisions, %u ms",
+             (unsigned)a.frames, (unsigned)a.deliveries, (unsigned)a.collisions,
+             (unsigned)a.endMs);
+    TEST_MESSAGE(msg);
+
+    TEST_ASSERT_TRUE(a.frames >= 9);
+    TEST_ASSERT_EQUAL_UINT32(a.frames,     b.frames);
+    TEST_ASSERT_EQUAL_UINT32(a.deliveries, b.deliveries);
+    TEST_ASSERT_EQUAL_UINT32(a.collisions, b.collisions);
+    TEST_ASSERT_EQUAL_UINT32(a.endMs,      b.endMs);
+    for (size_t i = 0; i < 9; i++)
+        TEST_ASSERT_EQUAL_UINT32(a.txPackets[i], b.txPackets[i]);
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// Main
+// ─────────────────────────────────────────────────────────────────────────
+int main(void)
+{
+    UNITY_BEGIN();
+
+    // 1. Link
+    RUN_TEST(test_link_range);
+    RUN_TEST(test_link_broadcast_delivered);
+    RUN_TEST(test_link_out_of_range);
+    RUN_TEST(test_link_receive_round_trips);
+    RUN_TEST(test_link_rx_clears_inverted_iq);
+    RUN_TEST(test_link_tx_fault_recovers);
+
+    // 2. Multi-hop
+    RUN_TEST(test_line_of_routers_reaches_far_end);
+    RUN_TEST(test_line_of_clients_does_not_relay);
+
+    // 3. Collisions
+    RUN_TEST(test_hidden_node_collision);
+    RUN_TEST(test_capture_effect);
+    RUN_TEST(test_equal_power_overlap_collides);
+
+    // 4. LBT
+    RUN_TEST(test_lbt_defers_while_busy);
+    RUN_TEST(test_no_lbt_collides);
+
+    // 5. Dedup / relay cancel
+    RUN_TEST(test_clique_delivers_once);
+    RUN_TEST(test_triangle_each_text_once);
+
+    // 6. PKC
+    RUN_TEST(test_pkc_dm_after_key_exchange);
+    RUN_TEST(test_pkc_second_dm_needs_no_request);
+
+    // 7. Churn
+    RUN_TEST(test_churn_eviction_forces_key_request);
+    RUN_TEST(test_churn_reboot_loses_key);
+    RUN_TEST(test_churn_offline_node_is_deaf);
+
+    // 8. Determinism
+    RUN_TEST(test_same_scenario_same_result);
+
+    return UNITY_END();
+}
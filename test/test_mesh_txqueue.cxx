@@ -0,0 +1,224 @@
+/**
+ * test_mesh_txqueue.cxx — Unity tests for the prioritized TX frame queue.
+ *
+ * Run with: cmake -B build && cmake --build build && ctest --test-dir build -V
+ *
+ * Test groups
+ * ───────────
+ *   1. Priority mapping       — portnum / destination → McTxPriority
+ *   2. Ordering               — priority order, FIFO within a priority
+ *   3. Capacity               — displacement of lower priorities, refusal
+ *   4. Stats                  — depth, high water, per-priority wait
+ */
+
+#include "unity.h"
+#include "mesh_txqueue.h"
+#include <cstdint>
+#include <cstring>
+
+// ── Unity required entry points ───────────────────────────────────────────
+void setUp(void)    {}
+void tearDown(void) {}
+
+// Push a 20-byte frame whose first byte is @p tag.
+static bool push(McTxQueue& q, uint8_t tag, McTxPriority prio, uint32_t now = 0)
+{
+    uint8_t f[20];
+    memset(f, tag, sizeof(f));
+    return mc_txqPush(q, f, sizeof(f), prio, now);
+}
+
+// Pop and return the tag byte, or 0 if the queue is empty.
+static uint8_t popTag(McTxQueue& q, uint32_t now = 0)
+{
+    uint8_t out[255];
+    return mc_txqPop(q, now, out) ? out[0] : 0;
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 1. Priority mapping
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_priority_for_portnums(void)
+{
+    TEST_ASSERT_TRUE(mc_txPriorityFor(5, true)   == McTxPriority::Routing);     // ROUTING
+    TEST_ASSERT_TRUE(mc_txPriorityFor(70, true)  == McTxPriority::Routing);     // TRACEROUTE
+    TEST_ASSERT_TRUE(mc_txPriorityFor(1, true)   == McTxPriority::Direct);      // text DM
+    TEST_ASSERT_TRUE(mc_txPriorityFor(12, true)  == McTxPriority::Direct);      // KEY_VERIFICATION
+    TEST_ASSERT_TRUE(mc_txPriorityFor(1, false)  == McTxPriority::Text);        // channel text
+    TEST_ASSERT_TRUE(mc_txPriorityFor(4, false)  == McTxPriority::NodeInfo);
+    TEST_ASSERT_TRUE(mc_txPriorityFor(4, true)   == McTxPriority::NodeInfo);    // reply
+    TEST_ASSERT_TRUE(mc_txPriorityFor(3, false)  == McTxPriority::NodeInfo);    // POSITION
+    TEST_ASSERT_TRUE(mc_txPriorityFor(67, false) == McTxPriority::Background);  // TELEMETRY
+    TEST_ASSERT_TRUE(mc_txPriorityFor(73, false) == McTxPriority::Background);  // MAP_REPORT
+    // Relays: portnum unknown (still encrypted)
+    TEST_ASSERT_TRUE(mc_txPriorityFor(0, true)   == McTxPriority::Direct);
+    TEST_ASSERT_TRUE(mc_txPriorityFor(0, false)  == McTxPriority::Text);
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 2. Ordering
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_empty_queue_pops_nothing(void)
+{
+    McTxQueue q;
+    TEST_ASSERT_EQUAL_UINT8(0, popTag(q));
+    TEST_ASSERT_FALSE(mc_txqPush(q, nullptr, 10, McTxPriority::Text, 0));
+    uint8_t big[256] = {};
+    TEST_ASSERT_FALSE(mc_txqPush(q, big, sizeof(big), McTxPriority::Text, 0));
+    TEST_ASSERT_EQUAL_UINT8(0, q.depth);
+}
+
+void test_pops_in_priority_order(void)
+{
+    McTxQueue q;
+    push(q, 'B', McTxPriority::Background);
+    push(q, 'N', McTxPriority::NodeInfo);
+    push(q, 'T', McTxPriority::Text);
+    push(q, 'D', McTxPriority::Direct);
+    push(q, 'R', McTxPriority::Routing);
+
+    TEST_ASSERT_EQUAL_UINT8('R', popTag(q));
+    TEST_ASSERT_EQUAL_UINT8('D', popTag(q));
+    TEST_ASSERT_EQUAL_UINT8('T', popTag(q));
+    TEST_ASSERT_EQUAL_UINT8('N', popTag(q));
+    TEST_ASSERT_EQUAL_UINT8('B', popTag(q));
+    TEST_ASSERT_EQUAL_UINT8(0, popTag(q));
+}
+
+void test_fifo_within_priority(void)
+{
+    McTxQueue q;
+    push(q, 1, McTxPriority::Text);
+    push(q, 2, McTxPriority::Text);
+    push(q, 9, McTxPriority::Routing);
+    push(q, 3, McTxPriority::Text);
+
+    TEST_ASSERT_EQUAL_UINT8(9, popTag(q));
+    TEST_ASSERT_EQUAL_UINT8(1, popTag(q));
+    push(q, 4, McTxPriority::Text);             // reuses a freed slot
+    TEST_ASSERT_EQUAL_UINT8(2, popTag(q));
+    TEST_ASSERT_EQUAL_UINT8(3, popTag(q));
+    TEST_ASSERT_EQUAL_UINT8(4, popTag(q));
+}
+
+void test_frame_copied_intact(void)
+{
+    McTxQueue q;
+    uint8_t f[255];
+    for (size_t i = 0; i < sizeof(f); i++) f[i] = static_cast<uint8_t>(i * 7);
+    TEST_ASSERT_TRUE(mc_txqPush(q, f, sizeof(f), McTxPriority::Direct, 0));
+    memset(f, 0, sizeof(f));                    // caller's buffer is free to reuse
+
+    uint8_t out[255];
+    McTxPriority prio = McTxPriority::Background;
+    TEST_ASSERT_EQUAL_UINT8(255, mc_txqPop(q, 0, out, &prio));
+    TEST_ASSERT_TRUE(prio == McTxPriority::Direct);
+    for (size_t i = 0; i < sizeof(out); i++)
+        TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(i * 7), out[i]);
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 3. Capacity
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_full_queue_displaces_newest_lowest(void)
+{
+    McTxQueue q;
+    for (uint8_t i = 0; i < MC_TXQ_DEPTH - 2; i++) push(q, 10 + i, McTxPriority::Text);
+    push(q, 'b', McTxPriority::Background);
+    push(q, 'c', McTxPriority::Background);     // newest of the lowest priority
+    TEST_ASSERT_EQUAL_UINT8(MC_TXQ_DEPTH, q.depth);
+
+    TEST_ASSERT_TRUE(push(q, 'R', McTxPriority::Routing));
+    TEST_ASSERT_EQUAL_UINT32(1u, q.displaced);
+    TEST_ASSERT_EQUAL_UINT8(MC_TXQ_DEPTH, q.depth);
+
+    TEST_ASSERT_EQUAL_UINT8('R', popTag(q));
+    for (uint8_t i = 0; i < MC_TXQ_DEPTH - 2; i++) TEST_ASSERT_EQUAL_UINT8(10 + i, popTag(q));
+    TEST_ASSERT_EQUAL_UINT8('b', popTag(q));
+    TEST_ASSERT_EQUAL_UINT8(0, popTag(q));
+}
+
+void test_full_queue_refuses_equal_or_lower(void)
+{
+    McTxQueue q;
+    for (uint8_t i = 0; i < MC_TXQ_DEPTH; i++) push(q, 1 + i, McTxPriority::NodeInfo);
+    TEST_ASSERT_FALSE(push(q, 'x', McTxPriority::NodeInfo));
+    TEST_ASSERT_FALSE(push(q, 'y', McTxPriority::Background));
+    TEST_ASSERT_EQUAL_UINT32(2u, q.refused);
+    TEST_ASSERT_EQUAL_UINT32(0u, q.displaced);
+    TEST_ASSERT_EQUAL_UINT8(1, popTag(q));
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 4. Stats
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_depth_and_high_water(void)
+{
+    McTxQueue q;
+    push(q, 1, McTxPriority::Text);
+    push(q, 2, McTxPriority::Text);
+    push(q, 3, McTxPriority::Text);
+    popTag(q);
+    popTag(q);
+    push(q, 4, McTxPriority::Text);
+    TEST_ASSERT_EQUAL_UINT8(2, q.depth);
+    TEST_ASSERT_EQUAL_UINT8(3, q.highWater);
+}
+
+void test_wait_time_per_priority(void)
+{
+    McTxQueue q;
+    push(q, 1, McTxPriority::Background, 100);
+    push(q, 2, McTxPriority::Routing, 150);
+    push(q, 3, McTxPriority::Background, 200);
+
+    popTag(q, 160);                             // Routing waited 10
+    popTag(q, 1100);                            // Background waited 1000
+    popTag(q, 1300);                            // Background waited 1100
+
+    TEST_ASSERT_EQUAL_UINT32(10u,   mc_txqWaitAvg(q, McTxPriority::Routing));
+    TEST_ASSERT_EQUAL_UINT32(1050u, mc_txqWaitAvg(q, McTxPriority::Background));
+    TEST_ASSERT_EQUAL_UINT32(1100u, q.waitMax[static_cast<size_t>(McTxPriority::Background)]);
+    TEST_ASSERT_EQUAL_UINT32(0u,    mc_txqWaitAvg(q, McTxPriority::Text));
+    TEST_ASSERT_EQUAL_UINT32(2u,    q.sent[static_cast<size_t>(McTxPriority::Background)]);
+}
+
+void test_wait_time_across_tick_wrap(void)
+{
+    McTxQueue q;
+    push(q, 1, McTxPriority::Direct, 0xFFFFFFF0u);
+    popTag(q, 0x00000010u);
+    TEST_ASSERT_EQUAL_UINT32(0x20u, mc_txqWaitAvg(q, McTxPriority::Direct));
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// Main
+// ─────────────────────────────────────────────────────────────────────────
+int main(void)
+{
+    UNITY_BEGIN();
+
+    // 1. Priority mapping
+    RUN_TEST(test_priority_for_portnums);
+
+    // 2. Ordering
+    RUN_TEST(test_empty_queue_pops_nothing);
+    RUN_TEST(test_pops_in_priority_order);
+    RUN_TEST(test_fifo_within_priority);
+    RUN_TEST(test_frame_copied_intact);
+
+    // 3. Capacity
+    RUN_TEST(test_full_queue_displaces_newest_lowest);
+    RUN_TEST(test_full_queue_refuses_equal_or_lower);
+
+    // 4. Stats
+    RUN_TEST(test_depth_and_high_water);
+    RUN_TEST(test_wait_time_per_priority);
+    RUN_TEST(test_wait_time_across_tick_wrap);
+
+    return UNITY_END();
+}
@@ -0,0 +1,362 @@
+/**
+ * test_screen_scheduler.cxx — Unity tests for the draw task's screen scheduler.
+ *
+ * Run with: cmake -B build && cmake --build build && ctest --test-dir build -V
+ *
+ * The scheduler is driven the way the draw task drives it: post() on each
+ * DRAW_* bit, then next() until it returns false, answering every pick with
+ * shown() or drained().
+ *
+ * Test groups
+ * ───────────
+ *   1. Picking                — standby once, drained picks fall through
+ *   2. Deadlines              — dwell held against posts, waitMs() timeouts
+ *   3. Preemption             — calls and alerts cut in, the cut screen resumes
+ *   4. Backlog                — dwell shortened, notifications and mesh take turns
+ *   5. Dwell per category     — ANCS category groups
+ *   6. Tick wrap              — deadlines across the 32-bit millisecond wrap
+ */
+
+#include "unity.h"
+#include "screen_scheduler.h"
+#include "ancs.h"
+#include <cstdint>
+
+// ── Unity required entry points ───────────────────────────────────────────
+void setUp(void)    {}
+void tearDown(void) {}
+
+static ScreenDwell dwellTimes()
+{
+    ScreenDwell d;
+    d.callMs     = 15000;
+    d.alertMs    = 12000;
+    d.meshMs     = 10000;
+    d.messageMs  = 15000;
+    d.scheduleMs = 14000;
+    d.infoMs     =  8000;
+    d.backlogMs  =  4000;
+    return d;
+}
+
+/// One next() pick, which must exist.
+static ScreenPick pick(ScreenScheduler& s, uint32_t now)
+{
+    ScreenPick p;
+    TEST_ASSERT_TRUE(s.next(now, p));
+    return p;
+}
+
+/// Pick @p want at @p now and show it for @p dwellMs.
+static void show(ScreenScheduler& s, Screen want, uint32_t now, uint32_t dwellMs)
+{
+    const ScreenPick p = pick(s, now);
+    TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(want), static_cast<uint8_t>(p.screen));
+    TEST_ASSERT_FALSE(p.resume);
+    s.shown(want, now, dwellMs);
+}
+
+static void expectScreen(Screen want, Screen got)
+{
+    TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(want), static_cast<uint8_t>(got));
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 1. Picking
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_standby_drawn_once(void)
+{
+    ScreenScheduler s(dwellTimes());
+    ScreenPick p = pick(s, 0);
+    expectScreen(Screen::Standby, p.screen);
+
+    TEST_ASSERT_FALSE(s.next(10, p));
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, s.waitMs(10));
+}
+
+void test_drained_pick_falls_through(void)
+{
+    ScreenScheduler s(dwellTimes());
+    pick(s, 0);                            // standby
+    s.post(Screen::Notification, 100);
+    s.post(Screen::Mesh, 100);
+
+    // Whichever comes first turns up empty; the other is shown in the
+    // same pass.
+    ScreenPick p = pick(s, 100);
+    const Screen first = p.screen;
+    s.drained(first);
+    p = pick(s, 100);
+    TEST_ASSERT_TRUE(p.screen != first);
+    s.shown(p.screen, 100, 5000);
+    TEST_ASSERT_FALSE(s.next(100, p));
+}
+
+void test_returns_to_standby_when_drained(void)
+{
+    ScreenScheduler s(dwellTimes());
+    pick(s, 0);
+    s.post(Screen::Mesh, 0);
+    show(s, Screen::Mesh, 0, 10000);
+    s.drained(Screen::Mesh);
+
+    ScreenPick p;
+    TEST_ASSERT_FALSE(s.next(9999, p));
+    p = pick(s, 10000);
+    expectScreen(Screen::Standby, p.screen);
+    TEST_ASSERT_FALSE(s.next(10001, p));
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 2. Deadlines
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_dwell_held_until_deadline(void)
+{
+    ScreenScheduler s(dwellTimes());
+    pick(s, 0);
+    s.post(Screen::Notification, 1000);
+    show(s, Screen::Notification, 1000, 8000);
+
+    // Still pending (the source may hold more) but not yet due.
+    ScreenPick p;
+    TEST_ASSERT_FALSE(s.next(5000, p));
+    TEST_ASSERT_EQUAL_UINT32(4000, s.waitMs(5000));
+
+    p = pick(s, 9000);
+    expectScreen(Screen::Notification, p.screen);
+}
+
+void test_wait_zero_with_standby_pending(void)
+{
+    ScreenScheduler s(dwellTimes());
+    TEST_ASSERT_EQUAL_UINT32(0, s.waitMs(0));      // standby not drawn yet
+    pick(s, 0);
+    s.post(Screen::Mesh, 50);
+    TEST_ASSERT_EQUAL_UINT32(0, s.waitMs(50));
+}
+
+void test_finish_ends_call_early(void)
+{
+    ScreenScheduler s(dwellTimes());
+    pick(s, 0);
+    s.post(Screen::Call, 0);
+    show(s, Screen::Call, 0, 15000);
+
+    s.finish(Screen::Call, 3000);
+    TEST_ASSERT_EQUAL_UINT32(0, s.waitMs(3000));
+    ScreenPick p = pick(s, 3000);
+    expectScreen(Screen::Standby, p.screen);
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 3. Preemption
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_call_preempts_and_notification_resumes(void)
+{
+    ScreenScheduler s(dwellTimes());
+    pick(s, 0);
+    s.post(Screen::Notification, 0);
+    show(s, Screen::Notification, 0, 15000);
+    s.drained(Screen::Notification);
+
+    s.post(Screen::Call, 5000);
+    show(s, Screen::Call, 5000, 15000);
+    s.finish(Screen::Call, 8000);
+
+    // 10 s of the notification's dwell were left when the call cut in.
+    ScreenPick p = pick(s, 8000);
+    expectScreen(Screen::Notification, p.screen);
+    TEST_ASSERT_TRUE(p.resume);
+    TEST_ASSERT_EQUAL_UINT32(10000, s.waitMs(8000));
+}
+
+void test_alert_preempts_mesh_but_not_call(void)
+{
+    ScreenScheduler s(dwellTimes());
+    pick(s, 0);
+    s.post(Screen::Mesh, 0);
+    show(s, Screen::Mesh, 0, 10000);
+    s.drained(Screen::Mesh);
+
+    s.post(Screen::Alert, 1000);
+    show(s, Screen::Alert, 1000, 12000);
+    s.drained(Screen::Alert);
+
+    s.post(Screen::Call, 2000);
+    show(s, Screen::Call, 2000, 15000);
+    s.drained(Screen::Call);
+
+    // Another alert during the call waits.
+    s.post(Screen::Alert, 3000);
+    ScreenPick p;
+    TEST_ASSERT_FALSE(s.next(3000, p));
+
+    // After the call the interrupted alert finishes its 11 s, then the
+    // new one is shown.
+    p = pick(s, 17000);
+    expectScreen(Screen::Alert, p.screen);
+    TEST_ASSERT_TRUE(p.resume);
+    TEST_ASSERT_EQUAL_UINT32(11000, s.waitMs(17000));
+    show(s, Screen::Alert, 28000, 12000);
+}
+
+void test_parked_alert_kept_over_text(void)
+{
+    ScreenScheduler s(dwellTimes());
+    pick(s, 0);
+    s.post(Screen::Mesh, 0);
+    show(s, Screen::Mesh, 0, 10000);
+    s.drained(Screen::Mesh);
+    s.post(Screen::Alert, 1000);
+    show(s, Screen::Alert, 1000, 12000);
+    s.drained(Screen::Alert);
+    s.post(Screen::Call, 4000);
+    show(s, Screen::Call, 4000, 15000);
+    s.finish(Screen::Call, 6000);
+
+    // The alert had 9 s left; the mesh text's remainder is dropped.
+    ScreenPick p = pick(s, 6000);
+    expectScreen(Screen::Alert, p.screen);
+    TEST_ASSERT_TRUE(p.resume);
+    TEST_ASSERT_EQUAL_UINT32(9000, s.waitMs(6000));
+
+    p = pick(s, 15000);
+    expectScreen(Screen::Standby, p.screen);
+}
+
+void test_notification_does_not_preempt_mesh(void)
+{
+    ScreenScheduler s(dwellTimes());
+    pick(s, 0);
+    s.post(Screen::Mesh, 0);
+    show(s, Screen::Mesh, 0, 10000);
+    s.drained(Screen::Mesh);
+
+    s.post(Screen::Notification, 1000);
+    ScreenPick p;
+    TEST_ASSERT_FALSE(s.next(1000, p));
+    TEST_ASSERT_TRUE(s.pending(Screen::Notification));
+    expectScreen(Screen::Mesh, s.current());
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 4. Backlog
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_backlog_post_shortens_dwell(void)
+{
+    ScreenScheduler s(dwellTimes());
+    pick(s, 0);
+    s.post(Screen::Mesh, 0);
+    show(s, Screen::Mesh, 0, 10000);
+    s.drained(Screen::Mesh);
+
+    s.post(Screen::Notification, 1000);
+    TEST_ASSERT_EQUAL_UINT32(3000, s.waitMs(1000));
+
+    // Already past the backlog dwell: due at once.
+    s.post(Screen::Notification, 6000);
+    ScreenPick p = pick(s, 6000);
+    expectScreen(Screen::Notification, p.screen);
+}
+
+void test_backlog_dwell_helper(void)
+{
+    ScreenScheduler s(dwellTimes());
+    TEST_ASSERT_EQUAL_UINT32(15000, s.dwell(15000, false));
+    TEST_ASSERT_EQUAL_UINT32(4000,  s.dwell(15000, true));
+    TEST_ASSERT_EQUAL_UINT32(2000,  s.dwell(2000,  true));
+}
+
+void test_notification_and_mesh_take_turns(void)
+{
+    ScreenScheduler s(dwellTimes());
+    pick(s, 0);
+    s.post(Screen::Notification, 0);
+    s.post(Screen::Mesh, 0);
+
+    uint32_t now = 0;
+    Screen   last = Screen::Standby;
+    for (int i = 0; i < 6; i++)
+    {
+        const ScreenPick p = pick(s, now);
+        TEST_ASSERT_TRUE(p.screen != last);
+        s.shown(p.screen, now, 4000);
+        last = p.screen;
+        now += 4000;
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 5. Dwell per category
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_category_dwell(void)
+{
+    ScreenScheduler s(dwellTimes());
+    TEST_ASSERT_EQUAL_UINT32(15000, s.notificationDwell(ANCS::CategoryIDIncomingCall));
+    TEST_ASSERT_EQUAL_UINT32(14000, s.notificationDwell(ANCS::CategoryIDSchedule));
+    TEST_ASSERT_EQUAL_UINT32(8000,  s.notificationDwell(ANCS::CategoryIDEmail));
+    TEST_ASSERT_EQUAL_UINT32(8000,  s.notificationDwell(ANCS::CategoryIDNews));
+    TEST_ASSERT_EQUAL_UINT32(8000,  s.notificationDwell(ANCS::CategoryIDHealthAndFitness));
+    TEST_ASSERT_EQUAL_UINT32(15000, s.notificationDwell(ANCS::CategoryIDSocial));
+    TEST_ASSERT_EQUAL_UINT32(15000, s.notificationDwell(ANCS::CategoryIDMissedCall));
+    TEST_ASSERT_EQUAL_UINT32(15000, s.notificationDwell(0xEE));    // unknown
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 6. Tick wrap
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_deadline_across_wrap(void)
+{
+    ScreenScheduler s(dwellTimes());
+    const uint32_t t0 = UINT32_MAX - 2000;
+    pick(s, t0);
+    s.post(Screen::Mesh, t0);
+    show(s, Screen::Mesh, t0, 10000);
+    s.drained(Screen::Mesh);
+
+    ScreenPick p;
+    TEST_ASSERT_FALSE(s.next(t0 + 5000, p));
+    TEST_ASSERT_EQUAL_UINT32(5000, s.waitMs(t0 + 5000));
+    p = pick(s, t0 + 10000);
+    expectScreen(Screen::Standby, p.screen);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    // 1. Picking
+    RUN_TEST(test_standby_drawn_once);
+    RUN_TEST(test_drained_pick_falls_through);
+    RUN_TEST(test_returns_to_standby_when_drained);
+
+    // 2. Deadlines
+    RUN_TEST(test_dwell_held_until_deadline);
+    RUN_TEST(test_wait_zero_with_standby_pending);
+    RUN_TEST(test_finish_ends_call_early);
+
+    // 3. Preemption
+    RUN_TEST(test_call_preempts_and_notification_resumes);
+    RUN_TEST(test_alert_preempts_mesh_but_not_call);
+    RUN_TEST(test_parked_alert_kept_over_text);
+    RUN_TEST(test_notification_does_not_preempt_mesh);
+
+    // 4. Backlog
+    RUN_TEST(test_backlog_post_shortens_dwell);
+    RUN_TEST(test_backlog_dwell_helper);
+    RUN_TEST(test_notification_and_mesh_take_turns);
+
+    // 5. Dwell per category
+    RUN_TEST(test_category_dwell);
+
+    // 6. Tick wrap
+    RUN_TEST(test_deadline_across_wrap);
+
+    return UNITY_END();
+}
@@ -0,0 +1,342 @@
+/**
+ * test_sx1262_batch.cxx — Unity tests for the batched SX1262 command sequences.
+ *
+ * Run with: cmake -B build && cmake --build build && ctest --test-dir build -V
+ *
+ * A mock SX1262 sits behind SxBus: it answers each command by opcode and
+ * counts transfers (one NSS frame each) and round trips (one transfer()
+ * call each — a BUSY wait plus a blocking SPI hand-off on the target).
+ *
+ * Test groups
+ * ───────────
+ *   1. Status batch          — reply parsing, command order, IRQs cleared
+ *   2. ReadBuffer            — offset, length, full 255-byte frame
+ *   3. Transactions/packet   — one-command-per-call path vs batched path
+ *   4. CAD / TX sequences    — command order, SetTx timeout, DIO1 remap point
+ */
+
+#include "unity.h"
+#include "sx1262_batch.h"
+#include "sx1262_defs.h"
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+// ── Unity required entry points ───────────────────────────────────────────
+void setUp(void)    {}
+void tearDown(void) {}
+
+class MockSx1262 : public SxBus
+{
+public:
+    uint16_t irq        = 0;
+    uint8_t  payloadLen = 0;
+    uint8_t  rxPtr      = 0;
+    uint8_t  rssiPkt    = 0;    ///< −2 × RSSI
+    uint8_t  snrPkt     = 0;    ///< 4 × SNR, two's complement
+    uint8_t  buffer[256] = {};
+
+    unsigned roundTrips = 0;
+    unsigned xfers      = 0;
+    size_t   maxBatch   = 0;
+    std::vector<uint8_t> ops;
+    std::vector<size_t>  remaps;    ///< ops.size() at each dio1Remapped()
+    uint8_t setTx[4] = {};          ///< last SetTx frame
+
+    void transfer(const SxXfer* x, size_t n) override
+    {
+        roundTrips++;
+        if (n > maxBatch) maxBatch = n;
+        for (size_t i = 0; i < n; i++) _frame(x[i]);
+    }
+
+    void dio1Remapped() override { remaps.push_back(ops.size()); }
+
+    void resetCounts()
+    {
+        roundTrips = 0; xfers = 0; maxBatch = 0;
+        ops.clear(); remaps.clear();
+    }
+
+private:
+    void _frame(const SxXfer& x)
+    {
+        xfers++;
+        ops.push_back(x.tx[0]);
+
+        uint8_t reply[3 + 255] = {};
+        switch (x.tx[0])
+        {
+        case CMD_GET_IRQ_STATUS:
+            reply[2] = static_cast<uint8_t>(irq >> 8);
+            reply[3] = static_cast<uint8_t>(irq);
+            break;
+        case CMD_GET_RX_BUF_STATUS:
+            reply[2] = payloadLen;
+            reply[3] = rxPtr;
+            break;
+        case CMD_GET_PKT_STATUS:
+            reply[2] = rssiPkt;
+            reply[3] = snrPkt;
+            break;
+        case CMD_CLEAR_IRQ:
+            irq &= static_cast<uint16_t>(~((x.tx[1] << 8) | x.tx[2]));
+            break;
+        case CMD_READ_BUFFER:
+            for (uint16_t i = 3; i < x.len; i++)
+                reply[i] = buffer[static_cast<uint8_t>(x.tx[1] + i - 3)];
+            break;
+        case CMD_SET_TX:
+            memcpy(setTx, x.tx, x.len < 4 ? x.len : 4);
+            break;
+        default:
+            break;
+        }
+        if (x.rx) memcpy(x.rx, reply, x.len);
+    }
+};
+
+/// A packet of @p len bytes waiting at @p ptr, RX_DONE raised.
+static void deliver(MockSx1262& c, uint8_t ptr, uint8_t len)
+{
+    for (unsigned i = 0; i < len; i++)
+        c.buffer[static_cast<uint8_t>(ptr + i)] = static_cast<uint8_t>(i * 7 + 1);
+    c.irq        = IRQ_RX_DONE;
+    c.payloadLen = len;
+    c.rxPtr      = ptr;
+    c.rssiPkt    = 180;                            // −90 dBm
+    c.snrPkt     = static_cast<uint8_t>(-26);      // −6.5 dB
+}
+
+// The receive path as it was before batching: every command is its own
+// wait-for-BUSY plus blocking transfer.
+static void legacyReceive(SxBus& bus, uint8_t* out)
+{
+    auto one = [&](const uint8_t* tx, uint8_t* rx, uint16_t len) {
+        const SxXfer x = { tx, rx, len };
+        bus.transfer(&x, 1);
+    };
+    uint8_t tx[4], rx[4];
+    tx[0] = CMD_GET_IRQ_STATUS;    tx[1] = tx[2] = tx[3] = 0;  one(tx, rx, 4);
+    const uint16_t irq = static_cast<uint16_t>((rx[2] << 8) | rx[3]);
+    tx[0] = CMD_CLEAR_IRQ;         tx[1] = tx[2] = 0xFF;       one(tx, nullptr, 3);
+    if (!(irq & IRQ_RX_DONE)) return;
+    tx[0] = CMD_GET_RX_BUF_STATUS; tx[1] = tx[2] = tx[3] = 0;  one(tx, rx, 4);
+    const uint8_t len = rx[2], ptr = rx[3];
+    tx[0] = CMD_GET_PKT_STATUS;    tx[1] = tx[2] = tx[3] = 0;  one(tx, rx, 4);
+    uint8_t txb[3 + 255] = { CMD_READ_BUFFER, ptr, 0 };
+    uint8_t rxb[3 + 255] = {};
+    one(txb, rxb, static_cast<uint16_t>(3 + len));
+    memcpy(out, rxb + 3, len);
+}
+
+// The receive path in lora.cxx.
+static void batchedReceive(SxBus& bus, uint8_t* out)
+{
+    const SxStatus st = sx_readStatus(bus);
+    if ((st.irq & IRQ_RX_DONE) && st.payloadLen > 0)
+        sx_readBuffer(bus, st.rxPtr, st.payloadLen, out);
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 1. Status batch
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_status_parses_every_field(void)
+{
+    MockSx1262 c;
+    deliver(c, 0x80, 42);
+    c.irq |= 0x0204;
+
+    const SxStatus st = sx_readStatus(c);
+    TEST_ASSERT_EQUAL_HEX16(0x0206, st.irq);
+    TEST_ASSERT_EQUAL_UINT8(42,   st.payloadLen);
+    TEST_ASSERT_EQUAL_HEX8(0x80,  st.rxPtr);
+    TEST_ASSERT_EQUAL_INT16(-90,  st.rssi);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, -6.5f, st.snr);
+}
+
+void test_status_reads_before_clearing(void)
+{
+    MockSx1262 c;
+    deliver(c, 0, 10);
+
+    const SxStatus st = sx_readStatus(c);
+    TEST_ASSERT_EQUAL_HEX16(IRQ_RX_DONE, st.irq);    // seen…
+    TEST_ASSERT_EQUAL_HEX16(0, c.irq);               // …then cleared
+    TEST_ASSERT_EQUAL_UINT(4, c.ops.size());
+    TEST_ASSERT_EQUAL_HEX8(CMD_GET_IRQ_STATUS, c.ops.front());
+    TEST_ASSERT_EQUAL_HEX8(CMD_CLEAR_IRQ,      c.ops.back());
+}
+
+void test_status_positive_snr(void)
+{
+    MockSx1262 c;
+    c.rssiPkt = 41;     // −20.5 → −20 dBm (integer halving, as before)
+    c.snrPkt  = 37;     // 9.25 dB
+    const SxStatus st = sx_readStatus(c);
+    TEST_ASSERT_EQUAL_INT16(-20, st.rssi);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 9.25f, st.snr);
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 2. ReadBuffer
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_read_buffer_at_offset(void)
+{
+    MockSx1262 c;
+    deliver(c, 0x40, 16);
+    uint8_t out[16] = {};
+    sx_readBuffer(c, 0x40, 16, out);
+    for (unsigned i = 0; i < 16; i++)
+        TEST_ASSERT_EQUAL_UINT8(i * 7 + 1, out[i]);
+    TEST_ASSERT_EQUAL_UINT(1, c.xfers);
+}
+
+void test_read_buffer_full_frame(void)
+{
+    MockSx1262 c;
+    deliver(c, 0, 255);
+    uint8_t out[255] = {};
+    sx_readBuffer(c, 0, 255, out);
+    TEST_ASSERT_EQUAL_UINT8(1,                   out[0]);
+    TEST_ASSERT_EQUAL_UINT8((uint8_t)(254 * 7 + 1), out[254]);
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 3. Transactions per packet
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_paths_receive_the_same_bytes(void)
+{
+    uint8_t a[255] = {}, b[255] = {};
+    MockSx1262 c;
+    deliver(c, 0x10, 60);
+    legacyReceive(c, a);
+    deliver(c, 0x10, 60);
+    batchedReceive(c, b);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(a, b, 60);
+}
+
+void test_rx_packet_round_trips(void)
+{
+    uint8_t out[255];
+    MockSx1262 c;
+
+    deliver(c, 0, 50);
+    legacyReceive(c, out);
+    const unsigned legacyTrips = c.roundTrips, legacyXfers = c.xfers;
+
+    c.resetCounts();
+    deliver(c, 0, 50);
+    batchedReceive(c, out);
+
+    char msg[80];
+    snprintf(msg, sizeof(msg), "RX packet: %u round trips / %u xfers -> %u / %u",
+             legacyTrips, legacyXfers, c.roundTrips, c.xfers);
+    TEST_MESSAGE(msg);
+
+    TEST_ASSERT_EQUAL_UINT(5, legacyTrips);
+    TEST_ASSERT_EQUAL_UINT(2, c.roundTrips);
+    // Every command still needs its own NSS frame.
+    TEST_ASSERT_EQUAL_UINT(legacyXfers, c.xfers);
+}
+
+void test_idle_wakeup_round_trips(void)
+{
+    // Timeout, CAD or TX wakeups read status only.
+    uint8_t out[255];
+    MockSx1262 c;
+    c.irq = 1u << 9;                 // TIMEOUT
+    legacyReceive(c, out);
+    TEST_ASSERT_EQUAL_UINT(2, c.roundTrips);
+
+    c.resetCounts();
+    c.irq = 1u << 9;
+    batchedReceive(c, out);
+    TEST_ASSERT_EQUAL_UINT(1, c.roundTrips);
+}
+
+void test_batches_fit_the_spi_queue(void)
+{
+    uint8_t out[255];
+    MockSx1262 c;
+    deliver(c, 0, 255);
+    batchedReceive(c, out);
+    TEST_ASSERT_TRUE(c.maxBatch <= SX_BATCH_MAX);
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 4. CAD / TX sequences
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_start_tx_sequence(void)
+{
+    MockSx1262 c;
+    const uint8_t frame[40] = { 1, 2, 3 };
+    sx_startTx(c, 906875000, frame, sizeof(frame), 320000);
+
+    const std::vector<uint8_t> want = {
+        CMD_SET_STANDBY, CMD_CLEAR_DEVICE_ERRORS, CMD_SET_RF_FREQ, CMD_SET_PKT_PARAMS,
+        CMD_WRITE_BUFFER, CMD_SET_DIO_IRQ,
+        CMD_CLEAR_IRQ, CMD_SET_TX };
+    TEST_ASSERT_EQUAL_UINT(want.size(), c.ops.size());
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(want.data(), c.ops.data(), want.size());
+    TEST_ASSERT_EQUAL_UINT(3, c.roundTrips);
+    TEST_ASSERT_TRUE(c.maxBatch <= SX_BATCH_MAX);
+
+    // Stale DIO1 wakeups dropped after the remap, before ClearIrq.
+    TEST_ASSERT_EQUAL_UINT(1, c.remaps.size());
+    TEST_ASSERT_EQUAL_UINT(6, c.remaps[0]);
+
+    // 320000 × 15.625 µs = 5 s, MSB first.
+    TEST_ASSERT_EQUAL_HEX8(0x04, c.setTx[1]);
+    TEST_ASSERT_EQUAL_HEX8(0xE2, c.setTx[2]);
+    TEST_ASSERT_EQUAL_HEX8(0x00, c.setTx[3]);
+}
+
+void test_start_cad_sequence(void)
+{
+    MockSx1262 c;
+    sx_startCad(c, 11);
+
+    const std::vector<uint8_t> want = {
+        CMD_SET_STANDBY, CMD_SET_CAD_PARAMS, CMD_SET_DIO_IRQ,
+        CMD_CLEAR_IRQ, CMD_SET_CAD };
+    TEST_ASSERT_EQUAL_UINT(want.size(), c.ops.size());
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(want.data(), c.ops.data(), want.size());
+    TEST_ASSERT_EQUAL_UINT(2, c.roundTrips);
+    TEST_ASSERT_EQUAL_UINT(1, c.remaps.size());
+    TEST_ASSERT_EQUAL_UINT(3, c.remaps[0]);
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// Main
+// ─────────────────────────────────────────────────────────────────────────
+int main(void)
+{
+    UNITY_BEGIN();
+
+    // 1. Status batch
+    RUN_TEST(test_status_parses_every_field);
+    RUN_TEST(test_status_reads_before_clearing);
+    RUN_TEST(test_status_positive_snr);
+
+    // 2. ReadBuffer
+    RUN_TEST(test_read_buffer_at_offset);
+    RUN_TEST(test_read_buffer_full_frame);
+
+    // 3. Transactions per packet
+    RUN_TEST(test_paths_receive_the_same_bytes);
+    RUN_TEST(test_rx_packet_round_trips);
+    RUN_TEST(test_idle_wakeup_round_trips);
+    RUN_TEST(test_batches_fit_the_spi_queue);
+
+    // 4. CAD / TX sequences
+    RUN_TEST(test_start_tx_sequence);
+    RUN_TEST(test_start_cad_sequence);
+
+    return UNITY_END();
+}
@@ -0,0 +1,240 @@
+/**
+ * test_text_layout.cxx — Unity tests for UTF-8 decoding and word wrap.
+ *
+ * Run with: cmake -B build && cmake --build build && ctest --test-dir build -V
+ *
+ * Widths come from the firmware fonts (font_spans.cxx): Font_7x10 is
+ * 7 px a glyph, which keeps the expected line breaks easy to count.
+ *
+ * Test groups
+ * ───────────
+ *   1. Decoding               — ASCII, folding, pictographs, malformed and cut bytes
+ *   2. Wrapping               — spaces, long words, newlines, widths
+ *   3. Truncation             — line limit, ellipsis, decode buffer cut
+ */
+
+#include "unity.h"
+#include "text_layout.h"
+#include <cstdint>
+#include <cstring>
+
+// ── Unity required entry points ───────────────────────────────────────────
+void setUp(void)    {}
+void tearDown(void) {}
+
+static char   g_out[TEXT_MAX_GLYPHS + 1];
+
+static const char* decode(const char* utf8)
+{
+    const size_t n = text_decode(utf8, strlen(utf8), g_out, TEXT_MAX_GLYPHS);
+    g_out[n] = '\0';
+    return g_out;
+}
+
+static TextLayout lay(const char* utf8, uint16_t maxWidth, uint8_t maxLines = TEXT_MAX_LINES)
+{
+    TextLayout t;
+    text_layout(t, utf8, strlen(utf8), Font_7x10, maxWidth, maxLines);
+    return t;
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 1. Decoding
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_ascii_unchanged(void)
+{
+    TEST_ASSERT_EQUAL_STRING("Dinner at 7? ~ok~", decode("Dinner at 7? ~ok~"));
+}
+
+void test_accents_fold_to_base_letter(void)
+{
+    TEST_ASSERT_EQUAL_STRING("Creme brulee a Sao Paulo", decode("Crème brûlée à São Paulo"));
+    TEST_ASSERT_EQUAL_STRING("Lodz, Strasse, AEro", decode("Łódź, Straße, Æro"));
+    // Decomposed: e + COMBINING ACUTE ACCENT
+    TEST_ASSERT_EQUAL_STRING("cafe", decode("cafe\xCC\x81"));
+}
+
+void test_punctuation_folds(void)
+{
+    TEST_ASSERT_EQUAL_STRING("\"Don't\" - wait...", decode("“Don’t” — wait…"));
+    TEST_ASSERT_EQUAL_STRING("5 EUR, 3 GBP", decode("5\xC2\xA0€, 3 £"));
+}
+
+void test_emoji_sequence_is_one_pictograph(void)
+{
+    TEST_ASSERT_EQUAL_STRING("ok *", decode("ok 👍"));
+    TEST_ASSERT_EQUAL_STRING("*!", decode("👍🏽!"));             // skin tone
+    TEST_ASSERT_EQUAL_STRING("*", decode("👨‍👩‍👧"));            // ZWJ family
+    TEST_ASSERT_EQUAL_STRING("* *", decode("❤️ 🇫🇷"));           // VS16; flag
+    TEST_ASSERT_EQUAL_STRING("1", decode("1\xEF\xB8\x8F\xE2\x83\xA3"));  // keycap
+}
+
+void test_unsupported_script_falls_back(void)
+{
+    TEST_ASSERT_EQUAL_STRING("?? ok", decode("日本 ok"));
+}
+
+void test_malformed_bytes_fall_back(void)
+{
+    TEST_ASSERT_EQUAL_STRING("a?b", decode("a\xFF" "b"));
+    TEST_ASSERT_EQUAL_STRING("a?b", decode("a\xC3" "b"));       // lead without continuation
+    TEST_ASSERT_EQUAL_STRING("a?", decode("a\xC0\xAF"));        // overlong '/'
+}
+
+void test_cut_sequence_at_end_dropped(void)
+{
+    // ANCS truncates attributes at a byte count, mid-character.
+    const char msg[] = "caf\xC3";
+    TEST_ASSERT_EQUAL_size_t(3, text_decode(msg, sizeof(msg), g_out, TEXT_MAX_GLYPHS));
+    TEST_ASSERT_EQUAL_size_t(3, text_decode("caf\xE2\x80", 5, g_out, TEXT_MAX_GLYPHS));
+}
+
+void test_controls(void)
+{
+    TEST_ASSERT_EQUAL_STRING("a b\nc", decode("a\tb\r\nc"));
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 2. Wrapping
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_fits_on_one_line(void)
+{
+    const TextLayout& t = lay("Hello", 35);
+    TEST_ASSERT_EQUAL_UINT8(1, t.lines);
+    TEST_ASSERT_EQUAL_STRING("Hello", t.line(0));
+    TEST_ASSERT_EQUAL_UINT8(35, t.width[0]);
+    TEST_ASSERT_FALSE(t.truncated);
+}
+
+void test_wraps_at_last_space(void)
+{
+    // 10 glyphs (70 px) a line.
+    const TextLayout& t = lay("the quick brown fox jumps", 70);
+    TEST_ASSERT_EQUAL_UINT8(3, t.lines);
+    TEST_ASSERT_EQUAL_STRING("the quick", t.line(0));
+    TEST_ASSERT_EQUAL_STRING("brown fox", t.line(1));
+    TEST_ASSERT_EQUAL_STRING("jumps",     t.line(2));
+    TEST_ASSERT_EQUAL_UINT8(63, t.width[0]);
+}
+
+void test_overflow_at_space_and_runs_of_spaces(void)
+{
+    const TextLayout& t = lay("abcdefghij    klm", 70);
+    TEST_ASSERT_EQUAL_UINT8(2, t.lines);
+    TEST_ASSERT_EQUAL_STRING("abcdefghij", t.line(0));
+    TEST_ASSERT_EQUAL_STRING("klm", t.line(1));
+}
+
+void test_long_word_broken(void)
+{
+    const TextLayout& t = lay("supercalifragilistic", 70);
+    TEST_ASSERT_EQUAL_UINT8(2, t.lines);
+    TEST_ASSERT_EQUAL_STRING("supercalif", t.line(0));
+    TEST_ASSERT_EQUAL_STRING("ragilistic", t.line(1));
+}
+
+void test_newline_breaks_and_keeps_indent(void)
+{
+    const TextLayout& t = lay("one\n  two\n\nthree", 160);
+    TEST_ASSERT_EQUAL_UINT8(4, t.lines);
+    TEST_ASSERT_EQUAL_STRING("one",   t.line(0));
+    TEST_ASSERT_EQUAL_STRING("  two", t.line(1));
+    TEST_ASSERT_EQUAL_STRING("",      t.line(2));
+    TEST_ASSERT_EQUAL_STRING("three", t.line(3));
+}
+
+void test_proportional_widths_never_exceed(void)
+{
+    const char* text = "Table for four tonight at the usual place? Let me know what you think";
+    TextLayout t;
+    text_layout(t, text, strlen(text), Font_11x18_Prop, 160, TEXT_MAX_LINES);
+    TEST_ASSERT_TRUE(t.lines >= 3);
+    for (uint8_t i = 0; i < t.lines; i++)
+    {
+        TEST_ASSERT_TRUE(t.width[i] <= 160);
+        TEST_ASSERT_EQUAL_UINT32(t.width[i], font_strWidth(Font_11x18_Prop, t.line(i)));
+    }
+}
+
+void test_empty_text_no_lines(void)
+{
+    const TextLayout& t = lay("", 160);
+    TEST_ASSERT_EQUAL_UINT8(0, t.lines);
+    TEST_ASSERT_FALSE(t.truncated);
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 3. Truncation
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_ellipsis_on_last_line(void)
+{
+    const TextLayout& t = lay("the quick brown fox jumps", 70, 2);
+    TEST_ASSERT_EQUAL_UINT8(2, t.lines);
+    TEST_ASSERT_TRUE(t.truncated);
+    TEST_ASSERT_EQUAL_STRING("the quick", t.line(0));
+    TEST_ASSERT_EQUAL_STRING("brown f...", t.line(1));     // 7 glyphs + "..." = 70 px
+    TEST_ASSERT_EQUAL_UINT8(70, t.width[1]);
+}
+
+void test_ellipsis_drops_trailing_space(void)
+{
+    const TextLayout& t = lay("abcdef ghijk", 70, 1);
+    TEST_ASSERT_EQUAL_STRING("abcdef...", t.line(0));
+}
+
+void test_decode_buffer_cut_is_truncated(void)
+{
+    char big[TEXT_MAX_GLYPHS + 40];
+    memset(big, 'x', sizeof(big) - 1);
+    big[sizeof(big) - 1] = '\0';
+    TextLayout t;
+    text_layout(t, big, sizeof(big), Font_7x10, 7 * 40, TEXT_MAX_LINES);
+    TEST_ASSERT_TRUE(t.truncated);
+    TEST_ASSERT_EQUAL_UINT8((TEXT_MAX_GLYPHS + 39) / 40, t.lines);
+    const char* last = t.line(t.lines - 1);
+    TEST_ASSERT_EQUAL_STRING("...", last + strlen(last) - 3);
+}
+
+void test_stops_at_nul_in_fixed_buffer(void)
+{
+    char title[64] = "Hi";
+    TextLayout t;
+    text_layout(t, title, sizeof(title), Font_7x10, 160, 1);
+    TEST_ASSERT_EQUAL_STRING("Hi", t.line(0));
+    TEST_ASSERT_FALSE(t.truncated);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    // 1. Decoding
+    RUN_TEST(test_ascii_unchanged);
+    RUN_TEST(test_accents_fold_to_base_letter);
+    RUN_TEST(test_punctuation_folds);
+    RUN_TEST(test_emoji_sequence_is_one_pictograph);
+    RUN_TEST(test_unsupported_script_falls_back);
+    RUN_TEST(test_malformed_bytes_fall_back);
+    RUN_TEST(test_cut_sequence_at_end_dropped);
+    RUN_TEST(test_controls);
+
+    // 2. Wrapping
+    RUN_TEST(test_fits_on_one_line);
+    RUN_TEST(test_wraps_at_last_space);
+    RUN_TEST(test_overflow_at_space_and_runs_of_spaces);
+    RUN_TEST(test_long_word_broken);
+    RUN_TEST(test_newline_breaks_and_keeps_indent);
+    RUN_TEST(test_proportional_widths_never_exceed);
+    RUN_TEST(test_empty_text_no_lines);
+
+    // 3. Truncation
+    RUN_TEST(test_ellipsis_on_last_line);
+    RUN_TEST(test_ellipsis_drops_trailing_space);
+    RUN_TEST(test_decode_buffer_cut_is_truncated);
+    RUN_TEST(test_stops_at_nul_in_fixed_buffer);
+
+    return UNITY_END();
+}
@@ -0,0 +1,284 @@
+/**
+ * test_text_scroll.cxx — Unity tests for message scrolling.
+ *
+ * Run with: cmake -B build && cmake --build build && ctest --test-dir build -V
+ *
+ * The window tests scroll a laid-out message through a 160-pixel-wide
+ * frame band the way Display::scrollStep() does — move the band up, draw
+ * only the rows exposed — and check every step against drawing the whole
+ * band afresh at the same offset.
+ *
+ * Test groups
+ * ───────────
+ *   1. Timing                 — idle when it fits, hold, steps, late wakeups, end, wrap
+ *   2. Row drawing            — bands, background, clipping
+ *   3. Scrolling a window     — shift plus exposed rows equals a full redraw
+ */
+
+#include "unity.h"
+#include "text_scroll.h"
+#include <cstdint>
+#include <cstring>
+
+// ── Unity required entry points ───────────────────────────────────────────
+void setUp(void)    {}
+void tearDown(void) {}
+
+static constexpr uint16_t INK    = 0x0000;
+static constexpr uint16_t PAPER  = 0xFFFF;
+static constexpr uint16_t WIDTH  = 160;
+static constexpr uint16_t WINDOW = 30;
+
+static const TextScrollTiming TIMING;   // defaults: what the firmware runs
+
+// ─────────────────────────────────────────────────────────────────────────
+// 1. Timing
+// ─────────────────────────────────────────────────────────────────────────
+
+void test_fits_stays_idle(void)
+{
+    TextScroll s;
+    TextScrollStep step;
+    s.start(WINDOW, WINDOW, 0);
+    TEST_ASSERT_FALSE(s.active());
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, s.waitMs(0));
+    TEST_ASSERT_FALSE(s.step(100000, step));
+}
+
+void test_holds_at_top_then_steps(void)
+{
+    TextScroll s;
+    TextScrollStep step;
+    s.start(90, WINDOW, 1000);
+    TEST_ASSERT_TRUE(s.active());
+    TEST_ASSERT_EQUAL_UINT32(TIMING.holdMs, s.waitMs(1000));
+    TEST_ASSERT_FALSE(s.step(1000 + TIMING.holdMs - 1, step));
+
+    // Hold over, no step due yet; the next one is a step period away.
+    TEST_ASSERT_FALSE(s.step(1000 + TIMING.holdMs, step));
+    TEST_ASSERT_EQUAL_UINT32(TIMING.stepMs, s.waitMs(1000 + TIMING.holdMs));
+
+    TEST_ASSERT_TRUE(s.step(1000 + TIMING.holdMs + TIMING.stepMs, step));
+    TEST_ASSERT_EQUAL_UINT16(TIMING.stepPx, step.offset);
+    TEST_ASSERT_EQUAL_UINT16(TIMING.stepPx, step.delta);
+    TEST_ASSERT_FALSE(step.full);
+    TEST_ASSERT_FALSE(s.step(1000 + TIMING.holdMs + TIMING.stepMs + 1, step));
+}
+
+void test_late_wakeup_jumps_ahead(void)
+{
+    TextScroll s;
+    TextScrollStep step;
+    s.start(200, WINDOW, 0);
+
+    // Woken five steps late: one move of five steps, not five moves.
+    TEST_ASSERT_TRUE(s.step(TIMING.holdMs + 5 * TIMING.stepMs, step));
+    TEST_ASSERT_EQUAL_UINT16(5 * TIMING.stepPx, step.delta);
+    TEST_ASSERT_FALSE(step.full);
+
+    // Late by more than the window: redraw it whole.
+    TEST_ASSERT_TRUE(s.step(TIMING.holdMs + (5 + WINDOW) * TIMING.stepMs, step));
+    TEST_ASSERT_EQUAL_UINT16(WINDOW * TIMING.stepPx, step.delta);
+    TEST_ASSERT_TRUE(step.full);
+}
+
+void test_stops_at_end_then_starts_over(void)
+{
+    TextScroll s;
+    TextScrollStep step;
+    s.start(WINDOW + 10, WINDOW, 0);
+
+    const uint32_t end = TIMING.holdMs + 100 * TIMING.stepMs;   // long past the end
+    TEST_ASSERT_TRUE(s.step(end, step));
+    TEST_ASSERT_EQUAL_UINT16(10, step.offset);
+    TEST_ASSERT_EQUAL_UINT16(10, step.delta);
+    TEST_ASSERT_EQUAL_UINT32(TIMING.endHoldMs, s.waitMs(end));
+    TEST_ASSERT_FALSE(s.step(end + TIMING.endHoldMs - 1, step));
+
+    TEST_ASSERT_TRUE(s.step(end + TIMING.endHoldMs, step));
+    TEST_ASSERT_EQUAL_UINT16(0, step.offset);
+    TEST_ASSERT_TRUE(step.full);
+    TEST_ASSERT_EQUAL_UINT16(0, s.offset());
+    TEST_ASSERT_EQUAL_UINT32(TIMING.holdMs, s.waitMs(end + TIMING.endHoldMs));
+}
+
+void test_clock_wrap(void)
+{
+    TextScroll s;
+    TextScrollStep step;
+    const uint32_t t0 = UINT32_MAX - 100;
+    s.start(90, WINDOW, t0);
+    TEST_ASSERT_FALSE(s.step(t0 + 50, step));
+    TEST_ASSERT_TRUE(s.step(t0 + TIMING.holdMs + TIMING.stepMs, step));   // wrapped
+    TEST_ASSERT_EQUAL_UINT16(TIMING.stepPx, step.offset);
+}
+
+void test_stop_goes_idle(void)
+{
+    TextScroll s;
+    TextScrollStep step;
+    s.start(90, WINDOW, 0);
+    s.stop();
+    TEST_ASSERT_FALSE(s.active());
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, s.waitMs(0));
+    TEST_ASSERT_FALSE(s.step(TIMING.holdMs + TIMING.stepMs, step));
+}
+
+void test_custom_step_size(void)
+{
+    TextScrollTiming t;
+    t.stepPx = 3;
+    TextScroll s(t);
+    TextScrollStep step;
+    s.start(WINDOW + 4, WINDOW, 0);
+    TEST_ASSERT_TRUE(s.step(t.holdMs + t.stepMs, step));
+    TEST_ASSERT_EQUAL_UINT16(3, step.offset);
+    TEST_ASSERT_TRUE(s.step(t.holdMs + 2 * t.stepMs, step));
+    TEST_ASSERT_EQUAL_UINT16(4, step.offset);         // clamped to the end
+    TEST_ASSERT_EQUAL_UINT16(1, step.delta);
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 2. Row drawing
+// ─────────────────────────────────────────────────────────────────────────
+
+static TextLayout lay(const char* utf8)
+{
+    TextLayout t;
+    text_layout(t, utf8, strlen(utf8), Font_11x18_Prop, WIDTH, TEXT_MAX_LINES);
+    return t;
+}
+
+static constexpr uint16_t H = 18;       // Font_11x18_Prop.height
+static uint16_t g_whole[TEXT_MAX_LINES * H * WIDTH];
+static uint16_t g_band[TEXT_MAX_LINES * H * WIDTH];
+
+void test_band_rows_match_glyphs(void)
+{
+    const TextLayout& t = lay("Hi");
+    text_drawRows(t, Font_11x18_Prop, INK, PAPER, 0, H, g_whole, WIDTH, WIDTH);
+
+    uint16_t glyph[12 * H];
+    const uint8_t w = font_advance(Font_11x18_Prop, 'H');
+    font_blit(Font_11x18_Prop, 'H', INK, PAPER, glyph, w);
+    for (uint16_t r = 0; r < H; r++)
+        TEST_ASSERT_EQUAL_MEMORY(glyph + r * w, g_whole + r * WIDTH, w * sizeof(uint16_t));
+}
+
+void test_any_band_matches_whole(void)
+{
+    const TextLayout& t = lay("The quick brown fox jumps over the lazy dog, twice.");
+    const uint16_t rows = static_cast<uint16_t>(t.lines * H);
+    TEST_ASSERT_TRUE(t.lines >= 2);
+    text_drawRows(t, Font_11x18_Prop, INK, PAPER, 0, rows, g_whole, WIDTH, WIDTH);
+
+    const uint16_t bands[][2] = { {0, 1}, {5, 7}, {17, 2}, {10, 30}, {H, H}, {1, static_cast<uint16_t>(rows - 1)} };
+    for (const auto& b : bands)
+    {
+        text_drawRows(t, Font_11x18_Prop, INK, PAPER, b[0], b[1], g_band, WIDTH, WIDTH);
+        TEST_ASSERT_EQUAL_MEMORY(g_whole + b[0] * WIDTH, g_band, b[1] * WIDTH * sizeof(uint16_t));
+    }
+}
+
+void test_background_past_text_and_line(void)
+{
+    const TextLayout& t = lay("i");
+    const uint8_t w = font_advance(Font_11x18_Prop, 'i');
+    text_drawRows(t, Font_11x18_Prop, INK, PAPER, 0, 2 * H, g_whole, WIDTH, WIDTH);
+    for (uint32_t r = 0; r < 2u * H; r++)
+        for (uint32_t x = r < H ? w : 0; x < WIDTH; x++)
+            TEST_ASSERT_EQUAL_HEX16(PAPER, g_whole[r * WIDTH + x]);
+}
+
+void test_stride_and_width_clip(void)
+{
+    // A 20-pixel band inside a wider frame: nothing outside it is touched.
+    const TextLayout& t = lay("WWWW");
+    static uint16_t frame[H * WIDTH];
+    for (uint16_t& px : frame) px = 0x1234;
+    text_drawRows(t, Font_11x18_Prop, INK, PAPER, 0, H, frame + 8, 20, WIDTH);
+
+    const uint32_t fit = font_advance(Font_11x18_Prop, 'W');    // glyphs wholly inside 20 px
+    for (uint32_t r = 0; r < H; r++)
+    {
+        for (uint32_t x = 0; x < WIDTH; x++)
+        {
+            const uint16_t px = frame[r * WIDTH + x];
+            if (x < 8 || x >= 28)                TEST_ASSERT_EQUAL_HEX16(0x1234, px);
+            else if (x >= 8 + (20 / fit) * fit) TEST_ASSERT_EQUAL_HEX16(PAPER, px);
+        }
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// 3. Scrolling a window
+// ─────────────────────────────────────────────────────────────────────────
+
+static uint16_t g_window[WINDOW * WIDTH];
+static uint16_t g_fresh[WINDOW * WIDTH];
+
+/// Display::scrollStep() on a plain buffer.
+static void apply(const TextLayout& t, const TextScrollStep& step)
+{
+    if (step.full) {
+        text_drawRows(t, Font_11x18_Prop, INK, PAPER, step.offset, WINDOW, g_window, WIDTH, WIDTH);
+        return;
+    }
+    const uint16_t kept = WINDOW - step.delta;
+    memmove(g_window, g_window + step.delta * WIDTH, kept * WIDTH * sizeof(uint16_t));
+    text_drawRows(t, Font_11x18_Prop, INK, PAPER, step.offset + kept, step.delta,
+                  g_window + kept * WIDTH, WIDTH, WIDTH);
+}
+
+static void scrollThrough(uint32_t wakeEveryMs)
+{
+    const TextLayout& t = lay("Your 7:40 train is running twelve minutes late; it now leaves "
+                              "from platform 4. Connections at the next stop are held.");
+    TEST_ASSERT_TRUE(t.lines * H > WINDOW);
+
+    TextScroll s;
+    s.start(static_cast<uint16_t>(t.lines * H), WINDOW, 0);
+    text_drawRows(t, Font_11x18_Prop, INK, PAPER, 0, WINDOW, g_window, WIDTH, WIDTH);
+
+    uint32_t steps = 0, restarts = 0;
+    for (uint32_t now = 0; restarts == 0; now += wakeEveryMs)
+    {
+        TextScrollStep step;
+        if (!s.step(now, step)) continue;
+        apply(t, step);
+        text_drawRows(t, Font_11x18_Prop, INK, PAPER, step.offset, WINDOW, g_fresh, WIDTH, WIDTH);
+        TEST_ASSERT_EQUAL_MEMORY(g_fresh, g_window, WINDOW * WIDTH * sizeof(uint16_t));
+        steps++;
+        if (step.full && step.offset == 0) restarts++;
+    }
+    TEST_ASSERT_TRUE(steps > 1);
+}
+
+void test_shift_matches_redraw_every_step(void) { scrollThrough(TIMING.stepMs); }
+void test_shift_matches_redraw_late_wakeups(void) { scrollThrough(7 * TIMING.stepMs + 3); }
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    // 1. Timing
+    RUN_TEST(test_fits_stays_idle);
+    RUN_TEST(test_holds_at_top_then_steps);
+    RUN_TEST(test_late_wakeup_jumps_ahead);
+    RUN_TEST(test_stops_at_end_then_starts_over);
+    RUN_TEST(test_clock_wrap);
+    RUN_TEST(test_stop_goes_idle);
+    RUN_TEST(test_custom_step_size);
+
+    // 2. Row drawing
+    RUN_TEST(test_band_rows_match_glyphs);
+    RUN_TEST(test_any_band_matches_whole);
+    RUN_TEST(test_background_past_text_and_line);
+    RUN_TEST(test_stride_and_width_clip);
+
+    // 3. Scrolling a window
+    RUN_TEST(test_shift_matches_redraw_every_step);
+    RUN_TEST(test_shift_matches_redraw_late_wakeups);
+
+    return UNITY_END();
+}
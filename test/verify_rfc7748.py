@@ -111,6 +111,28 @@ print(f"  Result:   {iter1.hex()}")
 print(f"  Expected: {iter1_expected.hex()}")
 print(f"  {'PASS ✓' if ok else 'FAIL ✗'}")
 
+# ── §5.2 Vector 2 (u with bit 255 set) ──────────────────────────────────
+print()
+print("RFC 7748 §5.2 Test Vector 2")
+scalar_52b = hex_to_bytes("4b66e9d4d1b4673c5ad22691957d6af5c11b6421e0ea01d42ca4169e7918ba0d")
+u_52b      = hex_to_bytes("e5210f12786811d3f4b7959d0538ae2c31dbe7106fc03c3efc4cd549c715a493")
+expect_52b = hex_to_bytes("95cbde9476e8907d7aade45cb4b873f88b595a68799fa152e6f8f7647aac7957")
+result_52b = x25519(scalar_52b, u_52b)
+print(f"  Result:   {result_52b.hex()}")
+print(f"  Expected: {expect_52b.hex()}")
+print(f"  {'PASS ✓' if result_52b == expect_52b else 'FAIL ✗'}")
+
+# ── §5.2 Iterated (1000 iterations) ─────────────────────────────────────
+print()
+print("RFC 7748 §5.2 Iterated (1000 iterations)")
+k, u = nine, nine
+for _ in range(1000):
+    k, u = x25519(k, u), k
+iter1000_expected = hex_to_bytes("684cf59ba83309552800ef566f2f4d3c1c3887c49360e3875f2eb94d99532c51")
+print(f"  Result:   {k.hex()}")
+print(f"  Expected: {iter1000_expected.hex()}")
+print(f"  {'PASS ✓' if k == iter1000_expected else 'FAIL ✗'}")
+
 # ── §6.1 Alice ──────────────────────────────────────────────────────────
 print()
 print("=" * 72)
@@ -161,12 +183,14 @@ print("=" * 72)
 
 # These are various transcriptions of Alice's private key that have appeared
 alice_variants = [
+    "77076d0a7318a57d3c16c17251b26645df4c2f87ebc0992ab177fba51db92c2a",  # RFC 7748 §6.1
     "77076d0a7318a57d3c16c17251b26645df4c543b268ed7a3c4f2bdd164e09f15",
     "77076d0a7318a57d3c16c17251b26645df949d789577965b83f63f2e9fc282e5",
     "77076d0a7318a57d3c16c17251b26645df4949d789577965b83f63f2e9fc2825",
 ]
 
 bob_variants = [
+    "5dab087e624a8a4b79e17f8b83800ee66f3bb1292618b6fd1c2f8b27ff88e0eb",  # RFC 7748 §6.1
     "5dab087e624a8a4b79e17f8b83800ee66f3bb1292618b6fd1c2689c675585eb8",
     "5dab087e624a8a4b79e17f8b83800ee66f3bb1292618b6fd1c268a9c6751daae",
     "5dab087e624a8a4b79e17f8b83800ee66f3bb1292618b6fd1c2689c6751a5768",